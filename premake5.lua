@@ -40,6 +40,21 @@ newoption {
    description = "Build a dedicated server"
 }
 
+newoption {
+   trigger     = "framegraph-check",
+   description = "Build a headless FrameGraph check using the dummy renderer"
+}
+
+newoption {
+   trigger     = "load-benchmark",
+   description = "Build a headless material load time benchmark using the dummy renderer"
+}
+
+newoption {
+   trigger     = "kernel-benchmark",
+   description = "Build a headless benchmark of the animation and audio mixing kernels"
+}
+
 newoption {
    trigger     = "asan",
    description = "Use address sanitizer"
@@ -55,6 +70,11 @@ newoption {
    description = "Create a single exe binary"
 }
 
+newoption {
+   trigger     = "avx2",
+   description = "Require AVX2 on x64, enables 8-wide sf::Float8"
+}
+
 workspace "spear"
 	configurations { "debug", "develop", "release" }
 
@@ -148,6 +168,9 @@ workspace "spear"
 		architecture "x86_64"
 		vectorextensions "SSE4.1"
 
+	filter { "platforms:x64", "options:avx2" }
+		vectorextensions "AVX2"
+
 	filter { "platforms:not wasm",  "system:windows" }
 		libdirs { "dep/lib/windows_%{cfg.platform}" }
 		includedirs { "dep/include/windows_%{cfg.platform}" }
@@ -240,6 +263,21 @@ workspace "spear"
 		targetsuffix "-server"
 		objdir "proj/obj/server/%{cfg.platform}_%{cfg.buildcfg}"
 
+	filter { "options:framegraph-check" }
+		defines { "SP_FRAMEGRAPH_CHECK=1", "SP_NO_APP=1" }
+		targetsuffix "-framegraph-check"
+		objdir "proj/obj/framegraph-check/%{cfg.platform}_%{cfg.buildcfg}"
+
+	filter { "options:load-benchmark" }
+		defines { "SP_LOAD_BENCHMARK=1", "SP_NO_APP=1" }
+		targetsuffix "-load-benchmark"
+		objdir "proj/obj/load-benchmark/%{cfg.platform}_%{cfg.buildcfg}"
+
+	filter { "options:kernel-benchmark" }
+		defines { "SP_KERNEL_BENCHMARK=1", "SP_NO_APP=1" }
+		targetsuffix "-kernel-benchmark"
+		objdir "proj/obj/kernel-benchmark/%{cfg.platform}_%{cfg.buildcfg}"
+
 project "spear"
 	kind "WindowedApp"
 	language "C++"
@@ -257,4 +295,10 @@ project "spear"
 		kind "ConsoleApp"
 	filter { "options:dedicated-server" }
 		kind "ConsoleApp"
+	filter { "options:framegraph-check" }
+		kind "ConsoleApp"
+	filter { "options:load-benchmark" }
+		kind "ConsoleApp"
+	filter { "options:kernel-benchmark" }
+		kind "ConsoleApp"
 
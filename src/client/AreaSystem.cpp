@@ -4,6 +4,7 @@
 #include "sf/HashMap.h"
 #include "sf/Frustum.h"
 #include "sf/Float4.h"
+#include "sf/Float8.h"
 
 #include "sf/ext/mx/mx_platform.h"
 
@@ -18,6 +19,170 @@ static const constexpr uint32_t SpatialMaxDepth = 7;
 static const constexpr uint32_t SpatialMinOptimizeDepth = 5;
 static const sf::Vec3 SpatialGridOrigin = sf::Vec3(0.0f, AreaMinY, 0.0f);
 
+// Four AABBs in SoA layout, tested against a frustum or ray at once
+struct BoundsBlock4
+{
+	float originX[4], originY[4], originZ[4];
+	float extentX[4], extentY[4], extentZ[4];
+
+	void set(uint32_t lane, const sf::Bounds3 &bounds)
+	{
+		originX[lane] = bounds.origin.x;
+		originY[lane] = bounds.origin.y;
+		originZ[lane] = bounds.origin.z;
+		extentX[lane] = bounds.extent.x;
+		extentY[lane] = bounds.extent.y;
+		extentZ[lane] = bounds.extent.z;
+	}
+
+	void setMinMax(uint32_t lane, const sf::Vec3 &min, const sf::Vec3 &max)
+	{
+		if (min.x <= max.x && min.y <= max.y && min.z <= max.z) {
+			set(lane, sf::Bounds3::minMax(min, max));
+		} else {
+			// Empty AABB: A large negative (finite to avoid `0 * inf` for axis aligned planes)
+			// extent fails the frustum test, `FastRay4` rejects negative extents explicitly
+			set(lane, { sf::Vec3(0.0f), sf::Vec3(-1e30f) });
+		}
+	}
+};
+
+// Four spheres in SoA layout
+struct SphereBlock4
+{
+	float originX[4], originY[4], originZ[4];
+	float radius[4];
+
+	void set(uint32_t lane, const sf::Sphere &sphere)
+	{
+		originX[lane] = sphere.origin.x;
+		originY[lane] = sphere.origin.y;
+		originZ[lane] = sphere.origin.z;
+		radius[lane] = sphere.radius;
+	}
+};
+
+// Unique frustum planes broadcast to all lanes, `sf::Frustum` stores the
+// side planes transposed and the near/far caps duplicated
+struct FrustumPlanes4
+{
+	static const constexpr uint32_t NumPlanes = 6;
+
+	sf::Float4 normalX[NumPlanes], normalY[NumPlanes], normalZ[NumPlanes], dist[NumPlanes];
+	sf::Float4 absX[NumPlanes], absY[NumPlanes], absZ[NumPlanes];
+
+	explicit FrustumPlanes4(const sf::Frustum &frustum)
+	{
+		float side[4][4], caps[4][4];
+		for (uint32_t i = 0; i < 4; i++) {
+			frustum.side[i].storeu(side[i]);
+			frustum.caps[i].storeu(caps[i]);
+		}
+		for (uint32_t i = 0; i < 4; i++) {
+			setPlane(i, side[0][i], side[1][i], side[2][i], side[3][i]);
+		}
+		for (uint32_t i = 0; i < 2; i++) {
+			setPlane(4 + i, caps[0][i], caps[1][i], caps[2][i], caps[3][i]);
+		}
+	}
+
+	void setPlane(uint32_t ix, float x, float y, float z, float w)
+	{
+		normalX[ix] = x; normalY[ix] = y; normalZ[ix] = z; dist[ix] = w;
+		absX[ix] = sf::abs(x); absY[ix] = sf::abs(y); absZ[ix] = sf::abs(z);
+	}
+
+	// Returns a mask of the lanes intersecting the frustum, matches `sf::Frustum::intersects()`
+	sf_forceinline uint32_t intersects(const BoundsBlock4 &block) const
+	{
+		sf::Float4 ox = sf::Float4::loadu(block.originX);
+		sf::Float4 oy = sf::Float4::loadu(block.originY);
+		sf::Float4 oz = sf::Float4::loadu(block.originZ);
+		sf::Float4 ex = sf::Float4::loadu(block.extentX);
+		sf::Float4 ey = sf::Float4::loadu(block.extentY);
+		sf::Float4 ez = sf::Float4::loadu(block.extentZ);
+
+		sf::Float4 result = HUGE_VALF;
+		for (uint32_t i = 0; i < NumPlanes; i++) {
+			sf::Float4 d = dist[i] + normalX[i]*ox + normalY[i]*oy + normalZ[i]*oz;
+			d += absX[i]*ex + absY[i]*ey + absZ[i]*ez;
+			result = result.min(d);
+		}
+		return result.maskGreaterThanZero();
+	}
+
+	sf_forceinline uint32_t intersects(const SphereBlock4 &block) const
+	{
+		sf::Float4 ox = sf::Float4::loadu(block.originX);
+		sf::Float4 oy = sf::Float4::loadu(block.originY);
+		sf::Float4 oz = sf::Float4::loadu(block.originZ);
+		sf::Float4 r = sf::Float4::loadu(block.radius);
+
+		sf::Float4 result = HUGE_VALF;
+		for (uint32_t i = 0; i < NumPlanes; i++) {
+			sf::Float4 d = dist[i] + normalX[i]*ox + normalY[i]*oy + normalZ[i]*oz + r;
+			result = result.min(d);
+		}
+		return result.maskGreaterThanZero();
+	}
+};
+
+// Ray broadcast to all lanes for slab tests against `BoundsBlock4`
+struct FastRay4
+{
+	sf::Float4 originX, originY, originZ;
+	sf::Float4 rcpX, rcpY, rcpZ;
+	sf::Float4 tMin, tMax;
+
+	FastRay4(const sf::FastRay &ray, float tMin_, float tMax_)
+		: originX(ray.origin.x), originY(ray.origin.y), originZ(ray.origin.z)
+		, rcpX(ray.rcpDirection.x), rcpY(ray.rcpDirection.y), rcpZ(ray.rcpDirection.z)
+		, tMin(tMin_), tMax(tMax_)
+	{
+	}
+
+	// Returns a mask of the lanes hit by the ray, matches `sf::intersectRayFastAabb()`
+	// Lanes with a negative extent are empty and never hit, the slab test alone would
+	// pass them as the swapped slab bounds span the whole ray
+	sf_forceinline uint32_t intersects(const BoundsBlock4 &block) const
+	{
+		sf::Float4 ox = sf::Float4::loadu(block.originX) - originX;
+		sf::Float4 oy = sf::Float4::loadu(block.originY) - originY;
+		sf::Float4 oz = sf::Float4::loadu(block.originZ) - originZ;
+		sf::Float4 ex = sf::Float4::loadu(block.extentX);
+		sf::Float4 ey = sf::Float4::loadu(block.extentY);
+		sf::Float4 ez = sf::Float4::loadu(block.extentZ);
+
+		sf::Float4 loX = (ox - ex) * rcpX, hiX = (ox + ex) * rcpX;
+		sf::Float4 loY = (oy - ey) * rcpY, hiY = (oy + ey) * rcpY;
+		sf::Float4 loZ = (oz - ez) * rcpZ, hiZ = (oz + ez) * rcpZ;
+		sf::Float4 t0 = loX.min(hiX).max(loY.min(hiY)).max(loZ.min(hiZ));
+		sf::Float4 t1 = loX.max(hiX).min(loY.max(hiY)).min(loZ.max(hiZ));
+
+		uint32_t miss = (t0 - t1).maskGreaterThanZero() | (tMin - t1).maskGreaterThanZero();
+		miss |= (sf::Float4(0.0f) - ex).maskGreaterThanZero();
+		return (tMax - t0).maskGreaterThanZero() & ~miss;
+	}
+
+	sf_forceinline uint32_t intersects(const SphereBlock4 &block) const
+	{
+		BoundsBlock4 bounds;
+		memcpy(bounds.originX, block.originX, sizeof(float) * 4);
+		memcpy(bounds.originY, block.originY, sizeof(float) * 4);
+		memcpy(bounds.originZ, block.originZ, sizeof(float) * 4);
+		memcpy(bounds.extentX, block.radius, sizeof(float) * 4);
+		memcpy(bounds.extentY, block.radius, sizeof(float) * 4);
+		memcpy(bounds.extentZ, block.radius, sizeof(float) * 4);
+		return intersects(bounds);
+	}
+};
+
+static sf_forceinline uint32_t getBlockLaneMask(uint32_t blockIndex, uint32_t count)
+{
+	uint32_t left = count - blockIndex * 4;
+	return left >= 4 ? 0xf : (1u << left) - 1;
+}
+
 struct AreaSystemImp final : AreaSystem
 {
 	struct BoxAreaImp
@@ -53,11 +218,13 @@ struct AreaSystemImp final : AreaSystem
 		sf::Vec3 aabbMin; float aabbMinPad = 0.0f;
 		sf::Vec3 aabbMax; float aabbMaxPad = 0.0f;
 
-		// Leaf areas
+		// Leaf areas, bounds are mirrored in SoA blocks for queries
 		uint32_t boxFlags = 0;
 		sf::Array<BoxAreaImp> boxes;
+		sf::Array<BoundsBlock4> boxBlocks;
 		uint32_t sphereFlags = 0;
 		sf::Array<SphereAreaImp> spheres;
+		sf::Array<SphereBlock4> sphereBlocks;
 
 		// Child areas
 		uint32_t childMask = 0;
@@ -77,6 +244,7 @@ struct AreaSystemImp final : AreaSystem
 				if (!diff.anyGreaterThanZero()) break;
 				newMin.storeu(s->aabbMin.v);
 				newMax.storeu(s->aabbMax.v);
+				s->syncParentBounds();
 				s = s->parent;
 			} while (--level >= SpatialMinOptimizeDepth);
 		}
@@ -93,6 +261,56 @@ struct AreaSystemImp final : AreaSystem
 			expandImp(min, max, level);
 		}
 
+		void syncParentBounds();
+
+		BoxAreaImp &pushBox(const sf::Bounds3 &bounds)
+		{
+			uint32_t index = boxes.size;
+			if (index % 4 == 0) boxBlocks.push();
+			boxBlocks[index / 4].set(index % 4, bounds);
+			BoxAreaImp &box = boxes.push();
+			box.bounds = bounds;
+			return box;
+		}
+
+		void setBoxBounds(uint32_t index, const sf::Bounds3 &bounds)
+		{
+			boxes[index].bounds = bounds;
+			boxBlocks[index / 4].set(index % 4, bounds);
+		}
+
+		void removeBox(uint32_t index)
+		{
+			uint32_t last = boxes.size - 1;
+			if (index != last) boxBlocks[index / 4].set(index % 4, boxes[last].bounds);
+			boxes.removeSwap(index);
+			if (boxes.size % 4 == 0) boxBlocks.pop();
+		}
+
+		SphereAreaImp &pushSphere(const sf::Sphere &sphere)
+		{
+			uint32_t index = spheres.size;
+			if (index % 4 == 0) sphereBlocks.push();
+			sphereBlocks[index / 4].set(index % 4, sphere);
+			SphereAreaImp &sph = spheres.push();
+			sph.sphere = sphere;
+			return sph;
+		}
+
+		void setSphere(uint32_t index, const sf::Sphere &sphere)
+		{
+			spheres[index].sphere = sphere;
+			sphereBlocks[index / 4].set(index % 4, sphere);
+		}
+
+		void removeSphere(uint32_t index)
+		{
+			uint32_t last = spheres.size - 1;
+			if (index != last) sphereBlocks[index / 4].set(index % 4, spheres[last].sphere);
+			spheres.removeSwap(index);
+			if (spheres.size % 4 == 0) sphereBlocks.pop();
+		}
+
 		bool isValidLeaf(const sf::Vec3 &origin, float extent) const
 		{
 			if (extent < minLeafExtent || extent > maxLeafExtent) return false;
@@ -105,6 +323,9 @@ struct AreaSystemImp final : AreaSystem
 	struct SpatialChildren
 	{
 		Spatial child[8];
+
+		// Mirror of `child[i].aabbMin/Max` for testing four children at once
+		BoundsBlock4 bounds[2];
 	};
 
 	enum class AreaShape
@@ -136,113 +357,198 @@ struct AreaSystemImp final : AreaSystem
 	sf::Array<Spatial*> optimizationQueues[SpatialMaxDepth];
 	uint32_t optimizationQueueOffsets[SpatialMaxDepth] = { };
 
-	static void queryFrustumSpatial(const Spatial *spatial, sf::Array<Area> &areas, uint32_t areaFlags, const sf::Frustum &frustum)
-	{
-		if (spatial->boxFlags & areaFlags) {
-			for (const BoxAreaImp &box : spatial->boxes) {
-				if ((box.area.flags & areaFlags) == 0) continue;
-				if (!frustum.intersects(box.bounds)) continue;
+	uint32_t version = 1;
 
-				areas.push(box.area);
-			}
-		}
+	sf::Array<AreaChange> changes;
 
-		if (spatial->sphereFlags & areaFlags) {
-			for (const SphereAreaImp &sph : spatial->spheres) {
-				if ((sph.area.flags & areaFlags) == 0) continue;
-				if (!frustum.intersects(sph.sphere)) continue;
+	void bumpVersion()
+	{
+		if (++version == 0) version = 1;
+	}
 
-				areas.push(sph.area);
-			}
+	void pushChange(const sf::Bounds3 &bounds, const Area &area)
+	{
+		uint32_t groupMask = 1u << (uint32_t)area.group;
+		if (changes.size < MaxTrackedChanges) {
+			changes.push({ bounds, area.flags, groupMask });
+		} else {
+			AreaChange &last = changes.back();
+			last.bounds = sf::boundsUnion(last.bounds, bounds);
+			last.areaFlags |= area.flags;
+			last.groupMask |= groupMask;
 		}
+	}
 
-		Spatial *children = spatial->children->child;
-		uint32_t childMask = spatial->childMask;
-		while (childMask) {
-			uint32_t ix = mx_ctz32(childMask);
-			childMask &= childMask - 1;
+	// Iterate all leaf areas in `root` matching `areaFlags` that pass `test`,
+	// `test(block)` returns a mask of the intersecting lanes
+	template <typename TestFn, typename BoxFn, typename SphereFn>
+	static void queryLeaves(const Spatial *root, uint32_t areaFlags, TestFn test, BoxFn boxFn, SphereFn sphereFn)
+	{
+		sf::SmallArray<const Spatial*, 64> stack;
+		stack.push(root);
+
+		while (stack.size > 0) {
+			const Spatial *spatial = stack.popValue();
+
+			if (spatial->boxFlags & areaFlags) {
+				const BoxAreaImp *boxes = spatial->boxes.data;
+				uint32_t numBoxes = spatial->boxes.size;
+				for (uint32_t blockIx = 0; blockIx < spatial->boxBlocks.size; blockIx++) {
+					uint32_t mask = test(spatial->boxBlocks[blockIx]) & getBlockLaneMask(blockIx, numBoxes);
+					while (mask) {
+						const BoxAreaImp &box = boxes[blockIx * 4 + mx_ctz32(mask)];
+						mask &= mask - 1;
+						if ((box.area.flags & areaFlags) == 0) continue;
+						boxFn(box);
+					}
+				}
+			}
 
-			Spatial *child = children + ix;
-			if (!frustum.intersects(sf::Bounds3::minMax(child->aabbMin, child->aabbMax))) continue;
+			if (spatial->sphereFlags & areaFlags) {
+				const SphereAreaImp *spheres = spatial->spheres.data;
+				uint32_t numSpheres = spatial->spheres.size;
+				for (uint32_t blockIx = 0; blockIx < spatial->sphereBlocks.size; blockIx++) {
+					uint32_t mask = test(spatial->sphereBlocks[blockIx]) & getBlockLaneMask(blockIx, numSpheres);
+					while (mask) {
+						const SphereAreaImp &sph = spheres[blockIx * 4 + mx_ctz32(mask)];
+						mask &= mask - 1;
+						if ((sph.area.flags & areaFlags) == 0) continue;
+						sphereFn(sph);
+					}
+				}
+			}
 
-			queryFrustumSpatial(child, areas, areaFlags, frustum);
+			uint32_t childMask = spatial->childMask;
+			if (childMask) {
+				const SpatialChildren *children = spatial->children;
+				childMask &= test(children->bounds[0]) | test(children->bounds[1]) << 4;
+				while (childMask) {
+					uint32_t ix = mx_ctz32(childMask);
+					childMask &= childMask - 1;
+					stack.push(&children->child[ix]);
+				}
+			}
 		}
 	}
 
-	static void queryFrustumSpatialBounds(const Spatial *spatial, sf::Array<AreaBounds> &areas, uint32_t areaFlags, const sf::Frustum &frustum)
+	static void queryFrustumSpatial(const Spatial *spatial, sf::Array<Area> &areas, uint32_t areaFlags, const FrustumPlanes4 &planes)
 	{
-		if (spatial->boxFlags & areaFlags) {
-			for (const BoxAreaImp &box : spatial->boxes) {
-				if ((box.area.flags & areaFlags) == 0) continue;
-				if (!frustum.intersects(box.bounds)) continue;
+		queryLeaves(spatial, areaFlags,
+			[&](const auto &block) { return planes.intersects(block); },
+			[&](const BoxAreaImp &box) { areas.push(box.area); },
+			[&](const SphereAreaImp &sph) { areas.push(sph.area); });
+	}
 
+	static void queryFrustumSpatialBounds(const Spatial *spatial, sf::Array<AreaBounds> &areas, uint32_t areaFlags, const FrustumPlanes4 &planes)
+	{
+		queryLeaves(spatial, areaFlags,
+			[&](const auto &block) { return planes.intersects(block); },
+			[&](const BoxAreaImp &box) {
 				AreaBounds &area = areas.push();
 				area.area = box.area;
 				area.bounds = box.bounds;
-			}
-		}
-
-		if (spatial->sphereFlags & areaFlags) {
-			for (const SphereAreaImp &sph : spatial->spheres) {
-				if ((sph.area.flags & areaFlags) == 0) continue;
-				if (!frustum.intersects(sph.sphere)) continue;
-
+			},
+			[&](const SphereAreaImp &sph) {
 				AreaBounds &area = areas.push();
 				area.area = sph.area;
 				area.bounds.origin = sph.sphere.origin;
 				area.bounds.extent = sf::Vec3(sph.sphere.origin);
-			}
-		}
-
-		Spatial *children = spatial->children->child;
-		uint32_t childMask = spatial->childMask;
-		while (childMask) {
-			uint32_t ix = mx_ctz32(childMask);
-			childMask &= childMask - 1;
-
-			Spatial *child = children + ix;
-			if (!frustum.intersects(sf::Bounds3::minMax(child->aabbMin, child->aabbMax))) continue;
-
-			queryFrustumSpatialBounds(child, areas, areaFlags, frustum);
-		}
+			});
 	}
 
-	static void castRaySpatial(const Spatial *spatial, sf::Array<Area> &areas, uint32_t areaFlags, const sf::FastRay &ray, float tMin, float tMax)
+	// Like `queryLeaves()` but tests every node against all `views` (a mask
+	// of indices to `queries`) and only descends with the views that pass
+	static void queryFrustumsSpatial(const Spatial *root, uint32_t rootViews, sf::Slice<const AreaFrustumQuery> queries, const FrustumPlanes4 *planes)
 	{
-		if (spatial->boxFlags & areaFlags) {
-			for (const BoxAreaImp &box : spatial->boxes) {
-				if ((box.area.flags & areaFlags) == 0) continue;
-				float t = sf::intersectRayFast(ray, box.bounds, tMin, tMax);
-				if (t >= tMax) continue;
-
-				areas.push(box.area);
+		struct StackEntry
+		{
+			const Spatial *spatial;
+			uint32_t views;
+		};
+
+		sf::SmallArray<StackEntry, 64> stack;
+		stack.push({ root, rootViews });
+
+		while (stack.size > 0) {
+			StackEntry entry = stack.popValue();
+			const Spatial *spatial = entry.spatial;
+
+			uint32_t boxViews = 0, sphereViews = 0;
+			for (uint32_t views = entry.views; views; views &= views - 1) {
+				uint32_t viewIx = mx_ctz32(views);
+				if (spatial->boxFlags & queries[viewIx].areaFlags) boxViews |= 1u << viewIx;
+				if (spatial->sphereFlags & queries[viewIx].areaFlags) sphereViews |= 1u << viewIx;
 			}
-		}
 
-		if (spatial->sphereFlags & areaFlags) {
-			for (const SphereAreaImp &sph : spatial->spheres) {
-				if ((sph.area.flags & areaFlags) == 0) continue;
-				float t = sf::intersectRayFast(ray, sph.sphere, tMin, tMax);
-				if (t >= tMax) continue;
-
-				areas.push(sph.area);
+			for (uint32_t blockIx = 0; boxViews && blockIx < spatial->boxBlocks.size; blockIx++) {
+				const BoundsBlock4 &block = spatial->boxBlocks[blockIx];
+				uint32_t laneMask = getBlockLaneMask(blockIx, spatial->boxes.size);
+				for (uint32_t views = boxViews; views; views &= views - 1) {
+					uint32_t viewIx = mx_ctz32(views);
+					const AreaFrustumQuery &query = queries[viewIx];
+					uint32_t mask = planes[viewIx].intersects(block) & laneMask;
+					while (mask) {
+						const BoxAreaImp &box = spatial->boxes[blockIx * 4 + mx_ctz32(mask)];
+						mask &= mask - 1;
+						if ((box.area.flags & query.areaFlags) == 0) continue;
+						query.areas->push(box.area);
+					}
+				}
 			}
-		}
 
-		Spatial *children = spatial->children->child;
-		uint32_t childMask = spatial->childMask;
-		while (childMask) {
-			uint32_t ix = mx_ctz32(childMask);
-			childMask &= childMask - 1;
+			for (uint32_t blockIx = 0; sphereViews && blockIx < spatial->sphereBlocks.size; blockIx++) {
+				const SphereBlock4 &block = spatial->sphereBlocks[blockIx];
+				uint32_t laneMask = getBlockLaneMask(blockIx, spatial->spheres.size);
+				for (uint32_t views = sphereViews; views; views &= views - 1) {
+					uint32_t viewIx = mx_ctz32(views);
+					const AreaFrustumQuery &query = queries[viewIx];
+					uint32_t mask = planes[viewIx].intersects(block) & laneMask;
+					while (mask) {
+						const SphereAreaImp &sph = spatial->spheres[blockIx * 4 + mx_ctz32(mask)];
+						mask &= mask - 1;
+						if ((sph.area.flags & query.areaFlags) == 0) continue;
+						query.areas->push(sph.area);
+					}
+				}
+			}
 
-			Spatial *child = children + ix;
-			float t = sf::intersectRayFastAabb(ray, child->aabbMin, child->aabbMax, tMin, tMax);
-			if (t >= tMax) continue;
+			uint32_t childMask = spatial->childMask;
+			if (childMask) {
+				const SpatialChildren *children = spatial->children;
+				uint32_t childViews[8] = { };
+				for (uint32_t views = entry.views; views; views &= views - 1) {
+					uint32_t viewIx = mx_ctz32(views);
+					const FrustumPlanes4 &viewPlanes = planes[viewIx];
+					uint32_t mask = childMask & (viewPlanes.intersects(children->bounds[0]) | viewPlanes.intersects(children->bounds[1]) << 4);
+					while (mask) {
+						childViews[mx_ctz32(mask)] |= 1u << viewIx;
+						mask &= mask - 1;
+					}
+				}
 
-			castRaySpatial(child, areas, areaFlags, ray, tMin, tMax);
+				while (childMask) {
+					uint32_t ix = mx_ctz32(childMask);
+					childMask &= childMask - 1;
+					if (childViews[ix] == 0) continue;
+					stack.push({ &children->child[ix], childViews[ix] });
+				}
+			}
 		}
 	}
 
+	static void castRaySpatial(const Spatial *spatial, sf::Array<Area> &areas, uint32_t areaFlags, const sf::FastRay &ray, const FastRay4 &ray4, float tMin, float tMax)
+	{
+		queryLeaves(spatial, areaFlags,
+			[&](const auto &block) { return ray4.intersects(block); },
+			[&](const BoxAreaImp &box) { areas.push(box.area); },
+			[&](const SphereAreaImp &sph) {
+				// Blocks only test the bounding box of the sphere
+				float t = sf::intersectRayFast(ray, sph.sphere, tMin, tMax);
+				if (t >= tMax) return;
+				areas.push(sph.area);
+			});
+	}
+
 	sf_forceinline static void initializeSpatialOptimization(Spatial *spatial)
 	{
 		// Set to be sticky in optimization queue with static bounds
@@ -301,6 +607,7 @@ struct AreaSystemImp final : AreaSystem
 			child.aabbMax = sf::Vec3(-HUGE_VALF);
 			child.depth = childDepth;
 			initializeSpatialOptimization(&child);
+			child.syncParentBounds();
 		}
 	}
 
@@ -367,33 +674,56 @@ struct AreaSystemImp final : AreaSystem
 
 	void optimizeSpatial(Spatial *spatial)
 	{
+		bumpVersion();
+
 		if (spatial->parent) {
 			addToOptimizationQueue(spatial->parent);
 		}
 
-		sf::Float4 aabbMin = +HUGE_VALF;
-		sf::Float4 aabbMax = -HUGE_VALF;
+		// Expand by two areas at a time, one per half of `sf::Float8`,
+		// an odd last area is paired with itself
+		sf::Float8 aabbMin8 = +HUGE_VALF;
+		sf::Float8 aabbMax8 = -HUGE_VALF;
 
 		uint32_t boxFlags = 0;
-		for (BoxAreaImp &box : spatial->boxes) {
-			sf::Float4 origin = { box.bounds.origin.x, box.bounds.origin.y, box.bounds.origin.z, 0.0f };
-			sf::Float4 extent = { box.bounds.extent.x, box.bounds.extent.y, box.bounds.extent.z, 0.0f };
-			aabbMin = aabbMin.min(origin - extent);
-			aabbMax = aabbMax.max(origin + extent);
-			boxFlags |= box.area.flags;
+		uint32_t numBoxes = spatial->boxes.size;
+		for (uint32_t i = 0; i < numBoxes; i += 2) {
+			const BoxAreaImp &boxA = spatial->boxes[i];
+			const BoxAreaImp &boxB = spatial->boxes[sf::min(i + 1, numBoxes - 1)];
+			const sf::Bounds3 &a = boxA.bounds, &b = boxB.bounds;
+			sf::Float8 origin = sf::Float8(
+				sf::Float4(a.origin.x, a.origin.y, a.origin.z, 0.0f),
+				sf::Float4(b.origin.x, b.origin.y, b.origin.z, 0.0f));
+			sf::Float8 extent = sf::Float8(
+				sf::Float4(a.extent.x, a.extent.y, a.extent.z, 0.0f),
+				sf::Float4(b.extent.x, b.extent.y, b.extent.z, 0.0f));
+			aabbMin8 = aabbMin8.min(origin - extent);
+			aabbMax8 = aabbMax8.max(origin + extent);
+			boxFlags |= boxA.area.flags | boxB.area.flags;
 		}
 		spatial->boxFlags = boxFlags;
 
 		uint32_t sphereFlags = 0;
-		for (SphereAreaImp &sph : spatial->spheres) {
-			sf::Float4 origin = { sph.sphere.origin.x, sph.sphere.origin.y, sph.sphere.origin.z, 0.0f };
-			sf::Float4 extent = { sph.sphere.radius, sph.sphere.radius, sph.sphere.radius, 0.0f };
-			aabbMin = aabbMin.min(origin - extent);
-			aabbMax = aabbMax.max(origin + extent);
-			sphereFlags |= sph.area.flags;
+		uint32_t numSpheres = spatial->spheres.size;
+		for (uint32_t i = 0; i < numSpheres; i += 2) {
+			const SphereAreaImp &sphA = spatial->spheres[i];
+			const SphereAreaImp &sphB = spatial->spheres[sf::min(i + 1, numSpheres - 1)];
+			const sf::Sphere &a = sphA.sphere, &b = sphB.sphere;
+			sf::Float8 origin = sf::Float8(
+				sf::Float4(a.origin.x, a.origin.y, a.origin.z, 0.0f),
+				sf::Float4(b.origin.x, b.origin.y, b.origin.z, 0.0f));
+			sf::Float8 extent = sf::Float8(
+				sf::Float4(a.radius, a.radius, a.radius, 0.0f),
+				sf::Float4(b.radius, b.radius, b.radius, 0.0f));
+			aabbMin8 = aabbMin8.min(origin - extent);
+			aabbMax8 = aabbMax8.max(origin + extent);
+			sphereFlags |= sphA.area.flags | sphB.area.flags;
 		}
 		spatial->sphereFlags = sphereFlags;
 
+		sf::Float4 aabbMin = aabbMin8.getLo().min(aabbMin8.getHi());
+		sf::Float4 aabbMax = aabbMax8.getLo().max(aabbMax8.getHi());
+
 		if (spatial->children) {
 			uint32_t childMask = 0;
 			uint32_t childBit = 1;
@@ -412,12 +742,15 @@ struct AreaSystemImp final : AreaSystem
 
 		aabbMin.storeu(spatial->aabbMin.v);
 		aabbMax.storeu(spatial->aabbMax.v);
+		spatial->syncParentBounds();
 	}
 
 	// API
 
 	uint32_t addBoxArea(AreaGroup group, uint32_t userId, const sf::Bounds3 &unclampedBounds, uint32_t areaFlags) override
 	{
+		bumpVersion();
+
 		uint32_t areaId = areaImps.size;
 		if (freeAreaIds.size > 0) {
 			areaId = freeAreaIds.popValue();
@@ -436,8 +769,7 @@ struct AreaSystemImp final : AreaSystem
 		areaImp.setShape(AreaShape::Box);
 
 		spatial->boxFlags |= areaFlags;
-		BoxAreaImp &box = spatial->boxes.push();
-		box.bounds = bounds;
+		BoxAreaImp &box = spatial->pushBox(bounds);
 		box.areaId = areaId;
 		box.area.group = group;
 		box.area.flags = areaFlags;
@@ -445,6 +777,7 @@ struct AreaSystemImp final : AreaSystem
 		spatial->expand(bounds);
 
 		addToOptimizationQueue(spatial);
+		pushChange(bounds, box.area);
 
 		return areaId;
 	}
@@ -457,6 +790,8 @@ struct AreaSystemImp final : AreaSystem
 
 	void updateBoxArea(uint32_t areaId, const sf::Bounds3 &unclampedBounds) override
 	{
+		bumpVersion();
+
 		AreaImp &areaImp = areaImps[areaId];
 		areaImp.checkShape(AreaShape::Box);
 
@@ -465,22 +800,28 @@ struct AreaSystemImp final : AreaSystem
 		float extent = sf::max(bounds.extent.x, bounds.extent.y, bounds.extent.z);
 		Spatial *spatial = areaImp.spatial;
 		uint32_t spatialIndex = areaImp.spatialIndex;
+
+		const BoxAreaImp &prevBox = spatial->boxes[spatialIndex];
+		if (!(prevBox.bounds == bounds)) {
+			pushChange(prevBox.bounds, prevBox.area);
+			pushChange(bounds, prevBox.area);
+		}
+
 		if (spatial->isValidLeaf(bounds.origin, extent)) {
-			spatial->boxes[spatialIndex].bounds = bounds;
+			spatial->setBoxBounds(spatialIndex, bounds);
 		} else {
 			addToOptimizationQueue(spatial);
 
 			Area area = spatial->boxes[spatialIndex].area;
 
 			areaImps[spatial->boxes.back().areaId].spatialIndex = spatialIndex;
-			spatial->boxes.removeSwap(spatialIndex);
+			spatial->removeBox(spatialIndex);
 
 			spatial = insertSpatial(bounds.origin, extent);
 			spatial->boxFlags |= area.flags;
 			areaImp.spatial = spatial;
 			areaImp.spatialIndex = spatial->boxes.size;
-			BoxAreaImp &box = spatial->boxes.push();
-			box.bounds = bounds;
+			BoxAreaImp &box = spatial->pushBox(bounds);
 			box.areaId = areaId;
 			box.area = area;
 		}
@@ -496,13 +837,16 @@ struct AreaSystemImp final : AreaSystem
 
 	void removeBoxArea(uint32_t areaId) override
 	{
+		bumpVersion();
+
 		AreaImp &areaImp = areaImps[areaId];
 		areaImp.checkShape(AreaShape::Box);
 
 		Spatial *spatial = areaImp.spatial;
 		uint32_t spatialIndex = areaImp.spatialIndex;
+		pushChange(spatial->boxes[spatialIndex].bounds, spatial->boxes[spatialIndex].area);
 		areaImps[spatial->boxes.back().areaId].spatialIndex = spatialIndex;
-		spatial->boxes.removeSwap(spatialIndex);
+		spatial->removeBox(spatialIndex);
 
 		addToOptimizationQueue(spatial);
 
@@ -512,6 +856,8 @@ struct AreaSystemImp final : AreaSystem
 
 	uint32_t addSphereArea(AreaGroup group, uint32_t userId, const sf::Sphere &sphere, uint32_t areaFlags) override
 	{
+		bumpVersion();
+
 		uint32_t areaId = areaImps.size;
 		if (freeAreaIds.size > 0) {
 			areaId = freeAreaIds.popValue();
@@ -530,8 +876,7 @@ struct AreaSystemImp final : AreaSystem
 		areaImp.setShape(AreaShape::Sphere);
 
 		spatial->sphereFlags |= areaFlags;
-		SphereAreaImp &sph = spatial->spheres.push();
-		sph.sphere = sphere;
+		SphereAreaImp &sph = spatial->pushSphere(sphere);
 		sph.areaId = areaId;
 		sph.area.group = group;
 		sph.area.flags = areaFlags;
@@ -539,6 +884,7 @@ struct AreaSystemImp final : AreaSystem
 		spatial->expand(bounds);
 
 		addToOptimizationQueue(spatial);
+		pushChange(bounds, sph.area);
 
 		return areaId;
 	}
@@ -551,6 +897,8 @@ struct AreaSystemImp final : AreaSystem
 
 	void updateSphereArea(uint32_t areaId, const sf::Sphere &sphere) override
 	{
+		bumpVersion();
+
 		AreaImp &areaImp = areaImps[areaId];
 		areaImp.checkShape(AreaShape::Sphere);
 
@@ -559,22 +907,28 @@ struct AreaSystemImp final : AreaSystem
 		float extent = sphere.radius;
 		Spatial *spatial = areaImp.spatial;
 		uint32_t spatialIndex = areaImp.spatialIndex;
+
+		const SphereAreaImp &prevSph = spatial->spheres[spatialIndex];
+		if (prevSph.sphere.origin != sphere.origin || prevSph.sphere.radius != sphere.radius) {
+			pushChange(clampBounds(prevSph.sphere), prevSph.area);
+			pushChange(bounds, prevSph.area);
+		}
+
 		if (spatial->isValidLeaf(bounds.origin, extent)) {
-			spatial->spheres[spatialIndex].sphere = sphere;
+			spatial->setSphere(spatialIndex, sphere);
 		} else {
 			addToOptimizationQueue(spatial);
 
 			Area area = spatial->spheres[spatialIndex].area;
 
 			areaImps[spatial->spheres.back().areaId].spatialIndex = spatialIndex;
-			spatial->spheres.removeSwap(spatialIndex);
+			spatial->removeSphere(spatialIndex);
 
 			spatial = insertSpatial(bounds.origin, extent);
 			spatial->sphereFlags |= area.flags;
 			areaImp.spatial = spatial;
 			areaImp.spatialIndex = spatial->spheres.size;
-			SphereAreaImp &sph = spatial->spheres.push();
-			sph.sphere = sphere;
+			SphereAreaImp &sph = spatial->pushSphere(sphere);
 			sph.areaId = areaId;
 			sph.area = area;
 		}
@@ -591,13 +945,16 @@ struct AreaSystemImp final : AreaSystem
 
 	void removeSphereArea(uint32_t areaId) override
 	{
+		bumpVersion();
+
 		AreaImp &areaImp = areaImps[areaId];
 		areaImp.checkShape(AreaShape::Sphere);
 
 		Spatial *spatial = areaImp.spatial;
 		uint32_t spatialIndex = areaImp.spatialIndex;
+		pushChange(clampBounds(spatial->spheres[spatialIndex].sphere), spatial->spheres[spatialIndex].area);
 		areaImps[spatial->spheres.back().areaId].spatialIndex = spatialIndex;
-		spatial->spheres.removeSwap(spatialIndex);
+		spatial->removeSphere(spatialIndex);
 
 		addToOptimizationQueue(spatial);
 
@@ -605,6 +962,30 @@ struct AreaSystemImp final : AreaSystem
 		freeAreaIds.push(areaId);
 	}
 
+	uint32_t getVersion() const override
+	{
+		return version;
+	}
+
+	sf::Slice<const AreaChange> getChanges() const override
+	{
+		return changes;
+	}
+
+	void clearChanges() override
+	{
+		changes.clear();
+	}
+
+	void markBoxAreaChanged(uint32_t areaId) override
+	{
+		AreaImp &areaImp = areaImps[areaId];
+		areaImp.checkShape(AreaShape::Box);
+
+		const BoxAreaImp &box = areaImp.spatial->boxes[areaImp.spatialIndex];
+		pushChange(box.bounds, box.area);
+	}
+
 	void optimize() override
 	{
 		static const uint32_t updatesPerLevel[] = { 4, 2 };
@@ -638,30 +1019,56 @@ struct AreaSystemImp final : AreaSystem
 
 	void queryFrustum(sf::Array<Area> &areas, uint32_t areaFlags, const sf::Frustum &frustum) const override
 	{
-		sf::Frustum local = frustum;
+		FrustumPlanes4 planes(frustum);
 		for (const auto &root : spatialRoots) {
 			const Spatial *spatial = root.val;
 			if ((spatial->boxFlags | spatial->sphereFlags | spatial->childMask) == 0) continue;
 			if (!frustum.intersects(sf::Bounds3::minMax(spatial->aabbMin, spatial->aabbMax))) continue;
 
-			queryFrustumSpatial(spatial, areas, areaFlags, frustum);
+			queryFrustumSpatial(spatial, areas, areaFlags, planes);
+		}
+	}
+
+	void queryFrustums(sf::Slice<const AreaFrustumQuery> queries) const override
+	{
+		sf_assert(queries.size <= MaxFrustumQueries);
+
+		sf::SmallArray<FrustumPlanes4, 8> planes;
+		planes.reserve(queries.size);
+		for (const AreaFrustumQuery &query : queries) {
+			planes.push(FrustumPlanes4(*query.frustum));
+		}
+
+		for (const auto &root : spatialRoots) {
+			const Spatial *spatial = root.val;
+			if ((spatial->boxFlags | spatial->sphereFlags | spatial->childMask) == 0) continue;
+			sf::Bounds3 bounds = sf::Bounds3::minMax(spatial->aabbMin, spatial->aabbMax);
+
+			uint32_t views = 0;
+			for (uint32_t i = 0; i < queries.size; i++) {
+				if (queries[i].frustum->intersects(bounds)) views |= 1u << i;
+			}
+			if (views == 0) continue;
+
+			queryFrustumsSpatial(spatial, views, queries, planes.data);
 		}
 	}
 
 	void queryFrustumBounds(sf::Array<AreaBounds> &areas, uint32_t areaFlags, const sf::Frustum &frustum) const override
 	{
-		sf::Frustum local = frustum;
+		FrustumPlanes4 planes(frustum);
 		for (const auto &root : spatialRoots) {
 			const Spatial *spatial = root.val;
 			if ((spatial->boxFlags | spatial->sphereFlags | spatial->childMask) == 0) continue;
 			if (!frustum.intersects(sf::Bounds3::minMax(spatial->aabbMin, spatial->aabbMax))) continue;
 
-			queryFrustumSpatialBounds(spatial, areas, areaFlags, frustum);
+			queryFrustumSpatialBounds(spatial, areas, areaFlags, planes);
 		}
 	}
 
 	void castRay(sf::Array<Area> &areas, uint32_t areaFlags, const sf::FastRay &ray, float tMin, float tMax) const override
 	{
+		FastRay4 ray4(ray, tMin, tMax);
 		for (const auto &root : spatialRoots) {
 			const Spatial *spatial = root.val;
 			if ((spatial->boxFlags | spatial->sphereFlags | spatial->childMask) == 0) continue;
@@ -669,11 +1076,18 @@ struct AreaSystemImp final : AreaSystem
 			float t = sf::intersectRayFastAabb(ray, spatial->aabbMin, spatial->aabbMax, tMin, tMax);
 			if (t >= tMax) continue;
 
-			castRaySpatial(spatial, areas, areaFlags, ray, tMin, tMax);
+			castRaySpatial(spatial, areas, areaFlags, ray, ray4, tMin, tMax);
 		}
 	}
 };
 
+void AreaSystemImp::Spatial::syncParentBounds()
+{
+	if (!parent) return;
+	uint32_t ix = (uint32_t)(this - parent->children->child);
+	parent->children->bounds[ix >> 2].setMinMax(ix & 3, aabbMin, aabbMax);
+}
+
 sf::Box<AreaSystem> AreaSystem::create() { return sf::box<AreaSystemImp>(); }
 
 }
@@ -7,8 +7,25 @@ namespace sf { struct Frustum; }
 
 namespace cl {
 
+struct AreaFrustumQuery
+{
+	sf::Array<Area> *areas;
+	uint32_t areaFlags;
+	const sf::Frustum *frustum;
+};
+
+struct AreaChange
+{
+	sf::Bounds3 bounds;
+	uint32_t areaFlags;
+	uint32_t groupMask; // < `1u << (uint32_t)AreaGroup`
+};
+
 struct AreaSystem : System
 {
+	static const constexpr uint32_t MaxFrustumQueries = 32;
+	static const constexpr uint32_t MaxTrackedChanges = 1024;
+
 	static sf::Box<AreaSystem> create();
 
 	virtual uint32_t addBoxArea(AreaGroup group, uint32_t userId, const sf::Bounds3 &bounds, uint32_t areaFlags) = 0;
@@ -25,7 +42,21 @@ struct AreaSystem : System
 
 	virtual void optimize() = 0;
 
+	// Changes whenever the result of any query may have changed
+	virtual uint32_t getVersion() const = 0;
+
+	// Bounds of areas added, moved or removed since the last `clearChanges()`,
+	// moves report both the old and new bounds. Past `MaxTrackedChanges` the
+	// last entry grows to cover the rest. Cleared once per frame after rendering.
+	virtual sf::Slice<const AreaChange> getChanges() const = 0;
+	virtual void clearChanges() = 0;
+
+	// Report a box area whose contents changed without its bounds moving
+	virtual void markBoxAreaChanged(uint32_t areaId) = 0;
+
 	virtual void queryFrustum(sf::Array<Area> &areas, uint32_t areaFlags, const sf::Frustum &frustum) const = 0;
+	// Query up to `MaxFrustumQueries` frustums with a single traversal
+	virtual void queryFrustums(sf::Slice<const AreaFrustumQuery> queries) const = 0;
 	virtual void queryFrustumBounds(sf::Array<AreaBounds> &areas, uint32_t areaFlags, const sf::Frustum &frustum) const = 0;
 	virtual void castRay(sf::Array<Area> &areas, uint32_t areaFlags, const sf::FastRay &ray, float tMin=0.0f, float tMax=HUGE_VALF) const = 0;
 
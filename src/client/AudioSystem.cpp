@@ -1,23 +1,34 @@
 #include "AudioSystem.h"
 
 #include "client/AreaSystem.h"
+#include "client/ClientSettings.h"
 
 #include "game/DebugDraw.h"
 
 #include "sf/Geometry.h"
 #include "sf/Random.h"
+#include "sf/Sort.h"
 
 #include "sp/Audio.h"
 #include "sp/Sound.h"
+#include "sp/Profiler.h"
 
 #include "sf/ext/mx/mx_platform.h"
 
 #include "sf/Mutex.h"
+#include "sf/Semaphore.h"
+#include "sf/Thread.h"
 
 namespace cl {
 
 const uint32_t MaxSoundInstances = 128;
 
+// Audible instances of the same sound if not specified by `AudioInfo::maxInstances`
+const uint32_t DefaultMaxInstancesPerSound = 6;
+
+// Audibility multiplier for voices that are already playing to avoid flip-flopping
+const float RealVoiceBias = 1.25f;
+
 struct SoundOpts
 {
 	float volume[2];
@@ -39,6 +50,12 @@ struct SoundInstance
 	uint32_t spatialSoundIndex = ~0u;
 	uint32_t trackedSoundId = ~0u;
 
+	const void *group = nullptr; // < Sound asset for `AudioInfo::maxInstances`
+
+	// Owned by the mixer
+	bool isVirtual = false;
+	bool wantReal = true;
+
 	SoundOpts optsBuf[4] = { };
 	uint32_t optsIndex = 0;
 
@@ -53,25 +70,90 @@ struct SoundInstance
 	}
 };
 
+// Single-producer single-consumer ring of interleaved stereo samples. The
+// producer side is guarded by `AudioThread::mutex` and the consumer is the
+// device callback, which never locks.
+struct AudioRing
+{
+	static const uint32_t NumSamples = 8192; // < Power of two
+
+	float data[NumSamples * 2];
+	uint32_t writeIndex = 0; // < Atomic, advanced by the producer
+	uint32_t readIndex = 0;  // < Atomic, advanced by the consumer
+
+	uint32_t getNumReadable() const { return mxa_load32_acq(&writeIndex) - mxa_load32_acq(&readIndex); }
+	uint32_t getNumWritable() const { return NumSamples - getNumReadable(); }
+
+	void write(const float *src, uint32_t numSamples)
+	{
+		sf_assert(numSamples <= getNumWritable());
+		uint32_t begin = mxa_load32_nf(&writeIndex) & (NumSamples - 1);
+		uint32_t numFirst = sf::min(numSamples, NumSamples - begin);
+		memcpy(data + begin * 2, src, numFirst * 2 * sizeof(float));
+		memcpy(data, src + numFirst * 2, (numSamples - numFirst) * 2 * sizeof(float));
+		mxa_add32_rel(&writeIndex, numSamples);
+	}
+
+	uint32_t read(float *dst, uint32_t numSamples)
+	{
+		numSamples = sf::min(numSamples, getNumReadable());
+		uint32_t begin = mxa_load32_nf(&readIndex) & (NumSamples - 1);
+		uint32_t numFirst = sf::min(numSamples, NumSamples - begin);
+		memcpy(dst, data + begin * 2, numFirst * 2 * sizeof(float));
+		memcpy(dst + numFirst * 2, data, (numSamples - numFirst) * 2 * sizeof(float));
+		mxa_add32_rel(&readIndex, numSamples);
+		return numSamples;
+	}
+};
+
 struct AudioThread
 {
 	static const uint32_t ShutdownSamples = 128;
+	static const uint32_t MixBlockSamples = 256;
 
 	SoundInstance *incoming = nullptr;
 	SoundInstance *outgoing = nullptr;
 
+	struct VoiceCandidate
+	{
+		float audibility;
+		uint32_t index;
+
+		bool operator<(const VoiceCandidate &rhs) const { return audibility > rhs.audibility; }
+	};
+
+	struct VoiceGroup
+	{
+		const void *group;
+		uint32_t count;
+	};
+
 	sf::Array<SoundInstance*> instances;
-	sf::Array<float> shutdownBuffer;
+	sf::Array<VoiceCandidate> voiceCandidates;
+	sf::Array<VoiceGroup> voiceGroups;
 
 	sp::AudioLimiter limiter;
 
+	// Held while producing audio into `ring`, never locked by the device
+	// callback while the mixer thread is running
 	sf::Mutex mutex;
-	uint32_t prevSampleRate = 0;
+	AudioRing ring;
+	float mixBuffer[MixBlockSamples * 2];
+
+	sf::Thread *mixerThread = nullptr;
+	sf::Semaphore mixerSemaphore;
+	uint32_t mixerRunning = 0; // < Atomic, callback renders on demand if zero
+	uint32_t mixerQuit = 0;    // < Atomic
+
+	uint32_t sampleRate = 0;   // < Atomic, set by the device callback
+	uint32_t targetSamples = 0; // < Atomic, how many samples to render ahead
+	uint32_t maxRealVoices = 32; // < Guarded by `mutex`
 
 	AudioThread()
 	{
 		instances.reserve(MaxSoundInstances);
-		shutdownBuffer.reserve(ShutdownSamples * 2);
+		voiceCandidates.reserve(MaxSoundInstances);
+		voiceGroups.reserve(MaxSoundInstances);
 	}
 
 	void pushInstance(SoundInstance **list, SoundInstance *instance) {
@@ -90,6 +172,70 @@ struct AudioThread
 		return (SoundInstance*)mxa_exchange_ptr(list, nullptr);
 	}
 
+	// Pick the most audible instances to be mixed, the rest only advance
+	// their position virtually until they rise above the cutoff again
+	void assignVoices()
+	{
+		voiceCandidates.clear();
+		for (uint32_t i = 0; i < instances.size; i++) {
+			SoundInstance *inst = instances[i];
+
+			float audibility;
+			if (inst->source->lengthInSamples == 0) {
+				audibility = HUGE_VALF;
+			} else {
+				SoundOpts soundOpts = inst->getOpts();
+				audibility = (soundOpts.volume[0] + soundOpts.volume[1]) * inst->info.priority;
+				if (inst->getFlags() & SoundInstance::Stop) audibility = 0.0f;
+				if (!inst->isVirtual) audibility *= RealVoiceBias;
+			}
+
+			voiceCandidates.push({ audibility, i });
+		}
+
+		sf::sort(voiceCandidates);
+
+		uint32_t maxReal = maxRealVoices;
+		uint32_t numReal = 0;
+		voiceGroups.clear();
+		for (const VoiceCandidate &candidate : voiceCandidates) {
+			SoundInstance *inst = instances[candidate.index];
+
+			if (candidate.audibility == HUGE_VALF) {
+				inst->wantReal = true;
+				numReal++;
+				continue;
+			}
+
+			bool real = numReal < maxReal;
+
+			if (real && inst->group) {
+				VoiceGroup *group = nullptr;
+				for (VoiceGroup &g : voiceGroups) {
+					if (g.group == inst->group) {
+						group = &g;
+						break;
+					}
+				}
+				if (!group) {
+					group = &voiceGroups.push();
+					group->group = inst->group;
+					group->count = 0;
+				}
+
+				uint32_t maxInstances = inst->info.maxInstances ? inst->info.maxInstances : DefaultMaxInstancesPerSound;
+				if (group->count < maxInstances) {
+					group->count++;
+				} else {
+					real = false;
+				}
+			}
+
+			inst->wantReal = real;
+			if (real) numReal++;
+		}
+	}
+
 	void renderAudio(float *finalBuffer, uint32_t numFinalSamples, uint32_t sampleRate)
 	{
 		// Add new sounds
@@ -101,6 +247,8 @@ struct AudioThread
 			}
 		}
 
+		assignVoices();
+
 		SoundInstance *nextOut = nullptr;
 
 		uint32_t numSamples;
@@ -127,12 +275,25 @@ struct AudioThread
 				opts.volumeNext[1] = 0.0f;
 			}
 
-			inst->sampler.advanceMixStereo(dstBuf, numSamples, inst->source, opts);
+			if (inst->wantReal) {
+				inst->isVirtual = false;
+				inst->sampler.advanceMixStereo(dstBuf, numSamples, inst->source, opts);
+			} else if (!inst->isVirtual) {
+				// Fade out before going virtual to avoid popping
+				opts.volumeNext[0] = 0.0f;
+				opts.volumeNext[1] = 0.0f;
+				inst->sampler.advanceMixStereo(dstBuf, numSamples, inst->source, opts);
+				if (inst->sampler.volumeSrc[0] + inst->sampler.volumeSrc[1] <= 0.00001f) {
+					inst->isVirtual = true;
+				}
+			} else {
+				inst->sampler.advanceVirtual(numSamples, inst->source, opts);
+			}
 
 			bool ended = inst->sampler.ended;
 
 			if (flags & SoundInstance::Stop) {
-				if (inst->sampler.volumeSrc[0] + inst->sampler.volumeSrc[1] <= 0.00001f) {
+				if (inst->isVirtual || inst->sampler.volumeSrc[0] + inst->sampler.volumeSrc[1] <= 0.00001f) {
 					ended = true;
 				}
 			}
@@ -152,37 +313,108 @@ struct AudioThread
 		}
 	}
 
-	void pullAudio(float *dstBuf, uint32_t numSamples, uint32_t sampleRate)
+	// Render until there are at least `numTarget` samples in `ring`, requires `mutex`
+	void renderToRing(uint32_t numTarget, uint32_t sampleRate)
+	{
+		numTarget = sf::min(numTarget, AudioRing::NumSamples);
+		for (;;) {
+			uint32_t numBuffered = ring.getNumReadable();
+			if (numBuffered >= numTarget) break;
+			uint32_t num = sf::min(numTarget - numBuffered, MixBlockSamples);
+			renderAudio(mixBuffer, num, sampleRate);
+			ring.write(mixBuffer, num);
+		}
+	}
+
+	static void mixerEntry(void *user)
 	{
+		AudioThread *at = (AudioThread*)user;
+		for (;;) {
+			at->mixerSemaphore.wait();
+			if (mxa_load32_acq(&at->mixerQuit)) break;
+			at->mixAhead();
+		}
+	}
+
+	void mixAhead()
+	{
+		SP_ZONE_FUNC();
+
 		sf::MutexGuard mg(mutex);
-		prevSampleRate = sampleRate;
+		uint32_t rate = mxa_load32_nf(&sampleRate);
+		if (rate == 0) return;
+
+		// Render in whole blocks to keep the per-call overhead down
+		uint32_t numTarget = sf::alignUp(mxa_load32_nf(&targetSamples), MixBlockSamples);
+		renderToRing(sf::min(numTarget, AudioRing::NumSamples - MixBlockSamples), rate);
+	}
+
+	void startMixer()
+	{
+		if (mixerThread) return;
+
+		sf::ThreadDesc desc;
+		desc.entry = &mixerEntry;
+		desc.user = this;
+		desc.name = "Audio Mixer";
+		mixerThread = sf::Thread::start(desc);
+		if (mixerThread) {
+			mxa_or32_rel(&mixerRunning, 1);
+			mixerSemaphore.signal();
+		}
+	}
+
+	void stopMixer()
+	{
+		if (!mixerThread) return;
+
+		mxa_and32_rel(&mixerRunning, 0);
+		mxa_or32_rel(&mixerQuit, 1);
+		mixerSemaphore.signal();
+		sf::Thread::join(mixerThread);
+		mixerThread = nullptr;
+		mxa_and32_rel(&mixerQuit, 0);
+	}
 
-		if (shutdownBuffer.size > 0) {
-			uint32_t numShutdown = sf::min(shutdownBuffer.size / 2, numSamples);
+	// Called from the device callback
+	void pullAudio(float *dstBuf, uint32_t numSamples, uint32_t sampleRate)
+	{
+		uint32_t prevSampleRate = mxa_load32_nf(&this->sampleRate);
+		if (prevSampleRate != sampleRate) mxa_cas32_rel(&this->sampleRate, prevSampleRate, sampleRate);
 
-			memcpy(dstBuf, shutdownBuffer.data, numShutdown * 2 * sizeof(float));
-			shutdownBuffer.removeOrdered(0, numShutdown * 2);
+		uint32_t target = numSamples + 2 * MixBlockSamples;
+		uint32_t prevTarget = mxa_load32_nf(&targetSamples);
+		if (prevTarget != target) mxa_cas32_nf(&targetSamples, prevTarget, target);
+
+		bool mixerActive = mxa_load32_acq(&mixerRunning) != 0;
+		if (!mixerActive) {
+			sf::MutexGuard mg(mutex);
+			renderToRing(numSamples, sampleRate);
+		}
 
-			numSamples -= numShutdown;
-			dstBuf += numShutdown * 2;
+		uint32_t numRead = ring.read(dstBuf, numSamples);
+		if (numRead < numSamples) {
+			memset(dstBuf + numRead * 2, 0, (numSamples - numRead) * 2 * sizeof(float));
 		}
 
-		if (numSamples > 0) {
-			renderAudio(dstBuf, numSamples, sampleRate);
+		if (mixerActive) {
+			mixerSemaphore.signal();
 		}
 	}
 
 	void shutdown()
 	{
+		stopMixer();
+
 		sf::MutexGuard mg(mutex);
-		if (prevSampleRate == 0) return;
+		uint32_t rate = mxa_load32_nf(&sampleRate);
+		if (rate == 0) return;
 
-		shutdownBuffer.clear();
-		shutdownBuffer.resize(ShutdownSamples * 2);
-		renderAudio(shutdownBuffer.data, ShutdownSamples, prevSampleRate);
+		float shutdownBuffer[ShutdownSamples * 2];
+		renderAudio(shutdownBuffer, ShutdownSamples, rate);
 
 		float v = 1.0f, dv = -1.0f / (float)ShutdownSamples;
-		float *dst = shutdownBuffer.data;
+		float *dst = shutdownBuffer;
 		for (uint32_t i = 0; i < ShutdownSamples; i++) {
 			dst[0] *= v;
 			dst[1] *= v;
@@ -190,6 +422,8 @@ struct AudioThread
 			dst += 2;
 		}
 
+		ring.write(shutdownBuffer, sf::min(ShutdownSamples, ring.getNumWritable()));
+
 		limiter.reset();
 		instances.clear();
 		outgoing = nullptr;
@@ -198,7 +432,7 @@ struct AudioThread
 	bool isFinished()
 	{
 		sf::MutexGuard mg(mutex);
-		return shutdownBuffer.size == 0 && instances.size == 0;
+		return ring.getNumReadable() == 0 && instances.size == 0;
 	}
 };
 
@@ -279,12 +513,13 @@ struct AudioSystemImp final : AudioSystem
 		return opts;
 	}
 
-	void playAudioSourceImp(sf::Box<sp::AudioSource> source, const AudioInfo &info, uint32_t entitySoundId)
+	void playAudioSourceImp(sf::Box<sp::AudioSource> source, const AudioInfo &info, uint32_t entitySoundId, const void *group=nullptr)
 	{
 		SoundInstance *inst = allocInstance();
 		if (!inst) return;
 		inst->source = std::move(source);
 		inst->info = info;
+		inst->group = group;
 
 		if (entitySoundId != ~0u) {
 			entitySounds[entitySoundId].instance = inst;
@@ -305,7 +540,7 @@ struct AudioSystemImp final : AudioSystem
 		if (!ref.isLoaded()) return;
 
 		uint32_t index = rng.nextU32() % ref->takes.size;
-		playAudioSourceImp(ref->getSource(index), info, entitySoundId);
+		playAudioSourceImp(ref->getSource(index), info, entitySoundId, (sp::Sound*)ref);
 	}
 
 	void playSoundImp(const sp::SoundRef &sound, const AudioInfo &info, uint32_t entitySoundId, float delay=0.0f)
@@ -354,6 +589,12 @@ struct AudioSystemImp final : AudioSystem
 			soundInstances[i].next = &soundInstances[i + 1];
 		}
 		nextFreeInstance = &soundInstances[0];
+
+		{
+			sf::MutexGuard mg(g_audioThread.mutex);
+			g_audioThread.maxRealVoices = sf::max(g_settings.maxAudioVoices, 1u);
+		}
+		g_audioThread.startMixer();
 	}
 
 	~AudioSystemImp()
@@ -361,20 +602,23 @@ struct AudioSystemImp final : AudioSystem
 		g_audioThread.shutdown();
 	}
 
-	sf::Box<void> preloadSound(const sv::SoundComponent &c) override
+	sf::Box<void> preloadSound(sf::Array<sp::Asset*> &assets, const sv::SoundComponent &c) override
 	{
 		auto data = sf::box<SoundComponentData>();
 		data->refs.reserve(c.sounds.size);
 		for (const sv::SoundInfo &info : c.sounds) {
-			data->refs.push().load(info.assetName);
+			sp::SoundRef &ref = data->refs.push();
+			ref.load(info.assetName);
+			assets.push(ref);
 		}
 		return data;
 	}
 
-	sf::Box<void> preloadSound(const sv::SoundEffect &effect) override
+	sf::Box<void> preloadSound(sf::Array<sp::Asset*> &assets, const sv::SoundEffect &effect) override
 	{
 		auto data = sf::box<SoundEffectData>();
 		data->ref.load(effect.soundName);
+		assets.push(data->ref);
 		return data;
 	}
 
@@ -461,6 +705,8 @@ struct AudioSystemImp final : AudioSystem
 		info.volume = c.volume + c.volumeVariance * rng.nextFloat();
 		info.pitch = c.pitch + c.pitchVariance * rng.nextFloat();
 		info.loop = c.loop;
+		info.priority = c.priority;
+		info.maxInstances = c.maxInstances;
 		playSoundImp(sound, info, entitySoundId);
 
 		systems.entities.addComponent(entityId, this, entitySoundId, 0, componentIndex, Entity::UpdateTransform);
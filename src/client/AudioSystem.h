@@ -18,14 +18,16 @@ struct AudioInfo
 	bool loop = false;
 	bool follow = true;
 	bool positional = true;
+	float priority = 1.0f;
+	uint32_t maxInstances = 0; // < Audible instances of the same sound, zero for default
 };
 
 struct AudioSystem : EntitySystem
 {
 	static sf::Box<AudioSystem> create(const SystemsDesc &desc);
 
-	virtual sf::Box<void> preloadSound(const sv::SoundComponent &c) = 0;
-	virtual sf::Box<void> preloadSound(const sv::SoundEffect &effect) = 0;
+	virtual sf::Box<void> preloadSound(sf::Array<sp::Asset*> &assets, const sv::SoundComponent &c) = 0;
+	virtual sf::Box<void> preloadSound(sf::Array<sp::Asset*> &assets, const sv::SoundEffect &effect) = 0;
 
 	virtual void playOneShot(sf::Box<sp::AudioSource> source, const AudioInfo &info) = 0;
 	virtual void playOneShot(const sp::SoundRef &sound, const AudioInfo &info) = 0;
@@ -14,9 +14,11 @@
 #include "client/GIMaterial.h"
 
 #include "sf/Array.h"
+#include "sf/Float8.h"
 
 #include "sp/Model.h"
 #include "sp/Animation.h"
+#include "sp/JobSystem.h"
 
 #include "sf/Random.h"
 
@@ -26,6 +28,23 @@
 
 namespace cl {
 
+struct AnimationLod
+{
+	float minPixels;      // < Minimum projected height to use this level
+	uint32_t interval;    // < Evaluate the pose every N frames and interpolate in between
+	uint32_t giInterval;  // < Re-skin GI vertices every N frames
+	bool boneSubset;      // < Keep small leaf bones (fingers, face, etc) in bind pose
+};
+
+static const AnimationLod animationLods[] = {
+	{ 200.0f, 1, 2, false },
+	{ 80.0f, 2, 4, false },
+	{ 0.0f, 4, 8, true },
+};
+
+// Bones need at least this many descendants in a chain to be animated at `boneSubset` levels
+static const uint32_t AnimationLodMinBoneHeight = 2;
+
 struct CharacterModelSystemImp final : CharacterModelSystem
 {
 	static const constexpr uint32_t MaxGIVertices = 0x10000;
@@ -35,6 +54,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 	{
 		sp::AnimationRef animation;
 		sf::Array<uint32_t> boneMapping;
+		sf::Array<uint32_t> lodBoneMapping;
 		sf::Array<sf::Symbol> tags;
 		sf::Array<sv::AnimationEvent> events;
 		float weight;
@@ -134,6 +154,9 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		sf::Array<sf::Symbol> oneShotTags;
 		bool needStateUpdate = false;
 
+		// Per-model so animation choices don't depend on update order
+		sf::Random rng;
+
 		sf::Array<sf::Symbol> frameEvents;
 
 		sf::Array<uint32_t> giBoneMapping;
@@ -147,6 +170,18 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		double lastUpdateTime = 0.0;
 		bool hasBeenUpdated = false;
 
+		// Animation LOD, `lodPrevPose` and `lodPose` are the last two evaluated
+		// poses that get interpolated between at reduced update rates.
+		uint32_t lodLevel = 0;
+		uint32_t lodFrame = 0;
+		bool lodPoseValid = false;
+		sf::Array<sp::BoneTransform> lodPrevPose;
+		sf::Array<sp::BoneTransform> lodPose;
+		sf::Array<uint32_t> lodExcludedBones;
+
+		uint32_t giSkinFrame = 0;
+		bool giSkinned = false;
+
 		bool isLoading() const {
 			for (const Animation &anim : animations) {
 				if (anim.animation.isLoading()) return true;
@@ -198,12 +233,12 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		sf::Array<sf::Symbol> animationTags;
 	};
 
+	// Scratch memory for one job thread
 	struct AnimWorkCtx
 	{
-		double updateTime = 0.0;
-		sf::Random rng;
 		sf::Array<sp::BoneTransform> boneTransforms;
 		sf::Array<sp::BoneTransform> tempBoneTransforms;
+		sp::AnimationContext animContext; // < Clips are shared so each worker needs its own
 	};
 
 	struct BoneListener
@@ -222,6 +257,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 	sf::Array<uint32_t> freeBoneListenerIds;
 
 	sf::Array<uint32_t> attachmentsToUpdate;
+	sf::Array<EntityTransform> attachmentTransforms;
 	uint32_t hiddenModelUpdateIndex = 0;
 
 	sf::Array<uint32_t> loadQueue;
@@ -238,7 +274,9 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 	Shader2 skinShader;
 	sp::Pipeline skinPipe;
 
-	AnimWorkCtx animCtx;
+	double animUpdateTime = 0.0;
+	sf::Random animRng;
+	sf::Array<AnimWorkCtx> animWorkCtx;
 
 	sp::ModelProps getGiLoadProps()
 	{
@@ -256,11 +294,11 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		}
 	}
 
-	void updateAttachmentTransformImp(Systems &systems, Attachment &attach, Model &model)
+	void updateAttachmentTransformImp(sf::Array<EntityTransform> &dst, Attachment &attach, Model &model)
 	{
-		float dt = (float)(animCtx.updateTime - model.lastUpdateTime);
+		float dt = (float)(animUpdateTime - model.lastUpdateTime);
 		if (attach.boneIndex == ~0u || dt > 0.2f || !model.hasBeenUpdated) {
-			hideAttachmentImp(systems, attach, model);
+			hideAttachmentImp(dst, attach, model);
 			return;
 		}
 
@@ -276,15 +314,15 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		transform.position = childToWorld.cols[3];
 		transform.rotation = sf::axesToQuat(x, y, z);
 		transform.scale = scale * attach.scale;
-		systems.entities.updateTransform(systems, attach.entityId, transform);
+		dst.push({ attach.entityId, transform });
 	}
 
-	void hideAttachmentImp(Systems &systems, Attachment &attach, Model &model)
+	void hideAttachmentImp(sf::Array<EntityTransform> &dst, Attachment &attach, Model &model)
 	{
 		Transform transform;
 		transform.position = model.bounds.origin;
 		transform.scale = 0.0f;
-		systems.entities.updateTransform(systems, attach.entityId, transform);
+		dst.push({ attach.entityId, transform });
 	}
 
 	void finishLoadingAttachmentImp(Attachment &attach, Model &model)
@@ -302,6 +340,52 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		}
 	}
 
+	// Find the bones that can be left in bind pose for far away models,
+	// bones that have something attached or listening to them are kept.
+	void updateLodBonesImp(Model &model)
+	{
+		const sf::Array<sp::Bone> &bones = model.model->bones;
+		uint32_t numBones = bones.size;
+
+		sf::SmallArray<uint32_t, sp::MaxBones> height;
+		sf::SmallArray<bool, sp::MaxBones> keep;
+		height.resize(numBones);
+		keep.resize(numBones);
+
+		for (uint32_t i = numBones; i-- > 0; ) {
+			uint32_t parentIx = bones[i].parentIx;
+			if (parentIx < numBones) {
+				height[parentIx] = sf::max(height[parentIx], height[i] + 1);
+			}
+			keep[i] = height[i] >= AnimationLodMinBoneHeight;
+		}
+
+		for (auto &pair : model.attachBones) {
+			if (pair.val.boneIndex < numBones) keep[pair.val.boneIndex] = true;
+		}
+		for (const ModelBoneListener &listener : model.listeners) {
+			if (listener.boneIndex < numBones) keep[listener.boneIndex] = true;
+		}
+
+		// Bones are sorted parent first so this propagates all the way up
+		for (uint32_t i = numBones; i-- > 0; ) {
+			uint32_t parentIx = bones[i].parentIx;
+			if (keep[i] && parentIx < numBones) keep[parentIx] = true;
+		}
+
+		model.lodExcludedBones.clear();
+		for (uint32_t i = 0; i < numBones; i++) {
+			if (!keep[i]) model.lodExcludedBones.push(i);
+		}
+
+		for (Animation &anim : model.animations) {
+			anim.lodBoneMapping = anim.boneMapping;
+			for (uint32_t &ix : anim.lodBoneMapping) {
+				if (ix != ~0u && !keep[ix]) ix = ~0u;
+			}
+		}
+	}
+
 	void finishLoadingModel(AreaSystem *areaSystem, uint32_t modelId)
 	{
 		Model &model = models[modelId];
@@ -332,6 +416,8 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 			finishLoadingListenerImp(listener, model);
 		}
 
+		updateLodBonesImp(model);
+
 		if (model.giModel) {
 			if (model.giModel->meshes.size == 0 || !model.giModel->meshes[0].cpuIndexData16 || !model.giMaterial) {
 				model.giModel.reset();
@@ -389,7 +475,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		return t;
 	}
 
-	void updateAnimationStateImp(AnimWorkCtx &ctx, Model &model, float dt)
+	void updateAnimationStateImp(Model &model, float dt)
 	{
 		if (model.animations.size == 0) return;
 
@@ -406,7 +492,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 				}
 			}
 
-			score += (double)anim.weight * (double)ctx.rng.nextFloat() * 0.01;
+			score += (double)anim.weight * (double)model.rng.nextFloat() * 0.01;
 
 			if (score > bestScore) {
 				bestScore = score;
@@ -416,7 +502,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 
 		Animation &nextAnim = model.animations[bestAnim];
 		float nextDuration = nextAnim.animation->duration;
-		float speed = nextAnim.speed + ctx.rng.nextFloat() * nextAnim.speedVariation;
+		float speed = nextAnim.speed + model.rng.nextFloat() * nextAnim.speedVariation;
 
 		bool simulateCatchUp = false;
 
@@ -471,7 +557,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		if (nextAnim.loop || simulateCatchUp) {
 			float timeRange = nextDuration - nextAnim.fadeOutTime * 1.25f;
 			if (timeRange > 0.0f) {
-				next.time = ctx.rng.nextFloat() * timeRange;
+				next.time = model.rng.nextFloat() * timeRange;
 			}
 		}
 	}
@@ -489,7 +575,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		tagWeights[sf::Symbol("Opening")] = 100.0;
 		tagWeights[sf::Symbol("Open")] = 100.0;
 		tagWeights[sf::Symbol("Use")] = 100.0;
-		animCtx.rng = sf::Random(desc.seed[0], 756789);
+		animRng = sf::Random(desc.seed[0], 756789);
 
 		uint8_t permutation[SP_NUM_PERMUTATIONS] = { };
 		#if CL_SHADOWCACHE_USE_ARRAY
@@ -517,7 +603,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		giVertexBuffer.initDynamicVertex("CharacterModel giVertexBuffer", MaxGIVertices * sizeof(GIVertexDst));
 	}
 
-	sf::Box<void> preloadCharacterModel(const sv::CharacterModelComponent &c) override
+	sf::Box<void> preloadCharacterModel(sf::Array<sp::Asset*> &assets, const sv::CharacterModelComponent &c) override
 	{
 		auto data = sf::box<CharacterModelData>();
 		data->model.load(c.modelName);
@@ -536,6 +622,12 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 			if (!material.material) continue;
 			data->materials.push().load(material.material);
 		}
+
+		if (data->model) assets.push(data->model);
+		if (data->giModel) assets.push(data->giModel);
+		if (data->giMaterial) assets.push(data->giMaterial);
+		for (sp::AnimationRef &ref : data->animations) assets.push(ref);
+		for (MeshMaterialRef &ref : data->materials) assets.push(ref);
 		return data;
 	}
 
@@ -554,7 +646,8 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		model.modelToEntity = sf::mat::scale(0.01f * c.scale);
 		model.modelToWorld = transform.asMatrix() * model.modelToEntity;
 
-		model.lastUpdateTime = animCtx.updateTime;
+		model.lastUpdateTime = animUpdateTime;
+		model.rng = sf::Random(animRng.nextU32(), 756789);
 
 		model.model.load(c.modelName);
 		for (auto &material : c.materials) {
@@ -635,12 +728,14 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 					model.addTag(tag);
 				}
 
+				sf::SmallArray<EntityTransform, 1> transforms;
 				if (model.loadQueueIndex == ~0u && model.model.isLoaded()) {
 					finishLoadingAttachmentImp(attach, model);
-					updateAttachmentTransformImp(systems, attach, model);
+					updateAttachmentTransformImp(transforms, attach, model);
 				} else {
-					hideAttachmentImp(systems, attach, model);
+					hideAttachmentImp(transforms, attach, model);
 				}
+				systems.entities.updateTransforms(systems, transforms);
 
 				systems.entities.addComponent(childEntityId, this, attachId, 1, 0xff, 0);
 
@@ -676,6 +771,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 
 				if (model.loadQueueIndex == ~0u && model.model.isLoaded()) {
 					finishLoadingListenerImp(modelListener, model);
+					updateLodBonesImp(model);
 				}
 
 				if (modelListener.boneIndex != ~0u) {
@@ -761,166 +857,279 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 		}
 	}
 
-	void updateAnimations(const VisibleAreas &activeAreas, float realDt) override
+	uint32_t selectLodLevel(const Model &model, const RenderArgs &renderArgs)
 	{
-		AnimWorkCtx &ctx = animCtx;
+		float dist = sf::max(sf::length(model.bounds.origin - renderArgs.cameraPosition), 0.01f);
+		float radius = sf::length(model.bounds.extent);
+		float pixels = radius / dist * renderArgs.viewToClip.m11 * (float)renderArgs.renderResolution.y;
+
+		uint32_t level = 0;
+		while (level + 1 < sf_arraysize(animationLods)) {
+			// Hysteresis: Require some margin before reducing detail
+			float minPixels = animationLods[level].minPixels;
+			if (level >= model.lodLevel) minPixels *= 0.8f;
+			if (pixels >= minPixels) break;
+			level++;
+		}
+		return level;
+	}
 
-		ctx.updateTime += realDt;
+	// Evaluate the current pose of `model` to `ctx.boneTransforms`
+	void evaluatePoseImp(AnimWorkCtx &ctx, Model &model, bool boneSubset)
+	{
+		uint32_t numBones = model.model->bones.size;
+		ctx.boneTransforms.clear();
+		ctx.boneTransforms.resize(numBones);
+		if (boneSubset) {
+			for (uint32_t boneIx : model.lodExcludedBones) {
+				ctx.boneTransforms[boneIx] = model.model->bones[boneIx].bindTransform;
+			}
+		}
 
-		for (uint32_t modelId : activeAreas.get(AreaGroup::CharacterModel)) {
-			Model &model = models[modelId];
+		for (uint32_t i = 0; i < model.activeAnimations.size; i++) {
+			ActiveAnimation &active = model.activeAnimations[i];
+			Animation &anim = model.animations[active.animIndex];
+			sf::Slice<const uint32_t> boneMapping = boneSubset ? anim.lodBoneMapping : anim.boneMapping;
 
-			float dt = (float)(ctx.updateTime - model.lastUpdateTime);
-			model.lastUpdateTime = ctx.updateTime;
-			model.hasBeenUpdated = true;
+			// ImGui::Text("%+.2f/%.2f (%.2fx %.2f alpha)  %s", active.time, anim.animation->duration, active.speed, active.alpha, anim.animation->name.data);
 
-			model.frameEvents.clear();
+			float duration = anim.animation->duration;
+			float t = wrapTime(active.time, duration);
 
-			ctx.boneTransforms.clear();
-			ctx.boneTransforms.resize(model.model->bones.size);
+			float a = active.alpha;
+			a = a * a * (3.0f - 2.0f * a);
 
-			bool needStateUpdate = model.needStateUpdate;
-			model.needStateUpdate = false;
+			const float loopFadeDuration = 1.0f/30.0f;
+			float left = duration - t;
+			if (anim.loop && left < loopFadeDuration) {
+				ctx.tempBoneTransforms.clear();
+				ctx.tempBoneTransforms.resize(numBones);
+				if (boneSubset) {
+					for (uint32_t boneIx : model.lodExcludedBones) {
+						ctx.tempBoneTransforms[boneIx] = model.model->bones[boneIx].bindTransform;
+					}
+				}
 
-			if (model.oneShotTags.size > 0) {
-				needStateUpdate = true;
-			}
+				float endAlpha = 1.0f - left / loopFadeDuration;
+				anim.animation->evaluate(ctx.animContext, t, boneMapping, ctx.tempBoneTransforms);
+				anim.animation->evaluate(ctx.animContext, 0.0f, boneMapping, ctx.tempBoneTransforms, endAlpha);
 
-			if (model.activeAnimations.size == 0) {
-				needStateUpdate = true;
+				sp::blendBoneTransform(ctx.boneTransforms, ctx.tempBoneTransforms, a);
+
+			} else if (i == 0 || active.alpha >= 0.9999f) {
+				anim.animation->evaluate(ctx.animContext, t, boneMapping, ctx.boneTransforms);
 			} else {
-				ActiveAnimation &top = model.activeAnimations.back();
-				Animation &topAnim = model.animations[top.animIndex];
-				float threshold = topAnim.animation->duration - topAnim.fadeOutTime;
-				if (top.time >= threshold) {
-					needStateUpdate = true;
-				}
+				anim.animation->evaluate(ctx.animContext, t, boneMapping, ctx.boneTransforms, a);
 			}
+		}
+	}
 
-			if (needStateUpdate) {
-				for (const sf::Symbol &tag : model.oneShotTags) {
-					model.addTag(tag);
+	// Advance animation time, fades and events, this runs every frame
+	// regardless of LOD so events fire at the right time.
+	void advanceAnimationsImp(Model &model, float dt)
+	{
+		for (uint32_t i = 0; i < model.activeAnimations.size; i++) {
+			ActiveAnimation &active = model.activeAnimations[i];
+			Animation &anim = model.animations[active.animIndex];
+
+			float prevTime = active.time;
+			active.time += dt * active.speed;
+
+			for (sv::AnimationEvent &ev : anim.events) {
+				if (prevTime <= ev.time && active.time > ev.time) {
+					model.frameEvents.push(ev.name);
 				}
+			}
 
-				updateAnimationStateImp(ctx, model, dt);
+			if (active.alpha < 1.0f) {
+				active.alpha += dt * active.alphaVelocity;
+				if (active.alpha >= 1.0f) {
+					active.alpha = 1.0f;
+					if (i > 0) {
+						for (uint32_t remI = 0; remI < i; remI++) {
+							ActiveAnimation &rem = model.activeAnimations[remI];
+							Animation &remAnim = model.animations[rem.animIndex];
+							for (sv::AnimationEvent &ev : remAnim.events) {
+								if (rem.time <= ev.time) {
+									model.frameEvents.push(ev.name);
+								}
+							}
+						}
 
-				for (const sf::Symbol &tag : model.oneShotTags) {
-					model.removeTag(tag);
+						model.activeAnimations.removeOrdered(0, i);
+						i = 0;
+					}
 				}
-				model.oneShotTags.clear();
 			}
+		}
+	}
 
-			for (uint32_t i = 0; i < model.activeAnimations.size; i++) {
-				ActiveAnimation &active = model.activeAnimations[i];
-				Animation &anim = model.animations[active.animIndex];
+	void skinGIVerticesImp(Model &model)
+	{
+		const GIVertexSrc *src = model.giVertexSrc.data, *srcEnd = src + model.giVertexSrc.size;
+		GIVertexDst *dst = model.giVertexDst.data;
+		sf::Mat34 *boneToWorld = model.boneToWorld.data;
+		sf::Vec2 uvBase = model.giMaterial->uvBase;
+		sf::Vec2 uvScale = model.giMaterial->uvScale;
+
+		sf::SmallArray<sf::Mat34, 64> meshToWorld;
+		meshToWorld.resizeUninit(model.giBoneMapping.size);
+		sf::Slice<const sp::MeshBone> srcBones = model.giModel->meshes[0].bones;
+		for (size_t i = 0; i < meshToWorld.size; i++) {
+			uint32_t boneIndex = model.giBoneMapping[i];
+			if (boneIndex != ~0u) {
+				meshToWorld[i] = boneToWorld[boneIndex] * srcBones[i].meshToBone;
+			} else {
+				meshToWorld[i] = sf::Mat34();
+			}
+		}
 
-				// ImGui::Text("%+.2f/%.2f (%.2fx %.2f alpha)  %s", active.time, anim.animation->duration, active.speed, active.alpha, anim.animation->name.data);
+		// Skin two vertices at a time, one per half of `sf::Float8`,
+		// an odd last vertex is paired with itself
+		while (src != srcEnd) {
+			const GIVertexSrc &va = src[0];
+			const GIVertexSrc &vb = src + 1 != srcEnd ? src[1] : src[0];
+			const sf::Mat34 &ta = meshToWorld[va.boneIndex[0]];
+			const sf::Mat34 &tb = meshToWorld[vb.boneIndex[0]];
+			sf::Float8 col0 = sf::Float8(sf::Float4::loadu(ta.cols[0].v), sf::Float4::loadu(tb.cols[0].v));
+			sf::Float8 col1 = sf::Float8(sf::Float4::loadu(ta.cols[1].v), sf::Float4::loadu(tb.cols[1].v));
+			sf::Float8 col2 = sf::Float8(sf::Float4::loadu(ta.cols[2].v), sf::Float4::loadu(tb.cols[2].v));
+			sf::Float8 col3 = sf::Float8(sf::Float4::loadu(ta.cols[3].v), sf::Float4::loadu(tb.cols[3].v));
+			const sf::Vec3 &pa = va.position, &pb = vb.position;
+			const sf::Vec3 &na = va.normal, &nb = vb.normal;
+
+			sf::Float8 tp = col0*sf::Float8(pa.x, pb.x) + col1*sf::Float8(pa.y, pb.y) + col2*sf::Float8(pa.z, pb.z) + col3;
+			sf::Float8 tn = col0*sf::Float8(na.x, nb.x) + col1*sf::Float8(na.y, nb.y) + col2*sf::Float8(na.z, nb.z);
+			tn *= sf::broadcastRcpLengthXYZ(tn);
+
+			// Pack to unrom
+			tn = tn * 0.5f + 0.5f;
+
+			uint32_t num = src + 1 != srcEnd ? 2 : 1;
+			sf::Float4 tps[2] = { tp.getLo(), tp.getHi() };
+			sf::Float4 tns[2] = { tn.getLo(), tn.getHi() };
+			for (uint32_t i = 0; i < num; i++) {
+				dst->position = tps[i].asVec3();
+				dst->normal = tns[i].asVec3();
+				dst->uv = src->uv * uvScale + uvBase;
+				dst->tint = ~0u;
+				src++;
+				dst++;
+			}
+		}
+	}
 
-				float duration = anim.animation->duration;
-				float t = wrapTime(active.time, duration);
+	// Evaluate the animations of a single model, only touches `model` and `ctx`
+	// so this can run for multiple models in parallel
+	void updateModelAnimationImp(AnimWorkCtx &ctx, Model &model, const RenderArgs &renderArgs)
+	{
+		float dt = (float)(animUpdateTime - model.lastUpdateTime);
+		model.lastUpdateTime = animUpdateTime;
+		model.hasBeenUpdated = true;
 
-				float a = active.alpha;
-				a = a * a * (3.0f - 2.0f * a);
+		model.frameEvents.clear();
 
-				const float loopFadeDuration = 1.0f/30.0f;
-				float left = duration - t;
-				if (anim.loop && left < loopFadeDuration) {
-					ctx.tempBoneTransforms.clear();
-					ctx.tempBoneTransforms.resize(model.model->bones.size);
+		bool needStateUpdate = model.needStateUpdate;
+		model.needStateUpdate = false;
 
-					float endAlpha = 1.0f - left / loopFadeDuration;
-					anim.animation->evaluate(t, anim.boneMapping, ctx.tempBoneTransforms);
-					anim.animation->evaluate(0.0f, anim.boneMapping, ctx.tempBoneTransforms, endAlpha);
+		if (model.oneShotTags.size > 0) {
+			needStateUpdate = true;
+		}
 
-					sp::blendBoneTransform(ctx.boneTransforms, ctx.tempBoneTransforms, a);
+		if (model.activeAnimations.size == 0) {
+			needStateUpdate = true;
+		} else {
+			ActiveAnimation &top = model.activeAnimations.back();
+			Animation &topAnim = model.animations[top.animIndex];
+			float threshold = topAnim.animation->duration - topAnim.fadeOutTime;
+			if (top.time >= threshold) {
+				needStateUpdate = true;
+			}
+		}
 
-				} else if (i == 0 || active.alpha >= 0.9999f) {
-					anim.animation->evaluate(t, anim.boneMapping, ctx.boneTransforms);
-				} else {
-					anim.animation->evaluate(t, anim.boneMapping, ctx.boneTransforms, a);
-				}
+		if (needStateUpdate) {
+			for (const sf::Symbol &tag : model.oneShotTags) {
+				model.addTag(tag);
+			}
 
-				float prevTime = active.time;
-				active.time += dt * active.speed;
+			updateAnimationStateImp(model, dt);
 
-				for (sv::AnimationEvent &ev : anim.events) {
-					if (prevTime <= ev.time && active.time > ev.time) {
-						model.frameEvents.push(ev.name);
-					}
-				}
+			for (const sf::Symbol &tag : model.oneShotTags) {
+				model.removeTag(tag);
+			}
+			model.oneShotTags.clear();
+		}
 
-				if (active.alpha < 1.0f) {
-					active.alpha += dt * active.alphaVelocity;
-					if (active.alpha >= 1.0f) {
-						active.alpha = 1.0f;
-						if (i > 0) {
-							for (uint32_t remI = 0; remI < i; remI++) {
-								ActiveAnimation &rem = model.activeAnimations[remI];
-								Animation &remAnim = model.animations[rem.animIndex];
-								for (sv::AnimationEvent &ev : remAnim.events) {
-									if (rem.time <= ev.time) {
-										model.frameEvents.push(ev.name);
-									}
-								}
-							}
+		uint32_t lodLevel = selectLodLevel(model, renderArgs);
+		const AnimationLod &lod = animationLods[lodLevel];
+		bool lodChanged = lodLevel != model.lodLevel;
+		model.lodLevel = lodLevel;
 
-							model.activeAnimations.removeOrdered(0, i);
-							i = 0;
-						}
-					}
-				}
+		// Stagger reduced rate updates of different models across frames
+		uint32_t modelId = (uint32_t)(&model - models.data);
+
+		if (lod.interval == 1) {
+			evaluatePoseImp(ctx, model, lod.boneSubset);
+			model.lodPoseValid = false;
+		} else {
+			// Don't interpolate from stale poses of models that were hidden for a while
+			if (dt >= 0.2f) model.lodPoseValid = false;
+
+			bool evaluate = true;
+			if (model.lodPoseValid && !lodChanged) {
+				evaluate = ++model.lodFrame >= lod.interval;
 			}
 
-			sp::boneTransformToWorld(model.model, model.boneToWorld, ctx.boneTransforms, model.modelToWorld);
-
-			// Update GI vertices
-			// TODO: Amortize by not doing this every frame?
-			if (model.giVertexSrc.size > 0) {
-				const GIVertexSrc *src = model.giVertexSrc.data, *srcEnd = src + model.giVertexSrc.size;
-				GIVertexDst *dst = model.giVertexDst.data;
-				sf::Mat34 *boneToWorld = model.boneToWorld.data;
-				sf::Vec2 uvBase = model.giMaterial->uvBase;
-				sf::Vec2 uvScale = model.giMaterial->uvScale;
-
-				sf::SmallArray<sf::Mat34, 64> meshToWorld;
-				meshToWorld.resizeUninit(model.giBoneMapping.size);
-				sf::Slice<const sp::MeshBone> srcBones = model.giModel->meshes[0].bones;
-				for (size_t i = 0; i < meshToWorld.size; i++) {
-					uint32_t boneIndex = model.giBoneMapping[i];
-					if (boneIndex != ~0u) {
-						meshToWorld[i] = boneToWorld[boneIndex] * srcBones[i].meshToBone;
-					} else {
-						meshToWorld[i] = sf::Mat34();
-					}
+			if (evaluate) {
+				evaluatePoseImp(ctx, model, lod.boneSubset);
+				if (model.lodPoseValid) {
+					model.lodPrevPose = model.lodPose;
+					model.lodFrame = 0;
+				} else {
+					model.lodPrevPose = ctx.boneTransforms;
+					model.lodFrame = modelId % lod.interval;
 				}
+				model.lodPose = ctx.boneTransforms;
+				model.lodPoseValid = true;
+			}
 
-				while (src != srcEnd) {
-					sf::Mat34 &transform = meshToWorld[src->boneIndex[0]];
-					sf::Float4 col0 = sf::Float4::loadu(transform.cols[0].v);
-					sf::Float4 col1 = sf::Float4::loadu(transform.cols[1].v);
-					sf::Float4 col2 = sf::Float4::loadu(transform.cols[2].v);
-					sf::Float4 col3 = sf::Float4::loadu(transform.cols[3].v);
-					const sf::Vec3 &vp = src->position;
-					const sf::Vec3 &vn = src->normal;
-
-					sf::Float4 tp = col0*vp.x + col1*vp.y + col2*vp.z + col3;
-					sf::Float4 tn = col0*vn.x + col1*vn.y + col2*vn.z;
-					tn *= sf::broadcastRcpLengthXYZ(tn);
-
-					// Pack to unrom
-					tn = tn * 0.5f + 0.5f;
-
-					dst->position = tp.asVec3();
-					dst->normal = tn.asVec3();
-					dst->uv = src->uv * uvScale + uvBase;
-					dst->tint = ~0u;
-					src++;
-					dst++;
-				}
+			// Interpolate towards the latest pose, lags behind by up to `lod.interval` frames
+			float alpha = (float)(model.lodFrame + 1) / (float)lod.interval;
+			ctx.boneTransforms = model.lodPrevPose;
+			sp::blendBoneTransform(ctx.boneTransforms, model.lodPose, alpha);
+		}
+
+		advanceAnimationsImp(model, dt);
+
+		sp::boneTransformToWorld(model.model, model.boneToWorld, ctx.boneTransforms, model.modelToWorld);
+
+		if (model.giVertexSrc.size > 0) {
+			if (!model.giSkinned) {
+				model.giSkinFrame = modelId % lod.giInterval;
+				model.giSkinned = true;
+				skinGIVerticesImp(model);
+			} else if (++model.giSkinFrame >= lod.giInterval) {
+				model.giSkinFrame = 0;
+				skinGIVerticesImp(model);
 			}
+		}
+	}
 
-			// TODO(threads): Mutex
-			attachmentsToUpdate.push(model.attachIds);
+	void updateAnimations(const VisibleAreas &activeAreas, const FrameArgs &frameArgs) override
+	{
+		animUpdateTime += frameArgs.dt;
+
+		animWorkCtx.resize(sp::JobSystem::getNumThreads());
+
+		sf::Slice<const uint32_t> modelIds = activeAreas.get(AreaGroup::CharacterModel);
+		const RenderArgs &renderArgs = frameArgs.mainRenderArgs;
+		sp::JobSystem::parallelForFunc(modelIds.size, [&](uint32_t index, uint32_t threadIndex) {
+			updateModelAnimationImp(animWorkCtx[threadIndex], models[modelIds[index]], renderArgs);
+		});
+
+		// Gather in visibility order so the result doesn't depend on scheduling
+		for (uint32_t modelId : modelIds) {
+			attachmentsToUpdate.push(models[modelId].attachIds);
 		}
 	}
 
@@ -939,11 +1148,13 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 
 	void updateAttachedEntities(Systems &systems) override
 	{
+		attachmentTransforms.clear();
+
 		for (uint32_t attachId : attachmentsToUpdate) {
 			Attachment &attach = attachments[attachId];
 			if (attach.boneIndex == ~0u || attach.modelId == ~0u) continue;
 			Model &model = models[attach.modelId];
-			updateAttachmentTransformImp(systems, attach, model);
+			updateAttachmentTransformImp(attachmentTransforms, attach, model);
 		}
 
 		// Periodically update hidden models
@@ -955,15 +1166,16 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 			}
 
 			Model &model = models[ix];
-			float dt = (float)(animCtx.updateTime - model.lastUpdateTime);
+			float dt = (float)(animUpdateTime - model.lastUpdateTime);
 			if (model.hasBeenUpdated && dt < 0.2f) continue;
 
 			for (uint32_t attachId : model.attachIds) {
 				Attachment &attach = attachments[attachId];
-				hideAttachmentImp(systems, attach, model);
+				hideAttachmentImp(attachmentTransforms, attach, model);
 			}
 		}
 
+		systems.entities.updateTransforms(systems, attachmentTransforms);
 		attachmentsToUpdate.clear();
 	}
 
@@ -1029,7 +1241,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 			if (ec.system == this && ec.subsystemIndex == 0) {
 				uint32_t modelId = ec.userId;
 				Model &model = models[modelId];
-				if (model.lastUpdateTime == animCtx.updateTime) {
+				if (model.lastUpdateTime == animUpdateTime) {
 					events.push(model.frameEvents);
 				}
 			}
@@ -1232,12 +1444,7 @@ struct CharacterModelSystemImp final : CharacterModelSystem
 				bindUniformVS(skinShader, bones);
 
 				pointLights.clear();
-				lightSystem->queryVisiblePointLights(visibleAreas, pointLights, model.bounds);
-
-				// TODO: Prioritize
-				if (pointLights.size > maxLights) {
-					pointLights.resizeUninit(maxLights);
-				}
+				lightSystem->queryGridLights(pointLights, maxLights, model.bounds);
 
 				float highlightFade = sf::max(0.0f, 1.0f - (float)(frameArgs.gameTime - model.highlightTime) * 5.0f);
 
@@ -22,7 +22,7 @@ struct CharacterModelSystem : EntitySystem
 		sf::Slice<const sf::Symbol> animationTags;
 	};
 
-	virtual sf::Box<void> preloadCharacterModel(const sv::CharacterModelComponent &c) = 0;
+	virtual sf::Box<void> preloadCharacterModel(sf::Array<sp::Asset*> &assets, const sv::CharacterModelComponent &c) = 0;
 
 	static sf::Box<CharacterModelSystem> create(const SystemsDesc &desc);
 
@@ -33,7 +33,7 @@ struct CharacterModelSystem : EntitySystem
 	virtual uint32_t addBoneListener(Systems &systems, uint32_t parentEntityId, const sf::Symbol &boneName, BoneUpdates::Group group, uint32_t userId) = 0;
 	virtual void freeBoneListener(uint32_t listenerId) = 0;
 
-	virtual void updateAnimations(const VisibleAreas &activeAreas, float dt) = 0;
+	virtual void updateAnimations(const VisibleAreas &activeAreas, const FrameArgs &frameArgs) = 0;
 	virtual void updateBoneListeners(BoneUpdates &boneUpdates, const VisibleAreas &activeAreas) = 0;
 	virtual void updateAttachedEntities(Systems &systems) = 0;
 	virtual void updateLoadQueue(AreaSystem *areaSystem) = 0;
@@ -4,6 +4,7 @@
 #include "sf/Array.h"
 #include "server/Message.h"
 #include "sp/Renderer.h"
+#include "sp/FrameGraph.h"
 
 #include "game/LocalServer.h"
 #include "game/shader/GameShaders.h"
@@ -229,12 +230,8 @@ struct Client
 	sf::Box<cl::ClientState> clState;
 
 	// Render targets/passes
-	sp::RenderTarget mainTarget;
-	sp::RenderTarget mainDepth;
-	sp::RenderTarget fxaaTarget;
-	sp::RenderPass mainPass;
-	sp::RenderPass tonemapPass;
-	sp::RenderPass fxaaPass;
+	sp::FrameGraph frameGraph;
+	sf::Vec2i mainResolution;
 
 	// Pipelines
 	sp::Pipeline fxaaPipe;
@@ -310,23 +307,12 @@ static void recreateTargets(Client *c, const sf::Vec2i &systemRes)
 
 	sf::Vec2i mainRes = sf::Vec2i(sf::Vec2(systemRes) * scale);
 
-	int mainSamples = c->msaaSamples;
-	sg_pixel_format mainFormat = SG_PIXELFORMAT_RGBA8;
-	sg_pixel_format mainDepthFormat = SG_PIXELFORMAT_DEPTH_STENCIL;
+	// Targets themselves are allocated by `frameGraph`, stale ones get
+	// released after a few frames of not being used.
+	c->mainResolution = mainRes;
 
-	c->mainTarget.init("mainTarget", mainRes, mainFormat, mainSamples);
-	c->mainDepth.init("mainDepth", mainRes, mainDepthFormat, mainSamples);
-	c->mainPass.init("main", c->mainTarget, c->mainDepth);
-
-	if (c->useFxaa) {
-		c->fxaaTarget.init("fxaaTarget", mainRes, SG_PIXELFORMAT_RGBA8);
-		c->fxaaPass.init("fxaa", c->fxaaTarget);
-		if (!c->fxaaPipe.desc.shader.id) {
-			c->fxaaPipe.init(gameShaders.fxaa, sp::PipeVertexFloat2);
-		}
-	} else {
-		sf::reset(c->fxaaTarget);
-		sf::reset(c->fxaaPass);
+	if (c->useFxaa && !c->fxaaPipe.desc.shader.id) {
+		c->fxaaPipe.init(gameShaders.fxaa, sp::PipeVertexFloat2);
 	}
 }
 
@@ -338,6 +324,8 @@ void clientGlobalInit()
 	GIMaterial::globalInit();
 	ParticleTexture::globalInit();
 	EnvmapTexture::globalInit();
+
+	sp::Asset::setMemoryBudget((size_t)g_settings.assetMemoryBudgetMB * 1024 * 1024);
 }
 
 void clientGlobalCleanup()
@@ -657,7 +645,7 @@ bool clientUpdate(Client *c, const ClientInput &input)
 			}
 		}
 
-		float minHeightRatio = 320.0f / c->mainTarget.resolution.y;
+		float minHeightRatio = 320.0f / c->mainResolution.y;
 		float minRenderScale = sf::clamp(minHeightRatio * minHeightRatio, 0.25f, 1.0f);
 
 		if (c->renderResolutionScale < 0.6f && c->msaaSamples > 1) {
@@ -699,7 +687,7 @@ bool clientUpdate(Client *c, const ClientInput &input)
 	c->frameArgs.editorOpen = c->editor != nullptr;
 	c->frameArgs.guiResolution = c->uiResolution;
 	c->frameArgs.windowResolution = input.resolution;
-	c->frameArgs.mainRenderArgs.targetResolution = c->mainTarget.resolution;
+	c->frameArgs.mainRenderArgs.targetResolution = c->mainResolution;
 	c->frameArgs.mainRenderArgs.renderResolution = sf::Vec2i(sf::Vec2(c->frameArgs.mainRenderArgs.targetResolution) * sf::sqrt(c->renderResolutionScale));
 	if (c->svState) {
 		c->frameArgs.localClientId = c->svState->localClientId;
@@ -819,36 +807,66 @@ ClientRenderOutput clientRender(Client *c)
 
 	bool topLeft = sg_query_features().origin_top_left;
 
-	{
-		sg_pass_action action = { };
-		action.colors[0].action = SG_ACTION_CLEAR;
-		#if SF_DEBUG
-			action.colors[0].val[0] = 0.25f;
-			action.colors[0].val[1] = 0.25f;
-			action.colors[0].val[2] = 0.25f;
-		#else
-			action.colors[0].val[0] = 0.0f;
-			action.colors[0].val[1] = 0.0f;
-			action.colors[0].val[2] = 0.0f;
-		#endif
-		action.colors[0].val[3] = 1.0f;
-		action.depth.action = SG_ACTION_CLEAR;
-		action.depth.val = 1.0f;
+	sp::FrameGraph &graph = c->frameGraph;
+	graph.reset();
+
+	sp::FrameTargetDesc mainDesc;
+	mainDesc.resolution = c->mainResolution;
+	mainDesc.format = SG_PIXELFORMAT_RGBA8;
+	mainDesc.msaaSamples = (uint32_t)c->msaaSamples;
+	uint32_t mainTarget = graph.createTarget("mainTarget", mainDesc);
+
+	sp::FrameTargetDesc mainDepthDesc = mainDesc;
+	mainDepthDesc.format = SG_PIXELFORMAT_DEPTH_STENCIL;
+	uint32_t mainDepth = graph.createTarget("mainDepth", mainDepthDesc);
+
+	sg_pass_action mainAction = { };
+	mainAction.colors[0].action = SG_ACTION_CLEAR;
+	#if SF_DEBUG
+		mainAction.colors[0].val[0] = 0.25f;
+		mainAction.colors[0].val[1] = 0.25f;
+		mainAction.colors[0].val[2] = 0.25f;
+	#else
+		mainAction.colors[0].val[0] = 0.0f;
+		mainAction.colors[0].val[1] = 0.0f;
+		mainAction.colors[0].val[2] = 0.0f;
+	#endif
+	mainAction.colors[0].val[3] = 1.0f;
+	mainAction.depth.action = SG_ACTION_CLEAR;
+	mainAction.depth.val = 1.0f;
 
-		sp::beginPass(c->mainPass, &action);
+	uint32_t mainPass = graph.addPass("main", &mainAction);
+	graph.write(mainPass, mainTarget);
+	graph.write(mainPass, mainDepth);
 
+	uint32_t outputTarget = mainTarget;
+	uint32_t fxaaPass = sp::FrameInvalid;
+	if (c->useFxaa) {
+		sp::FrameTargetDesc fxaaDesc;
+		fxaaDesc.resolution = c->mainResolution;
+		fxaaDesc.format = SG_PIXELFORMAT_RGBA8;
+		uint32_t fxaaTarget = graph.createTarget("fxaaTarget", fxaaDesc);
+
+		fxaaPass = graph.addPass("fxaa");
+		graph.read(fxaaPass, mainTarget);
+		graph.write(fxaaPass, fxaaTarget);
+		outputTarget = fxaaTarget;
+	}
+
+	graph.markOutput(outputTarget);
+	graph.compile();
+
+	if (graph.beginPass(mainPass)) {
 		sg_apply_viewport(0, 0, renderRes.x, renderRes.y, topLeft);
 
 		c->clState->renderMain(c->mainRenderArgs);
 
 		c->debugRender.render(c->mainRenderArgs.worldToClip);
 
-		sp::endPass();
+		graph.endPass();
 	}
 
-	if (c->useFxaa) {
-		sp::beginPass(c->fxaaPass, nullptr);
-
+	if (fxaaPass != sp::FrameInvalid && graph.beginPass(fxaaPass)) {
 		sg_apply_viewport(0, 0, renderRes.x, renderRes.y, topLeft);
 
 		{
@@ -866,20 +884,18 @@ ClientRenderOutput clientRender(Client *c)
 			sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_Fxaa_Pixel, &pu, sizeof(pu));
 
 			sg_bindings bindings = { };
-			bindings.fs_images[SLOT_Fxaa_tonemapImage] = c->mainTarget.image;
+			bindings.fs_images[SLOT_Fxaa_tonemapImage] = graph.getImage(mainTarget);
 			bindings.vertex_buffers[0] = gameShaders.fullscreenTriangleBuffer;
 			sg_apply_bindings(&bindings);
 
 			sg_draw(0, 3, 1);
 		}
 
-		sp::endPass();
-
-		output.image = c->fxaaTarget.image;
-	} else {
-		output.image = c->mainTarget.image;
+		graph.endPass();
 	}
 
+	output.image = graph.getImage(outputTarget);
+
 	return output;
 }
 
@@ -21,10 +21,13 @@ void initDefaultSettings(ClientSettings &settings, ClientSettings::Preset preset
 		settings.diffuseProbeResolution = 48;
 		settings.diffuseProbeDistance = 1.0f;
 		settings.diffuseProbeSmallFloat = true;
+		settings.diffuseProbeBudgetMs = 0.5f;
 		settings.shadowCacheResolution = 32;
 		settings.shadowCacheSlices = 8;
 		settings.shadowDepthResolution = 64;
 		settings.lightQuality = 0;
+		settings.assetMemoryBudgetMB = 96;
+		settings.maxAudioVoices = 16;
 	} else if (preset == ClientSettings::Low) {
 		settings.simpleShading = false;
 		settings.msaaSamples = 1;
@@ -40,10 +43,13 @@ void initDefaultSettings(ClientSettings &settings, ClientSettings::Preset preset
 		settings.diffuseProbeResolution = 48;
 		settings.diffuseProbeDistance = 1.0f;
 		settings.diffuseProbeSmallFloat = true;
+		settings.diffuseProbeBudgetMs = 0.75f;
 		settings.shadowCacheResolution = 64;
 		settings.shadowCacheSlices = 8;
 		settings.shadowDepthResolution = 128;
 		settings.lightQuality = 2;
+		settings.assetMemoryBudgetMB = 192;
+		settings.maxAudioVoices = 24;
 	} else if (preset == ClientSettings::Medium) {
 		settings.simpleShading = false;
 		settings.msaaSamples = 1;
@@ -59,10 +65,13 @@ void initDefaultSettings(ClientSettings &settings, ClientSettings::Preset preset
 		settings.diffuseProbeResolution = 64;
 		settings.diffuseProbeDistance = 1.0f;
 		settings.diffuseProbeSmallFloat = true;
+		settings.diffuseProbeBudgetMs = 1.0f;
 		settings.shadowCacheResolution = 128;
 		settings.shadowCacheSlices = 8;
 		settings.shadowDepthResolution = 256;
 		settings.lightQuality = 3;
+		settings.assetMemoryBudgetMB = 384;
+		settings.maxAudioVoices = 32;
 	} else if (preset == ClientSettings::High) {
 		settings.simpleShading = false;
 		settings.msaaSamples = 4;
@@ -78,10 +87,13 @@ void initDefaultSettings(ClientSettings &settings, ClientSettings::Preset preset
 		settings.diffuseProbeResolution = 128;
 		settings.diffuseProbeDistance = 0.5f;
 		settings.diffuseProbeSmallFloat = false;
+		settings.diffuseProbeBudgetMs = 1.5f;
 		settings.shadowCacheResolution = 256;
 		settings.shadowCacheSlices = 8;
 		settings.shadowDepthResolution = 512;
 		settings.lightQuality = 4;
+		settings.assetMemoryBudgetMB = 768;
+		settings.maxAudioVoices = 48;
 	} else if (preset == ClientSettings::Ultra) {
 		settings.simpleShading = false;
 		settings.msaaSamples = 8;
@@ -98,10 +110,13 @@ void initDefaultSettings(ClientSettings &settings, ClientSettings::Preset preset
 		settings.diffuseProbeResolution = 128;
 		settings.diffuseProbeDistance = 0.5f;
 		settings.diffuseProbeSmallFloat = false;
+		settings.diffuseProbeBudgetMs = 2.0f;
 		settings.shadowCacheResolution = 256;
 		settings.shadowCacheSlices = 8;
 		settings.shadowDepthResolution = 512;
 		settings.lightQuality = 5;
+		settings.assetMemoryBudgetMB = 1024;
+		settings.maxAudioVoices = 64;
     } else if (preset == ClientSettings::AppleA12) {
         settings.simpleShading = false;
         settings.msaaSamples = 4;
@@ -117,10 +132,13 @@ void initDefaultSettings(ClientSettings &settings, ClientSettings::Preset preset
         settings.diffuseProbeResolution = 48;
         settings.diffuseProbeDistance = 1.0f;
         settings.diffuseProbeSmallFloat = true;
+        settings.diffuseProbeBudgetMs = 0.75f;
         settings.shadowCacheResolution = 128;
         settings.shadowCacheSlices = 8;
         settings.shadowDepthResolution = 256;
         settings.lightQuality = 3;
+        settings.assetMemoryBudgetMB = 256;
+        settings.maxAudioVoices = 24;
 	}
 }
 
@@ -38,6 +38,7 @@ struct ClientSettings
 	uint32_t diffuseProbeResolution;
 	float diffuseProbeDistance;
 	bool diffuseProbeSmallFloat;
+	float diffuseProbeBudgetMs;
 
 	uint32_t shadowCacheResolution;
 	uint32_t shadowCacheSlices;
@@ -45,6 +46,10 @@ struct ClientSettings
 
 	uint32_t lightQuality;
 
+	uint32_t assetMemoryBudgetMB;
+
+	uint32_t maxAudioVoices;
+
 	bool spectatorMode = false;
 	bool musicEnabled = true;
 	bool hackSlowCamera = false;
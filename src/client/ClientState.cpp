@@ -110,16 +110,90 @@ static void applyEventImp(ClientState &cs, Systems &systems, const sv::Event &ev
 	}
 }
 
+// Maximum time to hold back an entity waiting for its assets
+static const float MaxPrefetchWaitTime = 2.0f;
+
+static bool isWaitingForPrefab(const Systems &systems, const sv::Event &event)
+{
+	if (const auto *e = event.as<sv::LoadPrefabEvent>()) {
+		return systems.entities.isPrefabLoading(e->prefab.name);
+	} else if (const auto *e = event.as<sv::AddPropEvent>()) {
+		return systems.entities.isPrefabLoading(e->prop.prefabName);
+	} else if (const auto *e = event.as<sv::ReplaceLocalPropEvent>()) {
+		return systems.entities.isPrefabLoading(e->prop.prefabName);
+	} else if (const auto *e = event.as<sv::AddCharacterEvent>()) {
+		return systems.entities.isPrefabLoading(e->character.prefabName);
+	}
+	return false;
+}
+
+static void applyPrefetchEvent(ClientState &cs, Systems &systems, const ClientState::PrefetchEvent &pe)
+{
+	applyEventImp(cs, systems, *pe.event, pe.immediate);
+	if (pe.immediate) {
+		systems.game->applyEventImmediate(systems, *pe.event);
+	} else {
+		systems.game->applyEventQueued(systems, pe.event);
+	}
+}
+
+static void updatePrefetchQueue(ClientState &cs, Systems &systems, float dt)
+{
+	// The wait time spans a single stall: it's reset only once
+	// nothing is blocking the queue anymore
+	uint32_t numApplied = 0;
+	bool stalled = false;
+	for (; numApplied < cs.prefetchQueue.size; numApplied++) {
+		const ClientState::PrefetchEvent &pe = cs.prefetchQueue[numApplied];
+		if (cs.prefetchWaitTime < MaxPrefetchWaitTime && isWaitingForPrefab(systems, *pe.event)) {
+			stalled = true;
+			break;
+		}
+
+		applyPrefetchEvent(cs, systems, pe);
+	}
+
+	if (stalled) {
+		cs.prefetchWaitTime += dt;
+	} else {
+		cs.prefetchWaitTime = 0.0f;
+	}
+	cs.prefetchQueue.removeOrdered(0, numApplied);
+}
+
+static void pushPrefetchEvent(ClientState &cs, Systems &systems, const sf::Box<sv::Event> &event, bool immediate)
+{
+	// Start loading the prefab assets right away, the prefab itself
+	// is added when the event is applied after the prefetch is done
+	if (const auto *e = event->as<sv::LoadPrefabEvent>()) {
+		systems.entities.prefetchPrefab(systems, e->prefab);
+	}
+
+	// Keep the event order intact: once something is waiting
+	// every following event has to wait behind it
+	ClientState::PrefetchEvent pe = { event, immediate };
+	if (cs.prefetchQueue.size > 0 || isWaitingForPrefab(systems, *event)) {
+		cs.prefetchQueue.push(std::move(pe));
+		return;
+	}
+
+	applyPrefetchEvent(cs, systems, pe);
+}
+
 void ClientState::applyEventImmediate(const sv::Event &event)
 {
 	applyEventImp(*this, systems, event, true);
 	systems.game->applyEventImmediate(systems, event);
 }
 
+void ClientState::applyEventImmediate(const sf::Box<sv::Event> &event)
+{
+	pushPrefetchEvent(*this, systems, event, true);
+}
+
 void ClientState::applyEventQueued(const sf::Box<sv::Event> &event)
 {
-	applyEventImp(*this, systems, *event, false);
-	systems.game->applyEventQueued(systems, event);
+	pushPrefetchEvent(*this, systems, event, false);
 }
 
 void ClientState::writePersist(ClientPersist &persist)
@@ -171,6 +245,8 @@ void ClientState::update(const sv::ServerState *svState, const FrameArgs &frameA
 	systems.tileModel->garbageCollectChunks(systems.area, frameArgs);
 	systems.entities.updateQueuedRemoves(systems, frameArgs);
 
+	updatePrefetchQueue(*this, systems, frameArgs.dt);
+
 	if (svState) {
 		systems.game->update(*svState, systems, frameArgs);
 	}
@@ -185,7 +261,7 @@ void ClientState::update(const sv::ServerState *svState, const FrameArgs &frameA
 
 	systems.tileModel->uploadVisibleChunks(systems.activeAreas, systems.area, frameArgs);
 	systems.particle->updateParticles(systems.activeAreas, frameArgs);
-	systems.characterModel->updateAnimations(systems.activeAreas, frameArgs.dt);
+	systems.characterModel->updateAnimations(systems.activeAreas, frameArgs);
 	systems.characterModel->updateBoneListeners(systems.boneUpdates, systems.activeAreas);
 	systems.characterModel->updateAttachedEntities(systems);
 
@@ -211,6 +287,9 @@ void ClientState::renderShadows()
 	if (systems.game->getVisualizeGI()) {
 		systems.envLight->renderEnvmapDebug(systems, systems.frameArgs.mainRenderArgs);
 	}
+
+	// Everything interested in changed areas has seen them by now
+	systems.area->clearChanges();
 }
 
 void ClientState::renderMain(const RenderArgs &args)
@@ -227,6 +306,8 @@ void ClientState::renderMain(const RenderArgs &args)
 		}
 	}
 
+	systems.light->updateLightGrid(systems.visibleAreas);
+
 	#if CL_USE_DEPTH_PREPASS
 		systems.tileModel->renderDepthPrepass(systems.visibleAreas, args);
 	#endif
@@ -13,9 +13,23 @@ struct ClientState
 	uint32_t localClientId = 0;
 	Systems systems;
 
+	struct PrefetchEvent
+	{
+		sf::Box<sv::Event> event;
+		bool immediate;
+	};
+
+	// Events held back until the assets of the prefabs they load or
+	// spawn have been prefetched, see `applyEventQueued()`
+	sf::Array<PrefetchEvent> prefetchQueue;
+	float prefetchWaitTime = 0.0f;
+
 	ClientState(const SystemsDesc &desc);
 
+	// Applied right away without waiting for prefetches, used for whole state loads
 	void applyEventImmediate(const sv::Event &event);
+	// Applied immediately once the assets it needs are prefetched, used for editor edits
+	void applyEventImmediate(const sf::Box<sv::Event> &event);
 	void applyEventQueued(const sf::Box<sv::Event> &event);
 
 	void writePersist(ClientPersist &persist);
@@ -2088,8 +2088,8 @@ void editorUpdate(EditorState *es, const FrameArgs &frameArgs, const ClientInput
 	handleImguiErrorsWindow(es, editorInput.errors);
 	handleImguiDebugWindows(es);
 
-	for (sv::Event *event : es->editEvents) {
-		es->clState->applyEventImmediate(*event);
+	for (const sf::Box<sv::Event> &event : es->editEvents) {
+		es->clState->applyEventImmediate(event);
 	}
 	es->editEvents.clear();
 
@@ -1,6 +1,7 @@
 #include "EnvLightSystem.h"
 
 #include "client/LightSystem.h"
+#include "client/AreaSystem.h"
 #include "client/MiscTexture.h"
 
 #include "sp/Renderer.h"
@@ -645,11 +646,25 @@ struct EnvLightSystemImp final : EnvLightSystem
 	static const uint32_t MaxDepthSlices = 4;
 	static const uint32_t MaxUpdateCount = 4;
 
+	// Change tracking granularity in probes along X/Z
+	static const uint32_t DirtyTileProbes = 8;
+	// `EnvmapBlend` settles to blending ~1% of each update so a change takes
+	// a couple of hundred updates to fully show up
+	static const uint32_t ConvergeUpdates = 240;
+	// Partial updates `SG_ACTION_LOAD` the swap they render into, so a dirty
+	// tile must be redrawn into both ping-pong swaps before it's considered clean
+	static_assert(ConvergeUpdates >= 2, "Dirty tiles must cover both envmap swaps");
+	// Changes affect probes around them through occlusion and bounce
+	static const constexpr float DirtyMarginProbes = 4.0f;
+	// Budget scale for changes at the edge of the grid
+	static const constexpr float MinDirtyUrgency = 0.25f;
+
 	struct UpdateState
 	{
 		sf::Vec3 rayDir;
 		sf::Array<PointLight> pointLights;
 		RenderArgs renderArgs;
+		VisibleAreas areas;
 		float depthToDistance;
 	};
 
@@ -714,6 +729,19 @@ struct EnvLightSystemImp final : EnvLightSystem
 
 	UpdateState updateStates[MaxUpdateCount][MaxDepthSlices];
 
+	// Updates still needed per tile of `DirtyTileProbes` probes covering the
+	// grid, `dirtyTiles[y * dirtyTilesSize + x]` is tile `dirtyTileOrigin + (x, y)`
+	sf::Array<uint32_t> dirtyTiles;
+	sf::Vec2i dirtyTileOrigin;
+	int32_t dirtyTilesSize = 0;
+
+	// Updates that must cover the whole grid: both swaps of the atlas need to
+	// be complete before we can blend only the dirty parts on top of them
+	uint32_t numFullUpdates = 0;
+
+	float budgetCreditMs = 0.0f;
+	float measuredCostMs = 0.0f;
+
 	bool iblEnabled = true;
 
 	void initTargets()
@@ -918,6 +946,89 @@ struct EnvLightSystemImp final : EnvLightSystem
 		debugLightingPass.init("debug envmap lighting", debugLightingTarget);
 	}
 
+	static int32_t floorDiv(int32_t a, int32_t b)
+	{
+		return a >= 0 ? a / b : -((-a + b - 1) / b);
+	}
+
+	// Move the tile window to cover the grid centered at `offset`, tiles that
+	// enter the window have no history and need a full set of updates
+	void moveDirtyTiles(const sf::Vec2i &offset)
+	{
+		int32_t res = (int32_t)envmapResolution, tile = (int32_t)DirtyTileProbes;
+		int32_t size = res / tile + 2;
+		sf::Vec2i origin;
+		origin.x = floorDiv(offset.x - res / 2, tile);
+		origin.y = floorDiv(offset.y - res / 2, tile);
+		if (size == dirtyTilesSize && origin == dirtyTileOrigin) return;
+
+		sf::Array<uint32_t> tiles;
+		tiles.resize((size_t)(size * size));
+		for (int32_t y = 0; y < size; y++)
+		for (int32_t x = 0; x < size; x++) {
+			int32_t px = origin.x + x - dirtyTileOrigin.x;
+			int32_t py = origin.y + y - dirtyTileOrigin.y;
+			if (px >= 0 && py >= 0 && px < dirtyTilesSize && py < dirtyTilesSize) {
+				tiles[y * size + x] = dirtyTiles[py * dirtyTilesSize + px];
+			} else {
+				tiles[y * size + x] = ConvergeUpdates;
+			}
+		}
+
+		dirtyTiles = std::move(tiles);
+		dirtyTileOrigin = origin;
+		dirtyTilesSize = size;
+	}
+
+	// Mark probes in `[min, max]` (in probe units) to need `ConvergeUpdates` more updates
+	void markDirtyProbes(const sf::Vec2 &min, const sf::Vec2 &max)
+	{
+		float tile = (float)DirtyTileProbes;
+		float minX = floorf(min.x / tile) - (float)dirtyTileOrigin.x, minY = floorf(min.y / tile) - (float)dirtyTileOrigin.y;
+		float maxX = floorf(max.x / tile) - (float)dirtyTileOrigin.x, maxY = floorf(max.y / tile) - (float)dirtyTileOrigin.y;
+		float last = (float)(dirtyTilesSize - 1);
+		if (maxX < 0.0f || maxY < 0.0f || minX > last || minY > last) return;
+
+		int32_t x0 = (int32_t)sf::max(minX, 0.0f), x1 = (int32_t)sf::min(maxX, last);
+		int32_t y0 = (int32_t)sf::max(minY, 0.0f), y1 = (int32_t)sf::min(maxY, last);
+		for (int32_t y = y0; y <= y1; y++)
+		for (int32_t x = x0; x <= x1; x++) {
+			dirtyTiles[y * dirtyTilesSize + x] = ConvergeUpdates;
+		}
+	}
+
+	void markDirtyBounds(const sf::Bounds3 &bounds)
+	{
+		sf::Vec2 origin = sf::Vec2(bounds.origin.x, bounds.origin.z) / probeDistance;
+		sf::Vec2 extent = sf::Vec2(bounds.extent.x, bounds.extent.z) / probeDistance + sf::Vec2(DirtyMarginProbes);
+		markDirtyProbes(origin - extent, origin + extent);
+	}
+
+	// Probes that scroll into the grid when moving from `prevOffset` to `offset`
+	void markDirtyScroll(const sf::Vec2i &prevOffset, const sf::Vec2i &offset)
+	{
+		float half = (float)(envmapResolution / 2) + 1.0f;
+		sf::Vec2 lo = sf::Vec2(offset) - sf::Vec2(half), hi = sf::Vec2(offset) + sf::Vec2(half);
+		if (offset.x > prevOffset.x) markDirtyProbes(sf::Vec2((float)prevOffset.x + half - 1.0f, lo.y), hi);
+		if (offset.x < prevOffset.x) markDirtyProbes(lo, sf::Vec2((float)prevOffset.x - half + 1.0f, hi.y));
+		if (offset.y > prevOffset.y) markDirtyProbes(sf::Vec2(lo.x, (float)prevOffset.y + half - 1.0f), hi);
+		if (offset.y < prevOffset.y) markDirtyProbes(lo, sf::Vec2(hi.x, (float)prevOffset.y - half + 1.0f));
+	}
+
+	// Texels `[min, max)` of a `envmapResolution^2` atlas face covering the tiles
+	// `[tileMin, tileMax]` relative to `dirtyTileOrigin`, texel `x` is roughly
+	// probe `offsetInProbes.x - envmapResolution/2 + x` (see `getEnvLightAtlas()`)
+	void getDirtyTexelRect(sf::Vec2i &min, sf::Vec2i &max, const sf::Vec2i &tileMin, const sf::Vec2i &tileMax) const
+	{
+		int32_t res = (int32_t)envmapResolution, tile = (int32_t)DirtyTileProbes;
+		int32_t margin = 2;
+		sf::Vec2i base = offsetInProbes - sf::Vec2i(res / 2);
+		min = (dirtyTileOrigin + tileMin) * tile - base - sf::Vec2i(margin);
+		max = (dirtyTileOrigin + tileMax + sf::Vec2i(1)) * tile - base + sf::Vec2i(margin);
+		min = sf::max(min, sf::Vec2i(0));
+		max = sf::max(sf::min(max, sf::Vec2i(res)), min);
+	}
+
 	// API
 
 	EnvLightSystemImp()
@@ -992,6 +1103,70 @@ struct EnvLightSystemImp final : EnvLightSystem
 		if (!blueNoiseTex.isLoaded()) return;
 		bool topLeft = sg_query_features().origin_top_left;
 
+		// Calculate a new GI grid origin, only applied if we update this frame
+		sf::Vec3 origin = systems.frameArgs.mainRenderArgs.cameraPosition;
+		sf::Vec3 dir = sf::normalize(sf::inverse(systems.frameArgs.mainRenderArgs.worldToView).cols[2]);
+		origin += dir * (origin.y / -dir.y);
+		sf::Vec2 originInProbes = sf::Vec2(origin.x, origin.z) / probeDistance;
+		sf::Vec2i newOffsetInProbes = sf::Vec2i(originInProbes);
+
+		// Gather changes affecting the probes, everything is dirty initially
+		moveDirtyTiles(newOffsetInProbes);
+		if (firstUpdate) {
+			for (uint32_t &tile : dirtyTiles) tile = ConvergeUpdates;
+		}
+		bool scrolled = newOffsetInProbes != offsetInProbes;
+		if (scrolled) markDirtyScroll(offsetInProbes, newOffsetInProbes);
+		for (const AreaChange &change : systems.area->getChanges()) {
+			if (change.areaFlags & Area::Envmap) markDirtyBounds(change.bounds);
+		}
+		for (const sf::Sphere &light : systems.light->getChangedLights()) {
+			markDirtyBounds(sf::Bounds3{ light.origin, sf::Vec3(light.radius) });
+		}
+
+		// Track the GPU cost of our passes from the (delayed) pass timings
+		{
+			double costSec = 0.0;
+			for (const sp::PassTime &time : sp::getPassTimes()) {
+				if (!strncmp(time.name.data, "env", 3)) costSec += time.time;
+			}
+			if (costSec > 0.0) {
+				float costMs = (float)(costSec * 1000.0);
+				measuredCostMs = measuredCostMs > 0.0f ? sf::lerp(measuredCostMs, costMs, 0.25f) : costMs;
+			}
+		}
+
+		// Static scenes cost nothing once converged, changes close to the
+		// camera accumulate budget faster. Without timing support the cost
+		// stays zero and dirty probes update every frame.
+		float nearestDirty = HUGE_VALF;
+		sf::Vec2i dirtyTileMin = sf::Vec2i(dirtyTilesSize), dirtyTileMax = sf::Vec2i(-1);
+		for (int32_t y = 0; y < dirtyTilesSize; y++)
+		for (int32_t x = 0; x < dirtyTilesSize; x++) {
+			if (dirtyTiles[y * dirtyTilesSize + x] == 0) continue;
+			dirtyTileMin = sf::min(dirtyTileMin, sf::Vec2i(x, y));
+			dirtyTileMax = sf::max(dirtyTileMax, sf::Vec2i(x, y));
+			sf::Vec2 center = (sf::Vec2(dirtyTileOrigin + sf::Vec2i(x, y)) + sf::Vec2(0.5f)) * (float)DirtyTileProbes;
+			nearestDirty = sf::min(nearestDirty, sf::length(center - originInProbes));
+		}
+		if (nearestDirty == HUGE_VALF) {
+			budgetCreditMs = 0.0f;
+			return;
+		}
+
+		float urgency = 1.0f;
+		if (!scrolled && !firstUpdate) {
+			urgency = sf::clamp(1.0f - nearestDirty / ((float)envmapResolution * 0.5f), MinDirtyUrgency, 1.0f);
+		}
+		float budgetMs = g_settings.diffuseProbeBudgetMs;
+		budgetCreditMs = sf::min(budgetCreditMs + budgetMs * urgency, sf::max(budgetMs, measuredCostMs));
+		if (budgetCreditMs < measuredCostMs) return;
+		budgetCreditMs -= measuredCostMs;
+
+		for (uint32_t &tile : dirtyTiles) {
+			if (tile > 0) tile--;
+		}
+
 		if (firstUpdate) {
 			sg_pass_action action = { };
 			action.colors[0].action = SG_ACTION_CLEAR;
@@ -1004,13 +1179,18 @@ struct EnvLightSystemImp final : EnvLightSystem
 		
 		EnvLightAltas prevEnvAtlas = getEnvLightAtlas();
 
-		// Calculate a new GI grid origin
-		sf::Vec3 origin = systems.frameArgs.mainRenderArgs.cameraPosition;
-		sf::Vec3 dir = sf::normalize(sf::inverse(systems.frameArgs.mainRenderArgs.worldToView).cols[2]);
-		origin += dir * (origin.y / -dir.y);
-		sf::Vec2 originInProbes = sf::Vec2(origin.x, origin.z) / probeDistance;
 		prevOffsetInProbes = offsetInProbes;
-		offsetInProbes = sf::Vec2i(originInProbes);
+		offsetInProbes = newOffsetInProbes;
+
+		// Restrict all the passes to the texels of the dirty tiles, the rest
+		// of the atlas has converged and is kept as-is
+		if (scrolled || firstUpdate) numFullUpdates = 2;
+		bool fullUpdate = numFullUpdates > 0;
+		if (numFullUpdates > 0) numFullUpdates--;
+
+		sf::Vec2i rectMin = sf::Vec2i(0), rectMax = sf::Vec2i((int32_t)envmapResolution);
+		if (!fullUpdate) getDirtyTexelRect(rectMin, rectMax, dirtyTileMin, dirtyTileMax);
+		sf::Vec2i rectSize = rectMax - rectMin;
 
 		probeDeltaOffset = sf::Vec2(0.5f);
 
@@ -1033,12 +1213,7 @@ struct EnvLightSystemImp final : EnvLightSystem
 
 		// Pass 1: Render G-buffers
 		{
-			sg_pass_action action = { };
-			action.colors[0].action = SG_ACTION_CLEAR;
-			action.colors[1].action = SG_ACTION_CLEAR;
-			action.depth.action = SG_ACTION_CLEAR;
-			action.depth.val = 1.0f;
-			sp::beginPass(gbufferPass, &action);
+			sf::SmallArray<VisibilityView, MaxUpdateCount*MaxDepthSlices> views;
 
 			for (uint32_t rayI = 0; rayI < updateCount; rayI++)
 			for (uint32_t sliceI = 0; sliceI < sliceCount; sliceI++) {
@@ -1082,14 +1257,38 @@ struct EnvLightSystemImp final : EnvLightSystem
 				renderArgs.worldToClip = renderArgs.viewToClip * renderArgs.worldToView;
 				renderArgs.frustum = sf::Frustum(renderArgs.worldToClip, sp::getClipNearW());
 
+				VisibilityView &view = views.push();
+				view.areas = &updateState.areas;
+				view.areaFlags = Area::Envmap;
+				view.frustum = renderArgs.frustum;
+			}
+
+			// Cull all the views in one pass before rendering any of them
+			systems.updateVisibility(views);
+
+			sg_pass_action action = { };
+			action.colors[0].action = SG_ACTION_CLEAR;
+			action.colors[1].action = SG_ACTION_CLEAR;
+			action.depth.action = SG_ACTION_CLEAR;
+			action.depth.val = 1.0f;
+			sp::beginPass(gbufferPass, &action);
+
+			for (uint32_t rayI = 0; rayI < updateCount; rayI++)
+			for (uint32_t sliceI = 0; sliceI < sliceCount; sliceI++) {
+				UpdateState &updateState = updateStates[rayI][sliceI];
+
 				sg_apply_viewport((int)(renderResolution * sliceI), (int)renderResolution * rayI, (int)renderResolution, (int)renderResolution, true);
 
-				systems.renderEnvmapGBuffer(renderArgs);
+				// G-buffer rows are flipped relative to the atlas when looking up
+				int32_t rectY = updateState.rayDir.y > 0.0f ? (int32_t)renderResolution - rectMax.y : rectMin.y;
+				sg_apply_scissor_rect((int)(renderResolution * sliceI) + rectMin.x, (int)(renderResolution * rayI) + rectY, rectSize.x, rectSize.y, true);
+
+				systems.renderEnvmapGBuffer(updateState.areas, updateState.renderArgs);
 
 				PointLightFilter filter = { };
 				filter.bounce = true;
 				updateState.pointLights.clear();
-				systems.light->queryVisiblePointLights(systems.envmapAreas, updateState.pointLights, filter);
+				systems.light->queryVisiblePointLights(updateState.areas, updateState.pointLights, filter);
 			}
 
 			sp::endPass();
@@ -1112,6 +1311,7 @@ struct EnvLightSystemImp final : EnvLightSystem
 
 				// TODO(profile): Do this with geometry instead?
 				sg_apply_viewport((int)(renderResolution * sliceI), (int)renderResolution * rayI, (int)renderResolution, (int)renderResolution, topLeft);
+				sg_apply_scissor_rect((int)(renderResolution * sliceI) + rectMin.x, (int)(renderResolution * rayI) + rectMin.y, rectSize.x, rectSize.y, topLeft);
 
 				sg_bindings binds = { };
 
@@ -1162,9 +1362,11 @@ struct EnvLightSystemImp final : EnvLightSystem
 
 		// Pass 3: Update the atlas
 		for (uint32_t depthI = 0; depthI < sliceCount; depthI++) {
+			// Partial updates blend on top of the previous contents of the
+			// swap, which differ from the latest ones only by converged noise
 			sg_pass_action action = { };
-			action.colors[0].action = SG_ACTION_DONTCARE;
-			action.colors[1].action = SG_ACTION_DONTCARE;
+			action.colors[0].action = fullUpdate ? SG_ACTION_DONTCARE : SG_ACTION_LOAD;
+			action.colors[1].action = fullUpdate ? SG_ACTION_DONTCARE : SG_ACTION_LOAD;
 			sp::beginPass(envBlendPass[writeSwap][depthI], &action);
 
 			sg_bindings binds = { };
@@ -1199,7 +1401,15 @@ struct EnvLightSystemImp final : EnvLightSystem
 
 			sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_EnvmapBlend_Pixel, &pu, sizeof(pu));
 
-			sg_draw(0, 3, 1);
+			if (fullUpdate) {
+				sg_draw(0, 3, 1);
+			} else {
+				// One rect per face of the atlas
+				for (uint32_t faceI = 0; faceI < 6; faceI++) {
+					sg_apply_scissor_rect((int)(envmapResolution * faceI) + rectMin.x, rectMin.y, rectSize.x, rectSize.y, topLeft);
+					sg_draw(0, 3, 1);
+				}
+			}
 
 			sp::endPass();
 		}
@@ -1248,7 +1458,8 @@ struct EnvLightSystemImp final : EnvLightSystem
 			action.depth.val = 1.0f;
 			sp::beginPass(debugGBufferPass, &action);
 
-			systems.renderEnvmapGBuffer(renderArgs);
+			systems.updateVisibility(systems.envmapAreas, Area::Envmap, renderArgs.frustum);
+			systems.renderEnvmapGBuffer(systems.envmapAreas, renderArgs);
 
 			PointLightFilter filter = { };
 			filter.bounce = true;
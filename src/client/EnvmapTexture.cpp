@@ -3,6 +3,7 @@
 #include "ext/sp_tools_common.h"
 
 #include "sp/ContentFile.h"
+#include "sp/JobSystem.h"
 
 namespace cl {
 
@@ -19,9 +20,20 @@ sp::AssetType EnvmapTexture::SelfType = { "EnvmapTexture", sizeof(EnvmapTextureI
 	[](Asset *a) { new ((EnvmapTextureImp*)a) EnvmapTextureImp(); }
 };
 
-static void loadTextureImp(void *user, const sp::ContentFile &file)
+struct EnvmapTextureDecodeJob
 {
-	EnvmapTextureImp *imp = (EnvmapTextureImp*)user;
+	EnvmapTextureImp *imp;
+	sp::ContentFileData file;
+
+	EnvmapTextureDecodeJob(EnvmapTextureImp *imp, const sp::ContentFile &file)
+		: imp(imp), file(file) { }
+};
+
+static void decodeTextureJob(void *user)
+{
+	EnvmapTextureDecodeJob *job = (EnvmapTextureDecodeJob*)user;
+	EnvmapTextureImp *imp = job->imp;
+	const sp::ContentFileData &file = job->file;
     bool ok = false;
 
 	if (file.size > 0) {
@@ -40,9 +52,11 @@ static void loadTextureImp(void *user, const sp::ContentFile &file)
 		d.type = SG_IMAGETYPE_CUBE;
 		d.label = imp->name.data;
 
+		size_t gpuBytes = 0;
 		for (uint32_t mipI = 0; mipI < (uint32_t)d.num_mipmaps; mipI++) {
 			char *data = sptex_decode_mip(&su, mipI);
 			size_t mipSize = header.s_mips[mipI].uncompressed_size / 6;
+			gpuBytes += header.s_mips[mipI].uncompressed_size;
 			if (data) {
 				for (uint32_t faceI = 0; faceI < 6; faceI++) {
 					d.content.subimage[faceI][mipI].ptr = data;
@@ -58,12 +72,15 @@ static void loadTextureImp(void *user, const sp::ContentFile &file)
 				imp->image = sg_make_image(&d);
 			});
 
+			imp->assetSetMemoryUsage(0, gpuBytes);
             ok = true;
         }
 
 		spfile_util_free(&su.file);
 	}
 
+	delete job;
+
     if (ok) {
     	imp->assetFinishLoading();
     } else {
@@ -71,6 +88,13 @@ static void loadTextureImp(void *user, const sp::ContentFile &file)
     }
 }
 
+static void loadTextureImp(void *user, const sp::ContentFile &file)
+{
+	// Decode on a job worker, the asset stays loading until it's done
+	EnvmapTextureImp *imp = (EnvmapTextureImp*)user;
+	sp::JobSystem::runAsync(&decodeTextureJob, new EnvmapTextureDecodeJob(imp, file));
+}
+
 void EnvmapTextureImp::assetStartLoading()
 {
 	sf::SmallStringBuf<256> path;
@@ -2,6 +2,7 @@
 
 #include "sp/ContentFile.h"
 #include "sp/Renderer.h"
+#include "sp/JobSystem.h"
 #include "sf/Mutex.h"
 
 #include "ext/sokol/sokol_gfx.h"
@@ -77,9 +78,20 @@ sp::AssetType GIMaterial::SelfType = { "GIMaterial", sizeof(GIMaterialImp), size
 	[](Asset *a) { new ((GIMaterialImp*)a) GIMaterialImp(); }
 };
 
-static void loadTextureImp(void *user, const sp::ContentFile &file)
+struct GIMaterialDecodeJob
 {
-	GIMaterialImp *imp = (GIMaterialImp*)user;
+	GIMaterialImp *imp;
+	sp::ContentFileData file;
+
+	GIMaterialDecodeJob(GIMaterialImp *imp, const sp::ContentFile &file)
+		: imp(imp), file(file) { }
+};
+
+static void decodeTextureJob(void *user)
+{
+	GIMaterialDecodeJob *job = (GIMaterialDecodeJob*)user;
+	GIMaterialImp *imp = job->imp;
+	const sp::ContentFileData &file = job->file;
 
 	if (file.size > 0) {
 		GIMaterialContext &ctx = g_giMaterialContext;
@@ -123,9 +135,17 @@ static void loadTextureImp(void *user, const sp::ContentFile &file)
 		spfile_util_free(&su.file);
 	}
 
+	delete job;
 	imp->assetFinishLoading();
 }
 
+static void loadTextureImp(void *user, const sp::ContentFile &file)
+{
+	// Decode on a job worker, the asset stays loading until it's done
+	GIMaterialImp *imp = (GIMaterialImp*)user;
+	sp::JobSystem::runAsync(&decodeTextureJob, new GIMaterialDecodeJob(imp, file));
+}
+
 static void loadAlbedoImp(void *user, const sp::ContentFile &file) { loadTextureImp(user, file); }
 
 void GIMaterialImp::assetStartLoading()
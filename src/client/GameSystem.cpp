@@ -24,6 +24,7 @@
 
 #include "sp/Renderer.h"
 #include "sp/Srgb.h"
+#include "sp/Asset.h"
 
 #include "ext/sokol/sokol_app.h"
 #include "ext/imgui/imgui.h"
@@ -323,8 +324,11 @@ struct GameSystemImp final : GameSystem
 	sf::HashMap<sf::Vec2i, float> tileHoverAmount;
 	sf::HashMap<sf::Vec2i, float> tileTrailAmount;
 
+	// Events before `queuedEventOffset` have already been applied, the
+	// array is compacted once drained or when the applied prefix dominates
 	EventContext queuedEventContext;
 	sf::Array<sf::Box<sv::Event>> queuedEvents;
+	uint32_t queuedEventOffset = 0;
 
 	sf::Array<Projectile> projectiles;
 
@@ -336,6 +340,8 @@ struct GameSystemImp final : GameSystem
 
 	bool showDebugMenu = false;
 	bool showDebugPointers = false;
+	bool showDebugAssetMemory = false;
+	sp::AssetMemoryStats assetMemoryStats;
 	bool simulateTouch = false;
 	bool visualizeEnvLighting = false;
 	bool visualizeEnvSpheres = false;
@@ -432,6 +438,11 @@ struct GameSystemImp final : GameSystem
 		return &statuses[id];
 	}
 
+	bool hasQueuedEvents() const
+	{
+		return queuedEventOffset < queuedEvents.size;
+	}
+
 	bool applyEventImp(Systems &systems, const sv::Event &event, EventContext &ctx)
 	{
 		float dt = systems.frameArgs.dt;
@@ -1635,6 +1646,7 @@ struct GameSystemImp final : GameSystem
 				ImGui::Checkbox("Simulate touch", &simulateTouch);
 				ImGui::Checkbox("In battle", &inBattle);
 				if (ImGui::Button("Pointers")) showDebugPointers = true;
+				if (ImGui::Button("Asset memory")) showDebugAssetMemory = true;
 			}
 			ImGui::End();
 		}
@@ -1656,6 +1668,33 @@ struct GameSystemImp final : GameSystem
 			ImGui::End();
 		}
 
+		if (showDebugAssetMemory) {
+			ImGui::SetNextWindowSize(ImVec2(400.0f, 400.0f), ImGuiCond_Appearing);
+			if (ImGui::Begin("Asset memory", &showDebugAssetMemory)) {
+				sp::Asset::getMemoryStats(assetMemoryStats, 64);
+				const float mb = 1.0f / (1024.0f * 1024.0f);
+				sp::AssetMemoryStats &stats = assetMemoryStats;
+
+				ImGui::Text("Total: %.1fMB / %.1fMB (CPU %.1fMB, GPU %.1fMB)",
+					(float)(stats.cpuBytes + stats.gpuBytes) * mb, (float)stats.budget * mb,
+					(float)stats.cpuBytes * mb, (float)stats.gpuBytes * mb);
+				ImGui::Text("Cached: %.1fMB", (float)stats.cachedBytes * mb);
+
+				ImGui::Separator();
+				for (const sp::AssetTypeMemory &type : stats.types) {
+					ImGui::Text("%s: %u (%u cached) CPU %.2fMB GPU %.2fMB", type.name,
+						type.numAssets, type.numCached, (float)type.cpuBytes * mb, (float)type.gpuBytes * mb);
+				}
+
+				ImGui::Separator();
+				for (const sp::AssetMemory &asset : stats.assets) {
+					ImGui::Text("%.2fMB %s %s%s", (float)(asset.cpuBytes + asset.gpuBytes) * mb,
+						asset.type->name, asset.name.data, asset.refcount == 0 ? " (cached)" : "");
+				}
+			}
+			ImGui::End();
+		}
+
 #if 0
 		if (visualizeEnvLighting) {
 			float aspect = (float)systems.frameArgs.resolution.x / (float)systems.frameArgs.resolution.y;
@@ -1692,7 +1731,7 @@ struct GameSystemImp final : GameSystem
 			return;
 		}
 
-		if (queuedEvents.size > 0) {
+		if (hasQueuedEvents()) {
 			return;
 		}
 
@@ -2224,7 +2263,7 @@ struct GameSystemImp final : GameSystem
 		{
 			ImGui::Begin("Event queue");
 			sf::Type *eventType = sf::typeOf<sv::Event>();
-			for (const sv::Event *event :queuedEvents) {
+			for (const sv::Event *event : queuedEvents.slice().drop(queuedEventOffset)) {
 				ImGui::Text("%s", eventType->getPolymorphTypeByValue(event->type)->name.data);
 			}
 			ImGui::End();
@@ -2232,18 +2271,27 @@ struct GameSystemImp final : GameSystem
 		#endif
 
 		turnChanged = false;
-		while (queuedEvents.size > 0) {
-			if (!applyEventImp(systems, *queuedEvents[0], queuedEventContext)) {
+		while (queuedEventOffset < queuedEvents.size) {
+			if (!applyEventImp(systems, *queuedEvents[queuedEventOffset], queuedEventContext)) {
 				queuedEventContext.begin = false;
 				queuedEventContext.timer += frameArgs.dt;
 				break;
 			} else {
-				queuedEvents.removeOrdered(0); // TODO( O(n^2) )
+				queuedEvents[queuedEventOffset].reset();
+				queuedEventOffset++;
 				queuedEventContext.begin = true;
 				queuedEventContext.timer = 0.0f;
 			}
 		}
 
+		if (queuedEventOffset == queuedEvents.size) {
+			queuedEvents.clear();
+			queuedEventOffset = 0;
+		} else if (queuedEventOffset >= 64 && queuedEventOffset * 2 >= queuedEvents.size) {
+			queuedEvents.removeOrdered(0, queuedEventOffset);
+			queuedEventOffset = 0;
+		}
+
 		for (uint32_t i = 0; i < 9; i++) {
 			if (input.keyDown[SAPP_KEYCODE_1 + i] && !input.prevKeyDown[SAPP_KEYCODE_1 + i]) {
 				if (selectedCardSlot != i) {
@@ -2706,7 +2754,7 @@ struct GameSystemImp final : GameSystem
 			}
 		}
 
-		if (queuedEvents.size > 0) {
+		if (hasQueuedEvents()) {
 			moveSet.distanceToTile.clear();
 			moveSelectTime = 0.0f;
 		}
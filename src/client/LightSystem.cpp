@@ -31,6 +31,10 @@ struct ShadowCache
 	sp::RenderTarget shadowCacheRender;
 	sp::RenderPass shadowCachePass;
 
+	// Visibility from static casters only, a row of slices per shadow slot
+	sp::RenderTarget staticGridAtlas;
+	sp::RenderPass staticGridPass;
+
 	sp::Texture depthRenderCube;
 	sp::RenderTarget depthRenderDepth;
 	sp::RenderPass depthRenderPass[6];
@@ -71,8 +75,16 @@ struct ShadowCache
 			depthRenderCube.init(d);
 		}
 
-		shadowCacheRender.init("shadowCacheRender", sf::Vec2i(cacheTileExtent * cacheTileSlices, cacheTileExtent), SG_PIXELFORMAT_R8);
-		shadowCachePass.init("shadowCache", shadowCacheRender);
+		{
+			sg_image_desc d = { };
+			d.bqq_copy_target = true;
+			shadowCacheRender.init("shadowCacheRender", sf::Vec2i(cacheTileExtent * cacheTileSlices, cacheTileExtent), SG_PIXELFORMAT_R8, 1, d);
+			shadowCachePass.init("shadowCache", shadowCacheRender);
+		}
+
+		uint32_t numSlots = cacheNumTilesX * cacheNumTilesY;
+		staticGridAtlas.init("staticGridAtlas", sf::Vec2i(cacheTileExtent * cacheTileSlices, cacheTileExtent * numSlots), SG_PIXELFORMAT_R8);
+		staticGridPass.init("staticShadowGrid", staticGridAtlas);
 
 		depthRenderDepth.init("depthRenderDepth", sf::Vec2i((uint32_t)depthRenderExtent), SG_PIXELFORMAT_DEPTH);
 
@@ -97,6 +109,23 @@ struct ShadowCache
 
 struct LightSystemImp final : LightSystem
 {
+	static const constexpr float LightGridMinCellSize = 4.0f;
+	static const constexpr uint32_t LightGridMaxCells = 32;
+	static const constexpr uint32_t LightGridMaxLightsPerCell = 32;
+	static const constexpr uint32_t MaxGridLights = UINT16_MAX;
+
+	// Re-rendered shadows per frame in addition to newly allocated slots
+	static const constexpr uint32_t MaxShadowRefreshesPerFrame = 2;
+
+	// Area groups that invalidate the static or dynamic part of a cached shadow,
+	// must match what `renderStaticShadows()`/`renderDynamicShadows()` draw.
+	// `ModelSystem` has no shadow pass so dynamic props never cast point light
+	// shadows and are left out. Character poses change without their area
+	// moving, so slots with characters are also refreshed continuously, see
+	// `ShadowSlot::hasDynamicCasters`.
+	static const constexpr uint32_t StaticCasterGroups = 1u << (uint32_t)AreaGroup::TileChunkCulling;
+	static const constexpr uint32_t DynamicCasterGroups = 1u << (uint32_t)AreaGroup::CharacterModel;
+
 	struct PointLightImp
 	{
 		uint32_t areaId = ~0u;
@@ -130,6 +159,33 @@ struct LightSystemImp final : LightSystem
 		uint32_t pointId = ~0u;
 		uint64_t updateFrame = 0;
 		uint64_t activeFrame = 0;
+		bool staticDirty = true;
+		bool dynamicDirty = true;
+		bool hasDynamicCasters = false; // < Last render included dynamic casters
+	};
+
+	struct GridLight
+	{
+		uint32_t pointId = ~0u;
+		sf::Sphere sphere;
+		float luminance; // < Of the unfaded color
+	};
+
+	struct GridCandidate
+	{
+		float importance;
+		uint16_t index;
+
+		bool operator<(const GridCandidate &rhs) const {
+			if (importance != rhs.importance) return importance > rhs.importance;
+			return index < rhs.index;
+		}
+	};
+
+	struct GridRect
+	{
+		uint32_t minX, minZ;
+		uint32_t maxX, maxZ; // < Inclusive
 	};
 
 	ShadowCache shadowCache;
@@ -141,14 +197,150 @@ struct LightSystemImp final : LightSystem
 	sf::Array<ShadowSlot> shadowSlots;
 	sf::Array<uint32_t> shadowsToUpdate;
 
+	sf::Array<sf::Sphere> changedLights;
+	VisibleAreas shadowSideAreas[6];
+
 	bool iblEnabled = true;
 	EnvmapTextureRef envmapTexture;
 
 	double gameTime = 0.0;
 
-	void renderPointLightShadows(Systems &systems, uint32_t pointId, uint32_t shadowIndex)
+	// Light grid, `gridCellLights[gridCellOffsets[i]:gridCellOffsets[i+1]]`
+	// are the lights touching cell `i` sorted by importance
+	sf::Array<GridLight> gridLights;
+	sf::Array<PointLight> gridPointLights;
+	sf::Array<uint32_t> gridCellOffsets;
+	sf::Array<uint16_t> gridCellLights;
+	sf::Vec3 gridOrigin;
+	float gridCellSize = 1.0f;
+	float gridHeight = 0.0f;
+	uint32_t gridCellsX = 0;
+	uint32_t gridCellsZ = 0;
+	uint32_t gridVersion = 1;
+
+	// Luminance scaled by a smooth falloff from the closest point of `bounds`,
+	// negative if the light doesn't touch the bounds at all
+	static float getLightImportance(const GridLight &light, const sf::Bounds3 &bounds)
 	{
-		PointLightImp &point = pointLights[pointId];
+		sf::Vec3 delta = sf::abs(light.sphere.origin - bounds.origin);
+		sf::Vec3 distance = delta - sf::min(delta, bounds.extent);
+		float distSq = sf::lengthSq(distance);
+		float radiusSq = light.sphere.radius * light.sphere.radius;
+		if (distSq > radiusSq) return -1.0f;
+		float falloff = 1.0f - sqrtf(distSq / sf::max(radiusSq, 0.0001f));
+		return light.luminance * falloff * falloff;
+	}
+
+	bool getGridRect(GridRect &rect, const sf::Bounds3 &bounds) const
+	{
+		if (gridCellsX == 0) return false;
+
+		sf::Vec3 min = (bounds.origin - bounds.extent - gridOrigin) / gridCellSize;
+		sf::Vec3 max = (bounds.origin + bounds.extent - gridOrigin) / gridCellSize;
+		if (max.x < 0.0f || max.z < 0.0f || min.x >= (float)gridCellsX || min.z >= (float)gridCellsZ) return false;
+		if (max.y * gridCellSize < 0.0f || min.y * gridCellSize > gridHeight) return false;
+
+		rect.minX = (uint32_t)sf::max(min.x, 0.0f);
+		rect.minZ = (uint32_t)sf::max(min.z, 0.0f);
+		rect.maxX = sf::min((uint32_t)max.x, gridCellsX - 1);
+		rect.maxZ = sf::min((uint32_t)max.z, gridCellsZ - 1);
+		return true;
+	}
+
+	sf::Bounds3 getGridCellBounds(uint32_t x, uint32_t z) const
+	{
+		sf::Vec3 min = gridOrigin + sf::Vec3((float)x * gridCellSize, 0.0f, (float)z * gridCellSize);
+		sf::Vec3 max = min + sf::Vec3(gridCellSize, gridHeight, gridCellSize);
+		return sf::Bounds3::minMax(min, max);
+	}
+
+	void rebuildLightGrid()
+	{
+		gridCellOffsets.clear();
+		gridCellLights.clear();
+		gridCellsX = gridCellsZ = 0;
+		if (gridLights.size == 0) return;
+
+		sf::Vec3 min = sf::Vec3(+HUGE_VALF), max = sf::Vec3(-HUGE_VALF);
+		for (const GridLight &light : gridLights) {
+			min = sf::min(min, light.sphere.origin - sf::Vec3(light.sphere.radius));
+			max = sf::max(max, light.sphere.origin + sf::Vec3(light.sphere.radius));
+		}
+
+		sf::Vec3 extent = max - min;
+		float cellSize = sf::max(LightGridMinCellSize, sf::max(extent.x, extent.z) / (float)LightGridMaxCells);
+		gridOrigin = min;
+		gridCellSize = cellSize;
+		gridHeight = extent.y;
+		gridCellsX = sf::clamp((uint32_t)ceilf(extent.x / cellSize), 1u, LightGridMaxCells);
+		gridCellsZ = sf::clamp((uint32_t)ceilf(extent.z / cellSize), 1u, LightGridMaxCells);
+
+		uint32_t numCells = gridCellsX * gridCellsZ;
+		gridCellOffsets.resize(numCells + 1);
+
+		// Count and scatter lights to the cells they touch
+		for (uint32_t pass = 0; pass < 2; pass++) {
+			for (uint32_t i = 0; i < gridLights.size; i++) {
+				const GridLight &light = gridLights[i];
+				GridRect rect;
+				sf::Bounds3 lightBounds = { light.sphere.origin, sf::Vec3(light.sphere.radius) };
+				if (!getGridRect(rect, lightBounds)) continue;
+				for (uint32_t z = rect.minZ; z <= rect.maxZ; z++) {
+					for (uint32_t x = rect.minX; x <= rect.maxX; x++) {
+						if (!sf::intersect(getGridCellBounds(x, z), light.sphere)) continue;
+						uint32_t cell = z * gridCellsX + x;
+						if (pass == 0) {
+							gridCellOffsets[cell + 1]++;
+						} else {
+							gridCellLights[gridCellOffsets[cell]++] = (uint16_t)i;
+						}
+					}
+				}
+			}
+
+			if (pass == 0) {
+				for (uint32_t cell = 0; cell < numCells; cell++) {
+					gridCellOffsets[cell + 1] += gridCellOffsets[cell];
+				}
+				gridCellLights.resizeUninit(gridCellOffsets[numCells]);
+			} else {
+				// Scattering advanced each offset to the start of the next cell
+				for (uint32_t cell = numCells; cell > 0; cell--) {
+					gridCellOffsets[cell] = gridCellOffsets[cell - 1];
+				}
+				gridCellOffsets[0] = 0;
+			}
+		}
+
+		// Sort cells by importance and compact them to at most
+		// `LightGridMaxLightsPerCell` lights each
+		sf::SmallArray<GridCandidate, 64> candidates;
+		uint32_t dst = 0;
+		for (uint32_t cell = 0; cell < numCells; cell++) {
+			sf::Bounds3 cellBounds = getGridCellBounds(cell % gridCellsX, cell / gridCellsX);
+			uint32_t begin = gridCellOffsets[cell], end = gridCellOffsets[cell + 1];
+
+			candidates.clear();
+			for (uint32_t i = begin; i < end; i++) {
+				uint16_t index = gridCellLights[i];
+				candidates.push({ getLightImportance(gridLights[index], cellBounds), index });
+			}
+			sf::sort(candidates);
+
+			gridCellOffsets[cell] = dst;
+			uint32_t numLights = sf::min(candidates.size, LightGridMaxLightsPerCell);
+			for (uint32_t i = 0; i < numLights; i++) {
+				gridCellLights[dst++] = candidates[i].index;
+			}
+		}
+		gridCellOffsets[numCells] = dst;
+		gridCellLights.resizeUninit(dst);
+	}
+
+	void renderPointLightShadows(Systems &systems, uint32_t shadowIndex)
+	{
+		ShadowSlot &slot = shadowSlots[shadowIndex];
+		PointLightImp &point = pointLights[slot.pointId];
 
 		sf::Vec3 cubeBasis[][2] = {
 			{ { +1,0,0 }, { 0,+1,0 } },
@@ -170,8 +362,10 @@ struct LightSystemImp final : LightSystem
 
 		bool topLeft = sg_query_features().origin_top_left;
 		float clipNearW = topLeft ? -1.0f : 0.0f;
+		RenderArgs sideArgs[6];
+		VisibilityView sideViews[6];
 		for (uint32_t side = 0; side < 6; side++) {
-			RenderArgs args;
+			RenderArgs &args = sideArgs[side];
 
 			const sf::Vec3 *basis = cubeBasis[side];
 			sf::Mat34 view = sf::mat::look(point.sphere.origin, basis[0], basis[1]);
@@ -185,9 +379,20 @@ struct LightSystemImp final : LightSystem
 			args.cameraPosition = point.sphere.origin;
 			args.frustum = sf::Frustum(args.worldToClip, clipNearW);
 
-			sp::beginPass(shadowCache.depthRenderPass[side], &action);
-			systems.renderShadows(args);
-			sp::endPass();
+			VisibilityView &sideView = sideViews[side];
+			sideView.areas = &shadowSideAreas[side];
+			sideView.areaFlags = Area::Shadow;
+			sideView.frustum = args.frustum;
+		}
+
+		systems.updateVisibility(sideViews);
+
+		bool hasDynamicCasters = false;
+		for (uint32_t side = 0; side < 6; side++) {
+			if (shadowSideAreas[side].get(AreaGroup::CharacterModel).size > 0) {
+				hasDynamicCasters = true;
+				break;
+			}
 		}
 
 		float radius = point.sphere.radius;
@@ -212,27 +417,78 @@ struct LightSystemImp final : LightSystem
 		point.shadowBias = (uvw * sf::Vec3(1.0f, 1.0f, -1.0f) + sf::Vec3((float)offsetX, 0.0f, (float)offsetY + 1.0f)) / sf::Vec3((float)cacheNumTilesX, 1.0f, (float)cacheNumTilesY);
 		point.shadowMul = sf::Vec3(-1.0f, -1.0f, 1.0f) / volumeExtent / sf::Vec3((float)cacheNumTilesX, 1.0f, (float)cacheNumTilesY);
 
-		{
-			sp::beginPass(shadowCache.shadowCachePass, NULL);
+		ShadowGrid_Pixel_t pu;
+		pu.depthSlices = (float)shadowCache.cacheTileSlices;
+		pu.volumeOrigin = volumeOrigin;
+		pu.volumeUnits = volumeExtent;
+		pu.volumeUnits.y /= shadowCache.cacheTileSlices;
+
+		sg_bindings bindings = { };
+		bindings.vertex_buffers[0] = gameShaders.fullscreenTriangleBuffer;
+		bindings.fs_images[SLOT_ShadowGrid_shadowDepth] = shadowCache.depthRenderCube.image;
+
+		sg_pass_action loadAction = { };
+		loadAction.colors[0].action = SG_ACTION_LOAD;
+
+		int rowWidth = (int)(cacheTileExtent * shadowCache.cacheTileSlices);
+		int rowY = (int)(shadowIndex * cacheTileExtent);
+
+		// Static casters are rendered into the slot's row of `staticGridAtlas`
+		// and only re-rendered when tile chunks around the light change.
+		if (slot.staticDirty) {
+			for (uint32_t side = 0; side < 6; side++) {
+				sp::beginPass(shadowCache.depthRenderPass[side], &action);
+				systems.renderStaticShadows(shadowSideAreas[side], sideArgs[side]);
+				sp::endPass();
+			}
 
-			gameShaders.shadowGridPipe.bind();
+			sp::beginPass(shadowCache.staticGridPass, &loadAction);
+			sg_apply_viewport(0, rowY, rowWidth, (int)cacheTileExtent, topLeft);
 
-			ShadowGrid_Pixel_t pu;
-			pu.depthSlices = (float)shadowCache.cacheTileSlices;
-			pu.volumeOrigin = volumeOrigin;
-			pu.volumeUnits = volumeExtent;
-			pu.volumeUnits.y /= shadowCache.cacheTileSlices;
+			gameShaders.shadowGridPipe.bind();
 			sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_ShadowGrid_Pixel, &pu, sizeof(pu));
-
-			sg_bindings bindings = { };
-			bindings.vertex_buffers[0] = gameShaders.fullscreenTriangleBuffer;
-			bindings.fs_images[SLOT_ShadowGrid_shadowDepth] = shadowCache.depthRenderCube.image;
 			sg_apply_bindings(&bindings);
+			sg_draw(0, 3, 1);
 
+			sp::endPass();
+			slot.staticDirty = false;
+		}
+
+		{
+			sg_bqq_subimage_rect rect = { };
+			rect.src_x = 0;
+			rect.src_y = rowY;
+			rect.width = rowWidth;
+			rect.height = (int)cacheTileExtent;
+
+			sg_bqq_subimage_copy_desc d = { };
+			d.src_image = shadowCache.staticGridAtlas.image;
+			d.dst_image = shadowCache.shadowCacheRender.image;
+			d.rects = &rect;
+			d.num_rects = 1;
+			d.num_mips = 1;
+			sg_bqq_copy_subimages(&d);
+		}
+
+		// Dynamic casters are multiplied on top of the static visibility
+		if (hasDynamicCasters) {
+			for (uint32_t side = 0; side < 6; side++) {
+				sp::beginPass(shadowCache.depthRenderPass[side], &action);
+				systems.renderDynamicShadows(shadowSideAreas[side], sideArgs[side]);
+				sp::endPass();
+			}
+
+			sp::beginPass(shadowCache.shadowCachePass, &loadAction);
+
+			gameShaders.shadowGridMulPipe.bind();
+			sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_ShadowGrid_Pixel, &pu, sizeof(pu));
+			sg_apply_bindings(&bindings);
 			sg_draw(0, 3, 1);
 
 			sp::endPass();
 		}
+		slot.dynamicDirty = false;
+		slot.hasDynamicCasters = hasDynamicCasters;
 
 		{
 			sf::SmallArray<sg_bqq_subimage_rect, 64> rects;
@@ -272,11 +528,15 @@ struct LightSystemImp final : LightSystem
 			if (oldest->pointId != ~0u) {
 				PointLightImp &point = pointLights[oldest->pointId];
 				point.shadowIndex = ~0u;
+				changedLights.push(point.sphere);
 			}
+			changedLights.push(pointLights[pointId].sphere);
 
 			oldest->pointId = pointId;
 			oldest->activeFrame = frameIndex;
 			oldest->updateFrame = 0;
+			oldest->staticDirty = true;
+			oldest->dynamicDirty = true;
 			return (uint32_t)(oldest - shadowSlots.data);
 		} else {
 			return ~0u;
@@ -347,6 +607,10 @@ struct LightSystemImp final : LightSystem
 		if (point.shadowIndex != ~0u) {
 			sf::Vec3 delta = point.sphere.origin - prev;
 			point.shadowBias -= point.shadowMul * delta;
+
+			ShadowSlot &slot = shadowSlots[point.shadowIndex];
+			slot.staticDirty = true;
+			slot.dynamicDirty = true;
 		}
 
 		systems.area->updateSphereArea(point.areaId, point.sphere);
@@ -389,6 +653,8 @@ struct LightSystemImp final : LightSystem
 
 	void updateLightFade(const FrameArgs &frameArgs) override
 	{
+		changedLights.clear();
+
 		float dt = frameArgs.dt;
 		for (uint32_t i = 0; i < fadingPointLightIds.size; i++) {
 			uint32_t pointId = fadingPointLightIds[i];
@@ -409,6 +675,7 @@ struct LightSystemImp final : LightSystem
 			}
 
 			point.currentColor = point.baseColor * point.fadeValue;
+			changedLights.push(point.sphere);
 
 			if (remove) {
 				pointLights[fadingPointLightIds.back()].fadeIndex = i;
@@ -439,30 +706,135 @@ struct LightSystemImp final : LightSystem
 		}
 	}
 
-	void queryVisiblePointLights(const VisibleAreas &visibleAreas, sf::Array<PointLight> &outPointLights, const sf::Bounds3 &bounds) const override
+	void updateLightGrid(const VisibleAreas &visibleAreas) override
 	{
-		if (g_settings.simpleShading) return;
-
-		for (uint32_t pointId : visibleAreas.get(AreaGroup::PointLight)) {
+		sf::Slice<const uint32_t> visible = visibleAreas.get(AreaGroup::PointLight);
+		if (g_settings.simpleShading) visible = { };
+		if (visible.size > MaxGridLights) visible.size = MaxGridLights;
+
+		// Selection only depends on the spheres and unfaded colors so the grid
+		// doesn't need to be rebuilt for fading lights or moving shadow slots
+		bool changed = visible.size != gridLights.size;
+		gridLights.resize(visible.size);
+		gridPointLights.resizeUninit(visible.size);
+		for (uint32_t i = 0; i < visible.size; i++) {
+			uint32_t pointId = visible[i];
 			const PointLightImp &point = pointLights[pointId];
-			if (sf::intersect(bounds, point.sphere)) {
-				PointLight &outPoint = outPointLights.push();
-				outPoint.position = point.sphere.origin;
-				outPoint.radius = point.sphere.radius;
-				outPoint.color = point.currentColor;
-				if (point.shadowIndex != ~0u) {
-					outPoint.shadowMul = point.shadowMul;
-					outPoint.shadowBias = point.shadowBias;
-				} else {
-					outPoint.shadowMul = sf::Vec3(0.0f);
-					outPoint.shadowBias = sf::Vec3(0.0f);
+			float luminance = sf::dot(point.baseColor, sf::Vec3(0.2126f, 0.7152f, 0.0722f));
+
+			GridLight &light = gridLights[i];
+			if (light.pointId != pointId || light.sphere.origin != point.sphere.origin || light.sphere.radius != point.sphere.radius || light.luminance != luminance) {
+				light.pointId = pointId;
+				light.sphere = point.sphere;
+				light.luminance = luminance;
+				changed = true;
+			}
+
+			PointLight &outPoint = gridPointLights[i];
+			outPoint.position = point.sphere.origin;
+			outPoint.radius = point.sphere.radius;
+			outPoint.color = point.currentColor;
+			if (point.shadowIndex != ~0u) {
+				outPoint.shadowMul = point.shadowMul;
+				outPoint.shadowBias = point.shadowBias;
+			} else {
+				outPoint.shadowMul = sf::Vec3(0.0f);
+				outPoint.shadowBias = sf::Vec3(0.0f);
+			}
+		}
+
+		if (changed) {
+			if (++gridVersion == 0) gridVersion = 1;
+			rebuildLightGrid();
+		}
+	}
+
+	uint32_t queryGridLightIndices(uint16_t *indices, uint32_t maxLights, const sf::Bounds3 &bounds) const override
+	{
+		GridRect rect;
+		if (!getGridRect(rect, bounds)) return 0;
+
+		// Single cell: Lights are already sorted by importance to the cell
+		if (rect.minX == rect.maxX && rect.minZ == rect.maxZ) {
+			uint32_t cell = rect.minZ * gridCellsX + rect.minX;
+			uint32_t numLights = 0;
+			for (uint32_t i = gridCellOffsets[cell]; i < gridCellOffsets[cell + 1]; i++) {
+				uint16_t index = gridCellLights[i];
+				if (!sf::intersect(bounds, gridLights[index].sphere)) continue;
+				indices[numLights++] = index;
+				if (numLights == maxLights) break;
+			}
+			return numLights;
+		}
+
+		sf::SmallArray<GridCandidate, 128> candidates;
+		for (uint32_t z = rect.minZ; z <= rect.maxZ; z++) {
+			for (uint32_t x = rect.minX; x <= rect.maxX; x++) {
+				uint32_t cell = z * gridCellsX + x;
+				for (uint32_t i = gridCellOffsets[cell]; i < gridCellOffsets[cell + 1]; i++) {
+					candidates.push({ 0.0f, gridCellLights[i] });
 				}
 			}
 		}
+
+		sf::sortBy(candidates, [](const GridCandidate &c) { return c.index; });
+
+		uint32_t numUnique = 0;
+		for (uint32_t i = 0; i < candidates.size; i++) {
+			uint16_t index = candidates[i].index;
+			if (i > 0 && index == candidates[i - 1].index) continue;
+			float importance = getLightImportance(gridLights[index], bounds);
+			if (importance < 0.0f) continue;
+			candidates[numUnique++] = { importance, index };
+		}
+		candidates.resizeUninit(numUnique);
+
+		sf::sort(candidates);
+
+		uint32_t numLights = sf::min(maxLights, candidates.size);
+		for (uint32_t i = 0; i < numLights; i++) {
+			indices[i] = candidates[i].index;
+		}
+		return numLights;
+	}
+
+	void queryGridLights(sf::Array<PointLight> &outPointLights, uint32_t maxLights, const sf::Bounds3 &bounds) const override
+	{
+		sf::SmallArray<uint16_t, 64> indices;
+		indices.resizeUninit(maxLights);
+		uint32_t numLights = queryGridLightIndices(indices.data, maxLights, bounds);
+		for (uint32_t i = 0; i < numLights; i++) {
+			outPointLights.push(gridPointLights[indices[i]]);
+		}
+	}
+
+	sf::Slice<const PointLight> getGridLights() const override
+	{
+		return gridPointLights;
+	}
+
+	uint32_t getLightGridVersion() const override
+	{
+		return gridVersion;
 	}
 
 	void renderShadowMaps(Systems &systems, const VisibleAreas &visibleAreas, uint64_t frameIndex) override
 	{
+		// Invalidate cached shadows touched by moved, added or removed casters
+		for (const AreaChange &change : systems.area->getChanges()) {
+			if ((change.areaFlags & Area::Shadow) == 0) continue;
+			bool isStatic = (change.groupMask & StaticCasterGroups) != 0;
+			bool isDynamic = (change.groupMask & DynamicCasterGroups) != 0;
+			if (!isStatic && !isDynamic) continue;
+
+			for (ShadowSlot &slot : shadowSlots) {
+				if (slot.pointId == ~0u) continue;
+				if (!sf::intersect(change.bounds, pointLights[slot.pointId].sphere)) continue;
+				if (isStatic) slot.staticDirty = true;
+				if (isDynamic) slot.dynamicDirty = true;
+			}
+		}
+
 		shadowsToUpdate.clear();
 		for (uint32_t pointId : visibleAreas.get(AreaGroup::PointLight)) {
 			PointLightImp &point = pointLights[pointId];
@@ -473,27 +845,43 @@ struct LightSystemImp final : LightSystem
 			}
 
 			if (point.shadowIndex != ~0u) {
-				shadowsToUpdate.push(point.shadowIndex);
-			}
+				ShadowSlot &slot = shadowSlots[point.shadowIndex];
+				slot.activeFrame = frameIndex;
 
+				// Animating characters don't show up as area changes, keep
+				// refreshing their shadows within the per-frame budget
+				if (slot.hasDynamicCasters) slot.dynamicDirty = true;
+
+				if (slot.staticDirty || slot.dynamicDirty) {
+					shadowsToUpdate.push(point.shadowIndex);
+				}
+			}
 		}
 
 		sf::sortBy(shadowsToUpdate, [&](uint32_t shadowIndex) {
 			return shadowSlots[shadowIndex].updateFrame;
 		});
 
-		uint32_t updatesLeft = 1;
+		// New shadows are always rendered, invalidated ones are refreshed
+		// oldest first a few at a time. Clean shadows are never re-rendered.
+		uint32_t refreshesLeft = MaxShadowRefreshesPerFrame;
 		for (uint32_t shadowIndex : shadowsToUpdate) {
 			ShadowSlot &slot = shadowSlots[shadowIndex];
-			renderPointLightShadows(systems, slot.pointId, shadowIndex);
+			if (slot.updateFrame != 0) {
+				if (refreshesLeft == 0) break;
+				refreshesLeft--;
+			}
 
-			if (slot.updateFrame != 0) updatesLeft--;
+			renderPointLightShadows(systems, shadowIndex);
 			slot.updateFrame = frameIndex;
-
-			if (updatesLeft == 0) break;
 		}
 	}
 
+	sf::Slice<const sf::Sphere> getChangedLights() const override
+	{
+		return changedLights;
+	}
+
 	virtual void setIblEnabled(bool enabled) override
 	{
 		iblEnabled = enabled;
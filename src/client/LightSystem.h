@@ -62,10 +62,29 @@ struct LightSystem : EntitySystem
 	virtual void updateLightFade(const FrameArgs &frameArgs) = 0;
 
 	virtual void queryVisiblePointLights(const VisibleAreas &visibleAreas, sf::Array<PointLight> &pointLights, const PointLightFilter &filter={}) const = 0;
-	virtual void queryVisiblePointLights(const VisibleAreas &visibleAreas, sf::Array<PointLight> &pointLights, const sf::Bounds3 &bounds) const = 0;
+
+	// Light grid: Visible point lights binned into world-space XZ cells once per
+	// frame so objects can look up their most important lights cheaply.
+	// `updateLightGrid()` must be called before any queries during a frame.
+	virtual void updateLightGrid(const VisibleAreas &visibleAreas) = 0;
+
+	// Write indices into `getGridLights()` of up to `maxLights` lights touching
+	// `bounds` ordered by decreasing importance, returns the number of lights.
+	virtual uint32_t queryGridLightIndices(uint16_t *indices, uint32_t maxLights, const sf::Bounds3 &bounds) const = 0;
+	virtual void queryGridLights(sf::Array<PointLight> &pointLights, uint32_t maxLights, const sf::Bounds3 &bounds) const = 0;
+	virtual sf::Slice<const PointLight> getGridLights() const = 0;
+
+	// Changes whenever the results of `queryGridLightIndices()` may change,
+	// never zero so it can be used to invalidate cached indices.
+	virtual uint32_t getLightGridVersion() const = 0;
 
 	virtual void renderShadowMaps(Systems &systems, const VisibleAreas &visibleAreas, uint64_t frameIndex) = 0;
 
+	// Lights whose color or shadow slot changed during the current frame,
+	// moved lights are reported through `AreaSystem::getChanges()` instead.
+	// Reset by `updateLightFade()`, complete after `renderShadowMaps()`.
+	virtual sf::Slice<const sf::Sphere> getChangedLights() const = 0;
+
 	virtual void setIblEnabled(bool enabled) = 0;
 
 	virtual sg_image getShadowTexture() const = 0;
@@ -1,10 +1,9 @@
 #include "MeshMaterial.h"
 
-#include "MeshMaterial.h"
-
 #include "ext/sokol/sokol_gfx.h"
 #include "ext/sp_tools_common.h"
 #include "sp/ContentFile.h"
+#include "sp/JobSystem.h"
 #include "sf/String.h"
 
 #include "client/ClientSettings.h"
@@ -47,12 +46,108 @@ struct MeshMaterialImp : MeshMaterial
 	virtual void assetUnload() final;
 
 	uint32_t textureLoadedMask = 0;
+	size_t gpuBytes = 0;
 };
 
 sp::AssetType MeshMaterial::SelfType = { "MeshMaterial", sizeof(MeshMaterialImp), sizeof(MeshMaterial::PropType),
 	[](Asset *a) { new ((MeshMaterialImp*)a) MeshMaterialImp(); }
 };
 
+// Materials are first loaded using only the mips up to `PreviewExtent`,
+// the full mip chain is decoded and swapped in later on a job worker.
+static const uint32_t PreviewExtent = 64;
+
+struct MeshTextureRefineJob
+{
+	MeshMaterialImp *imp;
+	sf::Symbol name; // < Copied as `imp` may be reset by a reload
+	MaterialTexture texture;
+	uint32_t previewId;
+	sp::ContentFileData data;
+
+	MeshTextureRefineJob(MeshMaterialImp *imp, MaterialTexture texture, uint32_t previewId, const sp::ContentFile &file)
+		: imp(imp), name(imp->name), texture(texture), previewId(previewId), data(file) { }
+};
+
+// Decode and upload the mips of a texture starting from the first one that fits in `maxExtent`.
+// Returns the image (zero on failure), `mipBase` is the first mip used and `fullBytes` the
+// size of the whole mip chain.
+static sg_image makeTextureImage(const sf::Symbol &assetName, MaterialTexture texture, const void *data, size_t size, uint32_t maxExtent, uint32_t &mipBase, size_t &fullBytes)
+{
+	sptex_util su;
+	sptex_util_init(&su, data, size);
+
+	sptex_header header = sptex_decode_header(&su);
+	uint32_t numMips = header.info.num_mips;
+
+	uint32_t extent = sf::max((uint32_t)header.info.width, (uint32_t)header.info.height);
+	mipBase = 0;
+	while (mipBase + 1 < numMips && extent >> mipBase > maxExtent) {
+		mipBase++;
+	}
+
+	sg_image_desc d = { };
+	d.pixel_format = MeshMaterial::materialFormats[(uint32_t)texture];
+	d.num_mipmaps = (int)(numMips - mipBase);
+	d.width = sf::max((int)header.info.width >> mipBase, 1);
+	d.height = sf::max((int)header.info.height >> mipBase, 1);
+	d.bqq_lod_bias = g_settings.materialLodBias;
+	initSampler(d, g_settings);
+
+	sf::SmallStringBuf<128> name;
+	name.append(assetName);
+	switch (texture) {
+	case MaterialTexture::Albedo: name.append(" albedo"); break;
+	case MaterialTexture::Normal: name.append(" normal"); break;
+	case MaterialTexture::Mask: name.append(" mask"); break;
+	case MaterialTexture::Count: /* nop */ break;
+	}
+	d.label = name.data;
+
+	fullBytes = 0;
+	for (uint32_t mipI = 0; mipI < numMips; mipI++) {
+		fullBytes += header.s_mips[mipI].uncompressed_size;
+		if (mipI < mipBase) continue;
+		d.content.subimage[0][mipI - mipBase].ptr = sptex_decode_mip(&su, mipI);
+		d.content.subimage[0][mipI - mipBase].size = header.s_mips[mipI].uncompressed_size;
+	}
+
+	sg_image image = { };
+	if (!spfile_util_failed(&su.file)) {
+		sp::ContentFile::mainThreadCallbackFunc([&](){
+			image = sg_make_image(&d);
+		});
+	}
+
+	spfile_util_free(&su.file);
+
+	return image;
+}
+
+static void refineTextureJob(void *user)
+{
+	MeshTextureRefineJob *job = (MeshTextureRefineJob*)user;
+	MeshMaterialImp *imp = job->imp;
+	uint32_t texIndex = (uint32_t)job->texture;
+
+	uint32_t mipBase;
+	size_t fullBytes;
+	sg_image image = makeTextureImage(job->name, job->texture, job->data.data, job->data.size, UINT32_MAX, mipBase, fullBytes);
+
+	sp::ContentFile::mainThreadCallbackFunc([&](){
+		// The preview may have been unloaded or replaced by a reload meanwhile
+		if (image.id != 0 && imp->images[texIndex].id == job->previewId) {
+			sg_destroy_image(imp->images[texIndex]);
+			imp->images[texIndex] = image;
+		} else if (image.id != 0) {
+			sg_destroy_image(image);
+		}
+		imp->release();
+	});
+
+	delete job;
+}
+
 static void loadTextureImp(void *user, const sp::ContentFile &file, MaterialTexture texture)
 {
 	MeshMaterialImp *imp = (MeshMaterialImp*)user;
@@ -63,50 +158,22 @@ static void loadTextureImp(void *user, const sp::ContentFile &file, MaterialText
 	bool allLoaded = imp->textureLoadedMask == (1 << (uint32_t)MaterialTexture::Count) - 1;
 
 	if (file.size > 0) {
-		sptex_util su;
-		sptex_util_init(&su, file.data, file.size);
-
-		sptex_header header = sptex_decode_header(&su);
-
-		sg_image_desc d = { };
-		d.pixel_format = MeshMaterial::materialFormats[(uint32_t)texture];
-		d.num_mipmaps = header.info.num_mips;
-		d.width = header.info.width;
-		d.height = header.info.height;
-        d.bqq_lod_bias = g_settings.materialLodBias;
-        initSampler(d, g_settings);
-
-        sf::SmallStringBuf<128> name;
-        name.append(imp->name);
-        switch (texture) {
-        case MaterialTexture::Albedo: name.append(" albedo"); break;
-        case MaterialTexture::Normal: name.append(" normal"); break;
-        case MaterialTexture::Mask: name.append(" mask"); break;
-        case MaterialTexture::Count: /* nop */ break;
-        }
-        d.label = name.data;
-
-		uint32_t mipDrop = 0;
-
-        // TODO: Mip drop
-#if 0
-		while (extent > atlas.textureExtent) {
-			extent /= 2;
-			mipDrop++;
-		}
-		sf_assert(extent == atlas.textureExtent);
-#endif
-
-		for (uint32_t mipI = 0; mipI < (uint32_t)d.num_mipmaps; mipI++) {
-			d.content.subimage[0][mipI].ptr = sptex_decode_mip(&su, mipDrop + mipI);
-			d.content.subimage[0][mipI].size = header.s_mips[mipDrop + mipI].uncompressed_size;
+		// Streaming in the full mips only makes sense if there's a worker to do it
+		bool progressive = sp::JobSystem::getNumThreads() > 1;
+		uint32_t maxExtent = progressive ? PreviewExtent : UINT32_MAX;
+
+		uint32_t mipBase;
+		size_t fullBytes;
+		sg_image image = makeTextureImage(imp->name, texture, file.data, file.size, maxExtent, mipBase, fullBytes);
+		imp->images[(uint32_t)texture] = image;
+		imp->gpuBytes += fullBytes;
+
+		if (image.id != 0 && mipBase > 0) {
+			// Keep the asset alive until the full texture is uploaded
+			imp->retain();
+			MeshTextureRefineJob *job = new MeshTextureRefineJob(imp, texture, image.id, file);
+			sp::JobSystem::runAsync(&refineTextureJob, job);
 		}
-
-        sp::ContentFile::mainThreadCallbackFunc([&](){
-			imp->images[(uint32_t)texture] = sg_make_image(&d);
-        });
-
-		spfile_util_free(&su.file);
 	}
 
 	if (allLoaded) {
@@ -118,6 +185,7 @@ static void loadTextureImp(void *user, const sp::ContentFile &file, MaterialText
             }
         }
         if (allGood) {
+			imp->assetSetMemoryUsage(0, imp->gpuBytes);
 			imp->assetFinishLoading();
         } else {
 			imp->assetFailLoading();
@@ -68,10 +68,12 @@ static void loadTextureImp(void *user, const sp::ContentFile &file)
 			d.label = imp->name.data;
 
 			uint32_t mipDrop = 0;
+			size_t gpuBytes = 0;
 
 			for (uint32_t mipI = 0; mipI < (uint32_t)d.num_mipmaps; mipI++) {
 				d.content.subimage[0][mipI].ptr = sptex_decode_mip(&su, mipDrop + mipI);
 				d.content.subimage[0][mipI].size = header.s_mips[mipDrop + mipI].uncompressed_size;
+				gpuBytes += header.s_mips[mipDrop + mipI].uncompressed_size;
 			}
 			
 			if (!spfile_util_failed(&su.file)) {
@@ -80,6 +82,7 @@ static void loadTextureImp(void *user, const sp::ContentFile &file)
 					imp->image = sg_make_image(&d);
 				});
 
+				imp->assetSetMemoryUsage(0, gpuBytes);
 				ok = true;
 			}
 		}
@@ -10,6 +10,7 @@
 #include "client/MeshMaterial.h"
 
 #include "sf/Array.h"
+#include "sf/Sort.h"
 
 #include "sp/Model.h"
 
@@ -37,6 +38,9 @@ static const sf::Slice<const spmdl_attrib> vertexFormatAttribs[] = {
 
 struct ModelSystemImp final : ModelSystem
 {
+	static const constexpr uint32_t MaxLights = 16;
+	static const constexpr uint32_t InitialInstancesPerFrame = 4096;
+
 	enum class VertexFormat
 	{
 		Tile,
@@ -68,6 +72,13 @@ struct ModelSystemImp final : ModelSystem
 
 		sf::Mat34 modelToEntity;
 		sf::Mat34 modelToWorld;
+		sf::Mat34 worldToModel; // < Cached `sf::inverse(modelToWorld)` for picking
+
+		// Indices to `LightSystem::getGridLights()` for `worldBounds`,
+		// valid if `lightGridVersion` matches the current light grid
+		uint32_t lightGridVersion = 0;
+		uint32_t numLights = 0;
+		uint16_t lightIndices[MaxLights];
 
 		bool isLoading() const {
 			if (model.isLoading()) return true;
@@ -100,6 +111,41 @@ struct ModelSystemImp final : ModelSystem
 	Shader2 meshShader;
 	sp::Pipeline meshPipes[(uint32_t)VertexFormat::Count];
 
+	// Per-instance vertex data, rows of `Model::modelToWorld`
+	struct InstanceData
+	{
+		sf::Vec4 worldRows[3];
+	};
+
+	sp::Buffer instanceBuffer;
+	uint32_t instanceBufferCapacity = 0;
+	sf::Array<InstanceData> instanceData;
+
+	struct DrawInstance
+	{
+		VertexFormat vertexFormat;
+		sp::Model *model;
+		MeshMaterial *material;
+		sg_image envmap;
+		uint32_t modelId;
+
+		bool operator<(const DrawInstance &rhs) const {
+			if (vertexFormat != rhs.vertexFormat) return vertexFormat < rhs.vertexFormat;
+			if (model != rhs.model) return model < rhs.model;
+			if (material != rhs.material) return material < rhs.material;
+			if (envmap.id != rhs.envmap.id) return envmap.id < rhs.envmap.id;
+			return modelId < rhs.modelId;
+		}
+	};
+
+	sf::Array<DrawInstance> drawInstances;
+
+	void initInstanceBuffer(uint32_t numInstances)
+	{
+		instanceBuffer.initDynamicVertex("ModelSystem instanceBuffer", sizeof(InstanceData) * numInstances);
+		instanceBufferCapacity = numInstances;
+	}
+
 	void finishLoadingModel(AreaSystem *areaSystem, uint32_t modelId)
 	{
 		Model &model = models[modelId];
@@ -143,6 +189,7 @@ struct ModelSystemImp final : ModelSystem
 			model.modelBounds = sf::boundsUnion(model.modelBounds, model.shadowModel->bounds);
 		}
 		model.worldBounds = sf::transformBounds(model.modelToWorld, model.modelBounds);
+		model.lightGridVersion = 0;
 
 		if (model.areaId != ~0u) {
 			areaSystem->updateBoxArea(model.areaId, model.worldBounds);
@@ -179,6 +226,8 @@ struct ModelSystemImp final : ModelSystem
 		meshShader = getShader2(SpShader_DynamicMesh, permutation);
 
 
+		initInstanceBuffer(InitialInstancesPerFrame);
+
 		uint32_t flags = sp::PipeDepthWrite|sp::PipeCullCCW|sp::PipeIndex16;
 
 		{
@@ -187,6 +236,7 @@ struct ModelSystemImp final : ModelSystem
 			d.layout.attrs[1].format = SG_VERTEXFORMAT_FLOAT3;
 			d.layout.attrs[2].format = SG_VERTEXFORMAT_FLOAT4;
 			d.layout.attrs[3].format = SG_VERTEXFORMAT_FLOAT2;
+			initInstanceLayout(d);
 		}
 
 		{
@@ -195,15 +245,28 @@ struct ModelSystemImp final : ModelSystem
 			d.layout.attrs[1].format = SG_VERTEXFORMAT_SHORT4N;
 			d.layout.attrs[2].format = SG_VERTEXFORMAT_SHORT4N;
 			d.layout.attrs[3].format = SG_VERTEXFORMAT_FLOAT2;
+			initInstanceLayout(d);
 		}
 	}
 
-	sf::Box<void> preloadModel(const sv::DynamicModelComponent &c) override
+	static void initInstanceLayout(sg_pipeline_desc &d)
+	{
+		d.layout.buffers[1].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+		for (uint32_t i = 4; i <= 6; i++) {
+			d.layout.attrs[i].format = SG_VERTEXFORMAT_FLOAT4;
+			d.layout.attrs[i].buffer_index = 1;
+		}
+	}
+
+	sf::Box<void> preloadModel(sf::Array<sp::Asset*> &assets, const sv::DynamicModelComponent &c) override
 	{
 		auto data = sf::box<ModelData>();
 		data->model.load(c.model);
 		if (c.shadowModel) data->shadowModel.load(c.shadowModel);
 		if (c.material) data->material.load(c.material);
+		if (data->model) assets.push(data->model);
+		if (data->shadowModel) assets.push(data->shadowModel);
+		if (data->material) assets.push(data->material);
 		return data;
 	}
 
@@ -221,6 +284,7 @@ struct ModelSystemImp final : ModelSystem
 
 		model.modelToEntity = getComponentTransform(c);
 		model.modelToWorld = transform.asMatrix() * model.modelToEntity;
+		model.worldToModel = sf::inverse(model.modelToWorld);
 
 		model.model.load(c.model);
 		if (c.castShadows) {
@@ -237,19 +301,40 @@ struct ModelSystemImp final : ModelSystem
 		systems.entities.addComponent(entityId, this, modelId, 0, componentIndex, Entity::UpdateTransform);
 	}
 
+	void updateTransformImp(Model &model, const TransformUpdate &update)
+	{
+		model.modelToWorld = update.entityToWorld * model.modelToEntity;
+		model.worldToModel = sf::inverse(model.modelToWorld);
+		model.worldBounds = sf::transformBounds(model.modelToWorld, model.modelBounds);
+		model.lightGridVersion = 0;
+	}
+
 	void updateTransform(Systems &systems, uint32_t entityId, const EntityComponent &ec, const TransformUpdate &update) override
 	{
 		uint32_t modelId = ec.userId;
 		Model &model = models[modelId];
 
-		model.modelToWorld = update.entityToWorld * model.modelToEntity;
-		model.worldBounds = sf::transformBounds(model.modelToWorld, model.modelBounds);
+		updateTransformImp(model, update);
 
 		if (model.areaId != ~0u) {
 			systems.area->updateBoxArea(model.areaId, model.worldBounds);
 		}
 	}
 
+	void updateTransforms(Systems &systems, sf::Slice<const EntityTransformUpdate> updates) override
+	{
+		for (const EntityTransformUpdate &u : updates) {
+			updateTransformImp(models[u.component.userId], *u.update);
+		}
+
+		for (const EntityTransformUpdate &u : updates) {
+			const Model &model = models[u.component.userId];
+			if (model.areaId != ~0u) {
+				systems.area->updateBoxArea(model.areaId, model.worldBounds);
+			}
+		}
+	}
+
 	void remove(Systems &systems, uint32_t entityId, const EntityComponent &ec) override
 	{
 		uint32_t modelId = ec.userId;
@@ -280,10 +365,71 @@ struct ModelSystemImp final : ModelSystem
 		}
 	}
 
+	void updateModelLights(const LightSystem *lightSystem, Model &model)
+	{
+		uint32_t version = lightSystem->getLightGridVersion();
+		if (model.lightGridVersion == version) return;
+		model.lightGridVersion = version;
+		model.numLights = lightSystem->queryGridLightIndices(model.lightIndices, MaxLights, model.worldBounds);
+	}
+
+	// Add the lights of `model` to `lights` unless the union would exceed `MaxLights`
+	static bool mergeLights(uint16_t *lights, uint32_t &numLights, const Model &model)
+	{
+		uint32_t num = numLights;
+		for (uint32_t i = 0; i < model.numLights; i++) {
+			uint16_t index = model.lightIndices[i];
+			bool found = false;
+			for (uint32_t j = 0; j < num; j++) {
+				if (lights[j] == index) {
+					found = true;
+					break;
+				}
+			}
+			if (found) continue;
+			if (num >= MaxLights) return false;
+			lights[num++] = index;
+		}
+		numLights = num;
+		return true;
+	}
+
 	void renderMain(const LightSystem *lightSystem, const EnvLightSystem *envLightSystem, VisFogSystem *visFogSystem,const VisibleAreas &visibleAreas, const RenderArgs &renderArgs) override
 	{
-		sf::SmallArray<cl::PointLight, 64> pointLights;
-		const uint32_t maxLights = 16;
+		// Sort visible models so that consecutive instances of the same model
+		// and material can be drawn as a single instanced batch
+		drawInstances.clear();
+		for (uint32_t modelId : visibleAreas.get(AreaGroup::DynamicModel)) {
+			Model &model = models[modelId];
+			DrawInstance &inst = drawInstances.push();
+			inst.vertexFormat = model.vertexFormat;
+			inst.model = model.model.ptr;
+			inst.material = model.material.ptr;
+			inst.envmap = lightSystem->getEnvmapTexture(model.worldBounds);
+			inst.modelId = modelId;
+		}
+		if (drawInstances.size == 0) return;
+		sf::sort(drawInstances);
+
+		instanceData.resizeUninit(drawInstances.size);
+		for (uint32_t i = 0; i < drawInstances.size; i++) {
+			Model &model = models[drawInstances[i].modelId];
+			updateModelLights(lightSystem, model);
+
+			InstanceData &data = instanceData[i];
+			data.worldRows[0] = model.modelToWorld.getRow(0);
+			data.worldRows[1] = model.modelToWorld.getRow(1);
+			data.worldRows[2] = model.modelToWorld.getRow(2);
+		}
+
+		// Instance data is only referenced by this frame's draws so the buffer
+		// can be re-created, see `ParticleSystem::uploadEffectsImp()`
+		if (instanceData.size > instanceBufferCapacity) {
+			initInstanceBuffer(sf::max(instanceData.size, instanceBufferCapacity * 2));
+		}
+
+		int baseOffset = sg_append_buffer(instanceBuffer.buffer, instanceData.data, (int)instanceData.byteSize());
+		sf_assert(!sg_query_buffer_overflow(instanceBuffer.buffer));
 
 		UBO_DynamicTransform tu;
 		UBO_Pixel pu;
@@ -291,61 +437,70 @@ struct ModelSystemImp final : ModelSystem
 		EnvLightAltas envLight = envLightSystem->getEnvLightAtlas();
 		VisFogImage visFog = visFogSystem->getVisFogImage();
 
+		tu.worldToClip = renderArgs.worldToClip;
+		pu.cameraPosition = renderArgs.cameraPosition;
+		pu.diffuseEnvmapMad = envLight.worldMad;
+		pu.visFogMad = visFog.worldMad;
+
+		sf::Slice<const PointLight> gridLights = lightSystem->getGridLights();
+
 		sg_bindings bindings = { };
 		bindImageFS(meshShader, bindings, CL_SHADOWCACHE_TEX, lightSystem->getShadowTexture());
 		bindImageFS(meshShader, bindings, TEX_diffuseEnvmapAtlas, envLight.image);
 		bindImageFS(meshShader, bindings, TEX_visFogTexture, visFog.image);
+		bindings.vertex_buffers[1] = instanceBuffer.buffer;
+
+		const DrawInstance *prev = nullptr;
+		uint32_t begin = 0;
+		while (begin < drawInstances.size) {
+			const DrawInstance &inst = drawInstances[begin];
+
+			// Extend the batch over instances sharing the model and material as long
+			// as the union of their lights fits in the uniforms. Point lights are cut
+			// off at their radius so the extra lights don't affect other instances.
+			uint16_t lightIndices[MaxLights];
+			uint32_t numLights = 0;
+			uint32_t end = begin;
+			for (; end < drawInstances.size; end++) {
+				const DrawInstance &other = drawInstances[end];
+				if (other.vertexFormat != inst.vertexFormat || other.model != inst.model) break;
+				if (other.material != inst.material || other.envmap.id != inst.envmap.id) break;
+				if (!mergeLights(lightIndices, numLights, models[other.modelId])) break;
+			}
 
-		for (uint32_t modelId : visibleAreas.get(AreaGroup::DynamicModel)) {
-			Model &model = models[modelId];
-
-			sg_image envmap = lightSystem->getEnvmapTexture(model.worldBounds);
-			bindImageFS(meshShader, bindings, TEX_envmap, envmap);
-
-			sp::Pipeline &pipe = meshPipes[(uint32_t)model.vertexFormat];
-			tu.modelToWorld = model.modelToWorld;
-			tu.worldToClip = renderArgs.worldToClip;
-
-			sf::Bounds3 bounds = sf::transformBounds(model.modelToWorld, model.modelBounds);
-
-			pointLights.clear();
-			lightSystem->queryVisiblePointLights(visibleAreas, pointLights, bounds);
-
-			// TODO: Prioritize
-			if (pointLights.size > maxLights) {
-				pointLights.resizeUninit(maxLights);
+			if (!prev || prev->vertexFormat != inst.vertexFormat) {
+				meshPipes[(uint32_t)inst.vertexFormat].bind();
 			}
+			prev = &inst;
 
-			pu.numLightsF = (float)pointLights.size;
-			pu.cameraPosition = renderArgs.cameraPosition;
-			pu.diffuseEnvmapMad = envLight.worldMad;
-			pu.visFogMad = visFog.worldMad;
+			pu.numLightsF = (float)numLights;
 			sf::Vec4 *dst = pu.pointLightData;
-			for (PointLight &light : pointLights) {
+			for (uint32_t i = 0; i < numLights; i++) {
+				PointLight light = gridLights[lightIndices[i]];
 				light.writeShader(dst);
 			}
 
-			pipe.bind();
+			sg_image *images = inst.material ? inst.material->images : MeshMaterial::defaultImages;
+			bindImageFS(meshShader, bindings, TEX_envmap, inst.envmap);
+			bindImageFS(meshShader, bindings, TEX_albedoTexture, images[(uint32_t)MaterialTexture::Albedo]);
+			bindImageFS(meshShader, bindings, TEX_normalTexture, images[(uint32_t)MaterialTexture::Normal]);
+			bindImageFS(meshShader, bindings, TEX_maskTexture, images[(uint32_t)MaterialTexture::Mask]);
+			bindings.vertex_buffer_offsets[1] = baseOffset + (int)(begin * sizeof(InstanceData));
 
-			bindUniformVS(meshShader, tu);
-			bindUniformFS(meshShader, pu);
-
-			for (sp::Mesh &mesh : model.model->meshes) {
-
-				sg_image *images = model.material ? model.material->images : MeshMaterial::defaultImages;
-				bindImageFS(meshShader, bindings, TEX_albedoTexture, images[(uint32_t)MaterialTexture::Albedo]);
-				bindImageFS(meshShader, bindings, TEX_normalTexture, images[(uint32_t)MaterialTexture::Normal]);
-				bindImageFS(meshShader, bindings, TEX_maskTexture, images[(uint32_t)MaterialTexture::Mask]);
-
-				bindings.index_buffer = model.model->indexBuffer.buffer;
+			for (sp::Mesh &mesh : inst.model->meshes) {
+				bindings.index_buffer = inst.model->indexBuffer.buffer;
 				bindings.index_buffer_offset = mesh.indexBufferOffset;
-				bindings.vertex_buffers[0] = model.model->vertexBuffer.buffer;
+				bindings.vertex_buffers[0] = inst.model->vertexBuffer.buffer;
 				bindings.vertex_buffer_offsets[0] = mesh.streams[0].offset;
 				sg_apply_bindings(&bindings);
 
-				sg_draw(0, mesh.numIndices, 1);
+				bindUniformVS(meshShader, tu);
+				bindUniformFS(meshShader, pu);
+
+				sg_draw(0, mesh.numIndices, (int)(end - begin));
 			}
 
+			begin = end;
 		}
 	}
 
@@ -369,7 +524,7 @@ struct ModelSystemImp final : ModelSystem
 		const Model &model = models[modelId];
 		if (!model.isLoaded()) return;
 
-		float t = model.model->castModelRay(ray.ray, model.modelToWorld);
+		float t = model.model->castModelRay(sf::transformRay(model.worldToModel, ray.ray));
 		if (t < HUGE_VALF) {
 			hits.push({ model.entityId, t });
 		}
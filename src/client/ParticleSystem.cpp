@@ -6,9 +6,11 @@
 #include "sf/Frustum.h"
 #include "sf/Random.h"
 #include "sf/Float4.h"
+#include "sf/Float8.h"
 #include "sf/Sort.h"
 
 #include "sp/Renderer.h"
+#include "sp/JobSystem.h"
 
 #include "client/ParticleTexture.h"
 #include "client/BSpline.h"
@@ -21,9 +23,12 @@
 
 namespace cl {
 
-static const constexpr uint32_t MaxParticlesPerFrame = 4*1024;
+static const constexpr uint32_t InitialParticlesPerFrame = 4*1024;
 static const constexpr uint32_t MaxParticleCacheFrames = 16;
 
+// Limited by the shared quad index buffer
+static const constexpr uint32_t MaxParticlesPerDraw = 16*1024;
+
 static const constexpr float HugeParticleLife = 1e20f;
 static const constexpr float HugeParticleLifeCmp = 1e19f;
 
@@ -213,13 +218,19 @@ struct ParticleSystemImp final : ParticleSystem
 		uint32_t uploadByteOffset = 0;
 		uint64_t uploadFrameIndex = MaxParticleCacheFrames;
 		sf::Array<Particle4> particles; // TODO: Alignment
-		sf::Array<GpuParticle> gpuParticles;
 		sf::Array<uint32_t> freeIndices;
+
+		// Particles written by `writeGpuParticlesImp()`, alive or died during the last step
+		uint32_t numGpuParticles = 0;
+
+		// Per-effect so effects can be simulated in parallel deterministically
+		sf::Random rng;
 	};
 
-	struct ParticleUpdateCtx
+	struct EffectUpload
 	{
-		sf::Random rng;
+		uint32_t effectId;
+		uint32_t particleOffset;
 	};
 
 	struct SortedEffect
@@ -248,7 +259,11 @@ struct ParticleSystemImp final : ParticleSystem
 	sf::Array<SortedEffect> sortedEffects;
 
 	sf::Random initRng;
-	ParticleUpdateCtx updateCtx;
+	sf::Random effectRng;
+
+	sf::Array<uint32_t> effectsToSimulate;
+	sf::Array<EffectUpload> effectUploads;
+	sf::Array<GpuParticle> uploadParticles;
 
 	static constexpr const uint32_t SplineSampleRate = 64;
 	static constexpr const uint32_t SplineAtlasWidth = 8;
@@ -259,17 +274,24 @@ struct ParticleSystemImp final : ParticleSystem
 	sp::Texture splineTexture;
 
 	sp::Buffer vertexBuffers[MaxParticleCacheFrames];
+	uint32_t vertexBufferCapacity[MaxParticleCacheFrames]; // < In particles
 	sp::Pipeline particlePipe;
 	uint64_t bufferFrameIndex = MaxParticleCacheFrames;
 
+	void initVertexBuffer(uint32_t index, uint32_t numParticles)
+	{
+		sf::SmallStringBuf<128> name;
+		name.format("particle vertexBuffer %u", index);
+		vertexBuffers[index].initDynamicVertex(name.data, sizeof(GpuParticle) * 4 * numParticles);
+		vertexBufferCapacity[index] = numParticles;
+	}
+
 	ParticleSystemImp(const SystemsDesc &desc)
 	{
-		updateCtx.rng = sf::Random(desc.seed[1], 581271);
+		effectRng = sf::Random(desc.seed[1], 581271);
 
 		for (uint32_t i = 0; i < MaxParticleCacheFrames; i++) {
-			sf::SmallStringBuf<128> name;
-			name.format("particle vertexBuffer %u", i);
-			vertexBuffers[i].initDynamicVertex(name.data, sizeof(GpuParticle) * 4 * MaxParticlesPerFrame);
+			initVertexBuffer(i, InitialParticlesPerFrame);
 		}
 
 		{
@@ -449,9 +471,11 @@ struct ParticleSystemImp final : ParticleSystem
 		sg_destroy_image(staging);
 	}
 
-	void simulateParticlesImp(sf::Random &rng, Effect &effect, float dt)
+	// Only touches `effect` so this can run for multiple effects in parallel
+	void simulateParticlesImp(Effect &effect, float dt)
 	{
-		EffectType &type = types[effect.typeId];
+		sf::Random &rng = effect.rng;
+		const EffectType &type = types[effect.typeId];
 		const sv::ParticleSystemComponent &comp = *type.svComponent;
 
 		bool firstEmit = effect.firstEmit;
@@ -470,9 +494,6 @@ struct ParticleSystemImp final : ParticleSystem
 			}
 		}
 
-		sf::Float4 dt4 = dt;
-		sf::ScalarFloat4 drag4 = comp.drag;
-
 		// Update spawning (scalar)
 		effect.spawnTimer -= dt;
 		int spawnsLeft = 20;
@@ -524,16 +545,9 @@ struct ParticleSystemImp final : ParticleSystem
 		effect.spawnTimer = sf::max(effect.spawnTimer, 0.0f);
 
 		// Integration
-		size_t numGpuParticles = effect.particles.size * (4 * 4);
-		effect.gpuParticles.reserveGeometric(numGpuParticles);
-		effect.gpuParticles.resizeUninit(numGpuParticles);
-		GpuParticle *dst = effect.gpuParticles.data;
-
+		uint32_t numGpuParticles = 0;
 		sf::Float4 pMin = +HUGE_VALF, pMax = -HUGE_VALF;
 
-		sf::ScalarAddFloat4 lifeTime = comp.lifeTime;
-		sf::ScalarFloat4 lifeTimeVariance = comp.lifeTimeVariance * (1.0f / 16777216.0f);
-
 		sf::Float4 rcpDt4 = 1.0f / dt;
 
 		sf::SmallArray<sv::GravityPoint, 16> localGravityPoints;
@@ -549,63 +563,128 @@ struct ParticleSystemImp final : ParticleSystem
 			lp.strength = -p.strength;
 		}
 
-		for (Particle4 &p : effect.particles) {
+		sf::Float8 dt8 = dt;
+		sf::Float8 drag8 = comp.drag;
+		sf::Float8 lifeTime8 = comp.lifeTime;
+		sf::Float8 lifeTimeVariance8 = comp.lifeTimeVariance * (1.0f / 16777216.0f);
 
-			sf::Float4 life = p.life;
+		// Integrate two `Particle4` blocks at a time, an odd last block is paired with itself
+		Particle4 *parts = effect.particles.data;
+		uint32_t numParts = effect.particles.size;
+		for (uint32_t partI = 0; partI < numParts; partI += 2) {
+			uint32_t numBlocks = partI + 1 < numParts ? 2 : 1;
+			Particle4 &p0 = parts[partI];
+			Particle4 &p1 = parts[partI + numBlocks - 1];
 
-			if (!life.allGreaterThanZero()) {
-				uint32_t base = (uint32_t)(&p - effect.particles.data) * 4;
+			for (uint32_t blockI = 0; blockI < numBlocks; blockI++) {
+				Particle4 &p = parts[partI + blockI];
+				if (p.life.allGreaterThanZero()) continue;
+
+				uint32_t base = (partI + blockI) * 4;
 				float lifes[4];
-				life.storeu(lifes);
+				p.life.storeu(lifes);
 				for (uint32_t i = 0; i < 4; i++) {
 					if (lifes[i] <= 0.0f) {
 						effect.freeIndices.push(base + i);
 						lifes[i] = HugeParticleLife;
 					}
 				}
-				life = sf::Float4::loadu(lifes);
+				p.life = sf::Float4::loadu(lifes);
 			}
 
-			sf::Float4 seed = p.seed;
+			sf::Float8 life = sf::Float8(p0.life, p1.life);
+			sf::Float8 seed = sf::Float8(p0.seed, p1.seed);
 
-			sf::Float4 px = p.px, py = p.py, pz = p.pz;
-			sf::Float4 vx = p.vx, vy = p.vy, vz = p.vz;
+			sf::Float8 px = sf::Float8(p0.px, p1.px), py = sf::Float8(p0.py, p1.py), pz = sf::Float8(p0.pz, p1.pz);
+			sf::Float8 vx = sf::Float8(p0.vx, p1.vx), vy = sf::Float8(p0.vy, p1.vy), vz = sf::Float8(p0.vz, p1.vz);
 
-			sf::Float4 ax = effect.gravity.x;
-			sf::Float4 ay = effect.gravity.y;
-			sf::Float4 az = effect.gravity.z;
-			ax -= vx * drag4;
-			ay -= vy * drag4;
-			az -= vz * drag4;
+			sf::Float8 ax = effect.gravity.x;
+			sf::Float8 ay = effect.gravity.y;
+			sf::Float8 az = effect.gravity.z;
+			ax -= vx * drag8;
+			ay -= vy * drag8;
+			az -= vz * drag8;
 
 			for (const sv::GravityPoint &p : localGravityPoints) {
-				sf::Float4 dx = px - p.position.x;
-				sf::Float4 dy = py - p.position.y;
-				sf::Float4 dz = pz - p.position.z;
-				sf::Float4 lenSq = (dx*dx + dy*dy + dz*dz) + p.radius;
-				sf::Float4 weight = lenSq.rsqrt() / lenSq * p.strength;
+				sf::Float8 dx = px - p.position.x;
+				sf::Float8 dy = py - p.position.y;
+				sf::Float8 dz = pz - p.position.z;
+				sf::Float8 lenSq = (dx*dx + dy*dy + dz*dz) + p.radius;
+				sf::Float8 weight = lenSq.rsqrt() / lenSq * p.strength;
 				ax += dx * weight;
 				ay += dy * weight;
 				az += dz * weight;
 			}
 
-			vx += ax * dt4;
-			vy += ay * dt4;
-			vz += az * dt4;
+			vx += ax * dt8;
+			vy += ay * dt8;
+			vz += az * dt8;
 
-			p.vx = vx; p.vy = vy; p.vz = vz;
+			px += vx * dt8;
+			py += vy * dt8;
+			pz += vz * dt8;
 
-			px += vx * dt4;
-			py += vy * dt4;
-			pz += vz * dt4;
+			life -= dt8 / (seed * lifeTimeVariance8 + lifeTime8);
 
-			p.px = px; p.py = py; p.pz = pz;
+			p1.vx = vx.getHi(); p1.vy = vy.getHi(); p1.vz = vz.getHi();
+			p1.px = px.getHi(); p1.py = py.getHi(); p1.pz = pz.getHi();
+			p1.life = life.getHi();
+			p0.vx = vx.getLo(); p0.vy = vy.getLo(); p0.vz = vz.getLo();
+			p0.px = px.getLo(); p0.py = py.getLo(); p0.pz = pz.getLo();
+			p0.life = life.getLo();
 
-			life -= dt4 / (seed * lifeTimeVariance + lifeTime);
-			p.life = life;
+			for (uint32_t blockI = 0; blockI < numBlocks; blockI++) {
+				const Particle4 &p = parts[partI + blockI];
+				sf::Float4 tx = p.px, ty = p.py, tz = p.pz, tl = p.life;
 
-			sf::Float4::transpose4(px, py, pz, life);
+				// Transposed: `tx` contains (x, y, z, life) of the first particle etc.
+				sf::Float4::transpose4(tx, ty, tz, tl);
 
+				if (tx.getW() < HugeParticleLifeCmp) {
+					pMin = pMin.min(tx);
+					pMax = pMax.max(tx);
+					numGpuParticles++;
+				}
+				if (ty.getW() < HugeParticleLifeCmp) {
+					pMin = pMin.min(ty);
+					pMax = pMax.max(ty);
+					numGpuParticles++;
+				}
+				if (tz.getW() < HugeParticleLifeCmp) {
+					pMin = pMin.min(tz);
+					pMax = pMax.max(tz);
+					numGpuParticles++;
+				}
+				if (tl.getW() < HugeParticleLifeCmp) {
+					pMin = pMin.min(tl);
+					pMax = pMax.max(tl);
+					numGpuParticles++;
+				}
+			}
+		}
+
+		memcpy(effect.prevEmitterToWorld, effect.emitterToWorld, sizeof(sf::Float4) * 4);
+
+		effect.numGpuParticles = numGpuParticles;
+
+		effect.gpuBounds.origin = ((pMin + pMax) * 0.5f).asVec3();
+		effect.gpuBounds.extent = ((pMax - pMin) * 0.5f + comp.cullPadding).asVec3();
+
+		if (comp.localSpace) {
+			effect.gpuBounds = sf::transformBounds(effect.particlesToWorld, effect.gpuBounds);
+		}
+
+		effect.uploadFrameIndex = 0;
+	}
+
+	// Expand the live particles to quad vertices, writes `effect.numGpuParticles * 4` vertices
+	static void writeGpuParticlesImp(const Effect &effect, GpuParticle *dst)
+	{
+		for (const Particle4 &p : effect.particles) {
+			sf::Float4 px = p.px, py = p.py, pz = p.pz, life = p.life;
+			sf::Float4 vx = p.vx, vy = p.vy, vz = p.vz, seed = p.seed;
+
+			sf::Float4::transpose4(px, py, pz, life);
 			sf::Float4::transpose4(vx, vy, vz, seed);
 
 			if (px.getW() < HugeParticleLifeCmp) {
@@ -617,8 +696,6 @@ struct ParticleSystemImp final : ParticleSystem
 				vx.storeu((float*)&dst[2] + 4);
 				px.storeu((float*)&dst[3] + 0);
 				vx.storeu((float*)&dst[3] + 4);
-				pMin = pMin.min(px);
-				pMax = pMax.max(px);
 				dst += 4;
 			}
 
@@ -631,8 +708,6 @@ struct ParticleSystemImp final : ParticleSystem
 				vy.storeu((float*)&dst[2] + 4);
 				py.storeu((float*)&dst[3] + 0);
 				vy.storeu((float*)&dst[3] + 4);
-				pMin = pMin.min(py);
-				pMax = pMax.max(py);
 				dst += 4;
 			}
 
@@ -645,8 +720,6 @@ struct ParticleSystemImp final : ParticleSystem
 				vz.storeu((float*)&dst[2] + 4);
 				pz.storeu((float*)&dst[3] + 0);
 				vz.storeu((float*)&dst[3] + 4);
-				pMin = pMin.min(pz);
-				pMax = pMax.max(pz);
 				dst += 4;
 			}
 
@@ -659,24 +732,9 @@ struct ParticleSystemImp final : ParticleSystem
 				seed.storeu((float*)&dst[2] + 4);
 				life.storeu((float*)&dst[3] + 0);
 				seed.storeu((float*)&dst[3] + 4);
-				pMin = pMin.min(life);
-				pMax = pMax.max(life);
 				dst += 4;
 			}
 		}
-
-		memcpy(effect.prevEmitterToWorld, effect.emitterToWorld, sizeof(sf::Float4) * 4);
-
-		effect.gpuParticles.resizeUninit(dst - effect.gpuParticles.data);
-
-		effect.gpuBounds.origin = ((pMin + pMax) * 0.5f).asVec3();
-		effect.gpuBounds.extent = ((pMax - pMin) * 0.5f + comp.cullPadding).asVec3();
-
-		if (comp.localSpace) {
-			effect.gpuBounds = sf::transformBounds(effect.particlesToWorld, effect.gpuBounds);
-		}
-
-		effect.uploadFrameIndex = 0;
 	}
 
 	void releaseEffectTypeImp(uint32_t typeId)
@@ -727,6 +785,12 @@ struct ParticleSystemImp final : ParticleSystem
 		}
 	}
 
+	virtual void getEffectTypeAssets(sf::Array<sp::Asset*> &assets, uint32_t typeId) const override
+	{
+		const EffectType &type = types[typeId];
+		if (type.texture) assets.push(type.texture);
+	}
+
 	virtual void addEffect(Systems &systems, uint32_t entityId, uint8_t componentIndex, const sf::Box<sv::ParticleSystemComponent> &c, const Transform &transform) override
 	{
 		uint32_t effectId = effects.size;
@@ -751,6 +815,8 @@ struct ParticleSystemImp final : ParticleSystem
 
 		effect.instantDelete = c->instantDelete;
 
+		effect.rng = sf::Random(effectRng.nextU32(), 581271);
+
 		sf::Mat34 entityToWorld = transform.asMatrix();
 		if (type.svComponent->localSpace) {
 			sf::Mat34().writeColMajor44((float*)effect.emitterToWorld);
@@ -790,7 +856,7 @@ struct ParticleSystemImp final : ParticleSystem
 
 		effect.stopEmit = true;
 
-		return effect.gpuParticles.size == 0 || frameArgs.gameTime - effect.lastUpdateTime > 2.0 || effect.instantDelete;
+		return effect.numGpuParticles == 0 || frameArgs.gameTime - effect.lastUpdateTime > 2.0 || effect.instantDelete;
 	}
 
 	void remove(Systems &systems, uint32_t entityId, const EntityComponent &ec) override
@@ -809,23 +875,63 @@ struct ParticleSystemImp final : ParticleSystem
 	{
 		float clampedDt = sf::min(args.dt, 0.1f);
 
+		effectsToSimulate.clear();
 		for (uint32_t effectId : activeAreas.get(AreaGroup::ParticleEffect)) {
 			Effect &effect = effects[effectId];
 			effect.lastUpdateTime = args.gameTime;
 
 			effect.timeDelta += clampedDt;
+			if (effect.timeDelta >= effect.timeStep) {
+				effectsToSimulate.push(effectId);
+			}
+		}
+
+		sp::JobSystem::parallelForFunc(effectsToSimulate.size, [&](uint32_t index, uint32_t threadIndex) {
+			Effect &effect = effects[effectsToSimulate[index]];
 			while (effect.timeDelta >= effect.timeStep) {
-				simulateParticlesImp(updateCtx.rng, effect, effect.timeStep);
+				simulateParticlesImp(effect, effect.timeStep);
 				effect.timeDelta -= effect.timeStep;
 			}
+		});
+	}
+
+	// Write all the effects that need to be re-uploaded into a single append to
+	// this frame's vertex buffer, growing it if necessary.
+	void uploadEffectsImp(uint64_t frame)
+	{
+		if (effectUploads.size == 0) return;
+
+		uint32_t numParticles = 0;
+		for (EffectUpload &upload : effectUploads) {
+			upload.particleOffset = numParticles;
+			numParticles += effects[upload.effectId].numGpuParticles;
+		}
+
+		uploadParticles.reserveGeometric(numParticles * 4);
+		uploadParticles.resizeUninit(numParticles * 4);
+
+		sp::JobSystem::parallelForFunc(effectUploads.size, [&](uint32_t index, uint32_t threadIndex) {
+			const EffectUpload &upload = effectUploads[index];
+			writeGpuParticlesImp(effects[upload.effectId], uploadParticles.data + upload.particleOffset * 4);
+		});
+
+		// Nothing can refer to the slot from `MaxParticleCacheFrames` ago so it's safe to re-create
+		uint32_t slot = (uint32_t)(frame % MaxParticleCacheFrames);
+		if (numParticles > vertexBufferCapacity[slot]) {
+			initVertexBuffer(slot, sf::max(numParticles, vertexBufferCapacity[slot] * 2));
+		}
+
+		int baseOffset = sg_append_buffer(vertexBuffers[slot].buffer, uploadParticles.data, (int)uploadParticles.byteSize());
+		for (const EffectUpload &upload : effectUploads) {
+			Effect &effect = effects[upload.effectId];
+			effect.uploadByteOffset = (uint32_t)baseOffset + upload.particleOffset * 4 * (uint32_t)sizeof(GpuParticle);
+			effect.uploadFrameIndex = frame;
 		}
 	}
 
 	void renderMain(const VisFogSystem *visFogSystem, const VisibleAreas &visibleAreas, const RenderArgs &renderArgs) override
 	{
 		// TODO: Sort by type
-		uint32_t frameParticlesLeft = MaxParticlesPerFrame;
-
 		VisFogImage visFog = visFogSystem->getVisFogImage();
 
 		bufferFrameIndex++;
@@ -835,7 +941,7 @@ struct ParticleSystemImp final : ParticleSystem
 		for (uint32_t effectId : visibleAreas.get(AreaGroup::ParticleEffect)) {
 			Effect &effect = effects[effectId];
 			EffectType &type = types[effect.typeId];
-			uint32_t numParticles = effect.gpuParticles.size / 4;
+			uint32_t numParticles = effect.numGpuParticles;
 			if (numParticles == 0) continue;
 			if (!renderArgs.frustum.intersects(effect.gpuBounds)) continue;
 			SortedEffect &sorted = sortedEffects.push();
@@ -847,24 +953,23 @@ struct ParticleSystemImp final : ParticleSystem
 
 		sf::sort(sortedEffects);
 
+		effectUploads.clear();
+		for (SortedEffect &sorted : sortedEffects) {
+			Effect &effect = effects[sorted.effectId];
+			if (frame - effect.uploadFrameIndex >= MaxParticleCacheFrames) {
+				EffectUpload &upload = effectUploads.push();
+				upload.effectId = sorted.effectId;
+			}
+		}
+		uploadEffectsImp(frame);
+
 		uint32_t prevTypeId = ~0u;
 		for (SortedEffect &sorted : sortedEffects) {
 			uint32_t effectId = sorted.effectId;
 
 			Effect &effect = effects[effectId];
 			EffectType &type = types[effect.typeId];
-			uint32_t numParticles = effect.gpuParticles.size / 4;
-
-			if (numParticles == 0) continue;
-			if (!renderArgs.frustum.intersects(effect.gpuBounds)) continue;
-
-			if (frame - effect.uploadFrameIndex >= MaxParticleCacheFrames) {
-				if (numParticles >= frameParticlesLeft) return;
-
-				frameParticlesLeft -= numParticles;
-				effect.uploadByteOffset = (uint32_t)sg_append_buffer(vertexBuffers[(uint32_t)frame % MaxParticleCacheFrames].buffer, effect.gpuParticles.data, (int)effect.gpuParticles.byteSize());
-				effect.uploadFrameIndex = frame;
-			}
+			uint32_t numParticles = effect.numGpuParticles;
 
 			sp::Buffer &vertexBuffer = vertexBuffers[(uint32_t)effect.uploadFrameIndex % MaxParticleCacheFrames];
 
@@ -891,14 +996,17 @@ struct ParticleSystemImp final : ParticleSystem
 
 			sg_bindings binds = { };
 			binds.vertex_buffers[0] = vertexBuffer.buffer;
-			binds.vertex_buffer_offsets[0] = effect.uploadByteOffset;
 			binds.index_buffer = sp::getSharedQuadIndexBuffer();
 			binds.vs_images[SLOT_Particle_u_SplineTexture] = splineTexture.image;
 			binds.vs_images[SLOT_Particle_u_VisFogTexture] = visFog.image;
 			binds.fs_images[SLOT_Particle_u_Texture] = image;
-			sg_apply_bindings(&binds);
 
-			sg_draw(0, numParticles * 6, 1);
+			for (uint32_t base = 0; base < numParticles; base += MaxParticlesPerDraw) {
+				uint32_t count = sf::min(numParticles - base, MaxParticlesPerDraw);
+				binds.vertex_buffer_offsets[0] = (int)(effect.uploadByteOffset + base * 4 * (uint32_t)sizeof(GpuParticle));
+				sg_apply_bindings(&binds);
+				sg_draw(0, (int)count * 6, 1);
+			}
 		}
 	}
 
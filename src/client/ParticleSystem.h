@@ -12,6 +12,7 @@ struct ParticleSystem : EntitySystem
 
 	virtual uint32_t reserveEffectType(Systems &systems, const sf::Box<sv::ParticleSystemComponent> &c) = 0;
 	virtual void releaseEffectType(Systems &systems, const sf::Box<sv::ParticleSystemComponent> &c) = 0;
+	virtual void getEffectTypeAssets(sf::Array<sp::Asset*> &assets, uint32_t typeId) const = 0;
 
 	virtual void addEffect(Systems &systems, uint32_t entityId, uint8_t componentIndex, const sf::Box<sv::ParticleSystemComponent> &c, const Transform &transform) = 0;
 
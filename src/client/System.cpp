@@ -16,6 +16,9 @@
 #include "client/AudioSystem.h"
 
 #include "sf/Reflection.h"
+#include "sf/Sort.h"
+
+#include "sp/Asset.h"
 
 namespace cl {
 
@@ -48,35 +51,82 @@ void Systems::init(const SystemsDesc &desc)
 
 void Systems::updateVisibility(VisibleAreas &areas, uint32_t areaFlags, const sf::Frustum &frustum)
 {
-	areas.areas.clear();
-	area->queryFrustum(areas.areas, areaFlags, frustum);
+	VisibilityView view = { &areas, areaFlags, frustum };
+	updateVisibility(sf::Slice<const VisibilityView>(&view, 1));
+}
 
-	for (sf::Array<uint32_t> &groupIds : areas.groups) {
-		groupIds.clear();
-	}
+void Systems::updateVisibility(sf::Slice<const VisibilityView> views)
+{
+	uint32_t areaVersion = area->getVersion();
+
+	sf::SmallArray<AreaFrustumQuery, AreaSystem::MaxFrustumQueries> queries;
+	sf::SmallArray<VisibleAreas*, AreaSystem::MaxFrustumQueries> queryAreas;
+
+	for (uint32_t viewIx = 0; viewIx < views.size; viewIx++) {
+		const VisibilityView &view = views[viewIx];
+		VisibleAreas &areas = *view.areas;
+
+		bool upToDate = areas.areaVersion == areaVersion && areas.areaFlags == view.areaFlags
+			&& memcmp(&areas.frustum, &view.frustum, sizeof(sf::Frustum)) == 0;
+		if (!upToDate) {
+			areas.areaVersion = areaVersion;
+			areas.areaFlags = view.areaFlags;
+			areas.frustum = view.frustum;
+			areas.areas.clear();
+			queries.push({ &areas.areas, view.areaFlags, &areas.frustum });
+			queryAreas.push(&areas);
+		}
+
+		bool last = viewIx + 1 == views.size;
+		if (queries.size == AreaSystem::MaxFrustumQueries || (last && queries.size > 0)) {
+			area->queryFrustums(queries);
+
+			for (VisibleAreas *visible : queryAreas) {
+				for (sf::Array<uint32_t> &groupIds : visible->groups) {
+					groupIds.clear();
+				}
+
+				for (const Area &area : visible->areas) {
+					if ((uint32_t)area.group >= sf_arraysize(visible->groups)) continue;
+					visible->groups[(uint32_t)area.group].push(area.userId);
+				}
+			}
 
-	for (const Area &area : areas.areas) {
-		if ((uint32_t)area.group >= sf_arraysize(areas.groups)) continue;
-		areas.groups[(uint32_t)area.group].push(area.userId);
+			queries.clear();
+			queryAreas.clear();
+		}
 	}
 }
 
-void Systems::renderShadows(const RenderArgs &renderArgs)
+void Systems::renderShadows(const VisibleAreas &shadowAreas, const RenderArgs &renderArgs)
 {
-	updateVisibility(shadowAreas, Area::Shadow, renderArgs.frustum);
+	renderStaticShadows(shadowAreas, renderArgs);
+	renderDynamicShadows(shadowAreas, renderArgs);
+}
 
+void Systems::renderStaticShadows(const VisibleAreas &shadowAreas, const RenderArgs &renderArgs)
+{
 	tileModel->renderShadow(shadowAreas, renderArgs);
-	characterModel->renderShadow(shadowAreas, renderArgs);
 }
 
-void Systems::renderEnvmapGBuffer(const RenderArgs &renderArgs)
+void Systems::renderDynamicShadows(const VisibleAreas &shadowAreas, const RenderArgs &renderArgs)
 {
-	updateVisibility(envmapAreas, Area::Envmap, renderArgs.frustum);
+	characterModel->renderShadow(shadowAreas, renderArgs);
+}
 
+void Systems::renderEnvmapGBuffer(const VisibleAreas &envmapAreas, const RenderArgs &renderArgs)
+{
 	tileModel->renderEnvmapGBuffer(envmapAreas, renderArgs);
 	characterModel->renderEnvmapGBuffer(envmapAreas, renderArgs);
 }
 
+void EntitySystem::updateTransforms(Systems &systems, sf::Slice<const EntityTransformUpdate> updates)
+{
+	for (const EntityTransformUpdate &u : updates) {
+		updateTransform(systems, u.entityId, u.component, *u.update);
+	}
+}
+
 bool EntitySystem::prepareForRemove(Systems &systems, uint32_t entityId, const EntityComponent &ec, const FrameArgs &args)
 {
 	return true;
@@ -87,24 +137,28 @@ void EntitySystem::editorHighlight(Systems &systems, const EntityComponent &ec,
 	// Nop
 }
 
-void Entities::addPrefabComponents(Systems &systems, uint32_t prefabId)
+static void addPrefabComponentsImp(Systems &systems, Prefab &prefab)
 {
-	Prefab &prefab = prefabs[prefabId];
 	for (const sf::Box<sv::Component> &comp : prefab.svPrefab->components) {
 		if (const auto *c = comp->as<sv::ParticleSystemComponent>()) {
-			systems.particle->reserveEffectType(systems, comp.cast<sv::ParticleSystemComponent>());
+			uint32_t typeId = systems.particle->reserveEffectType(systems, comp.cast<sv::ParticleSystemComponent>());
+			systems.particle->getEffectTypeAssets(prefab.assets, typeId);
 		} else if (const auto *c = comp->as<sv::CharacterModelComponent>()) {
 			ComponentData &data = prefab.componentData.push();
 			data.component = c;
-			data.data = systems.characterModel->preloadCharacterModel(*c);
+			data.data = systems.characterModel->preloadCharacterModel(prefab.assets, *c);
 		} else if (const auto *c = comp->as<sv::DynamicModelComponent>()) {
 			ComponentData &data = prefab.componentData.push();
 			data.component = c;
-			data.data = systems.model->preloadModel(*c);
+			data.data = systems.model->preloadModel(prefab.assets, *c);
+		} else if (const auto *c = comp->as<sv::TileModelComponent>()) {
+			ComponentData &data = prefab.componentData.push();
+			data.component = c;
+			data.data = systems.tileModel->preloadModel(prefab.assets, *c);
 		} else if (const auto *c = comp->as<sv::SoundComponent>()) {
 			ComponentData &data = prefab.componentData.push();
 			data.component = c;
-			data.data = systems.audio->preloadSound(*c);
+			data.data = systems.audio->preloadSound(prefab.assets, *c);
 		} else if (const auto *c = comp->as<sv::CardComponent>()) {
 			ComponentData &data = prefab.componentData.push();
 			data.component = c;
@@ -113,30 +167,30 @@ void Entities::addPrefabComponents(Systems &systems, uint32_t prefabId)
 			if (c->hitSound.soundName) {
 				ComponentData &data = prefab.componentData.push();
 				data.component = c;
-				data.data = systems.audio->preloadSound(c->hitSound);
+				data.data = systems.audio->preloadSound(prefab.assets, c->hitSound);
 			}
 		} else if (const auto *c = comp->as<sv::CharacterComponent>()) {
 			if (c->damageSound.soundName) {
-				prefab.componentData.push({ c, systems.audio->preloadSound(c->damageSound) });
+				prefab.componentData.push({ c, systems.audio->preloadSound(prefab.assets, c->damageSound) });
 			}
 			if (c->footstepSound.soundName) {
-				prefab.componentData.push({ c, systems.audio->preloadSound(c->footstepSound) });
+				prefab.componentData.push({ c, systems.audio->preloadSound(prefab.assets, c->footstepSound) });
 			}
 		} else if (const auto *c = comp->as<sv::DoorComponent>()) {
 			if (c->openSound.soundName) {
-				prefab.componentData.push({ c, systems.audio->preloadSound(c->openSound) });
+				prefab.componentData.push({ c, systems.audio->preloadSound(prefab.assets, c->openSound) });
 			}
 		} else if (const auto *c = comp->as<sv::ChestComponent>()) {
 			if (c->openSound.soundName) {
-				prefab.componentData.push({ c, systems.audio->preloadSound(c->openSound) });
+				prefab.componentData.push({ c, systems.audio->preloadSound(prefab.assets, c->openSound) });
 			}
 		}
 	}
 }
 
-void Entities::removePrefabComponents(Systems &systems, uint32_t prefabId)
+static void removePrefabComponentsImp(Systems &systems, Prefab &prefab)
 {
-	Prefab &prefab = prefabs[prefabId];
+	prefab.assets.clear();
 	for (const sf::Box<sv::Component> &comp : prefab.svPrefab->components) {
 		if (const auto *c = comp->as<sv::ParticleSystemComponent>()) {
 			systems.particle->releaseEffectType(systems, comp.cast<sv::ParticleSystemComponent>());
@@ -144,6 +198,16 @@ void Entities::removePrefabComponents(Systems &systems, uint32_t prefabId)
 	}
 }
 
+void Entities::addPrefabComponents(Systems &systems, uint32_t prefabId)
+{
+	addPrefabComponentsImp(systems, prefabs[prefabId]);
+}
+
+void Entities::removePrefabComponents(Systems &systems, uint32_t prefabId)
+{
+	removePrefabComponentsImp(systems, prefabs[prefabId]);
+}
+
 uint32_t Entities::addPrefab(Systems &systems, const sv::Prefab &svPrefab)
 {
 	auto res = nameToPrefab.insert(svPrefab.name);
@@ -158,14 +222,31 @@ uint32_t Entities::addPrefab(Systems &systems, const sv::Prefab &svPrefab)
 
 	res.entry.val = prefabId;
 
+	// Take over the component data of a prefetch, its assets are already loading or loaded
 	Prefab &prefab = prefabs[prefabId];
-	prefab.svPrefab = sf::box<sv::Prefab>(svPrefab);
-
-	addPrefabComponents(systems, prefabId);
+	if (Prefab *prefetch = prefetchPrefabs.findValue(svPrefab.name)) {
+		prefab = std::move(*prefetch);
+		prefetchPrefabs.remove(svPrefab.name);
+	} else {
+		prefab.svPrefab = sf::box<sv::Prefab>(svPrefab);
+		addPrefabComponents(systems, prefabId);
+	}
 
 	return prefabId;
 }
 
+void Entities::prefetchPrefab(Systems &systems, const sv::Prefab &svPrefab)
+{
+	if (nameToPrefab.findValue(svPrefab.name)) return;
+
+	auto res = prefetchPrefabs.insert(svPrefab.name);
+	if (!res.inserted) return;
+
+	Prefab &prefab = res.entry.val;
+	prefab.svPrefab = sf::box<sv::Prefab>(svPrefab);
+	addPrefabComponentsImp(systems, prefab);
+}
+
 void Entities::removePrefab(Systems &systems, uint32_t prefabId)
 {
 	Prefab &prefab = prefabs[prefabId];
@@ -185,6 +266,29 @@ sf::Box<sv::Prefab> Entities::findPrefab(const sf::Symbol &name) const
 	return { };
 }
 
+static bool isPrefabAssetsLoading(const Prefab &prefab)
+{
+	for (sp::Asset *asset : prefab.assets) {
+		if (!asset->isLoaded() && !asset->isFailed()) return true;
+	}
+	return false;
+}
+
+bool Entities::isPrefabLoading(uint32_t prefabId) const
+{
+	return isPrefabAssetsLoading(prefabs[prefabId]);
+}
+
+bool Entities::isPrefabLoading(const sf::Symbol &name) const
+{
+	if (const uint32_t *id = nameToPrefab.findValue(name)) {
+		return isPrefabLoading(*id);
+	} else if (const Prefab *prefetch = prefetchPrefabs.findValue(name)) {
+		return isPrefabAssetsLoading(*prefetch);
+	}
+	return false;
+}
+
 uint32_t Entities::addEntityImp(uint32_t svId, const Transform &transform, uint32_t prefabId, uint32_t indexInPrefab)
 {
 	uint32_t entityId = entities.size;
@@ -240,6 +344,49 @@ void Entities::updateTransform(Systems &systems, uint32_t entityId, const Transf
 	}
 }
 
+void Entities::updateTransforms(Systems &systems, sf::Slice<const EntityTransform> transforms)
+{
+	// Reserved up front so `EntityTransformUpdate::update` pointers stay valid
+	sf::SmallArray<TransformUpdate, 32> updates;
+	sf::SmallArray<EntityTransformUpdate, 64> componentUpdates;
+	updates.reserve(transforms.size);
+
+	for (const EntityTransform &et : transforms) {
+		Entity &entity = entities[et.entityId];
+
+		TransformUpdate &update = updates.push();
+		update.previousTransform = entity.transform;
+		update.transform = et.transform;
+		update.entityToWorld = et.transform.asMatrix();
+
+		entity.transform = et.transform;
+
+		for (const EntityComponent &ec : entity.components) {
+			if ((ec.flags & Entity::UpdateTransform) == 0) continue;
+			componentUpdates.push({ et.entityId, ec, &update });
+		}
+	}
+
+	// Group by system, updates to the same entity stay in order
+	sf::sort(componentUpdates, [](const EntityTransformUpdate &a, const EntityTransformUpdate &b) {
+		if (a.component.system != b.component.system) return (uintptr_t)a.component.system < (uintptr_t)b.component.system;
+		return (uintptr_t)a.update < (uintptr_t)b.update;
+	});
+
+	uint32_t begin = 0;
+	while (begin < componentUpdates.size) {
+		EntitySystem *system = componentUpdates[begin].component.system;
+		uint32_t end = begin + 1;
+		while (end < componentUpdates.size && componentUpdates[end].component.system == system) {
+			end++;
+		}
+
+		sf::Slice<const EntityTransformUpdate> run(componentUpdates.data + begin, end - begin);
+		system->updateTransforms(systems, run);
+		begin = end;
+	}
+}
+
 void Entities::removeEntityInstant(Systems &systems, uint32_t entityId)
 {
 	removeComponents(systems, entityId);
@@ -15,7 +15,7 @@
 
 struct sapp_event;
 namespace sv { struct Prefab; }
-namespace sp { struct Canvas; }
+namespace sp { struct Canvas; struct Asset; }
 
 namespace cl {
 
@@ -32,7 +32,7 @@ struct SystemsDesc
 };
 
 struct Systems;
-struct EntityComponent;
+struct EntitySystem;
 struct FrameArgs;
 
 enum class EditorHighlight
@@ -50,6 +50,28 @@ struct TransformUpdate
 	sf::Mat34 entityToWorld;
 };
 
+struct EntityComponent
+{
+	EntitySystem *system;
+	uint32_t userId;
+	uint16_t flags;
+	uint8_t subsystemIndex;
+	uint8_t componentIndex;
+};
+
+struct EntityTransform
+{
+	uint32_t entityId;
+	Transform transform;
+};
+
+struct EntityTransformUpdate
+{
+	uint32_t entityId;
+	EntityComponent component;
+	const TransformUpdate *update;
+};
+
 struct System
 {
 	virtual ~System();
@@ -58,21 +80,14 @@ struct System
 struct EntitySystem : System
 {
 	virtual void updateTransform(Systems &systems, uint32_t entityId, const EntityComponent &ec, const TransformUpdate &update) = 0;
+	// Called once per system by `Entities::updateTransforms()`, defaults to `updateTransform()` for each
+	virtual void updateTransforms(Systems &systems, sf::Slice<const EntityTransformUpdate> updates);
 	virtual bool prepareForRemove(Systems &systems, uint32_t entityId, const EntityComponent &ec, const FrameArgs &args);
 	virtual void remove(Systems &systems, uint32_t entityId, const EntityComponent &ec) = 0;
 
 	virtual void editorHighlight(Systems &systems, const EntityComponent &ec, EditorHighlight type);
 };
 
-struct EntityComponent
-{
-	EntitySystem *system;
-	uint32_t userId;
-	uint16_t flags;
-	uint8_t subsystemIndex;
-	uint8_t componentIndex;
-};
-
 struct ComponentData
 {
 	const sv::Component *component;
@@ -84,6 +99,10 @@ struct Prefab
 	sf::Box<sv::Prefab> svPrefab;
 	sf::Array<uint32_t> entityIds;
 	sf::Array<ComponentData> componentData;
+
+	// Every asset the prefab needs to be shown, resolved when the prefab is loaded.
+	// Not retained, the references in `componentData` keep these alive.
+	sf::Array<sp::Asset*> assets;
 };
 
 struct Entity
@@ -125,6 +144,10 @@ struct Entities
 	sf::Array<uint32_t> freePrefabIds;
 	sf::HashMap<sf::Symbol, uint32_t> nameToPrefab;
 
+	// Prefabs whose assets are loading before the prefab itself is added,
+	// adopted by `addPrefab()`, see `prefetchPrefab()`
+	sf::HashMap<sf::Symbol, Prefab> prefetchPrefabs;
+
 	sf::Array<uint32_t> removeQueue;
 
 	GlobalPrefabs globalPrefabs;
@@ -133,10 +156,14 @@ struct Entities
 	void removePrefabComponents(Systems &systems, uint32_t prefabId);
 
 	uint32_t addPrefab(Systems &systems, const sv::Prefab &svPrefab);
+	void prefetchPrefab(Systems &systems, const sv::Prefab &svPrefab);
 	void removePrefab(Systems &systems, uint32_t prefabId);
 
 	sf::Box<sv::Prefab> findPrefab(const sf::Symbol &name) const;
 
+	bool isPrefabLoading(uint32_t prefabId) const;
+	bool isPrefabLoading(const sf::Symbol &name) const;
+
 	uint32_t addEntityImp(uint32_t svId, const Transform &transform, uint32_t prefabId, uint32_t indexInPrefab);
 
 	uint32_t addEntity(Systems &systems, uint32_t svId, const Transform &transform, const sf::Symbol &prefabName);
@@ -145,6 +172,10 @@ struct Entities
 
 	void updateTransform(Systems &systems, uint32_t entityId, const Transform &transform);
 
+	// Update many entities at once, components are grouped so that each
+	// `EntitySystem` receives a single `updateTransforms()` call
+	void updateTransforms(Systems &systems, sf::Slice<const EntityTransform> transforms);
+
 	void addComponents(Systems &systems, uint32_t entityId, const Transform &transform, const Prefab &prefab);
 	void removeComponents(Systems &systems, uint32_t entityId);
 
@@ -196,11 +227,23 @@ struct VisibleAreas
 	sf::Array<uint32_t> groups[(uint32_t)AreaGroup::Custom0];
 	// TODO(?): sf::HashMap<uint32_t, sf::Array<uint32_t>> customGroups;
 
+	// Query that produced the current contents, reused if nothing changed
+	uint32_t areaVersion = 0;
+	uint32_t areaFlags = 0;
+	sf::Frustum frustum;
+
 	sf_forceinline sf::Slice<const uint32_t> get(AreaGroup group) const {
 		return groups[(uint32_t)group].slice();
 	}
 };
 
+struct VisibilityView
+{
+	VisibleAreas *areas;
+	uint32_t areaFlags;
+	sf::Frustum frustum;
+};
+
 struct EntityHit
 {
 	uint32_t entityId = ~0u;
@@ -274,7 +317,6 @@ struct Systems
 	Entities entities;
 	VisibleAreas activeAreas;
 	VisibleAreas visibleAreas;
-	VisibleAreas shadowAreas;
 	VisibleAreas envmapAreas;
 	BoneUpdates boneUpdates;
 	sf::Box<AreaSystem> area;
@@ -297,8 +339,14 @@ struct Systems
 
 	void updateVisibility(VisibleAreas &areas, uint32_t areaFlags, const sf::Frustum &frustum);
 
-	void renderShadows(const RenderArgs &renderArgs);
-	void renderEnvmapGBuffer(const RenderArgs &renderArgs);
+	// Update multiple views with a single traversal of the area system,
+	// views that would return the same results as last time are skipped
+	void updateVisibility(sf::Slice<const VisibilityView> views);
+
+	void renderShadows(const VisibleAreas &shadowAreas, const RenderArgs &renderArgs);
+	void renderStaticShadows(const VisibleAreas &shadowAreas, const RenderArgs &renderArgs);
+	void renderDynamicShadows(const VisibleAreas &shadowAreas, const RenderArgs &renderArgs);
+	void renderEnvmapGBuffer(const VisibleAreas &envmapAreas, const RenderArgs &renderArgs);
 };
 
 }
@@ -9,9 +9,13 @@
 #include "client/ClientSettings.h"
 
 #include "sf/Array.h"
+#include "sf/Float8.h"
+#include "sf/Semaphore.h"
+#include "sf/ext/mx/mx_platform.h"
 
 #include "sp/Model.h"
 #include "sp/Profiler.h"
+#include "sp/JobSystem.h"
 
 #include "game/DebugDraw.h"
 
@@ -87,12 +91,104 @@ struct TileModelSystemImp final : TileModelSystem
 		uint32_t tint;
 	};
 
+	struct GeometryBuilder
+	{
+		uint32_t numVertices = 0, numIndices = 0;
+		sf::Array<uint16_t> indices16;
+		sf::Array<uint32_t> indices32;
+		uint16_t *indicesDst16 = nullptr;
+		uint32_t *indicesDst32 = nullptr;
+
+		void count(sp::Model *model) {
+			if (!model) return;
+			for (sp::Mesh &mesh : model->meshes) {
+				numVertices += mesh.numVertices;
+				numIndices += mesh.numIndices;
+			}
+		}
+
+		void finishCount() {
+			if (numIndices == 0) return;
+			if (numVertices > UINT16_MAX) {
+				indices32.resizeUninit(numIndices);
+				indicesDst32 = indices32.data;
+			} else {
+				indices16.resizeUninit(numIndices);
+				indicesDst16 = indices16.data;
+			}
+		}
+
+		void appendIndices(sf::Slice<uint16_t> indices, uint32_t vertexOffset) {
+			if (indicesDst16) {
+				uint16_t *dst = indicesDst16;
+				for (uint16_t index : indices) {
+					*dst++ = (uint16_t)(vertexOffset + index);
+				}
+				indicesDst16 = dst;
+			} else {
+				uint32_t *dst = indicesDst32;
+				for (uint16_t index : indices) {
+					*dst++ = vertexOffset + index;
+				}
+				indicesDst32 = dst;
+			}
+		}
+	};
+
+	// Transformed and packed vertices of a single model in a chunk. Kept between
+	// chunk rebuilds so that only the models that changed need to be transformed.
+	struct ModelGeometry
+	{
+		uint32_t version = 0; // < Matches `Model::geometryVersion` when built, zero if never
+		sf::Vec2 uvBase, uvScale;
+		sf::Array<char> vertices;
+		sf::Vec3 aabbMin, aabbMax;
+	};
+
+	// Snapshot of a model in a `ChunkBuild`, as the build may run on a worker
+	// thread while the main thread keeps modifying `models`.
+	struct ChunkBuildModel
+	{
+		uint32_t modelId;
+		uint32_t serial;
+		uint32_t version;
+		sp::ModelRef model;
+		sf::Mat34 modelToWorld;
+		uint32_t tint;
+		sf::Vec2 uvBase, uvScale;
+		ModelGeometry geometry; // < Moved from/to `Model::geometry[]`
+	};
+
+	// Chunk geometry built in the background. The chunk keeps rendering its
+	// previous buffers until the build is swapped in on the main thread.
+	struct ChunkBuild
+	{
+		ChunkType type;
+		sf::Array<ChunkBuildModel> models;
+
+		GeometryBuilder builder;
+		sf::Array<char> vertices;
+		sf::Bounds3 bounds;
+
+		uint32_t done = 0; // < Atomic, set when a background build has finished
+		sf::Semaphore *finished = nullptr; // < Signaled after `done`, outlives the build
+	};
+
 	struct ChunkRef
 	{
 		uint32_t chunkId = ~0u;
 		uint32_t indexInChunk = ~0u;
 	};
 
+	struct ModelData
+	{
+		sp::ModelRef model;
+		sp::ModelRef shadowModel;
+		sp::ModelRef giModel;
+		cl::TileMaterialRef material;
+		cl::GIMaterialRef giMaterial;
+	};
+
 	struct Model
 	{
 		sf::Vec2i chunkPos;
@@ -107,9 +203,14 @@ struct TileModelSystemImp final : TileModelSystem
 
 		sf::Mat34 modelToEntity;
 		sf::Mat34 modelToWorld;
+		sf::Mat34 worldToModel; // < Cached `sf::inverse(modelToWorld)` for picking
 
 		uint32_t tint = 0xffffffff;
 
+		uint32_t serial = 0;
+		uint32_t geometryVersion = 1;
+		ModelGeometry geometry[ChunkTypeCount];
+
 		bool isLoading() const {
 			if (material && material.isLoading()) return true;
 			if (giMaterial && giMaterial.isLoading()) return true;
@@ -148,6 +249,8 @@ struct TileModelSystemImp final : TileModelSystem
 
 		ChunkType type;
 
+		sf::Box<ChunkBuild> build; // < In-progress geometry build, if any
+
 		void resetBuffers() {
 			vertexBuffer.reset();
 			indexBuffer.reset();
@@ -204,71 +307,6 @@ struct TileModelSystemImp final : TileModelSystem
 		}
 	};
 
-	struct GeometryBuilder
-	{
-		uint32_t numVertices = 0, numIndices = 0;
-		sf::Array<uint16_t> indices16;
-		sf::Array<uint32_t> indices32;
-		uint16_t *indicesDst16 = nullptr;
-		uint32_t *indicesDst32 = nullptr;
-		sf::Float4 aabbMin = sf::Float4(+HUGE_VALF), aabbMax = sf::Float4(-HUGE_VALF);
-
-		void count(sp::Model *model) {
-			if (!model) return;
-			for (sp::Mesh &mesh : model->meshes) {
-				numVertices += mesh.numVertices;
-				numIndices += mesh.numIndices;
-			}
-		}
-
-		void finishCount() {
-			if (numIndices == 0) return;
-			if (numVertices > UINT16_MAX) {
-				indices32.resizeUninit(numIndices);
-				indicesDst32 = indices32.data;
-			} else {
-				indices16.resizeUninit(numIndices);
-				indicesDst16 = indices16.data;
-			}
-		}
-
-		void appendIndices(sf::Slice<uint16_t> indices, uint32_t vertexOffset) {
-			if (indicesDst16) {
-				uint16_t *dst = indicesDst16;
-				for (uint16_t index : indices) {
-					*dst++ = (uint16_t)(vertexOffset + index);
-				}
-				indicesDst16 = dst;
-			} else {
-				uint32_t *dst = indicesDst32;
-				for (uint16_t index : indices) {
-					*dst++ = vertexOffset + index;
-				}
-				indicesDst32 = dst;
-			}
-		}
-
-		sf_forceinline void updateBounds(const sf::Float4 &pos) {
-			aabbMin = aabbMin.min(pos);
-			aabbMax = aabbMax.max(pos);
-		}
-
-		void finish(const char *indexName, Chunk &dst, AreaSystem *areaSystem, uint32_t chunkId) {
-			if (indicesDst16) {
-				dst.indexBuffer.initIndex(indexName, indices16.slice());
-				dst.largeIndices = false;
-			} else if (indicesDst32) {
-				dst.indexBuffer.initIndex(indexName, indices32.slice());
-				dst.largeIndices = true;
-			} else {
-				dst.largeIndices = false;
-			}
-			dst.numIndices = numIndices;
-			sf::Bounds3 bounds = sf::Bounds3::minMax(aabbMin.asVec3(), aabbMax.asVec3());
-			dst.setBounds(chunkId, areaSystem, bounds);
-		}
-	};
-
 	static sf::Mat34 getComponentTransform(const sv::TileModelComponent &c)
 	{
 		return sf::mat::translate(c.position) * (
@@ -280,6 +318,7 @@ struct TileModelSystemImp final : TileModelSystem
 
 	sf::Array<Model> models;
 	sf::Array<uint32_t> freeModelIds;
+	uint32_t nextModelSerial = 0;
 
 	sf::Array<Chunk> chunks;
 	sf::Array<uint32_t> freeChunkIds;
@@ -289,6 +328,14 @@ struct TileModelSystemImp final : TileModelSystem
 
 	sf::Array<uint32_t> loadQueue;
 
+	sf::Array<uint32_t> pendingChunkIds;
+
+	// Background builds signal this after they stop touching their `ChunkBuild`,
+	// `numAsyncBuilds` of the signals haven't been consumed yet
+	sf::Semaphore asyncBuildsFinished;
+	uint32_t numAsyncBuilds = 0;
+	sf::Array<uint32_t> immediateChunkIds;
+
 	uint32_t numUplodadedChunks = 0;
 	uint32_t garbageCollectChunkIndex = 0;
 
@@ -297,177 +344,285 @@ struct TileModelSystemImp final : TileModelSystem
 	sp::Pipeline chunkDepthPipe[2];
 	sp::Pipeline chunkMeshPipe[2];
 
-	void updateChunkGeometry(uint32_t chunkId, AreaSystem *areaSystem)
+	static uint32_t getVertexSize(ChunkType type)
 	{
-		SP_ZONE_FUNC();
+		switch (type) {
+		case ChunkType::Normal: return sizeof(MapVertex);
+		case ChunkType::Shadow: return sizeof(sf::Vec3);
+		case ChunkType::GI: return sizeof(GIVertex);
+		}
+		return 0;
+	}
 
-		Chunk &chunk = chunks[chunkId];
-		ChunkType type = chunk.type;
+	// Transform a pair of points/directions by `cols` broadcast to both halves
+	static sf_forceinline sf::Float8 transformPoint2(const sf::Float8 *cols, const float *a, const float *b)
+	{
+		return cols[0]*sf::Float8(a[0], b[0]) + cols[1]*sf::Float8(a[1], b[1]) + cols[2]*sf::Float8(a[2], b[2]) + cols[3];
+	}
 
-		GeometryBuilder builder;
-		for (uint32_t &modelId : chunk.modelIds) {
-			Model &model = models[modelId];
-			builder.count(model.model[(uint32_t)type]);
-		}
+	static sf_forceinline sf::Float8 transformDirection2(const sf::Float8 *cols, const float *a, const float *b)
+	{
+		return cols[0]*sf::Float8(a[0], b[0]) + cols[1]*sf::Float8(a[1], b[1]) + cols[2]*sf::Float8(a[2], b[2]);
+	}
 
-		chunk.resetBuffers();
+	// Called from worker threads, may only touch `m`
+	static void transformModelGeometry(ChunkType type, ChunkBuildModel &m)
+	{
+		ModelGeometry &geo = m.geometry;
 
-		builder.finishCount();
+		uint32_t numVertices = 0;
+		for (sp::Mesh &mesh : m.model->meshes) {
+			numVertices += mesh.numVertices;
+		}
+		geo.vertices.resizeUninit(numVertices * getVertexSize(type));
 
 		const constexpr float roundScale = 1000.0f;
 		const constexpr float rcpRoundScale = 1.0f / roundScale;
 
-		sf::SmallStringBuf<256> name;
-		switch (type) {
-		case ChunkType::Normal: name.format("MapChunk(%d,%d) ", chunk.chunkPos.x, chunk.chunkPos.y); break;
-		case ChunkType::Shadow: name.format("ShadowChunk(%d,%d) ", chunk.chunkPos.x, chunk.chunkPos.y); break;
-		case ChunkType::GI: name.format("GIChunk(%d,%d) ", chunk.chunkPos.x, chunk.chunkPos.y); break;
-		}
-		uint32_t prefixLen = name.size;
+		const sf::Mat34 &transform = m.modelToWorld;
+		sf::Float4 col0 = sf::Float4::loadu(transform.cols[0].v).clearW();
+		sf::Float4 col1 = sf::Float4::loadu(transform.cols[1].v).clearW();
+		sf::Float4 col2 = sf::Float4::loadu(transform.cols[2].v).clearW();
+		sf::Float4 col3 = sf::Float4::loadu(transform.cols[3].v - 1).rotateLeft().clearW();
+
+		// Vertices are transformed in pairs, one per half of `sf::Float8`,
+		// an odd last vertex of a mesh is paired with itself
+		const sf::Float8 cols[4] = {
+			sf::Float8(col0, col0), sf::Float8(col1, col1),
+			sf::Float8(col2, col2), sf::Float8(col3, col3),
+		};
+
+		sf::Float8 aabbMin = sf::Float8(+HUGE_VALF), aabbMax = sf::Float8(-HUGE_VALF);
 
 		if (type == ChunkType::Normal) {
-			sf::Array<MapVertex> vertices;
-			vertices.resizeUninit(builder.numVertices);
-			MapVertex *vertexDst = vertices.data;
-
-			for (uint32_t modelId : chunk.modelIds) {
-				Model &model = models[modelId];
-				sf::Mat34 transform = model.modelToWorld;
-
-				sf::Float4 col0 = sf::Float4::loadu(transform.cols[0].v).clearW();
-				sf::Float4 col1 = sf::Float4::loadu(transform.cols[1].v).clearW();
-				sf::Float4 col2 = sf::Float4::loadu(transform.cols[2].v).clearW();
-				sf::Float4 col3 = sf::Float4::loadu(transform.cols[3].v - 1).rotateLeft().clearW();
-
-				cl::TileMaterial *material = model.material;
-				sf::Vec2 uvBase, uvScale;
-				if (material) {
-					uvBase = material->uvBase;
-					uvScale = material->uvScale;
-				}
-				for (sp::Mesh &mesh : model.model[(uint32_t)ChunkType::Normal]->meshes) {
-					sf_assert(mesh.streams[0].stride == sizeof(MapSrcVertex));
-					builder.appendIndices(sf::slice(mesh.cpuIndexData16, mesh.numIndices), (uint32_t)(vertexDst - vertices.data));
-					for (MapSrcVertex &vertex : sf::slice((MapSrcVertex*)mesh.streams[0].cpuData, mesh.numVertices)) {
+			MapVertex *vertexDst = (MapVertex*)geo.vertices.data;
+			for (sp::Mesh &mesh : m.model->meshes) {
+				sf_assert(mesh.streams[0].stride == sizeof(MapSrcVertex));
+				const MapSrcVertex *src = (const MapSrcVertex*)mesh.streams[0].cpuData;
+				for (uint32_t i = 0; i < mesh.numVertices; i += 2) {
+					const MapSrcVertex &va = src[i];
+					const MapSrcVertex &vb = src[sf::min(i + 1, mesh.numVertices - 1)];
+
+					sf::Float8 tp = transformPoint2(cols, va.position.v, vb.position.v);
+					sf::Float8 tn = transformDirection2(cols, va.normal.v, vb.normal.v);
+					sf::Float8 tt = transformDirection2(cols, va.tangent.v, vb.tangent.v);
+
+					tp = (tp * roundScale).round() * rcpRoundScale;
+					tn *= sf::broadcastRcpLengthXYZ(tn);
+					tt *= sf::broadcastRcpLengthXYZ(tt);
+					aabbMin = aabbMin.min(tp);
+					aabbMax = aabbMax.max(tp);
+
+					sf::Float4 tps[2] = { tp.getLo(), tp.getHi() };
+					sf::Float4 tns[2] = { tn.getLo(), tn.getHi() };
+					sf::Float4 tts[2] = { tt.getLo(), tt.getHi() };
+					for (uint32_t j = 0; j < 2 && i + j < mesh.numVertices; j++) {
+						const MapSrcVertex &vertex = src[i + j];
 						MapVertex &dst = *vertexDst++;
-						const sf::Vec3 &vp = vertex.position;
-						const sf::Vec3 &vn = vertex.normal;
-						const sf::Vec4 &vt = vertex.tangent;
-
-						sf::Float4 tp = col0*vp.x + col1*vp.y + col2*vp.z + col3;
-						sf::Float4 tn = col0*vn.x + col1*vn.y + col2*vn.z;
-						sf::Float4 tt = col0*vt.x + col1*vt.y + col2*vt.z;
-
-						tp = (tp * roundScale).round() * rcpRoundScale;
-						tn *= sf::broadcastRcpLengthXYZ(tn);
-						tt *= sf::broadcastRcpLengthXYZ(tt);
-
-						dst.position = tp.asVec3();
-						dst.normal = packSnormVec3ToUnorm10_2(tn.asVec3());
-						dst.tangent = packSnormVec3ToUnorm10_2(tt.asVec3(), vertex.tangent.w > 0.0f ? 3 : 0);
-						dst.uv = packVec2ToUnorm16(vertex.uv * uvScale + uvBase);
-						dst.tint = model.tint;
-						builder.updateBounds(tp);
+						dst.position = tps[j].asVec3();
+						dst.normal = packSnormVec3ToUnorm10_2(tns[j].asVec3());
+						dst.tangent = packSnormVec3ToUnorm10_2(tts[j].asVec3(), vertex.tangent.w > 0.0f ? 3 : 0);
+						dst.uv = packVec2ToUnorm16(vertex.uv * m.uvScale + m.uvBase);
+						dst.tint = m.tint;
 					}
 				}
 			}
-
-			if (vertices.size) {
-				name.resize(prefixLen); name.append(" vertices");
-				chunk.vertexBuffer.initVertex(name.data, vertices.slice());
-			}
 		} else if (type == ChunkType::Shadow) {
-			sf::Array<sf::Vec3> vertices;
-			vertices.resizeUninit(builder.numVertices);
-			sf::Vec3 *vertexDst = vertices.data;
-
-			for (uint32_t modelId : chunk.modelIds) {
-				Model &model = models[modelId];
-				sf::Mat34 transform = model.modelToWorld;
-
-				sf::Float4 col0 = sf::Float4::loadu(transform.cols[0].v).clearW();
-				sf::Float4 col1 = sf::Float4::loadu(transform.cols[1].v).clearW();
-				sf::Float4 col2 = sf::Float4::loadu(transform.cols[2].v).clearW();
-				sf::Float4 col3 = sf::Float4::loadu(transform.cols[3].v - 1).rotateLeft().clearW();
+			sf::Vec3 *vertexDst = (sf::Vec3*)geo.vertices.data;
+			for (sp::Mesh &mesh : m.model->meshes) {
+				const MapSrcVertex *src = (const MapSrcVertex*)mesh.streams[0].cpuData;
+				for (uint32_t i = 0; i < mesh.numVertices; i += 2) {
+					const MapSrcVertex &va = src[i];
+					const MapSrcVertex &vb = src[sf::min(i + 1, mesh.numVertices - 1)];
+
+					sf::Float8 tp = transformPoint2(cols, va.position.v, vb.position.v);
+
+					tp = (tp * roundScale).round() * rcpRoundScale;
+					aabbMin = aabbMin.min(tp);
+					aabbMax = aabbMax.max(tp);
+
+					*vertexDst++ = tp.getLo().asVec3();
+					if (i + 1 < mesh.numVertices) {
+						*vertexDst++ = tp.getHi().asVec3();
+					}
+				}
+			}
+		} else if (type == ChunkType::GI) {
+			GIVertex *vertexDst = (GIVertex*)geo.vertices.data;
+			for (sp::Mesh &mesh : m.model->meshes) {
+				const MapSrcVertex *src = (const MapSrcVertex*)mesh.streams[0].cpuData;
+				for (uint32_t i = 0; i < mesh.numVertices; i += 2) {
+					const MapSrcVertex &va = src[i];
+					const MapSrcVertex &vb = src[sf::min(i + 1, mesh.numVertices - 1)];
+
+					sf::Float8 tp = transformPoint2(cols, va.position.v, vb.position.v);
+					sf::Float8 tn = transformDirection2(cols, va.normal.v, vb.normal.v);
+
+					tp = (tp * roundScale).round() * rcpRoundScale;
+					tn *= sf::broadcastRcpLengthXYZ(tn);
+					aabbMin = aabbMin.min(tp);
+					aabbMax = aabbMax.max(tp);
+
+					sf::Float4 tps[2] = { tp.getLo(), tp.getHi() };
+					sf::Float4 tns[2] = { tn.getLo(), tn.getHi() };
+					for (uint32_t j = 0; j < 2 && i + j < mesh.numVertices; j++) {
+						const MapSrcVertex &vertex = src[i + j];
+						GIVertex &dst = *vertexDst++;
+						dst.position = tps[j].asVec3();
+						dst.normal = packSnormVec3ToUnorm10_2(tns[j].asVec3());
+						dst.uv = packVec2ToUnorm16(vertex.uv * m.uvScale + m.uvBase);
+						dst.tint = m.tint;
+					}
+				}
+			}
+		} else {
+			sf_failf("Unexpected type: %u", (uint32_t)type);
+		}
 
-				for (sp::Mesh &mesh : model.model[(uint32_t)ChunkType::Shadow]->meshes) {
-					builder.appendIndices(sf::slice(mesh.cpuIndexData16, mesh.numIndices), (uint32_t)(vertexDst - vertices.data));
-					for (MapSrcVertex &vertex : sf::slice((MapSrcVertex*)mesh.streams[0].cpuData, mesh.numVertices)) {
-						sf::Vec3 &dst = *vertexDst++;
+		geo.version = m.version;
+		geo.uvBase = m.uvBase;
+		geo.uvScale = m.uvScale;
+		geo.aabbMin = aabbMin.getLo().min(aabbMin.getHi()).asVec3();
+		geo.aabbMax = aabbMax.getLo().max(aabbMax.getHi()).asVec3();
+	}
 
-						const sf::Vec3 &vp = vertex.position;
+	// Called from worker threads, may only touch `build`
+	static void buildChunkGeometry(ChunkBuild &build)
+	{
+		SP_ZONE_FUNC();
 
-						sf::Float4 tp = col0*vp.x + col1*vp.y + col2*vp.z + col3;
+		GeometryBuilder &builder = build.builder;
+		for (ChunkBuildModel &m : build.models) {
+			builder.count(m.model);
+		}
+		builder.finishCount();
 
-						tp = (tp * roundScale).round() * rcpRoundScale;
+		uint32_t vertexSize = getVertexSize(build.type);
+		build.vertices.resizeUninit(builder.numVertices * vertexSize);
 
-						dst = tp.asVec3();
-						builder.updateBounds(tp);
-					}
-				}
+		sf::Vec3 aabbMin = sf::Vec3(+HUGE_VALF), aabbMax = sf::Vec3(-HUGE_VALF);
+		uint32_t vertexOffset = 0;
+		for (ChunkBuildModel &m : build.models) {
+			ModelGeometry &geo = m.geometry;
+			if (geo.version != m.version || geo.uvBase != m.uvBase || geo.uvScale != m.uvScale) {
+				transformModelGeometry(build.type, m);
 			}
 
-			if (vertices.size) {
-				name.resize(prefixLen); name.append(" vertices");
-				chunk.vertexBuffer.initVertex(name.data, vertices.slice());
+			memcpy(build.vertices.data + vertexOffset * vertexSize, geo.vertices.data, geo.vertices.size);
+			for (sp::Mesh &mesh : m.model->meshes) {
+				builder.appendIndices(sf::slice(mesh.cpuIndexData16, mesh.numIndices), vertexOffset);
+				vertexOffset += mesh.numVertices;
 			}
 
-		} else if (type == ChunkType::GI) {
+			aabbMin = sf::min(aabbMin, geo.aabbMin);
+			aabbMax = sf::max(aabbMax, geo.aabbMax);
+		}
 
-			sf::Array<GIVertex> vertices;
-			vertices.resizeUninit(builder.numVertices);
-			GIVertex *vertexDst = vertices.data;
-
-			for (uint32_t modelId : chunk.modelIds) {
-				Model &model = models[modelId];
-				sf::Mat34 transform = model.modelToWorld;
-
-				sf::Float4 col0 = sf::Float4::loadu(transform.cols[0].v).clearW();
-				sf::Float4 col1 = sf::Float4::loadu(transform.cols[1].v).clearW();
-				sf::Float4 col2 = sf::Float4::loadu(transform.cols[2].v).clearW();
-				sf::Float4 col3 = sf::Float4::loadu(transform.cols[3].v - 1).rotateLeft().clearW();
-
-				for (sp::Mesh &mesh : model.model[(uint32_t)ChunkType::GI]->meshes) {
-					builder.appendIndices(sf::slice(mesh.cpuIndexData16, mesh.numIndices), (uint32_t)(vertexDst - vertices.data));
-					GIMaterial *giMaterial = model.giMaterial;
-					sf::Vec2 uvBase, uvScale;
-					if (giMaterial) {
-						uvBase = giMaterial->uvBase;
-						uvScale = giMaterial->uvScale;
-					}
-					for (MapSrcVertex &vertex : sf::slice((MapSrcVertex*)mesh.streams[0].cpuData, mesh.numVertices)) {
-						GIVertex &dst = *vertexDst++;
-						const sf::Vec3 &vp = vertex.position;
-						const sf::Vec3 &vn = vertex.normal;
+		build.bounds = sf::Bounds3::minMax(aabbMin, aabbMax);
+	}
 
-						sf::Float4 tp = col0*vp.x + col1*vp.y + col2*vp.z + col3;
-						sf::Float4 tn = col0*vn.x + col1*vn.y + col2*vn.z;
+	static void buildChunkJob(void *user)
+	{
+		ChunkBuild *build = (ChunkBuild*)user;
+		sf::Semaphore *finished = build->finished;
+		buildChunkGeometry(*build);
+		mxa_or32_rel(&build->done, 1);
+		finished->signal();
+	}
 
-						tp = (tp * roundScale).round() * rcpRoundScale;
-						tn *= sf::broadcastRcpLengthXYZ(tn);
+	void startChunkBuild(uint32_t chunkId)
+	{
+		Chunk &chunk = chunks[chunkId];
+		sf_assert(!chunk.build);
+		ChunkType type = chunk.type;
 
-						sf::Vec2 uv = vertex.uv * uvScale + uvBase;
-						sf::Vec3 normal = tn.asVec3();
+		chunk.build = sf::box<ChunkBuild>();
+		ChunkBuild &build = *chunk.build;
+		build.type = type;
+		build.models.reserve(chunk.modelIds.size);
 
-						dst.position = tp.asVec3();
-						dst.normal = packSnormVec3ToUnorm10_2(normal);
-						dst.uv = packVec2ToUnorm16(uv);
-						dst.tint = model.tint;
-						builder.updateBounds(tp);
-					}
+		for (uint32_t modelId : chunk.modelIds) {
+			Model &model = models[modelId];
+			ChunkBuildModel &m = build.models.push();
+			m.modelId = modelId;
+			m.serial = model.serial;
+			m.version = model.geometryVersion;
+			m.model = model.model[(uint32_t)type];
+			m.modelToWorld = model.modelToWorld;
+			m.tint = model.tint;
+			if (type == ChunkType::Normal) {
+				if (cl::TileMaterial *material = model.material) {
+					m.uvBase = material->uvBase;
+					m.uvScale = material->uvScale;
+				}
+			} else if (type == ChunkType::GI) {
+				if (cl::GIMaterial *giMaterial = model.giMaterial) {
+					m.uvBase = giMaterial->uvBase;
+					m.uvScale = giMaterial->uvScale;
 				}
 			}
+			m.geometry = std::move(model.geometry[(uint32_t)type]);
+		}
+
+		chunk.dirty = false;
+		chunk.uploaded = true;
+	}
+
+	void finishChunkBuild(uint32_t chunkId, AreaSystem *areaSystem)
+	{
+		SP_ZONE_FUNC();
 
-			if (vertices.size) {
-				name.resize(prefixLen); name.append(" vertices");
-				chunk.vertexBuffer.initVertex(name.data, vertices.slice());
+		Chunk &chunk = chunks[chunkId];
+		sf::Box<ChunkBuild> buildBox = std::move(chunk.build);
+		ChunkBuild &build = *buildBox;
+		ChunkType type = chunk.type;
+
+		// Hand the cached vertices back to the models unless they have been
+		// removed or rebuilt by a newer build in the meantime
+		for (ChunkBuildModel &m : build.models) {
+			Model &model = models[m.modelId];
+			if (model.serial != m.serial) continue;
+			ModelGeometry &geo = model.geometry[(uint32_t)type];
+			if (m.geometry.version >= geo.version) {
+				geo = std::move(m.geometry);
 			}
-		} else {
-			sf_failf("Unexpected type: %u", (uint32_t)type);
 		}
 
+		// All the models have been removed while building
+		if (chunk.modelIds.size == 0) return;
+
+		sf::SmallStringBuf<256> name;
+		switch (type) {
+		case ChunkType::Normal: name.format("MapChunk(%d,%d) ", chunk.chunkPos.x, chunk.chunkPos.y); break;
+		case ChunkType::Shadow: name.format("ShadowChunk(%d,%d) ", chunk.chunkPos.x, chunk.chunkPos.y); break;
+		case ChunkType::GI: name.format("GIChunk(%d,%d) ", chunk.chunkPos.x, chunk.chunkPos.y); break;
+		}
+		uint32_t prefixLen = name.size;
+
+		chunk.resetBuffers();
+
+		if (build.vertices.size) {
+			name.resize(prefixLen); name.append(" vertices");
+			chunk.vertexBuffer.initVertex(name.data, build.vertices.slice());
+		}
+
+		GeometryBuilder &builder = build.builder;
 		name.resize(prefixLen); name.append(" indices");
-		builder.finish(name.data, chunk, areaSystem, chunkId);
+		if (builder.indicesDst16) {
+			chunk.indexBuffer.initIndex(name.data, builder.indices16.slice());
+			chunk.largeIndices = false;
+		} else if (builder.indicesDst32) {
+			chunk.indexBuffer.initIndex(name.data, builder.indices32.slice());
+			chunk.largeIndices = true;
+		} else {
+			chunk.largeIndices = false;
+		}
+		chunk.numIndices = builder.numIndices;
+
+		chunk.setBounds(chunkId, areaSystem, build.bounds);
+
+		// Geometry may have changed even if the bounds didn't
+		areaSystem->markBoxAreaChanged(chunk.cullingAreaId);
 	}
 
 	void addDirtyChunk(uint32_t chunkId)
@@ -569,6 +724,13 @@ struct TileModelSystemImp final : TileModelSystem
 
 	// API
 
+	~TileModelSystemImp()
+	{
+		if (numAsyncBuilds > 0) {
+			asyncBuildsFinished.wait(numAsyncBuilds);
+		}
+	}
+
 	TileModelSystemImp()
 	{
 		uint8_t permutation[SP_NUM_PERMUTATIONS] = { };
@@ -603,6 +765,27 @@ struct TileModelSystemImp final : TileModelSystem
 		}
 	}
 
+	sf::Box<void> preloadModel(sf::Array<sp::Asset*> &assets, const sv::TileModelComponent &c) override
+	{
+		auto data = sf::box<ModelData>();
+
+		sp::ModelProps modelProps;
+		modelProps.cpuData = true;
+
+		if (c.model) data->model.load(c.model, modelProps);
+		if (c.shadowModel) data->shadowModel.load(c.shadowModel, modelProps);
+		if (c.giModel) data->giModel.load(c.giModel, modelProps);
+		if (c.material) data->material.load(c.material);
+		if (c.giMaterial) data->giMaterial.load(c.giMaterial);
+
+		if (data->model) assets.push(data->model);
+		if (data->shadowModel) assets.push(data->shadowModel);
+		if (data->giModel) assets.push(data->giModel);
+		if (data->material) assets.push(data->material);
+		if (data->giMaterial) assets.push(data->giMaterial);
+		return data;
+	}
+
 	void addModel(Systems &systems, uint32_t entityId, uint8_t componentIndex, const sv::TileModelComponent &c, const Transform &transform) override
 	{
 		uint32_t modelId = models.size;
@@ -614,9 +797,11 @@ struct TileModelSystemImp final : TileModelSystem
 
 		Model &model = models[modelId];
 		model.entityId = entityId;
+		model.serial = ++nextModelSerial;
 
 		model.modelToEntity = getComponentTransform(c);
 		model.modelToWorld = transform.asMatrix() * model.modelToEntity;
+		model.worldToModel = sf::inverse(model.modelToWorld);
 
 		sf::Vec2i chunkPos = getChunkFromPosition(transform.position);
 		model.chunkPos = chunkPos;
@@ -662,6 +847,8 @@ struct TileModelSystemImp final : TileModelSystem
 		Model &model = models[modelId];
 
 		model.modelToWorld = update.entityToWorld * model.modelToEntity;
+		model.worldToModel = sf::inverse(model.modelToWorld);
+		model.geometryVersion++;
 
 		sf::Vec2i chunkPos = getChunkFromPosition(update.transform.position);
 
@@ -715,16 +902,43 @@ struct TileModelSystemImp final : TileModelSystem
 
 	void uploadVisibleChunks(const VisibleAreas &activeAreas, AreaSystem *areaSystem, const FrameArgs &frameArgs) override
 	{
+		SP_ZONE_FUNC();
+
+		for (uint32_t i = 0; i < pendingChunkIds.size; i++) {
+			uint32_t chunkId = pendingChunkIds[i];
+			if (!mxa_load32_acq(&chunks[chunkId].build->done)) continue;
+			finishChunkBuild(chunkId, areaSystem);
+			pendingChunkIds.removeSwap(i--);
+		}
+		while (numAsyncBuilds > 0 && asyncBuildsFinished.tryWait()) {
+			numAsyncBuilds--;
+		}
+
+		immediateChunkIds.clear();
 		for (uint32_t chunkId : activeAreas.get(AreaGroup::TileChunkActive)) {
 			Chunk &chunk = chunks[chunkId];
-			if (chunk.modelIds.size == 0) continue;
-
-			if (!chunk.uploaded || chunk.dirty) {
-				updateChunkGeometry(chunkId, areaSystem);
-				chunk.uploaded = true;
-				chunk.dirty = false;
+			if (chunk.modelIds.size == 0 || chunk.build) continue;
+
+			if (!chunk.uploaded) {
+				// Nothing to render yet so build these right away in parallel
+				startChunkBuild(chunkId);
+				immediateChunkIds.push(chunkId);
+			} else if (chunk.dirty) {
+				// Keep rendering the old geometry until the background build is done
+				startChunkBuild(chunkId);
+				pendingChunkIds.push(chunkId);
+				chunk.build->finished = &asyncBuildsFinished;
+				numAsyncBuilds++;
+				sp::JobSystem::runAsync(&buildChunkJob, chunk.build.ptr);
 			}
 		}
+
+		sp::JobSystem::parallelForFunc(immediateChunkIds.size, [&](uint32_t index, uint32_t threadIndex) {
+			buildChunkGeometry(*chunks[immediateChunkIds[index]].build);
+		});
+		for (uint32_t chunkId : immediateChunkIds) {
+			finishChunkBuild(chunkId, areaSystem);
+		}
 	}
 
 	void garbageCollectChunks(AreaSystem *areaSystem, const FrameArgs &frameArgs) override
@@ -735,7 +949,8 @@ struct TileModelSystemImp final : TileModelSystem
 			uint32_t chunkId = emptyChunks.data[i];
 			Chunk &chunk = chunks[chunkId];
 
-			if (chunk.modelIds.size == 0) {
+			// Background builds reference the chunk until swapped in
+			if (chunk.modelIds.size == 0 && !chunk.build) {
 				if (chunk.cullingAreaId != ~0u) areaSystem->removeBoxArea(chunk.cullingAreaId);
 				if (chunk.activeAreaId != ~0u) areaSystem->removeBoxArea(chunk.activeAreaId);
 
@@ -835,12 +1050,7 @@ struct TileModelSystemImp final : TileModelSystem
 			bindImageFS(chunkMeshShader, bindings, TEX_envmap, envmap);
 
 			pointLights.clear();
-			lightSystem->queryVisiblePointLights(visibleAreas, pointLights, chunk.bounds);
-
-			// TODO: Prioritize
-			if (pointLights.size > maxLights) {
-				pointLights.resizeUninit(maxLights);
-			}
+			lightSystem->queryGridLights(pointLights, maxLights, chunk.bounds);
 
 			pu.numLightsF = (float)pointLights.size;
 			pu.cameraPosition = renderArgs.cameraPosition;
@@ -915,7 +1125,7 @@ struct TileModelSystemImp final : TileModelSystem
 		for (uint32_t modelId : chunk.modelIds) {
 			const Model &model = models[modelId];
 			if (!model.model[(uint32_t)ChunkType::Normal]) continue;
-			float t = model.model[(uint32_t)ChunkType::Normal]->castModelRay(ray.ray, model.modelToWorld);
+			float t = model.model[(uint32_t)ChunkType::Normal]->castModelRay(sf::transformRay(model.worldToModel, ray.ray));
 			if (t < HUGE_VALF) {
 				hits.push({ model.entityId, t });
 			}
@@ -12,6 +12,8 @@ struct TileModelSystem : EntitySystem
 {
 	static sf::Box<TileModelSystem> create();
 
+	virtual sf::Box<void> preloadModel(sf::Array<sp::Asset*> &assets, const sv::TileModelComponent &c) = 0;
+
 	virtual void addModel(Systems &systems, uint32_t entityId, uint8_t componentIndex, const sv::TileModelComponent &c, const Transform &transform) = 0;
 
 	virtual void garbageCollectChunks(AreaSystem *areaSystem, const FrameArgs &frameArgs) = 0;
@@ -12,57 +12,190 @@ static const sf::Vec2i visFogNeighbors[] = {
 	{ +1, -1 }, { -1, -1 }, { +1, +1 }, { -1, +1 },  
 };
 
+static const constexpr int32_t VisFogPageShift = 5;
+static const constexpr int32_t VisFogPageSize = 1 << VisFogPageShift;
+static const constexpr uint32_t VisFogPageBytes = VisFogPageSize * VisFogPageSize * 2;
+
+// Step `fog` towards `target` in place, the first channel jumps directly to the
+// target and the second one fades by `fadeNum`. Returns `true` if still fading.
+static bool stepVisFogPage(uint8_t *fog, const uint8_t *target, uint32_t fadeNum)
+{
+	uint8_t step[16];
+	for (uint32_t i = 0; i < 16; i += 2) {
+		step[i + 0] = 255;
+		step[i + 1] = (uint8_t)sf::min(fadeNum, 255u);
+	}
+
+#if SF_ARCH_X86
+	__m128i stepV = _mm_loadu_si128((const __m128i*)step);
+	__m128i fadingV = _mm_setzero_si128();
+	for (uint32_t i = 0; i < VisFogPageBytes; i += 16) {
+		__m128i f = _mm_loadu_si128((const __m128i*)(fog + i));
+		__m128i t = _mm_loadu_si128((const __m128i*)(target + i));
+		f = _mm_min_epu8(_mm_adds_epu8(f, stepV), t);
+		_mm_storeu_si128((__m128i*)(fog + i), f);
+		fadingV = _mm_or_si128(fadingV, _mm_xor_si128(f, t));
+	}
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(fadingV, _mm_setzero_si128())) != 0xffff;
+#else
+	uint32_t fading = 0;
+	for (uint32_t i = 0; i < VisFogPageBytes; i++) {
+		uint32_t f = sf::min((uint32_t)fog[i] + step[i % 16], (uint32_t)target[i]);
+		fog[i] = (uint8_t)f;
+		fading |= f ^ target[i];
+	}
+	return fading != 0;
+#endif
+}
+
 struct VisFogSystemImp final : VisFogSystem
 {
-	struct DirtyTile
+	// Fog is stored sparsely in pages of `VisFogPageSize^2` tiles that are
+	// allocated when first seen. `fog` contains the RG8 values shown and
+	// `target` the values they fade towards, both only ever increase.
+	struct Page
 	{
-		uint8_t val[2];
+		sf::Vec2i pagePos;
+		bool fading = false;
+		bool uploadDirty = false;
+		uint8_t fog[VisFogPageBytes];
+		uint8_t target[VisFogPageBytes];
 	};
 
-	sf::Vec2i visFogOffset = sf::Vec2i(-128, -128);
-	sf::Vec2i visFogResolution = sf::Vec2i(256, 256);
+	sf::Array<Page> pages;
+	sf::HashMap<sf::Vec2i, uint32_t> pageMapping;
+	sf::Array<uint32_t> fadingPages;
+	sf::Array<uint32_t> uploadPages;
+
+	// Texture covering all the allocated pages with one empty page of
+	// margin on each side as the texture is sampled with clamp to edge
+	sf::Vec2i windowMin, windowMax; // < Page coordinates, inclusive
+	bool windowDirty = true;
+
 	sp::Texture disabledFogTexture;
 	sp::Texture visFogTexture;
-	sf::Array<uint8_t> visFog;
 	sv::ReachableSet reachableSet;
 	sf::Vec4 worldMad;
-	sf::HashMap<uint32_t, DirtyTile> dirtyTiles;
 	float deltaFade = 0.0f;
 	uint32_t disableFrames = 0;
 
+	uint32_t getPageIndex(const sf::Vec2i &pagePos)
+	{
+		auto res = pageMapping.insert(pagePos);
+		if (res.inserted) {
+			res.entry.val = pages.size;
+			Page &page = pages.push();
+			page.pagePos = pagePos;
+			memset(page.fog, 0, sizeof(page.fog));
+			memset(page.target, 0, sizeof(page.target));
+
+			if (pagePos.x <= windowMin.x || pagePos.y <= windowMin.y || pagePos.x >= windowMax.x || pagePos.y >= windowMax.y) {
+				windowMin = sf::min(windowMin, pagePos - sf::Vec2i(1));
+				windowMax = sf::max(windowMax, pagePos + sf::Vec2i(1));
+				windowDirty = true;
+			}
+		}
+		return res.entry.val;
+	}
+
 	void addVisibleTile(const sf::Vec2i &tile, uint32_t val1, bool immediate)
 	{
-		sf::Vec2i relBase = tile - visFogOffset;
 		for (const sf::Vec2i &nb : sf::slice(visFogNeighbors)) {
-			sf::Vec2i rel = relBase + nb;
-			if (rel.x < 0 || rel.y < 0 || rel.x >= visFogResolution.x || rel.y >= visFogResolution.y) continue;
+			sf::Vec2i pos = tile + nb;
+			sf::Vec2i pagePos = sf::Vec2i(pos.x >> VisFogPageShift, pos.y >> VisFogPageShift);
+			uint32_t pageIndex = getPageIndex(pagePos);
+			Page &page = pages[pageIndex];
 
-			uint32_t ix = (rel.y * visFogResolution.x + rel.x) * 2;
+			uint32_t ix = ((pos.y & (VisFogPageSize - 1)) * VisFogPageSize + (pos.x & (VisFogPageSize - 1))) * 2;
 			uint32_t val0 = &nb == visFogNeighbors ? 255 : 128;
 
-			if (val0 > visFog[ix + 0] || val1 > visFog[ix + 1]) {
-				DirtyTile &dirty = dirtyTiles[ix];
-				dirty.val[0] = sf::max(dirty.val[0], (uint8_t)val0, visFog[ix + 0]);
-				dirty.val[1] = sf::max(dirty.val[1], (uint8_t)val1, visFog[ix + 1]);
+			uint8_t *target = page.target + ix;
+			if (val0 > target[0] || val1 > target[1]) {
+				target[0] = sf::max(target[0], (uint8_t)val0);
+				target[1] = sf::max(target[1], (uint8_t)val1);
 
 				if (immediate) {
-					visFog[ix + 0] = dirty.val[0];
-					visFog[ix + 1] = dirty.val[1];
+					page.fog[ix + 0] = target[0];
+					page.fog[ix + 1] = target[1];
+					if (!page.uploadDirty) {
+						page.uploadDirty = true;
+						uploadPages.push(pageIndex);
+					}
+				} else if (!page.fading) {
+					page.fading = true;
+					fadingPages.push(pageIndex);
 				}
 			}
 		}
 	}
 
+	void updateWindow()
+	{
+		sf::Vec2i resolution = (windowMax - windowMin + sf::Vec2i(1)) * VisFogPageSize;
+		sf::Vec2i offset = windowMin * VisFogPageSize;
+
+		worldMad.x = 1.0f / (float)resolution.x;
+		worldMad.y = 1.0f / (float)resolution.y;
+		worldMad.z = (0.5f + (float)-offset.x) / (float)resolution.x;
+		worldMad.w = (0.5f + (float)-offset.y) / (float)resolution.y;
+
+		sg_image_desc d = { };
+		d.label = "visFogTexture";
+		d.pixel_format = SG_PIXELFORMAT_RG8;
+		d.width = resolution.x;
+		d.height = resolution.y;
+		d.bqq_copy_target = true;
+		d.min_filter = SG_FILTER_LINEAR;
+		d.mag_filter = SG_FILTER_LINEAR;
+		d.wrap_u = SG_WRAP_CLAMP_TO_EDGE;
+		d.wrap_v = SG_WRAP_CLAMP_TO_EDGE;
+		visFogTexture.init(d);
+
+		// Fill the whole texture as it has no initial contents
+		sf::Array<uint8_t> data;
+		data.resize(resolution.x * resolution.y * 2);
+		uint32_t rowBytes = VisFogPageSize * 2;
+		for (Page &page : pages) {
+			sf::Vec2i base = (page.pagePos - windowMin) * VisFogPageSize;
+			for (int32_t y = 0; y < VisFogPageSize; y++) {
+				uint8_t *dst = data.data + ((base.y + y) * resolution.x + base.x) * 2;
+				memcpy(dst, page.fog + y * rowBytes, rowBytes);
+			}
+			page.uploadDirty = false;
+		}
+		uploadPages.clear();
+
+		sg_image_desc ud = { };
+		ud.width = resolution.x;
+		ud.height = resolution.y;
+		ud.num_mipmaps = 1;
+		ud.content.subimage[0][0].ptr = data.data;
+		ud.content.subimage[0][0].size = (int)data.size;
+		sg_bqq_update_subimage(visFogTexture.image, &ud, 0, 0);
+
+		windowDirty = false;
+	}
+
+	void uploadPage(const Page &page)
+	{
+		sf::Vec2i base = (page.pagePos - windowMin) * VisFogPageSize;
+
+		sg_image_desc d = { };
+		d.width = VisFogPageSize;
+		d.height = VisFogPageSize;
+		d.num_mipmaps = 1;
+		d.content.subimage[0][0].ptr = page.fog;
+		d.content.subimage[0][0].size = (int)sizeof(page.fog);
+		sg_bqq_update_subimage(visFogTexture.image, &d, base.x, base.y);
+	}
+
 	// -- API
 
 	VisFogSystemImp()
 	{
-		visFog.resize(visFogResolution.x * visFogResolution.y * 2);
-
-		worldMad.x = 1.0f / (float)visFogResolution.x;
-		worldMad.y = 1.0f / (float)visFogResolution.y;
-		worldMad.z = (0.5f + (float)-visFogOffset.x) / (float)visFogResolution.x;
-		worldMad.w = (0.5f + (float)-visFogOffset.y) / (float)visFogResolution.y;
+		// Start with a single empty page around the origin
+		windowMin = sf::Vec2i(-1, -1);
+		windowMax = sf::Vec2i(0, 0);
 
 		{
 			sg_image_desc d = { };
@@ -80,19 +213,7 @@ struct VisFogSystemImp final : VisFogSystem
 			disabledFogTexture.init(d);
 		}
 
-		{
-			sg_image_desc d = { };
-			d.label = "visFogTexture";
-			d.pixel_format = SG_PIXELFORMAT_RG8;
-			d.width = visFogResolution.x;
-			d.height = visFogResolution.y;
-			d.usage = SG_USAGE_DYNAMIC;
-			d.min_filter = SG_FILTER_LINEAR;
-			d.mag_filter = SG_FILTER_LINEAR;
-			d.wrap_u = SG_WRAP_CLAMP_TO_EDGE;
-			d.wrap_v = SG_WRAP_CLAMP_TO_EDGE;
-			visFogTexture.init(d);
-		}
+		updateWindow();
 	}
 
 	void updateVisibility(const sv::VisibleUpdateEvent &e, bool immediate) override
@@ -115,35 +236,41 @@ struct VisFogSystemImp final : VisFogSystem
 			disableFrames--;
 		}
 
-		if (dirtyTiles.size() == 0) return;
-
-		const float rcpFadeUnitSpeed = 255.0f / 3.0f;
-		deltaFade += dt * rcpFadeUnitSpeed;
+		if (fadingPages.size > 0) {
+			const float rcpFadeUnitSpeed = 255.0f / 3.0f;
+			deltaFade += dt * rcpFadeUnitSpeed;
+		}
 
-		if (deltaFade < 1.0f) return;
-		uint32_t fadeNum = (uint32_t)deltaFade;
-		deltaFade -= (float)fadeNum;
+		if (deltaFade >= 1.0f) {
+			uint32_t fadeNum = (uint32_t)deltaFade;
+			deltaFade -= (float)fadeNum;
 
-		for (uint32_t i = 0; i < dirtyTiles.size(); i++) {
-			auto &pair = dirtyTiles.data[i];
-			uint8_t *dst = visFog.data + pair.key;
+			for (uint32_t i = 0; i < fadingPages.size; i++) {
+				uint32_t pageIndex = fadingPages[i];
+				Page &page = pages[pageIndex];
 
-			dst[0] = pair.val.val[0];
+				if (!page.uploadDirty) {
+					page.uploadDirty = true;
+					uploadPages.push(pageIndex);
+				}
 
-			if ((uint32_t)(pair.val.val[1] - dst[1]) <= fadeNum) {
-				dst[1] = pair.val.val[1];
-				dirtyTiles.remove(pair.key);
-				i--;
-			} else {
-				dst[1] += fadeNum;
+				if (!stepVisFogPage(page.fog, page.target, fadeNum)) {
+					page.fading = false;
+					fadingPages.removeSwap(i--);
+				}
 			}
 		}
 
-		// TODO: Dirty rectangle
-		sg_image_content content = { };
-		content.subimage[0][0].ptr = visFog.data;
-		content.subimage[0][0].size = visFog.size;
-		sg_update_image(visFogTexture.image, &content);
+		if (windowDirty) {
+			updateWindow();
+		} else {
+			for (uint32_t pageIndex : uploadPages) {
+				Page &page = pages[pageIndex];
+				uploadPage(page);
+				page.uploadDirty = false;
+			}
+			uploadPages.clear();
+		}
 	}
 
 	VisFogImage getVisFogImage() const override
@@ -28,6 +28,13 @@ int main(int argc, char **argv)
 	if (arg >= 0) {
 		procDesc.threads = atoi(sargs_value_at(arg));
 	}
+	if (sargs_exists("no-cache")) {
+		procDesc.useBuildCache = false;
+	}
+	arg = sargs_find("shared-cache");
+	if (arg >= 0) {
+		procDesc.sharedBuildCacheRoot = sf::String(sargs_value_at(arg));
+	}
 
 	stm_setup();
 
@@ -39,9 +46,19 @@ int main(int argc, char **argv)
 		std::this_thread::sleep_for(std::chrono::milliseconds(10));
 	}
 
+	int ret = 0;
+
+	arg = sargs_find("pack");
+	if (arg >= 0) {
+		if (!packProcessedAssets(sf::String(sargs_value_at(arg)))) {
+			sf::debugPrintLine("Failed to write content pack");
+			ret = 1;
+		}
+	}
+
 	closeProcessing();
 
-	return 0;
+	return ret;
 }
 
 #endif
@@ -0,0 +1,132 @@
+#if defined(SP_FRAMEGRAPH_CHECK)
+
+#include "sf/Base.h"
+#include "sp/FrameGraph.h"
+
+// Headless check of `sp::FrameGraph` pass culling, transient target
+// aliasing and pooled image release running on the sokol dummy backend.
+
+static int g_numFailed = 0;
+
+static void check(bool cond, const char *desc)
+{
+	sf::debugPrintLine("%s: %s", cond ? "OK" : "FAIL", desc);
+	if (!cond) g_numFailed++;
+}
+
+struct CheckFrame
+{
+	uint32_t color, lit, unused, output;
+	uint32_t gbufferPass, lightPass, postPass, debugPass, orphanPass;
+};
+
+// gbuffer -> color -> light -> lit -> post -> output
+//                               lit -> debug -> unused
+//                                      orphan -> unused
+static CheckFrame declareFrame(sp::FrameGraph &graph)
+{
+	CheckFrame f;
+
+	sp::FrameTargetDesc desc;
+	desc.resolution = sf::Vec2i(64, 64);
+
+	graph.reset();
+	f.color = graph.createTarget("color", desc);
+	f.lit = graph.createTarget("lit", desc);
+	f.unused = graph.createTarget("unused", desc);
+	f.output = graph.createTarget("output", desc);
+	graph.markOutput(f.output);
+
+	f.gbufferPass = graph.addPass("gbuffer");
+	graph.write(f.gbufferPass, f.color);
+
+	f.lightPass = graph.addPass("light");
+	graph.read(f.lightPass, f.color);
+	graph.write(f.lightPass, f.lit);
+
+	f.postPass = graph.addPass("post");
+	graph.read(f.postPass, f.lit);
+	graph.write(f.postPass, f.output);
+
+	f.debugPass = graph.addPass("debug");
+	graph.read(f.debugPass, f.lit);
+	graph.write(f.debugPass, f.unused);
+
+	f.orphanPass = graph.addPass("orphan");
+	graph.write(f.orphanPass, f.unused);
+
+	graph.compile();
+
+	for (uint32_t pass = 0; pass < graph.passes.size; pass++) {
+		if (graph.beginPass(pass)) graph.endPass();
+	}
+
+	return f;
+}
+
+static void declareIdleFrame(sp::FrameGraph &graph)
+{
+	graph.reset();
+	graph.compile();
+}
+
+int main(int argc, char **argv)
+{
+	sg_desc desc = { };
+	sg_setup(&desc);
+
+	{
+		sp::FrameGraph graph;
+
+		CheckFrame f = declareFrame(graph);
+		const sp::FrameGraphStats &stats = graph.getStats();
+
+		check(graph.isPassActive(f.gbufferPass) && graph.isPassActive(f.lightPass) && graph.isPassActive(f.postPass), "passes contributing to the output are active");
+		check(!graph.isPassActive(f.debugPass) && !graph.isPassActive(f.orphanPass), "passes not contributing to the output are culled");
+		check(stats.numCulledPasses == 2, "culled passes are counted");
+		check(graph.getImage(f.unused).id == 0, "targets of culled passes have no image");
+
+		sg_image colorImage = graph.getImage(f.color);
+		sg_image litImage = graph.getImage(f.lit);
+		sg_image outputImage = graph.getImage(f.output);
+		check(colorImage.id != litImage.id, "targets with overlapping lifetimes don't alias");
+		check(colorImage.id == outputImage.id, "targets with disjoint lifetimes alias");
+		check(stats.numTransientTargets == 3 && stats.numImages == 2, "three transient targets are backed by two images");
+		check(stats.imageBytes < stats.transientBytes, "aliasing saves memory");
+
+		uint32_t numImages = graph.images.size;
+		uint32_t numRenderPasses = graph.renderPasses.size;
+		declareFrame(graph);
+		check(graph.images.size == numImages && graph.renderPasses.size == numRenderPasses, "pooled images and passes are reused across frames");
+		check(graph.getImage(f.color).id == colorImage.id, "reused targets keep their image");
+
+		for (uint32_t i = 0; i < sp::FrameGraph::MaxUnusedFrames; i++) {
+			declareIdleFrame(graph);
+		}
+		check(graph.images.size == numImages, "pooled images survive MaxUnusedFrames idle frames");
+		check(sg_query_image_state(colorImage) == SG_RESOURCESTATE_VALID, "pooled images are not destroyed before the idle limit");
+
+		declareIdleFrame(graph);
+		declareIdleFrame(graph);
+		check(graph.images.size == 0 && graph.renderPasses.size == 0, "pooled images and passes are released past the idle limit");
+		check(sg_query_image_state(colorImage) == SG_RESOURCESTATE_INVALID, "released images are destroyed");
+
+		declareFrame(graph);
+		check(graph.images.size == numImages, "released images are recreated on demand");
+
+		graph.releaseAll();
+		check(graph.images.size == 0 && graph.renderPasses.size == 0, "releaseAll() frees the pool");
+	}
+
+	sg_shutdown();
+
+	if (g_numFailed > 0) {
+		sf::debugPrintLine("%d checks failed", g_numFailed);
+		return 1;
+	}
+
+	sf::debugPrintLine("All checks passed");
+	return 0;
+}
+
+#endif
@@ -0,0 +1,255 @@
+#if defined(SP_KERNEL_BENCHMARK)
+
+#include "sf/Base.h"
+#include "sf/Array.h"
+#include "sf/Float8.h"
+#include "sf/Random.h"
+#include "sp/Animation.h"
+#include "sp/Audio.h"
+
+#include "ext/sokol/sokol_time.h"
+#include "ext/sokol/sokol_args.h"
+
+// Headless benchmark of the batched animation and audio mixing kernels. The
+// bone kernels are timed against straightforward per-bone reference versions
+// and fail the run if the results differ too much.
+// Build with `--avx2` as well to measure the 8-wide `sf::Float8` paths.
+//
+// Arguments (sokol_args style):
+//   iterations=N  Calls per timed kernel, defaults to 10000
+//   voices=N      Voices in the audio mix benchmark, defaults to 128
+
+// Fail if the batched results differ more than this from the reference
+static const float MaxKernelError = 1e-4f;
+
+static int g_numFailed = 0;
+
+static void reportError(const char *name, float error)
+{
+	bool ok = error <= MaxKernelError;
+	sf::debugPrintLine("%s: %s, error %g", ok ? "OK" : "FAIL", name, error);
+	if (!ok) g_numFailed++;
+}
+
+static void blendBoneReference(sp::BoneTransform &d, const sp::BoneTransform &s, float alpha)
+{
+	d.translation = sf::lerp(d.translation, s.translation, alpha);
+	d.scale = sf::lerp(d.scale, s.scale, alpha);
+
+	// Normalized lerp towards the closer hemisphere
+	sf::Quat rotation = s.rotation;
+	if (sf::dot(d.rotation, rotation) < 0.0f) rotation = -rotation;
+	d.rotation = sf::normalize(sf::lerp(d.rotation, rotation, alpha));
+}
+
+static void blendBoneTransformReference(sf::Slice<sp::BoneTransform> dst, sf::Slice<const sp::BoneTransform> src, float alpha)
+{
+	for (uint32_t i = 0; i < dst.size; i++) {
+		blendBoneReference(dst[i], src[i], alpha);
+	}
+}
+
+static void boneTransformToWorldReference(sf::Slice<const sp::Bone> bones, sf::Slice<sf::Mat34> dst, sf::Slice<const sp::BoneTransform> src, const sf::Mat34 &toWorld)
+{
+	if (bones.size == 0) return;
+	dst[0] = toWorld * sf::mat::world(src[0].translation, src[0].rotation, src[0].scale);
+	for (uint32_t boneI = 1; boneI < bones.size; boneI++) {
+		uint32_t parentI = bones[boneI].parentIx;
+		dst[boneI] = dst[parentI] * sf::mat::world(src[boneI].translation, src[boneI].rotation, src[boneI].scale);
+	}
+}
+
+static void initPose(sf::Slice<sp::BoneTransform> dst, sf::Random &rng)
+{
+	for (sp::BoneTransform &t : dst) {
+		t.translation = sf::Vec3(rng.nextFloat(), rng.nextFloat(), rng.nextFloat()) - sf::Vec3(0.5f);
+		sf::Vec3 angles = sf::Vec3(rng.nextFloat(), rng.nextFloat(), rng.nextFloat()) * sf::F_2PI;
+		t.rotation = sf::eulerAnglesToQuat(angles);
+		t.scale = sf::Vec3(0.9f + 0.2f * rng.nextFloat());
+	}
+}
+
+// Average nanoseconds per call of `func()`
+template <typename Fn>
+static double timeNs(uint32_t iterations, Fn func)
+{
+	uint64_t begin = stm_now();
+	for (uint32_t i = 0; i < iterations; i++) {
+		func();
+	}
+	return stm_sec(stm_since(begin)) * 1e9 / (double)iterations;
+}
+
+// Worst case chain where every bone depends on the previous one. Odd bone
+// counts exercise the 4-wide and scalar tails of the batched kernels.
+static void benchmarkBones(uint32_t numBones, uint32_t iterations)
+{
+	sf::Random rng;
+
+	sf::Array<sp::Bone> bones;
+	bones.resize(numBones);
+	for (uint32_t i = 0; i < numBones; i++) {
+		bones[i].parentIx = i > 0 ? i - 1 : ~0u;
+	}
+
+	sf::Array<sp::BoneTransform> poseA, poseB, ref, batched;
+	poseA.resize(numBones);
+	poseB.resize(numBones);
+	initPose(poseA, rng);
+	initPose(poseB, rng);
+
+	sf::Array<sf::Mat34> refWorld, batchedWorld;
+	refWorld.resize(numBones);
+	batchedWorld.resize(numBones);
+	sf::Mat34 toWorld = sf::mat::translate(1.0f, 2.0f, 3.0f);
+
+	double blendReferenceNs = timeNs(iterations, [&]() {
+		ref = poseA;
+		blendBoneTransformReference(ref, poseB, 0.3f);
+	});
+	double blendBatchedNs = timeNs(iterations, [&]() {
+		batched = poseA;
+		sp::blendBoneTransform(batched, poseB, 0.3f);
+	});
+	double worldReferenceNs = timeNs(iterations, [&]() {
+		boneTransformToWorldReference(bones, refWorld, ref, toWorld);
+	});
+	double worldBatchedNs = timeNs(iterations, [&]() {
+		sp::boneTransformToWorld(bones, batchedWorld, ref, toWorld);
+	});
+
+	float blendError = 0.0f, worldError = 0.0f;
+	for (uint32_t i = 0; i < numBones; i++) {
+		for (uint32_t j = 0; j < 4; j++) {
+			blendError = sf::max(blendError, sf::abs(ref[i].rotation.v[j] - batched[i].rotation.v[j]));
+		}
+		for (uint32_t j = 0; j < 3; j++) {
+			blendError = sf::max(blendError, sf::abs(ref[i].translation.v[j] - batched[i].translation.v[j]));
+			blendError = sf::max(blendError, sf::abs(ref[i].scale.v[j] - batched[i].scale.v[j]));
+		}
+		for (uint32_t j = 0; j < 12; j++) {
+			worldError = sf::max(worldError, sf::abs(refWorld[i].v[j] - batchedWorld[i].v[j]));
+		}
+	}
+
+	sf::debugPrintLine("%u bones:", numBones);
+	sf::debugPrintLine("  Blend: %.0fns (reference %.0fns, %.2fx)", blendBatchedNs, blendReferenceNs, blendReferenceNs / blendBatchedNs);
+	sf::debugPrintLine("  World: %.0fns (reference %.0fns, %.2fx)", worldBatchedNs, worldReferenceNs, worldReferenceNs / worldBatchedNs);
+	reportError("Bone blend", blendError);
+	reportError("Bone world matrices", worldError);
+}
+
+struct BenchmarkAudioSource : sp::AudioSource
+{
+	const float *data;
+	uint32_t numSamples;
+
+	BenchmarkAudioSource(const float *data, uint32_t numSamples, uint32_t sampleRate, uint32_t numChannels)
+		: data(data), numSamples(numSamples)
+	{
+		this->sampleRate = sampleRate;
+		this->numChannels = numChannels;
+		this->lengthInSamples = numSamples;
+	}
+
+	virtual void seek(uint32_t sample) override
+	{
+	}
+
+	virtual uint32_t advance(uint32_t sample, float *dst, uint32_t num) override
+	{
+		uint32_t numToRead = sample < numSamples ? sf::min(num, numSamples - sample) : 0;
+		memcpy(dst, data + sample * numChannels, numToRead * numChannels * sizeof(float));
+		return numToRead;
+	}
+};
+
+// Mix `numVoices` looping in-memory voices with mixed channel counts, sample
+// rates and pitches into a 48kHz stereo buffer in `AudioSystem` sized blocks.
+static void benchmarkAudioMix(uint32_t numVoices, uint32_t numFrames)
+{
+	const uint32_t sampleRate = 48000;
+	const uint32_t blockFrames = 256;
+	const uint32_t sourceSamples = 24000;
+	sf::Random rng;
+
+	sf::Array<float> sourceData;
+	sourceData.resizeUninit(sourceSamples * 2 + sp::AudioSource::AdvancePaddingInFloats);
+	for (float &f : sourceData) {
+		f = rng.nextFloat() * 2.0f - 1.0f;
+	}
+
+	// Half of the voices play at the output rate without pitch shifting like
+	// most sound effects, the rest exercise the general resampling path
+	sf::Array<BenchmarkAudioSource> sources;
+	sf::Array<sp::AudioSampler> samplers;
+	sf::Array<sp::AudioMixOpts> opts;
+	sources.reserve(numVoices);
+	samplers.resize(numVoices);
+	opts.resize(numVoices);
+	for (uint32_t i = 0; i < numVoices; i++) {
+		uint32_t numChannels = i % 4 < 2 ? 1 : 2;
+		bool unitStep = i % 2 == 0;
+		uint32_t srcRate = unitStep ? sampleRate : 44100;
+		sources.push(BenchmarkAudioSource(sourceData.data, sourceSamples, srcRate, numChannels));
+
+		sp::AudioMixOpts &opt = opts[i];
+		opt.loop = true;
+		opt.sampleRate = sampleRate;
+		opt.pitch = unitStep ? 1.0f : 0.75f + rng.nextFloat() * 0.5f;
+		opt.volumeNext[0] = rng.nextFloat();
+		opt.volumeNext[1] = rng.nextFloat();
+	}
+
+	sf::Array<float> mixBuf;
+	mixBuf.resizeUninit(blockFrames * 2);
+
+	uint64_t begin = stm_now();
+	for (uint32_t frame = 0; frame < numFrames; frame += blockFrames) {
+		uint32_t numBlock = sf::min(blockFrames, numFrames - frame) & ~1u;
+		if (numBlock == 0) break;
+
+		memset(mixBuf.data, 0, numBlock * 2 * sizeof(float));
+		for (uint32_t i = 0; i < numVoices; i++) {
+			samplers[i].advanceMixStereo(mixBuf.data, numBlock, &sources[i], opts[i]);
+		}
+	}
+	double mixSec = stm_sec(stm_since(begin));
+	double realtimeFactor = mixSec > 0.0 ? (double)numFrames / (double)sampleRate / mixSec : 0.0;
+
+	sf::debugPrintLine("%u voices, %u frames:", numVoices, numFrames);
+	sf::debugPrintLine("  Mix: %.2fms (%.1fx realtime)", mixSec * 1e3, realtimeFactor);
+}
+
+int main(int argc, char **argv)
+{
+	sargs_desc desc = { argc, argv };
+	desc.max_args = 16;
+	desc.buf_size = 16*4096;
+	sargs_setup(&desc);
+
+	uint32_t iterations = 10000;
+	if (sargs_exists("iterations")) {
+		iterations = sf::max((uint32_t)atoi(sargs_value("iterations")), 1u);
+	}
+	uint32_t numVoices = 128;
+	if (sargs_exists("voices")) {
+		numVoices = sf::max((uint32_t)atoi(sargs_value("voices")), 1u);
+	}
+
+	stm_setup();
+
+	sf::debugPrintLine("Float8: %s", SF_FLOAT8_AVX ? "AVX" : "2x Float4");
+
+	benchmarkBones(sp::MaxBones, iterations);
+	benchmarkBones(sp::MaxBones - 3, iterations);
+	benchmarkAudioMix(numVoices, 48000);
+
+	if (g_numFailed > 0) {
+		sf::debugPrintLine("%d checks failed", g_numFailed);
+		return 1;
+	}
+	return 0;
+}
+
+#endif
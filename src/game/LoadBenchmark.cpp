@@ -0,0 +1,186 @@
+#if defined(SP_LOAD_BENCHMARK)
+
+#include "sf/Base.h"
+#include "sf/Array.h"
+#include "sf/HashSet.h"
+#include "sf/Thread.h"
+#include "sp/Asset.h"
+#include "sp/ContentFile.h"
+#include "sp/JobSystem.h"
+#include "sp/Json.h"
+#include "server/ServerState.h"
+#include "client/MeshMaterial.h"
+
+#include "sf/ext/mx/mx_platform.h"
+
+#include "ext/sokol/sokol_gfx.h"
+#include "ext/sokol/sokol_time.h"
+#include "ext/sokol/sokol_args.h"
+
+// Headless benchmark loading every `MeshMaterial` referenced by the prefabs
+// of a map on the sokol dummy backend. Reports the time until every material
+// is usable (preview mips) and until the full mip chains have been swapped in.
+//
+// Arguments (sokol_args style):
+//   map=PATH      Map to load, defaults to `Maps/Castle/Autoload.json`
+//   workers=N     Job workers, defaults to all cores but one, zero loads serially
+//   pack=PATH     Content pack to mount in addition to Build/
+
+// Give up if loading takes longer than this
+static const double MaxLoadTime = 300.0;
+
+static sf::Box<sv::ServerState> loadMap(const char *name)
+{
+	jsi_args args = { };
+	args.dialect.allow_bare_keys = true;
+	args.dialect.allow_comments = true;
+	args.dialect.allow_control_in_string = true;
+	args.dialect.allow_missing_comma = true;
+	args.dialect.allow_trailing_comma = true;
+	jsi_value *value = jsi_parse_file(name, &args);
+	if (!value) {
+		sf::debugPrintLine("Failed to parse map %s:%u:%u: %s",
+			name, args.error.line, args.error.column, args.error.description);
+		return { };
+	}
+
+	sv::SavedMap map;
+	bool ok = sp::readJson(value, map);
+	jsi_free(value);
+	if (!ok) return { };
+
+	return map.state;
+}
+
+static void gatherMaterials(sf::HashSet<sf::Symbol> &materials, const sv::ServerState &state)
+{
+	for (const sv::Prefab &prefab : state.prefabs) {
+		for (const sf::Box<sv::Component> &comp : prefab.components) {
+			if (const auto *c = comp->as<sv::DynamicModelComponent>()) {
+				if (c->material) materials.insert(c->material);
+			} else if (const auto *c = comp->as<sv::TileModelComponent>()) {
+				if (c->material) materials.insert(c->material);
+			} else if (const auto *c = comp->as<sv::CharacterModelComponent>()) {
+				for (const sv::CharacterMaterial &material : c->materials) {
+					if (material.material) materials.insert(material.material);
+				}
+			}
+		}
+	}
+}
+
+static void updateLoading()
+{
+	sp::ContentFile::runMainThreadCallbacks();
+	sp::ContentFile::globalUpdate();
+	sp::Asset::globalUpdate();
+}
+
+int main(int argc, char **argv)
+{
+	sargs_desc desc = { argc, argv };
+	desc.max_args = 16;
+	desc.buf_size = 16*4096;
+	sargs_setup(&desc);
+
+	const char *mapName = sargs_value_def("map", "Maps/Castle/Autoload.json");
+	uint32_t numWorkers = sf::Thread::getNumCores() - 1;
+	if (sargs_exists("workers")) {
+		numWorkers = (uint32_t)atoi(sargs_value("workers"));
+	}
+
+	stm_setup();
+
+	{
+		sg_desc desc = { };
+		sg_setup(&desc);
+	}
+
+	sp::ContentFile::globalInit(true);
+	sp::JobSystem::globalInit(numWorkers);
+	sp::Asset::globalInit();
+	cl::MeshMaterial::globalInit();
+
+	// The dummy backend doesn't report the sRGB extension formats, use the
+	// plain variant that shares the same processed files
+	sg_pixel_format &albedoFormat = cl::MeshMaterial::materialFormats[(uint32_t)cl::MaterialTexture::Albedo];
+	if (albedoFormat == _SG_PIXELFORMAT_DEFAULT) albedoFormat = SG_PIXELFORMAT_BC1_RGBA;
+
+	sp::ContentFile::addRelativeFileRoot("Build", "Assets/");
+	if (sargs_exists("pack")) {
+		sp::ContentFile::addPackFile(sf::String(sargs_value("pack")), "Assets/");
+	}
+
+	int ret = 0;
+
+	sf::Box<sv::ServerState> state = loadMap(mapName);
+	if (state) {
+		sf::HashSet<sf::Symbol> names;
+		gatherMaterials(names, *state);
+
+		sf::debugPrintLine("Loading %u materials from %s with %u job workers", names.size(), mapName, numWorkers);
+
+		uint64_t startTime = stm_now();
+		double previewTime = -1.0, fullTime = -1.0;
+
+		sf::Array<cl::MeshMaterialRef> materials;
+		materials.reserve(names.size());
+		for (const sf::Symbol &name : names) {
+			materials.push().load(name);
+		}
+
+		while (fullTime < 0.0) {
+			updateLoading();
+
+			// Pending refine jobs hold an extra reference to the material
+			bool allLoaded = true, allRefined = true;
+			for (cl::MeshMaterialRef &ref : materials) {
+				if (!ref->isLoaded() && !ref->isFailed()) allLoaded = false;
+				if (mxa_load32_acq(&ref->refcount) > 1) allRefined = false;
+			}
+
+			double time = stm_sec(stm_since(startTime));
+			if (allLoaded && previewTime < 0.0) previewTime = time;
+			if (allLoaded && allRefined) fullTime = time;
+
+			if (time > MaxLoadTime) {
+				sf::debugPrintLine("Timed out after %.0fs", time);
+				ret = 1;
+				break;
+			}
+
+			sf::Thread::sleepMs(1);
+		}
+
+		uint32_t numFailed = 0;
+		for (cl::MeshMaterialRef &ref : materials) {
+			if (ref->isFailed()) numFailed++;
+		}
+
+		if (fullTime >= 0.0) {
+			sf::debugPrintLine("Preview mips: %.1fms", previewTime * 1000.0);
+			sf::debugPrintLine("Full mips: %.1fms", fullTime * 1000.0);
+		}
+		if (numFailed > 0) {
+			sf::debugPrintLine("%u/%u materials failed to load", numFailed, materials.size);
+			ret = 1;
+		}
+
+		materials.clear();
+		for (uint32_t i = 0; i < 4; i++) {
+			updateLoading();
+		}
+	} else {
+		ret = 1;
+	}
+
+	cl::MeshMaterial::globalCleanup();
+	sp::JobSystem::globalCleanup();
+	sp::Asset::globalCleanup();
+	sp::ContentFile::globalCleanup();
+	sg_shutdown();
+
+	return ret;
+}
+
+#endif
@@ -26,6 +26,7 @@
 #include "sf/Float4.h"
 
 #include "sf/Mutex.h"
+#include "sf/File.h"
 
 #include "ext/sokol/sokol_gl.h"
 
@@ -258,7 +259,15 @@ void spInit()
 	#endif
 
 	if (mapBuild) {
-		sp::ContentFile::addRelativeFileRoot("Build", "Assets/");
+		// Loose files in Build/ are tried first so freshly processed assets are
+		// not hidden by a stale archive, the archive covers anything missing
+		bool hasPack = sargs_exists("pack");
+		if (!hasPack || sf::isDirectory("Build")) {
+			sp::ContentFile::addRelativeFileRoot("Build", "Assets/");
+		}
+		if (hasPack) {
+			sp::ContentFile::addPackFile(sf::String(sargs_value("pack")), "Assets/");
+		}
 	}
 
     
@@ -11,8 +11,10 @@
 #include "sf/HashMap.h"
 #include "sf/HashSet.h"
 #include "sf/Box.h"
+#include "sf/Sort.h"
 
 #include "sp/Asset.h"
+#include "sp/ContentPack.h"
 
 #include "ext/sokol/sokol_time.h"
 
@@ -48,6 +50,56 @@ enum class JobPriority
 struct Task;
 struct Processor;
 
+// Bump to invalidate all existing build cache entries
+static const uint32_t BuildCacheVersion = 1;
+
+// 128-bit non-cryptographic hash used to key the build cache
+struct BuildHash
+{
+	uint64_t a = UINT64_C(0x243f6a8885a308d3);
+	uint64_t b = UINT64_C(0x13198a2e03707344);
+
+	void update(const void *data, size_t size)
+	{
+		const uint64_t k0 = UINT64_C(0x9e3779b97f4a7c15);
+		const uint64_t k1 = UINT64_C(0xc2b2ae3d27d4eb4f);
+
+		const char *ptr = (const char*)data;
+		while (size > 0) {
+			uint64_t word = 0;
+			size_t chunk = sf::min(size, sizeof(uint64_t));
+			memcpy(&word, ptr, chunk);
+			a = ((a << 31u | a >> 33u) ^ word) * k0;
+			b = ((b << 27u | b >> 37u) + word) * k1;
+			ptr += chunk;
+			size -= chunk;
+		}
+	}
+
+	void update(sf::String str)
+	{
+		uint64_t size = str.size;
+		update(&size, sizeof(size));
+		update(str.data, str.size);
+	}
+
+	void update(const BuildHash &hash)
+	{
+		update(&hash.a, sizeof(hash.a));
+		update(&hash.b, sizeof(hash.b));
+	}
+
+	void format(sf::StringBuf &dst) const
+	{
+		uint64_t ha = a ^ (b >> 29u), hb = b ^ (a >> 31u);
+		ha = (ha ^ (ha >> 33u)) * UINT64_C(0xff51afd7ed558ccd);
+		hb = (hb ^ (hb >> 33u)) * UINT64_C(0xc4ceb9fe1a85ec53);
+		ha ^= ha >> 33u;
+		hb ^= hb >> 33u;
+		dst.format("%016llx%016llx", (unsigned long long)ha, (unsigned long long)hb);
+	}
+};
+
 struct Job
 {
 	enum Status
@@ -57,21 +109,32 @@ struct Job
 		Failed,
 	};
 
+	enum CacheKey
+	{
+		NotCached,  // < Cheap job, doesn't affect the cache key
+		Hashed,     // < Expensive job, added to the cache key
+		HashFailed, // < Something the job depends on couldn't be hashed
+	};
+
 	sf::StringBuf description;
 
 	virtual bool isNotable() const { return false; }
 	virtual Status begin(Processor &p) = 0;
 	virtual Status getStatus() { return Status::Succeeded; }
+
+	// Add everything that affects the result of the job to `hash`
+	virtual CacheKey hashCacheKey(Processor &p, BuildHash &hash) { return NotCached; }
 };
 
 struct ExecJob : Job
 {
 	sf::Symbol exeName;
 	sf::Array<sf::StringBuf> args;
+	sf::Array<sf::StringBuf> inputFiles; // < Files read by the tool that are not task inputs
 	sf::Process *process = nullptr;
 
-	ExecJob(const sf::String &exeName, sf::Array<sf::StringBuf> &&args)
-		: exeName(exeName), args(std::move(args))
+	ExecJob(const sf::String &exeName, sf::Array<sf::StringBuf> &&args, sf::Array<sf::StringBuf> &&inputFiles)
+		: exeName(exeName), args(std::move(args)), inputFiles(std::move(inputFiles))
 	{
 	}
 
@@ -86,6 +149,7 @@ struct ExecJob : Job
 
 	virtual Status begin(Processor &p);
 	virtual Status getStatus();
+	virtual CacheKey hashCacheKey(Processor &p, BuildHash &hash);
 };
 
 struct CopyJob : Job
@@ -147,6 +211,41 @@ struct MkdirsJob : Job
 	}
 };
 
+// Copy a file into the build cache, failing to do so doesn't fail the task
+struct CacheStoreJob : Job
+{
+	sf::StringBuf src, dst;
+
+	CacheStoreJob(sf::String src, sf::String dst)
+		: src(src), dst(dst)
+	{
+	}
+
+	virtual Status begin(Processor &p)
+	{
+		description.format("cache %s %s", src.data, dst.data);
+
+		sf::SmallStringBuf<512> tempFile;
+		tempFile.append(dst, ".tmp");
+
+		size_t len = 0;
+		for (size_t i = 0; i < dst.size; i++) {
+			if (dst.data[i] == '/' || dst.data[i] == '\\') len = i;
+		}
+
+		sf::Array<char> data;
+		bool ok = true;
+		ok = ok && (len == 0 || sf::createDirectories(sf::String(dst.data, len)));
+		ok = ok && sf::readFile(data, src);
+		ok = ok && sf::writeFile(tempFile, data);
+		ok = ok && sf::replaceFile(dst, tempFile);
+		if (!ok) {
+			sf::debugPrintLine("Failed to store %s in build cache", src.data);
+		}
+		return Succeeded;
+	}
+};
+
 struct TaskInstance;
 
 struct JobQueue
@@ -154,9 +253,9 @@ struct JobQueue
 	TaskInstance *taskInstance;
 	sf::Array<sf::Box<Job>> jobs;
 
-	void exec(sf::String exeName, sf::Array<sf::StringBuf> &&args)
+	void exec(sf::String exeName, sf::Array<sf::StringBuf> &&args, sf::Array<sf::StringBuf> &&inputFiles=sf::Array<sf::StringBuf>())
 	{
-		jobs.push(sf::box<ExecJob>(exeName, std::move(args)));
+		jobs.push(sf::box<ExecJob>(exeName, std::move(args), std::move(inputFiles)));
 	}
 
 	void copy(sf::String src, sf::String dst)
@@ -169,6 +268,11 @@ struct JobQueue
 		jobs.push(sf::box<MoveJob>(src, dst));
 	}
 
+	void cacheStore(sf::String src, sf::String dst)
+	{
+		jobs.push(sf::box<CacheStoreJob>(src, dst));
+	}
+
 	void mkdirsToFile(sf::String path)
 	{
 		size_t len = 0;
@@ -246,6 +350,12 @@ struct ActiveJobQueue
 	sf::Box<Job> job;
 };
 
+struct FileHash
+{
+	uint64_t timestamp = 0;
+	BuildHash hash;
+};
+
 struct Processor
 {
 	bool verbose = false;
@@ -256,6 +366,14 @@ struct Processor
 	sf::StringBuf buildRoot;
 	sf::StringBuf toolRoot;
 
+	// Content addressed build cache, outputs are keyed by the hash of the input
+	// files, tool binaries and job arguments. Empty roots are disabled.
+	sf::StringBuf cacheRoot;
+	sf::StringBuf sharedCacheRoot;
+	sf::HashMap<sf::Symbol, FileHash> fileHashes;
+	uint32_t numCacheHits = 0;
+	uint32_t numCacheMisses = 0;
+
 	sf::HashSet<sf::Symbol> assetsToReload;
 	sf::HashMap<sf::Symbol, ProcessingAsset> processingAssets;
 
@@ -273,9 +391,16 @@ struct Processor
 	void addJobs(JobPriority priority, TaskInstance &ti, JobQueue jobs)
 	{
 		jobs.taskInstance = &ti;
+		if (cacheRoot.size > 0) {
+			applyBuildCache(ti, jobs);
+		}
 		jobQueues[(uint32_t)priority].push(std::move(jobs));
 	}
 
+	bool hashFile(BuildHash &hash, sf::String path);
+	bool hasCacheEntry(sf::String entryRoot, TaskInstance &ti);
+	void applyBuildCache(TaskInstance &ti, JobQueue &jobs);
+
 	void addInputFile(const sf::Symbol &path);
 
 	void updateTasks();
@@ -312,6 +437,116 @@ void Processor::addInputFile(const sf::Symbol &path)
 	}
 }
 
+bool Processor::hashFile(BuildHash &hash, sf::String path)
+{
+	uint64_t timestamp = sf::getFileTimestamp(path);
+	if (!timestamp) return false;
+
+	FileHash &fileHash = fileHashes[sf::Symbol(path)];
+	if (fileHash.timestamp != timestamp) {
+		sf::Array<char> data;
+		if (!sf::readFile(data, path)) return false;
+		fileHash.hash = BuildHash();
+		fileHash.hash.update(data.data, data.size);
+		fileHash.timestamp = timestamp;
+	}
+
+	hash.update(fileHash.hash);
+	return true;
+}
+
+bool Processor::hasCacheEntry(sf::String entryRoot, TaskInstance &ti)
+{
+	for (auto &output : ti.outputs) {
+		sf::SmallStringBuf<512> path;
+		sf::appendPath(path, entryRoot, output.key);
+		if (!sf::fileExists(path)) return false;
+	}
+	return true;
+}
+
+// Replace `jobs` with copies from the build cache if there's a matching entry,
+// otherwise append jobs to store the outputs after the task succeeds.
+void Processor::applyBuildCache(TaskInstance &ti, JobQueue &jobs)
+{
+	BuildHash hash;
+	hash.update(&BuildCacheVersion, sizeof(BuildCacheVersion));
+	hash.update(ti.task->name);
+
+	// Don't use or store a cache entry unless everything could be hashed
+	bool cacheable = false;
+	for (sf::Box<Job> &job : jobs.jobs) {
+		Job::CacheKey key = job->hashCacheKey(*this, hash);
+		if (key == Job::HashFailed) return;
+		if (key == Job::Hashed) cacheable = true;
+	}
+	if (!cacheable) return;
+
+	// Hash inputs in a stable order as the map order depends on file discovery
+	sf::SmallArray<sf::Symbol, 16> inputKeys;
+	for (auto &input : ti.inputs) inputKeys.push(input.key);
+	sf::sort(inputKeys, [](const sf::Symbol &a, const sf::Symbol &b) { return sf::String(a) < sf::String(b); });
+	for (const sf::Symbol &key : inputKeys) {
+		sf::SmallStringBuf<512> path;
+		sf::appendPath(path, dataRoot, ti.inputs[key]);
+		hash.update(key);
+		if (!hashFile(hash, path)) return;
+	}
+
+	sf::SmallStringBuf<64> hashStr;
+	hash.format(hashStr);
+
+	sf::StringBuf localEntry, sharedEntry;
+	sf::appendPath(localEntry, cacheRoot, sf::String(hashStr.data, 2), hashStr);
+	if (sharedCacheRoot.size > 0) {
+		sf::appendPath(sharedEntry, sharedCacheRoot, sf::String(hashStr.data, 2), hashStr);
+	}
+
+	bool localHit = hasCacheEntry(localEntry, ti);
+	bool sharedHit = !localHit && sharedEntry.size > 0 && hasCacheEntry(sharedEntry, ti);
+
+	if (localHit || sharedHit) {
+		sf::String hitEntry = localHit ? localEntry : sharedEntry;
+		numCacheHits++;
+		if (verbose) {
+			sf::debugPrintLine("Cache hit: %s (%s) %s", ti.key.data, ti.task->name.data, hashStr.data);
+		}
+
+		JobQueue restore;
+		restore.taskInstance = jobs.taskInstance;
+		for (auto &output : ti.outputs) {
+			sf::SmallStringBuf<512> cacheFile, tempFile, dstFile;
+			sf::appendPath(cacheFile, hitEntry, output.key);
+			sf::appendPath(tempFile, tempRoot, output.val);
+			sf::appendPath(dstFile, buildRoot, output.val);
+			restore.mkdirsToFile(tempFile);
+			restore.mkdirsToFile(dstFile);
+			restore.copy(cacheFile, tempFile);
+			restore.move(tempFile, dstFile);
+			if (sharedHit) {
+				sf::SmallStringBuf<512> localFile;
+				sf::appendPath(localFile, localEntry, output.key);
+				restore.cacheStore(cacheFile, localFile);
+			}
+		}
+		jobs = std::move(restore);
+		return;
+	}
+
+	numCacheMisses++;
+	for (auto &output : ti.outputs) {
+		sf::SmallStringBuf<512> dstFile;
+		sf::appendPath(dstFile, buildRoot, output.val);
+		sf::String entries[] = { localEntry, sharedEntry };
+		for (sf::String entry : entries) {
+			if (entry.size == 0) continue;
+			sf::SmallStringBuf<512> cacheFile;
+			sf::appendPath(cacheFile, entry, output.key);
+			jobs.cacheStore(dstFile, cacheFile);
+		}
+	}
+}
+
 void Processor::updateTasks()
 {
 	uint64_t now = stm_now();
@@ -425,6 +660,30 @@ Job::Status ExecJob::begin(Processor &p)
 	return process ? Running : Failed;
 }
 
+Job::CacheKey ExecJob::hashCacheKey(Processor &p, BuildHash &hash)
+{
+	sf::SmallStringBuf<512> exePath;
+	sf::appendPath(exePath, p.toolRoot, exeName);
+	#if SF_OS_WINDOWS
+		exePath.append(".exe");
+	#endif
+
+	hash.update(exeName);
+	if (!p.hashFile(hash, exePath)) return HashFailed;
+
+	uint64_t numArgs = args.size;
+	hash.update(&numArgs, sizeof(numArgs));
+	for (sf::StringBuf &arg : args) {
+		hash.update(arg);
+	}
+
+	for (sf::StringBuf &path : inputFiles) {
+		if (!p.hashFile(hash, path)) return HashFailed;
+	}
+
+	return Hashed;
+}
+
 Job::Status ExecJob::getStatus()
 {
 	sf_assert(process);
@@ -807,7 +1066,7 @@ struct MaterialTextureTask : Task
 		args.push(std::move(path));
 	}
 
-	void pushJobs(Processor &p, TaskInstance &ti, sf::Array<sf::StringBuf> &&args)
+	void pushJobs(Processor &p, TaskInstance &ti, sf::Array<sf::StringBuf> &&args, sf::Array<sf::StringBuf> &&inputFiles=sf::Array<sf::StringBuf>())
 	{
 		JobQueue jq;
 		{
@@ -817,7 +1076,7 @@ struct MaterialTextureTask : Task
 			jq.mkdirsToFile(tempFile);
 			jq.mkdirsToFile(dstFile);
 		}
-		jq.exec("sp-texcomp", std::move(args));
+		jq.exec("sp-texcomp", std::move(args), std::move(inputFiles));
 		for (int i = 0; i < mipDrops; i++) {
 			sf::SmallStringBuf<256> tempFile, dstFile;
 			sf::appendPath(tempFile, p.tempRoot, ti.outputs[s_drop_arr[i]]);
@@ -938,6 +1197,7 @@ struct MaskTextureTask : MaterialTextureTask
 	virtual void process(Processor &p, TaskInstance &ti)
 	{
 		sf::Array<sf::StringBuf> args;
+		sf::Array<sf::StringBuf> inputFiles;
 
 		addCommonTexcompArgs(p, ti, args);
 
@@ -960,6 +1220,7 @@ struct MaskTextureTask : MaterialTextureTask
 			sf::appendPath(path, p.dataRoot, "Utility", "White.png");
 			args.push("--input-g");
 			args.push(path);
+			inputFiles.push(path);
 		}
 
 		if (auto pair = ti.inputs.find(s_emissive)) {
@@ -976,7 +1237,7 @@ struct MaskTextureTask : MaterialTextureTask
 			args.push(path);
 		}
 
-		pushJobs(p, ti, std::move(args));
+		pushJobs(p, ti, std::move(args), std::move(inputFiles));
 	}
 };
 
@@ -1456,6 +1717,34 @@ static void findResourcesImp(Processor &p, sf::String root, sf::StringBuf &prefi
 	}
 }
 
+static void findBuildFilesImp(Processor &p, sf::Array<sp::ContentPackSource> &sources, sf::StringBuf &prefix)
+{
+	sf::Array<sf::FileInfo> files;
+	files.reserve(128);
+
+	{
+		sf::SmallStringBuf<256> dir;
+		sf::appendPath(dir, p.buildRoot, prefix);
+		sf::listFiles(dir, files);
+	}
+
+	for (sf::FileInfo &file : files) {
+		uint32_t len = prefix.size;
+		if (prefix.size > 0) prefix.append('/');
+		prefix.append(file.name);
+
+		if (file.isDirectory) {
+			findBuildFilesImp(p, sources, prefix);
+		} else {
+			sp::ContentPackSource &source = sources.push();
+			source.name = prefix;
+			sf::appendPath(source.path, p.buildRoot, prefix);
+		}
+
+		prefix.resize(len);
+	}
+}
+
 void initializeProcessing(const ProcessingDesc &desc)
 {
 	Processor &p = g_processor;
@@ -1475,6 +1764,10 @@ void initializeProcessing(const ProcessingDesc &desc)
 	sf::appendPath(p.tempRoot, "Temp");
 	sf::appendPath(p.buildRoot, "Build");
 	sf::appendPath(p.toolRoot, "Tools");
+	if (desc.useBuildCache) {
+		sf::appendPath(p.cacheRoot, "Cache");
+		p.sharedCacheRoot = desc.sharedBuildCacheRoot;
+	}
 #if SF_OS_WINDOWS
 	sf::appendPath(p.toolRoot, "win32");
 #elif SF_OS_APPLE
@@ -1627,6 +1920,12 @@ bool updateProcessing()
 		return true;
 	}
 
+	if (p.numCacheHits + p.numCacheMisses > 0) {
+		sf::debugPrintLine("Build cache: %u restored, %u built", p.numCacheHits, p.numCacheMisses);
+		p.numCacheHits = 0;
+		p.numCacheMisses = 0;
+	}
+
 	if (p.assetsToReload.size() > 0) {
 		sf::Array<sf::Symbol> fixedNames;
 		sf::SmallStringBuf<1024> fixed;
@@ -1649,6 +1948,18 @@ bool updateProcessing()
 	return false;
 }
 
+bool packProcessedAssets(const sf::String &path)
+{
+	Processor &p = g_processor;
+
+	sf::Array<sp::ContentPackSource> sources;
+	sf::SmallStringBuf<256> prefix;
+	findBuildFilesImp(p, sources, prefix);
+
+	sf::debugPrintLine("Packing %u files to %s", sources.size, sf::SmallStringBuf<256>(path).data);
+	return sp::writeContentPack(path, sources, p.level);
+}
+
 void queryProcessingAssets(sf::Array<ProcessingAsset> &assets)
 {
 	Processor &p = g_processor;
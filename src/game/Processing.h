@@ -2,12 +2,15 @@
 
 #include "sf/Array.h"
 #include "sf/Symbol.h"
+#include "sf/String.h"
 
 struct ProcessingDesc
 {
 	int level = 5;
 	int threads = 0;
 	bool localProcessing = false;
+	bool useBuildCache = true;       // < Restore unchanged outputs from `Cache/`
+	sf::String sharedBuildCacheRoot; // < Optional cache directory shared between machines
 };
 
 struct ProcessingAsset
@@ -23,3 +26,6 @@ bool updateProcessing();
 
 void queryProcessingAssets(sf::Array<ProcessingAsset> &assets);
 
+// Pack everything in the build directory into a single archive, see `sp/ContentPack.h`
+bool packProcessedAssets(const sf::String &path);
+
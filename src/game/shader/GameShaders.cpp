@@ -101,6 +101,15 @@ void GameShaders::load()
 	}
 
 	shadowGridPipe.init(shadowGrid, sp::PipeVertexFloat2);
+
+	{
+		// Multiply with the existing visibility to composite separately rendered casters
+		sg_pipeline_desc &d = shadowGridMulPipe.init(shadowGrid, sp::PipeVertexFloat2);
+		d.blend.enabled = true;
+		d.blend.src_factor_alpha = d.blend.src_factor_rgb = SG_BLENDFACTOR_DST_COLOR;
+		d.blend.dst_factor_alpha = d.blend.dst_factor_rgb = SG_BLENDFACTOR_ZERO;
+	}
+
 	postprocessPipe.init(postprocess, sp::PipeVertexFloat2);
 
 	{
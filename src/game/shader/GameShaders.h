@@ -34,6 +34,7 @@ struct GameShaders
 	sp::Pipeline mapChunkEnvmapPipe[2];
 	sp::Pipeline dynamicEnvmapPipe;
 	sp::Pipeline shadowGridPipe;
+	sp::Pipeline shadowGridMulPipe;
 	sp::Pipeline fakeShadowPipe;
 	sp::Pipeline debugMeshPipe;
 	sp::Pipeline debugSkinnedMeshPipe;
@@ -67,54 +67,54 @@ const SpShaderInfo spShaders[] = {
 const SpPermutationInfo spPermutations[] = {
 	{ { 1 }, {  }, { 1 }, 0, 1132 },
 	{ { 2 }, { 1,2 }, {  }, 1132, 3879 },
-	{ { 3 }, {  }, { 1,2,3,4 }, 5011, 769 },
-	{ { 3 }, {  }, { 1,2,3,4 }, 5780, 769 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 6549, 8285 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 14834, 8285 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 23119, 8539 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 31658, 8539 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 40197, 8285 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 48482, 8285 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 56767, 8539 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 65306, 8539 },
-	{ { 5 }, {  }, { 5 }, 73845, 347 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 74192, 6387 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 80579, 6642 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 87221, 6168 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 93389, 6423 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 99812, 6641 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 106453, 6896 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 113349, 6422 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 119771, 6677 },
-	{ { 7 }, {  }, { 1 }, 126448, 301 },
-	{ {  }, {  }, {  }, 126749, 60 },
-	{ { 7 }, {  }, { 1,2,3,4,6 }, 126809, 1346 },
-	{ { 7 }, {  }, { 1,2,3,4,6 }, 128155, 1346 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 129501, 8326 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 137827, 8326 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 146153, 8580 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 154733, 8580 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 163313, 8326 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 171639, 8326 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 179965, 8580 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 188545, 8580 },
-	{ { 8,9 }, {  }, { 1,7,8,9,10,11 }, 197125, 1556 },
-	{ { 8,9 }, {  }, { 1,7,8,9,10,11 }, 198681, 1556 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 200237, 8570 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 208807, 8570 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 217377, 8824 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 226201, 8824 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 235025, 8570 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 243595, 8570 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 252165, 8824 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 260989, 8824 },
+	{ { 3 }, {  }, { 1,2,3,4,5,6,7 }, 5011, 1044 },
+	{ { 3 }, {  }, { 1,2,3,4,5,6,7 }, 6055, 1044 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 7099, 8285 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 15384, 8285 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 23669, 8539 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 32208, 8539 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 40747, 8285 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 49032, 8285 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 57317, 8539 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 65856, 8539 },
+	{ { 5 }, {  }, { 8 }, 74395, 347 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 74742, 6387 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 81129, 6642 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 87771, 6168 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 93939, 6423 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 100362, 6641 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 107003, 6896 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 113899, 6422 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 120321, 6677 },
+	{ { 7 }, {  }, { 1 }, 126998, 301 },
+	{ {  }, {  }, {  }, 127299, 60 },
+	{ { 7 }, {  }, { 1,2,3,4,9 }, 127359, 1346 },
+	{ { 7 }, {  }, { 1,2,3,4,9 }, 128705, 1346 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 130051, 8326 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 138377, 8326 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 146703, 8580 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 155283, 8580 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 163863, 8326 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 172189, 8326 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 180515, 8580 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 189095, 8580 },
+	{ { 8,9 }, {  }, { 1,10,11,12,13,14 }, 197675, 1556 },
+	{ { 8,9 }, {  }, { 1,10,11,12,13,14 }, 199231, 1556 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 200787, 8570 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 209357, 8570 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 217927, 8824 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 226751, 8824 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 235575, 8570 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 244145, 8570 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 252715, 8824 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 261539, 8824 },
 };
 
 const SpUniformBlockInfo spUniformBlocks[] = {
 	{ }, // Null uniform block
 	{ "DebugEnvSphereVertex", 120 },
 	{ "DebugEnvSpherePixel", 32 },
-	{ "DynamicTransform", 128 },
+	{ "DynamicTransform", 64 },
 	{ "Pixel", 1088 },
 	{ "EnvmapVertex", 16 },
 	{ "EnvmapPixel", 8320 },
@@ -145,6 +145,9 @@ const SpAttribInfo spAttribs[] = {
 	{ "a_normal", 1 },
 	{ "a_tangent", 2 },
 	{ "a_uv", 3 },
+	{ "a_worldRow0", 4 },
+	{ "a_worldRow1", 5 },
+	{ "a_worldRow2", 6 },
 	{ "a_position", 0 },
 	{ "a_tint", 4 },
 	{ "a_uv", 1 },
@@ -155,151 +158,152 @@ const SpAttribInfo spAttribs[] = {
 };
 
 const char spShaderData[] = 
-	"\x28\xb5\x2f\xfd\xa0\xf5\x1d\x04\x00\x74\x80\x00\x4a\x8e\xec\x19\x2e\xb0\x4c\x88\xce\x01\x98\xd0\x68\x62\xb6\x90\xa9\xb8\xc8\x6c"
-	"\xb6\xe3\x68\xd9\xfe\xa7\xde\xb3\x0e\x21\x1f\xa6\x14\x8d\x22\x5d\x70\x30\xb0\xd1\x0d\x73\x2a\xf3\xff\xa0\xff\x00\xf0\x03\xaf\x90"
-	"\x01\x8b\x01\x9d\x01\x07\x74\xd2\x1f\x70\x3a\xa9\x02\x70\x36\x34\x77\x0e\x36\xcd\xa5\x19\x2e\xe7\x6d\xf0\x6e\x09\xce\x06\x09\xce"
-	"\x86\xd7\x7f\x59\x80\xf3\xfb\x32\x83\x48\xa7\xf4\x83\xd3\x09\x35\x97\x0f\x2f\xf9\x0a\x38\x1f\xaf\xff\x3c\x09\x26\x62\x18\xbe\xac"
-	"\x86\xe7\xd1\x38\x18\x12\x50\xe0\x6e\xeb\x65\xf6\xbb\x97\xac\xcb\xd9\xcc\xb3\xee\xc3\x72\x57\xb3\x96\xc4\xb3\x0b\xe2\x47\x67\xb3"
-	"\x8d\x00\x83\xdb\x79\x18\x86\xaf\x3b\xa4\x6a\xb3\xda\x97\xef\xaf\xc4\x5b\xc0\x30\x15\xa7\x33\x6d\x41\xe8\x4f\x19\x67\xcc\x30\x95"
-	"\x43\xe2\x6e\xb6\x69\xb6\xfb\x46\xd1\x19\x00\xcc\x04\x9d\xd0\x1f\x79\xa7\x99\xac\xfb\x35\x97\x8f\x4d\xf3\x80\xc8\x26\xff\x5f\x5f"
-	"\x1f\xce\xe7\x01\x67\x82\x94\xf1\x04\x73\xba\xe2\x3c\x04\xa7\x7c\x7c\x7d\xc2\xc1\x9f\x18\xc1\xd9\xec\x8c\x9b\xfa\x83\x8b\xd3\xda"
-	"\xa2\x54\xa2\x10\xba\x5d\x76\xc1\x59\x1f\x23\x6d\x8e\xe1\x88\x2a\xc6\x01\x18\xa6\x8a\x0e\x05\x20\xb2\x49\x53\x0f\xde\x2b\x2b\x70"
-	"\xad\x6c\x77\x97\xf1\x77\xc6\xde\x19\x46\xe2\xb1\xc9\xd8\x6a\xbf\xb0\xfe\x18\xa6\x9a\x60\xaa\xce\xc3\x97\x75\xb8\xdc\x8d\xe8\xb8"
-	"\x1b\x5a\x06\xcd\xcb\xdf\x19\x2f\x4c\xd5\xed\x88\x09\xbe\x0b\xdc\x0d\x6d\x06\xd1\xcb\x6e\x10\x10\x5b\xf7\x85\xa9\x6e\x05\x43\x22"
-	"\xeb\x7e\x78\x61\xaa\xcb\x2e\x70\x61\x4e\xa1\xfb\x64\xdd\x6f\x61\xaa\x0d\x67\x0b\xf4\xc3\x95\x71\x9a\xf2\x69\x5b\x6d\x61\x24\x0e"
-	"\xde\xcd\xdd\xc8\xe5\x6e\xc4\x06\xf9\x32\x83\x89\x27\xb9\x8e\x6b\x9c\xc6\x70\xf6\x1e\xe9\x04\x5d\xbb\xcb\xac\xc6\xe9\xfc\x6d\x4f"
-	"\x33\x4c\x95\x35\xde\xb8\xd3\x1b\x84\xbd\x64\xdd\xef\x19\x3f\xd2\x9a\x35\xde\xd6\xd2\x59\xb3\x3d\x1d\xda\x8c\x61\xaa\x6d\x75\x86"
-	"\x7d\xd3\x3c\x7c\x5d\x0d\x5b\x97\xdb\x18\xa6\xbb\xa7\x54\x7a\xd6\xb8\xe3\xee\x27\x40\x59\xef\x87\x01\x45\x13\x44\x11\x22\x09\x8a"
-	"\x28\x3a\xa9\xc3\x40\xa0\x18\x8d\x08\x61\xc1\x40\x98\x1a\x93\x4a\x06\x65\x48\x8d\x86\x84\x80\x40\x27\xa5\x26\x3a\x31\xe8\x07\xc9"
-	"\x84\xeb\x62\xac\x84\xf3\x89\xe0\xfc\x28\x8a\x4e\x7a\xc5\xe3\xe3\x34\xa3\x07\x6c\x28\x7a\x93\x14\x45\xe7\xed\xb2\xbb\x30\x55\x63"
-	"\x46\xd0\xc2\x44\x06\x95\x20\x89\x52\x3a\xe9\xab\x01\x07\x9b\x63\x78\x01\x17\x46\x82\x89\x8d\x64\xc2\x41\xf4\x03\x67\x6f\xc6\xd9"
-	"\x43\x31\x29\xef\xbc\x7e\x67\x5e\x77\xb9\xc8\x9f\x86\x66\xeb\xeb\xf5\x74\x46\x97\x97\x7f\x1c\xfe\xbc\xde\xba\x1b\x24\x93\x60\x3a"
-	"\xa9\xd7\x77\x97\x66\x80\x68\x5e\xc3\xee\xb2\xb6\x2a\xd3\x41\x56\xc2\xe9\x20\x43\xc7\xc1\x41\x82\xd3\xe1\xf5\x5f\xac\xbb\x75\xd4"
-	"\xa4\xcd\x9d\x37\xfc\x89\x28\x9a\x6d\xdd\x0c\xbb\xdc\xeb\x1d\xa4\xe2\xb4\xeb\x6e\x8e\x98\x78\x9a\xfb\x13\x89\x9d\xc5\x12\x47\x9e"
-	"\x62\xe1\xa4\xd8\xe5\xe9\xa4\x94\x54\xd4\xdf\xcc\x5a\xdd\xe2\xba\xa6\xeb\xce\xa5\xeb\xba\x73\x7a\xd9\x9d\x5d\x68\xb1\x98\xd1\xeb"
-	"\x17\x0d\xa9\x01\x51\x17\x74\x2d\xa6\xa4\x78\xbd\x74\x45\x11\x15\x5d\x8d\xc6\x02\xba\xa8\x89\x2e\xe8\xc3\xcb\x05\x15\x5e\x7e\x92"
-	"\xdc\xb9\x24\xf9\x03\x5e\x46\x92\x3b\x07\x2f\x0f\x49\xde\x64\xac\x35\x9b\x66\x33\xeb\xf5\x9d\xc5\x8d\x05\x9d\x94\xe2\xf5\x8b\x89"
-	"\x4e\x93\xf1\x7a\x8a\x62\xcc\x49\xf1\xfa\x49\xa2\x8d\xc6\xa4\xaf\x97\xa8\x06\x63\x42\xaf\x8f\x24\x0c\xc6\x02\x9a\x54\xf1\x7a\x48"
-	"\x52\x1f\x46\xb6\x76\xe4\xae\xd3\xd9\xe4\xa1\x58\x66\xb1\xa6\x73\x98\xe9\x87\x42\x82\xe3\xcb\x0c\x26\xe4\x33\xe7\xed\xcb\x2d\x0c"
-	"\x35\x55\x2a\xb3\x41\x56\xa4\x28\x0c\x67\x83\x0c\x9d\x4a\x08\xce\x48\x27\xfd\x13\xaf\x3f\xe1\xfc\xbc\x3f\x11\x7a\x01\xa7\x73\x11"
-	"\x95\xb9\xfd\x01\xe7\xb6\x71\x3a\xd3\x91\xb8\xb0\x10\x89\x2c\xfc\x89\x44\xee\x9c\x61\x61\x62\x91\x8f\x72\x59\x16\x86\x4a\xf1\xe8"
-	"\x1c\x9a\xb4\xb1\x5e\xbe\x7b\x2b\x38\x33\xb1\x2c\x4c\x45\x27\xe3\x80\x9a\xd4\x79\x58\x01\x67\x6c\xfe\x2c\xcb\xc2\x54\x8e\x5c\x00"
-	"\xde\x87\x00\x0e\x4e\xc9\xe2\x04\xa2\xcc\x5b\x60\xc1\xc2\x48\x3c\x1a\xc0\x54\xb2\x7e\x02\x08\x17\x0f\x18\xe2\x33\x01\x64\x77\xf8"
-	"\x71\x05\x85\x81\x1d\x31\xc1\x19\x53\x49\x20\x49\x51\x04\x41\x95\x04\xf4\xce\x6f\x67\x25\xf5\xd4\x6e\x7b\x7d\xba\x9d\x95\xfc\x21"
-	"\x1f\x13\x12\x2e\xef\x88\xd4\x3b\x22\x0f\xc5\xea\xff\x34\x0f\x28\x28\x40\x24\x38\x1c\x12\x28\xe0\xe0\x0a\xe4\x63\x83\x92\xa8\x45"
-	"\xd4\xa0\xa0\x09\x9a\x92\xa4\x33\x6a\x5e\xaf\xe9\x7c\x2f\xa7\xde\xb9\xe2\x0b\x0b\xaf\x77\x30\x30\xd4\x33\x80\x93\x89\xf3\xcb\x37"
-	"\x9b\x9b\xa0\xbb\x7c\x7d\x04\x9c\x4c\x22\x1b\xb1\x65\x76\x21\xf2\x87\x61\xeb\xab\xe1\x01\x05\x05\x08\x47\x04\x94\x13\x48\xb1\x2b"
-	"\x1e\x9b\x3b\xa7\x58\x34\xd5\x47\x0b\x5b\x5f\x91\x06\x16\xce\x22\x2c\x08\x44\x82\x04\xd3\x22\x02\xbb\xad\x63\x67\xac\xb7\xa9\x92"
-	"\x22\x28\x81\x41\xf3\x1a\x74\x56\xd3\xd7\x95\x64\xf6\x61\xa2\x13\x3a\xfc\xdd\x11\x55\x0e\xe9\xc2\x9c\x02\x45\x5f\x36\xa2\xbb\x43"
-	"\xca\x38\xe3\x8c\x9f\xae\xd3\x9c\x75\x79\xca\xac\xdf\x79\xd9\xb6\x85\xa9\x84\xe0\xdc\x79\xab\x26\xaa\x2b\xe3\xb4\x03\xfa\x21\xbb"
-	"\x97\xd6\xba\x6c\xb9\x07\x0b\x6b\x36\x87\xdf\x23\x2c\xf9\x3c\x08\xfb\x48\xda\xf9\x4e\xb2\xdd\x10\xf6\x53\x04\xd5\x2f\x0c\x53\x51"
-	"\xec\x89\xfc\x69\xf8\xf3\x58\x28\xf6\xb8\xe2\x91\xe6\x56\xf0\xeb\x1b\xbe\xd7\x3f\xe2\x04\x41\x93\xfe\x41\x60\x50\x93\xfe\x69\x34"
-	"\xa2\x49\xc1\x07\x6c\xa6\x2a\x82\x55\xfc\xee\x1c\xfc\x7b\x3d\x58\xe5\xbf\x85\xa9\x2e\xe7\x75\x7a\x03\xef\x66\xb5\x1b\x0d\x3a\xab"
-	"\x65\x1c\xed\x12\x29\xf6\xdb\x19\x4f\x13\xaf\x20\xea\x80\xce\x29\xa2\x9f\xc4\x25\xeb\x46\x34\x4e\x67\x88\x7e\xa0\x90\xc6\xe9\xdc"
-	"\x40\x03\xcb\x6e\xd9\xbb\x64\x5d\xe8\x79\x40\x20\x10\x08\x04\xa2\x80\xe4\x9b\xfd\xa0\xca\x48\x67\x74\x05\xcf\x37\x62\x4f\xf2\xcd"
-	"\x5e\x9f\x6f\x76\x79\x89\x4e\xba\xc8\x09\x84\x49\xe9\x84\x28\x88\x4e\x48\xf1\xa7\xa1\x8a\x07\x8f\xe1\x7c\x5c\x71\x84\x29\x35\xcd"
-	"\xe5\xab\xf3\xc7\xc3\x49\x00\x01\x8a\xca\x84\x26\xaf\x94\x83\xfa\x47\x7c\x40\xcf\xe7\x3d\x36\x9c\x59\xf2\xf5\xbb\xc3\x0b\x2a\xa2"
-	"\x4c\x68\x72\xe7\x94\x49\x27\xaf\x0f\xc1\x09\x4d\xea\x27\x16\x82\x9e\xc9\xa7\xcf\x93\xff\x1a\x78\x7e\x18\xee\x17\xf0\xad\xa8\x0a"
-	"\xaa\x73\x70\xe6\xca\xcc\x8a\xf8\xf8\x30\xbe\x93\xd8\x2b\x1e\x4e\xec\x0f\x38\xb1\x63\xaf\x6f\x32\xcb\x5d\x37\xc2\x6e\x8b\x81\x7b"
-	"\x69\xeb\x5e\x97\x22\x88\x8a\x38\xec\x08\x2d\x77\xe9\xf3\x20\xb6\x0e\x3b\xf4\x43\xc4\xde\xee\xb5\xe1\xcc\x82\x28\x77\x31\xcc\x93"
-	"\x4c\x20\x98\x91\xe2\xf2\xe1\x1f\x09\xce\x4e\x6f\x8d\xde\x3a\xbd\x3d\x92\x22\x88\xcb\x6e\x10\x54\x0f\x6c\x38\xc3\x28\xe1\xfe\x03"
-	"\x75\x7f\x68\xd7\x80\x58\x83\xa0\xec\x4f\x05\x9c\x1b\xcd\xae\x78\x48\xb3\x26\x43\x19\x42\x98\x35\x9c\xd6\x19\x46\x33\xc6\xf6\xfa"
-	"\x30\x6b\x20\xa1\xe5\x38\x04\x1c\x11\x25\x7c\xfc\xa9\x9e\x68\x7a\x75\xae\x7c\x6f\x40\x45\x5f\xdf\x9c\xd3\x58\x18\x2b\xf2\x0e\x53"
-	"\xc9\xfa\x48\x52\xea\x9f\x27\x4a\x0d\x88\x35\x70\x2e\x97\x87\xc0\x59\x1a\x74\x76\x81\x6d\xb5\x4a\x83\xc0\xb6\xda\xd3\x6c\x7d\xd5"
-	"\x43\xa0\x78\x08\xce\xf8\x34\x4d\xc3\xb6\xda\xa3\xe9\xf2\x31\xdf\xb8\xa5\x27\xbd\xc6\x0a\x67\xbd\x17\x5d\x3e\x52\x13\x38\x9b\xfd"
-	"\x79\x7f\x38\xbd\x2d\x8b\x55\x94\x8a\x7c\x0c\x83\xda\xa8\x92\xc3\x94\x39\xa6\x66\x44\x04\x00\x00\x00\x08\x00\xc2\x08\x00\x06\xa4"
-	"\x59\x16\x66\x69\x94\x35\xed\x12\x40\xe0\x70\x38\x8a\x92\x1c\xc7\x29\x83\x88\x01\x04\x00\x10\x01\x08\x00\x02\x80\x00\x00\x40\x00"
-	"\x00\x00\x08\x04\x52\x20\xf2\x3c\xed\x34\x46\x00\x86\x10\x62\x16\x42\x1a\x16\x5a\xe9\x55\x1f\xb2\x6f\x5c\x23\xdc\x2a\x4a\xd7\x3f"
-	"\xa7\x7a\x6f\x37\x2f\x68\xcf\x56\x51\xa5\xdd\x99\xe4\x92\xa5\x81\x71\xb3\x93\x7f\xa0\xf4\x8d\xad\x09\xad\x4d\x07\x98\xfc\x8c\xb3"
-	"\x11\xd6\x56\xe8\xab\x1a\x2a\x4f\x2a\xe6\x95\x55\x07\x4c\x55\x75\x60\x70\xd0\x48\x6d\xa5\x6a\xc4\x3a\x94\xd5\xfb\x81\xff\xb4\xef"
-	"\x85\x73\x70\xfb\x01\xc0\x9d\xd6\xdd\x14\x60\xcb\xfb\xf0\xd0\x7c\x58\xc7\x6e\x46\xc5\x12\xd1\x23\x89\x8c\xdd\x96\x72\x4e\x61\xc3"
-	"\x36\x6f\xef\x60\x4e\x8c\xd9\x9a\xee\xf2\xaf\x6e\xe9\x16\xb3\x69\x2b\xf3\x8b\x67\x04\x46\x68\x1f\xa6\xa4\x9a\x08\xee\x2b\xed\xac"
-	"\xf5\x4e\xd1\x9a\x95\x4b\xb9\xf0\x7e\x4d\x47\xe8\xb9\x15\x80\xce\xab\xe3\x98\x07\x74\x6b\xb3\xbc\x04\x5a\x69\x35\x11\x71\x6e\x2d"
-	"\x75\x23\xa7\x95\x56\x0f\x26\xcc\x4d\xce\x48\xfc\x1a\x7d\x7a\x5b\x3d\x51\x51\xee\xe8\xc8\xbe\x63\x10\xdd\x2a\x28\x2f\xb5\xf1\x67"
-	"\x08\xd9\x37\x1b\x82\x9c\x58\x26\xca\x5a\xaa\x7a\xb8\x63\xec\xea\x42\xb1\x41\x4a\x0f\x8d\x8b\x00\xac\xb6\x42\xb2\xbd\xc2\x0a\x49"
-	"\xd9\xe1\xa1\xd5\x27\x37\x0e\xa1\x5e\x49\x65\x07\x41\x73\x4f\x55\x6a\xf5\x71\x44\x73\x7a\xc6\x0a\xbe\xf5\xaf\x7a\xde\xfe\x74\x71"
-	"\x05\x57\xf7\x6c\x7b\x8f\xd1\x38\x67\x65\x28\x98\x3d\xa2\xb3\xa9\xf2\xf5\xcd\x93\x2a\x49\xe7\xea\x58\x18\x04\xe2\xfe\x3e\x9c\x19"
-	"\x73\xa0\x6d\x9b\x5a\x9d\x95\x0d\x4b\xac\x1b\x6a\x7f\xe4\x0f\x45\xa8\x9d\xaa\x5a\x96\x0f\xbf\x0c\xf8\x09\x02\x31\xe1\x39\xa5\x28"
-	"\xf6\x39\xff\x1a\x17\x90\xbc\xec\x27\xf7\x1f\x8a\x5a\x67\xa2\x78\x7c\xc9\x41\x1c\x09\x42\xf7\xeb\x4e\xfe\x06\x48\x3c\x00\x2d\x47"
-	"\x19\xc4\x7d\x7c\xec\x95\xe1\xd2\x46\x8a\xdb\x98\x4f\xad\x2a\x4f\x1c\x6c\x5e\xdc\xb6\xef\x6f\x13\xb4\x79\xe7\xe1\x8c\x10\x4b\x5a"
-	"\xe7\x7a\x96\x07\xeb\xe5\xc1\x51\x32\xd2\xb5\x2e\x61\x16\x84\xeb\xbf\xe0\x03\xa3\x81\xb0\x07\xf5\x61\x1b\xcc\x73\x8f\x93\xee\xcf"
-	"\x8b\x59\x46\x1b\x42\xfb\xe1\x4c\xcf\x04\x8d\x0c\x34\xf3\xa0\x8e\xf5\xd1\xbe\xca\x16\x49\x24\x2b\x56\x57\xf0\xd5\xf1\x0d\xb0\x7a"
-	"\x54\xb0\xe2\x27\x88\x0f\xe9\x9f\xf5\x08\x1e\xc3\x38\xac\xaa\x83\x86\x8e\x1a\x0d\x0b\x52\x91\xc0\x26\xa6\x36\x98\x80\x49\x0b\x80"
-	"\x7f\x00\xd8\xce\x24\x9a\x0f\xee\xb8\xcb\x3b\xc4\xe5\x23\x5e\x5e\x19\x5e\xab\xc0\x9a\xca\x92\x11\x33\x4a\xe0\x51\x33\x35\x7f\xb8"
-	"\x94\xa4\x12\x3b\x32\x16\x5e\x90\x70\xe9\xf2\x4d\x69\x93\xa2\x8b\x56\x15\x4e\x3c\xc7\xa8\x2d\xa6\x58\xbf\xbb\x44\xc6\x4a\x40\x1e"
-	"\xf8\xa8\x9b\xf0\x58\x0b\x49\x66\xb5\x13\x20\x0e\x9e\x84\x36\xc2\xde\xc3\x9c\x91\xc7\x21\xc3\x64\x47\x01\x97\x0e\x16\x23\x89\x30"
-	"\x91\x16\x08\x42\xaf\xb6\x29\xfd\x3d\x0e\x4d\x13\x05\x0a\x42\x7c\xe0\xa3\xa2\x8f\x46\x6f\x10\x80\x46\x84\x34\x7f\x55\x56\x88\x8a"
-	"\xc9\x00\xda\xf1\x82\x26\x90\x1b\xbc\x0f\x88\x30\x62\x41\x8f\xbf\x02\xad\xe4\xa1\x1a\xd2\xd7\xdd\xfa\xae\x07\x45\x70\xe4\x77\x84"
-	"\xdc\xb5\x6d\x1c\x39\x37\x4f\xff\x0c\xb1\x87\xff\x58\xfb\x70\x41\x35\x1b\xae\xdc\xe6\x25\x12\xd1\xcf\xb1\x2f\x12\xe1\x86\xe8\x14"
-	"\x5a\xfc\x40\x0b\x21\xd5\x41\x55\x98\x49\xa8\x9e\x14\x78\xcd\xb8\x2f\x16\xfa\x0a\xe4\xd3\x12\x11\x64\x92\xa0\xef\xf1\x40\xa8\x57"
-	"\x07\xc5\x8d\x0c\x5e\x87\x34\x73\x6e\x10\x36\x17\x16\xb0\x18\xf7\x59\x7a\x7b\x85\x4a\xcb\xc6\xec\x06\x6b\x15\x0c\xe0\xd7\xb6\x2f"
-	"\x06\x69\x08\x3b\xd0\x3a\xc7\x7f\x04\xe2\x06\x4e\x89\x50\xe4\xce\xce\x05\x9a\xa3\x6e\xc8\xbd\x69\x6b\x20\x9a\x64\x9b\x14\xc3\x5b"
-	"\x87\x84\xa3\xb9\x74\x6d\xe6\x41\x39\x9d\xb7\x10\x96\xef\xcc\x04\x98\xa9\xbd\x2e\xb2\x41\x02\xbe\xa7\xfc\x85\x1e\x06\xc3\x5f\x88"
-	"\x28\xe7\x20\xff\xda\xf2\xf2\x9e\xd4\x43\x50\x9d\x54\x80\x10\x48\xe5\x6e\xd9\xb1\xfe\xc0\xaf\x57\xad\xd1\x0a\x68\x30\x50\x2d\xa8"
-	"\x62\xe6\xb9\x5d\x8d\xcc\xcb\x6d\x26\x6d\x50\x34\x0c\xae\x10\xc5\x25\xc9\x6b\x44\xf1\x86\x9c\x02\x1e\x3f\x1a\x6e\x85\x63\xe5\xdc"
-	"\x0f\x1f\xd0\xb2\x55\xb4\x5b\x78\x37\xef\xd0\x94\xb4\x94\xf2\xcb\x82\x66\x21\xc7\x48\x83\xb3\xd1\x0d\x24\x8f\x38\x26\x8a\x54\x75"
-	"\x0e\x3c\xc5\x81\x41\x9f\x22\xb5\xb4\x9a\x1f\xdf\xc2\x52\x09\xc3\xe2\x25\x9a\xd2\x58\x91\xb7\x9c\xc5\x2f\xe5\xd5\x92\x29\xf2\xde"
-	"\x6e\xa4\x4f\x3b\x05\x64\x70\x5a\xd2\x83\x0f\xe4\xc6\x29\x65\xbd\x13\xf4\x97\x27\xc2\xc9\x96\x79\x27\xc4\x29\xaa\x56\xd4\x97\x3f"
-	"\x16\x58\x52\xec\x55\x06\x25\x41\x5c\xca\x1f\xa1\xbc\xd8\x63\x78\x56\x65\xab\x20\xad\xac\xcb\xb4\x4b\x7a\x48\x36\xe1\x00\xce\x30"
-	"\x93\x01\xc9\x60\xf1\x5c\xad\xcf\xaf\x6c\xd8\x8a\x40\x0b\x9a\x63\x9b\x5e\x4e\x96\xaa\x9b\x4f\x5d\xaa\x4c\x5b\x22\xf7\x48\xae\xf1"
-	"\xf1\x3a\xb9\x91\x15\x43\x87\xea\x60\x2f\xd9\x89\x1a\x33\xe8\x83\x81\x33\x64\xf3\xcf\xc3\x24\x64\xb8\x2a\xb1\x23\xfc\x75\x8f\x44"
-	"\xf5\xd5\x90\x17\x22\x1f\x8c\xb7\xfd\xad\x7a\x55\xf8\x40\x59\x55\x82\x50\xa6\xa8\xf1\x0b\xa8\x71\x00\x44\x2d\x1e\x7d\x7c\x5a\xde"
-	"\x4f\xf2\x37\x23\xa7\x8d\x24\x36\x8d\x4b\x6c\x56\xc8\x17\x0b\x13\x6b\xf4\x15\x1c\xad\xbe\x19\x3c\x1c\xf9\xe8\x21\x4b\x2d\x8b\x80"
-	"\x4b\x4f\x0c\xe5\xbc\x3e\xfb\x7c\x8f\x09\xc3\xe8\x9b\x7e\x09\x35\x1e\x3c\x06\xf2\xed\x79\xca\xbd\x4b\x18\x38\x13\xfc\x6f\xaa\x2f"
-	"\x27\x36\x56\x21\xf0\x18\x95\x47\x41\x17\xaf\x73\xb0\x3b\x98\x84\x1c\x22\x2b\x27\xc9\x98\x44\x29\x46\x45\x49\x00\x9d\xeb\xae\x1c"
-	"\x07\x93\xc0\x8c\xa1\xfd\x9d\x4e\x29\x44\x0f\x5a\x18\x77\x06\xeb\xcb\xd6\x4c\xd4\xf3\x30\x87\x26\xa5\xa4\x95\xeb\x16\x67\xf0\x89"
-	"\x24\x0b\x78\xeb\xd5\x92\x91\x37\xee\x50\xbf\x9a\x82\xc0\x1f\x7f\xfa\xd0\x31\x61\x10\x18\x4a\x44\x89\xf6\x63\xd8\x73\x1c\x21\x18"
-	"\x05\x95\x18\x43\xd5\x2f\xca\x0c\x7c\x61\xab\x8c\x4d\xae\x20\x06\x3c\xcf\x2b\xbd\x37\x6d\xa2\x4b\x25\x3a\xbe\x29\xc0\xd2\xca\xfb"
-	"\x51\xd1\x84\xb5\x04\xcf\x55\xc2\xf7\x29\x46\x18\xa4\x45\x9b\xc4\xf4\x9a\xa2\x02\x73\x7f\x0d\x67\xc6\x3f\xa0\x73\x23\xbc\xb2\xd2"
-	"\xca\x65\xfd\x05\x56\xf6\x13\xb7\x9c\x29\x52\xce\x94\x5b\x2c\x6a\x7f\x27\x1f\x18\xdd\x63\x7f\x46\xa7\xda\xee\x16\xc1\xa5\x5e\x48"
-	"\x92\xd1\x61\xc9\xf6\xa7\x49\x32\xed\x94\x87\x1f\xbd\x5a\x4c\x4c\xe0\xd9\xf8\xfa\x41\xcd\x0f\xae\x2d\x31\x0e\x46\xeb\x85\x51\x9d"
-	"\xae\x1a\x27\xca\x4d\xde\x1f\xae\x02\x1d\xd7\x45\x5a\x79\x8b\x9e\x17\x09\x75\x06\x60\xf3\xf2\x0b\xbc\xa0\xe9\xab\x28\x21\x17\x83"
-	"\xb5\x57\x39\x7c\x5e\x7b\xe4\x1a\x04\x70\x09\x94\x85\xd1\xf4\x90\xb2\x9d\x63\x7c\x18\x51\x5d\xb3\xea\xf2\xc7\xc0\xdb\xbe\xa1\x52"
-	"\xb3\x05\x4c\x72\x0f\x61\x11\x04\x2e\x4e\x7b\x54\x30\x12\xc3\x00\x9c\x03\x21\x82\xbc\x19\xa8\x2c\x24\xb8\x25\xbf\x97\xea\x68\x70"
-	"\xc5\x49\x29\x90\x3b\xe5\x03\x8b\x4d\x92\x30\x98\x12\x88\xfb\x1d\xa7\x50\x21\xe9\xb7\xa2\x63\xa7\x37\x55\x0f\x95\x8f\x3d\xb3\x52"
-	"\xd7\x31\x14\x20\xb3\x52\xde\x99\xa5\x57\xd4\x33\x76\xf6\xdf\x67\x80\xff\x94\x02\xa9\x9b\xa6\xa6\xde\xa2\x5f\x0b\x6b\xec\x6b\x93"
-	"\x90\x31\x8a\x60\xce\x68\x8f\x50\x8c\xe8\x11\xf1\xb4\x7c\x10\xa5\xa8\xdc\x40\xb0\x72\xbf\x58\xf1\xa1\x85\xc4\xb1\x86\xf8\xf7\x43"
-	"\x10\x32\x4b\xe9\xdb\x4a\x82\xd5\x43\x60\x2e\xe6\xe3\x3e\xbd\xc7\xb5\xa8\x2e\xeb\x0d\x30\xb7\x6a\xd6\xf2\xc1\x2f\x72\xf7\x64\x74"
-	"\x36\x87\x50\xbd\x46\x57\x00\x3a\xb8\x85\x0f\xcb\x38\x2c\x7b\xc8\xc3\xcd\xf3\x93\x0c\x66\x19\x30\x48\x26\x60\xa1\xd3\xad\x3a\xdc"
-	"\x37\x8b\x08\x84\x11\xc5\x6a\x40\x00\xb9\x44\x45\x03\x2d\x51\xed\x0d\x01\x43\x08\x14\xed\x7e\xe1\x4b\x6b\x92\x3a\x4f\x3b\x4c\x69"
-	"\x15\x43\x04\x48\x57\x56\x8c\xa4\x4d\x42\x48\xb2\xcd\x81\x70\x43\xc5\xd1\x72\x6e\x5e\x2a\xaf\x68\x98\xf4\xb6\x1b\x84\x26\x07\x30"
-	"\x36\x20\x1d\x12\x10\x21\x7d\x63\x55\xe0\xf2\x23\xf1\x72\xd7\xab\x60\xfc\x0d\x44\xa4\xd3\x39\x75\xf5\xec\xab\xa1\x8b\xa6\xc1\x34"
-	"\xce\x5f\x05\xc1\x77\x93\xbb\x23\x9e\x2e\xf8\x89\x77\x07\x1b\x55\xa2\xf6\x43\xf0\xec\x14\xc9\xf3\xac\x00\xe4\xf4\xba\x89\x7f\x08"
-	"\x2a\xda\x71\x26\x12\x0a\x24\xe2\x97\xa2\xc3\xec\x48\x84\xf4\x20\x91\x6a\x71\xe5\xdc\x85\x66\x40\x03\x41\x79\xf4\x0a\x5c\x89\x25"
-	"\x43\x1a\x87\x05\xbd\x3e\x31\x15\x03\xf2\x9f\x1f\x8f\x3b\x36\xc3\xe8\x7f\xaa\xcb\xac\x32\x9a\xca\xc1\x04\x30\x6a\x60\xbe\x74\xa8"
-	"\x83\x18\x94\xe6\x32\x55\x3f\x8a\x1f\x6d\xeb\x1e\xf2\x58\x2c\xd9\x84\x6a\xc9\x56\x5f\xb1\x92\xdf\x2c\xa3\x13\x90\xff\xb7\x48\xf9"
-	"\x07\xc7\x47\x2a\xe5\x4f\xfa\x7c\x2a\x2e\xaf\x87\xfd\x0a\x91\xdc\x4c\xc3\xfa\xbe\xaf\xbb\xef\xfa\x63\xb3\x99\xc7\xe9\xe2\x81\xe3"
-	"\xe3\x4f\x9d\x09\x6a\xaf\xa1\xb5\x4b\x8a\xa4\x8e\x19\x16\x2a\xf6\xf8\x6a\x8f\x33\x95\xb8\xcb\x0f\x03\x65\xa9\xea\xc7\x57\x41\xf5"
-	"\xd7\x82\xa7\x52\x69\xa0\xcb\xa3\x0e\x5b\xdb\xf5\x05\x46\x7c\x4f\x96\x5e\x56\x58\xdb\xa7\x48\xf1\x35\xb6\x2c\xf6\x80\x9e\x07\x40"
-	"\x10\x6a\x9f\x28\x3c\x8b\x60\x7a\x42\xbc\x1f\x95\x16\x4d\xb3\x43\xef\x2a\x9a\x9f\xde\x66\x50\x7e\x30\xc5\x64\xad\xd9\x8b\x23\xd2"
-	"\xc3\x10\xa6\x9a\xe6\x92\x46\x49\xe1\xb1\xd2\x4b\x28\xb4\x83\x5a\xa1\xf6\xbb\x81\x86\x07\x70\x58\x48\x01\xe0\x8f\xc0\xaf\x42\x0d"
-	"\x92\xc5\x96\x33\x45\x6d\x88\x9d\x93\x3f\xb0\x34\x34\x9d\x53\x23\x34\xc6\x29\xeb\xd0\x98\x87\x34\x1f\x47\x06\x37\x03\xbc\x13\x60"
-	"\x25\x4c\x2e\x85\x12\x86\x3d\x8c\xb7\x6b\xa2\x36\xa1\x1c\xc0\x1f\x54\x57\x9b\x4a\x6d\x0c\x73\x8a\x0d\x1e\x0a\xdf\xaa\xf3\x44\x59"
-	"\x8a\x7e\x18\x64\x58\xa0\xea\x35\x03\xc7\x34\x1d\x2f\xc2\x98\x81\xf9\x64\xc5\x13\xc0\x95\x35\xe1\x20\x7b\x1b\x13\x03\xce\x0f\x03"
-	"\xbe\x65\xc9\xf9\x4b\x79\xdb\x96\x22\x9d\x86\xa7\x22\xb4\x61\x79\x34\x0e\xaf\x0e\x52\x0b\xa0\x42\xe5\x49\xd8\x24\xf1\xff\xa4\x66"
-	"\x9e\xe6\x43\xab\x60\x31\xd2\x12\x92\xc9\x22\xc0\x50\xeb\xf6\x1f\x20\x6e\x13\x01\x3b\x12\xa4\x86\x36\x25\x9c\xbf\xa5\x73\xc1\x0a"
-	"\x7c\x20\x64\x47\x26\x87\x43\x16\xb7\x3e\x37\xe9\x86\xd8\xc1\x6c\x88\x37\x58\x48\x8d\x2f\x32\x44\x04\xa3\x57\xce\xaa\xbf\x01\x52"
-	"\x0c\x1e\x15\x5f\x91\x40\x84\xb7\x30\xd0\xbd\x2c\x17\xc7\x52\xf1\xdd\xe3\x7f\xdc\xa0\x4f\xba\xf8\xf5\x7a\x16\xa9\xfd\x51\xce\x00"
-	"\x39\x41\x70\x34\x63\x6d\x10\xc6\x52\x41\x63\x95\x21\x22\xd3\xb7\x24\xec\xf1\x15\xd6\x56\x28\x0a\xde\xa6\x30\xd2\x98\x35\x14\x3b"
-	"\x5a\x8b\x29\x40\x15\x3d\xdd\xbb\x1f\x3c\x26\xb6\xb9\xa8\x2b\x8f\x3b\x4d\xe4\x55\xb4\xdf\xfd\xb0\x41\x90\x3e\xb0\xa0\xd4\x94\x85"
-	"\x31\x2f\x8d\xb9\xa1\x4c\xc1\x37\x07\x14\xaa\xd8\xff\xb3\x6a\x29\x8c\xa2\xdc\x57\x9b\xe7\x40\x58\xf3\xe0\x73\x1d\x66\xe1\xbc\xdc"
-	"\x15\x5d\x9d\xc7\x31\xae\x04\x73\x64\x96\x1f\x2c\xd7\x49\x8d\x8d\x57\x82\xe4\x36\xb5\x74\x65\x52\xe0\x03\x54\x11\x00\x93\x09\x1c"
-	"\x94\x90\x12\x46\x5c\x3e\x94\x8f\x88\x88\x90\x58\x50\x97\x5d\x20\x9a\x22\x26\x38\x42\x82\x32\x6e\x00\x89\x26\x79\xef\x49\xde\x91"
-	"\xc6\xe5\xac\x71\x39\x46\xd0\x13\x3b\xbd\xfd\xa1\x14\xcd\x35\x5b\x5f\xcb\xc2\x6c\x14\x0a\xa5\x52\xa1\x51\x04\x41\x61\xe8\x44\x11"
-	"\x04\x81\x53\x1e\x9c\x20\xae\xa7\x14\xcd\xd5\x7f\x92\x2e\x1f\x9b\x09\xc4\x78\x69\x40\x11\x74\x37\x6b\xc9\xa7\xee\x66\x9d\x40\xc6"
-	"\x0d\x20\x14\xaa\xbb\x16\xbe\x32\x9e\xa4\x88\x12\x52\xc2\x0a\x0e\x80\xa3\xa0\x41\xca\xda\x80\xa2\x05\x51\x05\x87\x29\x62\x88\x22"
-	"\x94\x68\x76\x32\xcc\xf9\x41\x76\xa8\x0b\x6d\x26\x79\x8a\xbf\x27\x76\x2f\xcb\xe3\xe7\xb4\xd7\x25\x0d\x44\x1d\x99\x84\x43\x1d\x67"
-	"\x20\xa7\x3e\x0a\x97\xe2\x7e\x54\xe6\xb7\x2f\x7c\x6f\x18\x20\xc9\x51\xd5\x5c\x77\x64\x5b\xc1\x7c\xdf\xa1\xdf\x1b\xf9\x8b\x46\xf9"
-	"\x9c\x4e\x12\xc5\x13\x71\x44\xc8\x6b\x1d\xf2\x8c\x62\xce\xff\x17\x55\x31\xd2\x1d\x98\x7d\x2b\xb8\x95\xb1\x79\x09\x9a\x97\x17\x2d"
-	"\xdc\x39\xc8\x2a\x8e\xe0\x2e\x88\xd3\x07\xc7\x16\x69\x59\xf4\x8f\x86\xed\x33\x9b\xb6\x08\x36\xfd\x9c\x77\x07\x85\x26\x18\xae\x52"
-	"\xdf\xa3\x3a\x2a\x3a\x85\x6c\x96\x82\xee\x42\xf1\x63\x41\x8c\x97\x5e\x6e\x6c\xed\x58\x5d\xf6\xd3\x4a\x1a\xb9\x53\x77\xd2\xe6\xc0"
-	"\xc6\x79\x0d\x8b\x6e\xec\xd8\xff\xfd\x48\xdf\x9a\x21\xac\x83\xe1\x56\x8c\xf7\x80\x9d\xa4\x3a\xb8\xf8\xfc\xd6\xc7\xf7\x53\x83\xff"
-	"\xc5\xe4\x68\xd8\x1e\x8e\x23\xa8\xdc\xf5\x15\x38\x0d\x64\x52\xf7\x7b\x80\xbc\xeb\x16\x60\xf4\x35\xe4\x8f\x4d\x3e\x7f\xb2\xe6\x49"
-	"\xb0\x7b\x42\x27\xb7\xbc\x8b\x91\x44\x0e\xbe\x68\x1a\xcc\xdd\x49\x27\x04\xfd\xaa\x70\x66\x69\x1a\x20\x65\x71\xec\x58\xf2\xc9\xde"
-	"\xb6\x7f\x65\x0b\xe2\x03\xd4\xbc\xd4\xed\xbc\x8d\x91\x5a\x46\xe5\x68\xde\xb0\xc8\x06\x5f\x43\x89\x0d\x23\x59\x04\x02\xbd\x65\x03"
-	"\xcd\x97\x03\x4e\x28\xf7\xc8\x2b\xc9\xe9\x9e\x3a\x36\x0c\x59\xa4\x61\xc0\xda\x1a\xf6\xa2\x04\x12\xc3\x81\xa1\x4b\xce\x0b\x42\xdf"
-	"\x27\x10\x44\x8e\xe1\x45\xf7\x61\x20\x7d\xee\x0d\x42\x54\x3a\x96\x7b\x67\x3d\x0a\x2c\x20\x75\x44\x7c\x87\x94\x41\x05\x84\xee\xd2"
-	"\x3b\xa4\xb8\x3a\x15\x39\x4e\x04\xef\x29\x09\xba\x9c\x12\xfa\xee\xe5\xda\x45\x57\x8f\x2a\xa6\x89\xa4\x70\x04\xcb\xce\x2b\x85\xcf"
-	"\x48\x43\x35\x37\xdf\x6a\x4b\x1a\xef\xb9\xdd\xbc\x28\xe3\x82\x89\xe8\x76\x79\xa5\xbc\x34\xa4\x54\x67\x58\xd8\x40\xea\x29\x41\x90"
-	"\xcd\xe7\x04\x6c\xbd\x26\x06\x45\x00\x00\x08\x69\x01\x00\xf1\xdd\x03\x21"
+	"\x28\xb5\x2f\xfd\xa0\x1b\x20\x04\x00\x34\x83\x00\x8a\x8f\x2c\x1a\x2e\xb0\x4c\xa6\xce\x31\xc8\x0d\xf8\x9a\x5e\x20\x53\xf9\x2c\x80"
+	"\x8d\x5d\x6c\x32\xaf\x6b\x8e\x3a\x01\xc1\x2a\x72\x47\x83\x78\xef\x00\x5d\x50\x03\xdb\x84\x4f\xf8\xa7\xf4\xa7\xb8\xff\xe1\x1e\x95"
+	"\x01\x8e\x01\xa0\x01\x05\x9c\xce\x04\x02\x9d\xf4\x07\x9c\x4e\xba\x00\x9c\x8e\xe6\xce\xc1\xa6\xb9\x74\xe3\x72\xde\x06\xef\x96\xe0"
+	"\x74\x48\x70\x3a\x5e\xff\x25\x01\xce\xef\xcb\x0b\x44\x3a\xa5\x23\x9c\x4e\xa8\xb9\x7c\x78\xc9\x57\xc0\xf9\x78\xfd\xe7\x39\x60\x22"
+	"\x86\xe1\xcb\x72\x3c\x8f\x86\xd1\x48\x80\x81\xbb\xad\x97\xd9\xef\x5e\xb2\x2e\x67\x33\xcf\xba\x0f\xcb\x5d\xcd\x5a\x0e\x9e\x5d\x10"
+	"\x3f\x3a\x9b\x6d\x04\x16\xb8\x9d\x87\x61\xf8\x3a\x43\xaa\x36\xab\x7d\xf9\xfe\x4a\x3c\x05\x18\xa6\xe2\x74\xa6\x2d\x07\xfd\x29\xe3"
+	"\x8c\x19\xa6\x62\x48\xdc\xcd\x36\xcd\x76\xdf\x28\x3a\x03\x80\x79\x40\x27\xf4\x47\xde\x69\x26\xeb\x7e\xcd\xe5\x63\xd3\x3c\x1c\xb2"
+	"\xc9\xff\xd7\xd7\x87\xf3\x79\xc0\xa9\x20\x65\x3c\xc1\x9c\xae\x38\x0f\xc1\x29\x1f\x5f\xaf\x80\xf0\x27\x46\x70\x36\x3b\xe3\xa6\x1e"
+	"\xe1\xe2\xb4\xb6\x28\x95\x28\x84\x6e\x97\x5d\x70\xd6\xc7\x48\x9b\x63\xf8\xa1\x8a\x71\x00\x86\xa9\x22\x83\x01\x87\x6c\xd2\xd4\x83"
+	"\xf7\xca\x0c\x5c\x2b\xdb\xdd\x65\xfc\x9d\xb1\x77\x86\x71\xf0\xd8\x64\x6c\xb5\x5f\x58\x7f\x0c\x53\x3d\x60\xaa\xce\xc3\x97\x65\xb8"
+	"\xdc\x7d\xe8\xb8\x1b\xda\x86\xe6\xe5\xef\x8c\x17\xa6\xea\xf6\xc3\x04\xdf\x05\xee\x86\x36\x83\xe8\x65\x37\x07\x87\xad\xfb\xc2\x54"
+	"\xb7\x82\x21\x91\x75\x3f\xbc\x30\xd5\x65\x1b\xb8\x30\xc7\xa0\xfb\x64\xdd\x6f\x61\xaa\x0d\x67\x0a\xe8\x86\x2b\xe3\x34\xe5\xd3\xb6"
+	"\xda\xc2\x38\x38\x78\x37\x77\x23\x97\xbb\x0f\x1b\xe4\xcb\x0b\x4c\x3c\xc9\x65\x5c\xe3\x34\x86\xb3\xf7\x48\x27\xe8\xda\x5d\x66\x35"
+	"\x4e\xe7\x6f\x7b\x9a\x61\xaa\xac\xf1\xc6\x9d\xde\x1c\xec\x25\xeb\x7e\xcf\xf8\x91\xd6\xac\xf1\xb6\x96\xce\x9a\xed\xe9\xd0\x66\x0c"
+	"\x53\x6d\xab\x33\xec\x9b\xe6\xe1\xeb\x6a\xd8\xba\xdc\xc6\x30\xdd\x3d\xa5\xd2\xb3\xc6\x1d\x77\x3f\x01\x02\x5e\xa7\x37\xf0\x6e\x56"
+	"\xbb\x59\xef\x47\x01\x45\x13\x44\x13\x22\x09\x8a\x28\x3a\xa9\xa3\x48\xa0\x14\x8b\x28\x21\xa1\x48\x98\x16\x93\x4a\x05\x55\x48\x8b"
+	"\x85\x94\x90\x40\x27\xa5\x26\x3a\x35\x74\x83\x64\xc2\x75\x31\x56\xc2\xf9\x44\x70\x52\x14\x9d\xf4\x88\xc7\xc7\x69\x46\x0f\xd8\x50"
+	"\xf4\x26\x29\x8a\xce\xdb\x65\x77\x61\xaa\xc5\x8c\xa0\x85\x89\x0a\x2a\x41\x12\xa5\x74\xd2\x57\x03\x0e\x36\xc7\xf0\x02\x2e\x8c\x03"
+	"\x26\x36\x92\x09\x07\xd1\x0d\x9c\xbd\x19\x67\x0f\xc5\xa4\xbc\xf3\xfa\x9d\x79\xdd\xe5\x22\x7f\x1c\xcd\xd6\xd7\xeb\xe9\x8c\x2e\x2f"
+	"\xff\x30\xfc\x79\xbd\x75\x37\x48\x26\xc1\x74\x52\xaf\xef\x2e\xdd\x80\x68\x9e\x63\x77\x59\x5b\x95\xc9\x20\x2b\xe1\x64\x90\xa1\xc3"
+	"\xc0\x20\xc1\xc9\xf0\xfa\x2f\xd6\xdd\x3a\x6a\xd2\xe6\xce\x1d\x7f\x22\x88\x66\x5b\x37\xc3\x2e\xf7\x7a\x86\x4e\x23\x4e\xbb\xee\xe6"
+	"\x87\x89\xa7\xb9\x3f\x91\xd8\x59\x2c\x71\xe4\x29\x16\x4e\x8a\x5d\x9e\x4e\x4a\x49\x44\xfd\xcd\xac\xd5\x25\xae\x6b\xba\xee\x5c\xba"
+	"\xae\x3b\xa7\x97\xdd\xd9\x85\x12\x89\x19\xbd\x3e\xb1\x90\x16\x10\x75\x41\x57\x62\x4a\x88\xd7\x4b\x57\x14\x51\xd1\xb5\x58\x24\xa0"
+	"\x8b\x9a\x68\x82\x3e\xbc\x4c\x50\xe1\xe5\x27\xc9\x9d\x4b\x92\x3f\xe0\x65\x24\xb9\x73\xf0\xf2\x90\xe4\x4d\xc6\x5a\xb3\x69\x36\xb3"
+	"\x5e\xdf\x59\xbc\x48\xd0\x49\x21\x5e\x9f\x98\xe8\x34\x15\xaf\xa7\x28\xc5\x9c\x10\xaf\x9f\x24\xba\x58\x4c\xfa\x7a\x89\x5a\x28\x26"
+	"\xf4\xfa\x48\xa2\x50\x24\xa0\x49\x11\xaf\x87\x24\xf5\x61\x64\x6b\x46\xee\x3a\x9d\x4d\x1e\x8a\x65\x16\x6b\x3a\x87\x99\x7e\x30\x50"
+	"\x60\x7c\x79\x81\x07\xf2\x99\xf3\xf6\xe5\x16\x86\x9a\x2a\x95\xe9\x90\x15\x29\x0a\xc3\xe9\x90\xa1\x53\x09\xc1\x19\xe9\xa4\x7f\xe2"
+	"\xf5\x27\x9c\x9f\xf7\x27\x42\x0f\x94\x8a\x7c\xac\xcc\xed\x0f\x38\xb7\x8d\xd3\x99\x8e\xc4\x85\x85\x48\x64\xe1\x4f\x24\x72\xe7\x8d"
+	"\x85\x07\x8b\x7c\x94\xcb\xb2\x34\x2a\xc4\xa3\x73\x68\xd2\xc6\x7a\xf9\xee\xbd\xe0\xcc\x83\x65\x61\x2a\x3a\x15\x08\xd4\xa4\xce\xc3"
+	"\x0a\x38\x63\xf3\x67\x59\x16\xa6\x72\xa4\x02\xe0\x6d\x08\xe0\xe0\x94\x2c\x4e\x20\xca\xbc\x06\x14\x30\x80\xa9\x64\x7d\x05\x10\x2e"
+	"\x22\x34\x9e\x0a\x20\xbb\xc3\x8f\x23\x28\x0e\xec\x87\x09\xce\x98\x8a\x02\x49\x8a\x22\x08\xaa\x28\xa0\x77\x7e\x3b\x2b\xa9\xa7\x76"
+	"\xdb\xeb\xd3\xed\xac\xe4\x0f\xf9\xa8\xa0\x70\x79\x46\xa4\x9e\x11\x79\x28\x56\xff\xa7\x89\x80\x01\x03\x07\x05\x06\x43\x02\x05\x20"
+	"\x7c\x81\x7c\x5c\x50\x12\x95\x88\x16\x14\x34\x41\x53\x92\x74\x46\xcd\xeb\x35\x9d\xef\xe5\xd4\x3b\x47\x7c\x61\xe1\xf5\x8c\x46\xa3"
+	"\xbe\x01\x4e\x26\xce\x2f\xdf\x6c\xae\x82\xee\xf2\xf5\x11\x70\x32\x89\xec\xc3\x96\xd9\x85\xc8\x9f\xc6\xd6\x97\x23\x02\x06\x0c\x1c"
+	"\x18\x11\x50\x4e\x20\xc5\x8e\x78\x6c\xee\x9c\x62\xd1\x54\x1f\x2d\x6c\x7d\x45\x1a\x58\x38\x7b\xb0\x20\x0e\x0a\x14\x4c\x89\x09\xec"
+	"\xb6\x8c\x9d\xb1\xde\xa6\x4a\x8a\x20\x85\x86\xe6\x35\xe8\xac\xa6\xaf\x2b\xc9\x6c\xc3\x44\x2b\x74\xf8\x3b\x23\xaa\x18\xd2\x85\x39"
+	"\x06\x14\x7d\xd9\x87\xee\x0c\x29\xe3\x8c\x33\x7e\xba\x4e\x73\xd6\xe5\x29\x58\xb2\xf3\xb2\x6d\x51\x25\x04\xe7\x8e\x9e\x4a\x08\xce"
+	"\x1c\x41\x7f\x62\xa7\xb7\x3f\xcd\xd6\xd7\xd6\x4c\x9d\xde\xba\x6c\xb9\x06\x0b\x6b\x36\x87\xdf\x23\x2c\x89\x12\x10\x45\x29\x9a\x61"
+	"\xfa\x3c\x07\xfb\x48\xda\xf9\x4e\xb2\xdd\x0e\xf6\x53\x04\xd5\x2f\x0c\x53\x51\xec\x89\xfc\x71\xfc\x79\x2c\x14\x7b\x1c\xf1\x48\x73"
+	"\x2b\xf8\xf5\xdf\xeb\x1f\x71\x82\xa0\x49\xff\x24\x28\xa8\x49\xff\x2c\x16\xd1\xa4\xe0\x03\x36\x53\x15\xc1\x2a\x7e\x77\x10\xfe\xbd"
+	"\x1e\xac\xf2\xdf\xc2\x54\x97\x0b\x0d\x3a\xab\x65\x1c\xed\x42\xb1\xdf\xce\x78\xbf\x82\x28\x04\x3a\xa7\x88\x7e\x0e\x2e\x59\x37\xa2"
+	"\x71\x3a\x43\x74\x03\x85\x34\x4e\xe7\x07\x1a\x58\x76\xcb\xde\x25\xeb\x42\xcf\x03\x02\x81\x40\x20\x10\x04\x24\xdf\xec\x08\x55\x46"
+	"\x3a\xa3\x2f\x78\xbe\x0f\x7b\x92\x6f\xf6\xfa\x7c\xb3\x28\x2f\xd1\x49\x17\xc9\x3c\x48\x98\x94\x4e\x88\x82\x26\xa5\x13\x42\xfc\x71"
+	"\x54\x11\xe1\x31\x9c\x8f\x23\x9e\x30\xa5\xa6\xb9\x7c\x75\xfe\x78\x38\x09\x20\x00\x51\x99\xd0\xe4\x35\x52\x10\xea\x1f\x31\x3e\xa0"
+	"\xe7\xf3\x1e\x1b\xce\xac\x4a\xbe\x7e\x77\x38\x41\x45\x94\x09\x4d\xee\x9c\x32\xe9\xe4\xf5\x21\x38\xa1\xc9\xc4\x42\xd0\x33\xf9\xf4"
+	"\x79\xf2\xdf\x03\xd5\xe7\x39\x3c\x3f\x0c\xf7\x0b\xf8\x46\xfc\x80\x2f\xa8\xce\xc1\x99\x2b\x33\x23\xe2\xe3\xc3\xf8\x4e\x62\x8f\x78"
+	"\x38\xb1\x3f\xe0\xc4\x8e\xbd\xbe\xc9\x2c\x77\xdd\x07\xbb\x2d\x07\xee\xa5\xad\x7b\x5d\x8a\x20\x2a\xe2\x30\x23\xb4\xdc\xe7\x61\x86"
+	"\x6e\x78\xd8\xdb\xbd\xae\x8c\xd3\x10\xe8\x86\x0d\x67\x16\x44\xb9\x8b\x61\x9e\x64\x22\xc1\x8c\x10\x97\x0f\xff\x48\x70\x76\x7a\x6b"
+	"\x3a\xbd\x49\x91\xc3\x65\x37\x09\xaa\x08\x36\x9c\x61\x11\x25\xdc\x7f\xa0\xee\x0f\xed\x1a\x10\x6b\x10\x94\xfd\xa9\x80\x73\xa3\xd9"
+	"\x11\x0f\x69\xd6\x64\x28\x4b\x08\xb3\x86\xd3\x3a\xc3\x68\xa6\xd8\x5e\x1f\x36\x90\xd0\x72\x1c\x02\x8c\x88\x12\x3e\xfe\x54\x4f\x34"
+	"\xbd\x3a\x57\xbe\x37\xa0\xa2\xaf\x6f\xce\x69\x2c\x8c\x15\x79\x87\xa9\x64\x7d\x24\x29\xf5\xcf\x13\xa5\x06\xc4\x1a\x38\x97\xcb\x4b"
+	"\x20\x1f\x4e\x67\x69\xd0\xd9\x06\xb6\xd5\x2a\x0d\x02\xdb\x6a\xf1\x69\xb6\xbe\xea\x25\x40\x3c\x04\x67\x7c\x9a\xc6\xb1\xad\xf6\x68"
+	"\xba\x7c\xcc\x37\x6e\xe9\x49\xaf\xb1\xc2\x59\xef\x45\x97\x8f\xd4\x04\xce\x66\x7f\xde\x1f\x4e\x6f\xcb\x62\x01\x83\xd4\xa8\x72\xc3"
+	"\x94\x39\xa6\xd0\x8c\x88\x88\x24\x49\x92\xe1\x12\x09\x10\x06\x84\x59\x96\x45\x59\x8e\x3b\x44\x0f\x12\x40\xf0\x68\x38\x89\x82\x20"
+	"\x87\x29\x83\x88\x21\x84\x10\x42\x08\x11\x11\x11\x91\x40\x44\x44\x44\x44\x92\x24\x49\x07\x2c\xaa\xc0\xef\x00\x3e\xfc\xf5\x16\xe6"
+	"\x2c\x26\x72\x58\xb6\xdb\x16\xb8\xa3\x8b\x3c\x9e\xa3\x17\x7e\x5f\xc9\x56\x51\x1c\x8f\xa5\x6f\x59\xda\xf7\x63\x07\xe4\xe3\x5d\x31"
+	"\x4a\xd6\xb7\x0c\x4c\xee\x7d\xa0\x36\xa5\x89\x46\x27\x58\x7b\x4b\x94\xfa\xf6\x0a\x0d\xb9\xeb\x6d\xe1\xf5\xae\xf8\x07\xc1\x94\x7a"
+	"\x2b\xe9\x46\xd8\x24\xbe\x78\x4c\x27\xbd\x9b\x17\xe7\x78\x42\x0e\xdc\x65\xe0\x70\x37\x99\xdb\x5e\x7c\xd8\x50\x10\x34\xbb\x5d\xb9"
+	"\xdd\xce\x16\x34\x5f\xb1\x6a\xb3\xa3\x6d\x74\xbb\x88\x24\xb4\x5f\x45\x8e\xde\x0d\xc4\xa5\x1d\x70\xee\x99\xf2\x58\x1d\xbb\x86\x2b"
+	"\xc7\x7d\x10\xef\x1d\x4b\x73\xb6\xdb\x95\xd0\xd9\xc6\x65\xc0\x53\xe8\x31\x0f\x68\x77\xb4\xbc\x04\xba\x0e\x4d\x44\x9c\xd0\x91\xba"
+	"\x91\x53\x72\xb0\xc2\x84\x09\x61\xbf\x46\x9f\xf2\xc0\x13\x15\x25\xd0\x22\xbb\xc1\x4a\xa5\xb1\xf2\x21\x61\x67\x28\xad\xb4\x62\x8f"
+	"\x82\x86\x26\x96\x89\x44\x4b\xe9\x15\xdc\x31\xe6\x4e\x2a\x36\xc8\x78\x27\x5a\x57\xa9\x52\x03\x65\x3d\x3a\x92\x52\xa3\x0e\xad\x3e"
+	"\xff\xd0\xc6\x1c\xfc\xb0\xa7\xf0\x16\xc1\x46\xad\xb8\xf3\x99\xeb\x7b\x44\xd3\x7e\x3a\x07\x19\xe9\x44\x1f\x9d\x45\x86\x4e\xb5\xf0"
+	"\x9c\xf8\xdd\x39\xfb\xeb\xed\xd4\x51\x3b\xd1\x41\xc1\xec\xb1\xef\x3b\x80\xff\xb5\x5b\x69\x00\x72\xee\xfc\x7f\x6c\xa3\x43\xb4\x1b"
+	"\xd5\xb9\xe0\x15\x01\x36\x9a\x5a\x7b\xb6\x3f\x8c\x18\xe8\x09\x40\x3c\x46\x77\xa3\x04\x88\xa1\xd8\x5b\x33\xf0\xeb\xf2\x26\x3a\x84"
+	"\xdd\x02\x80\xc8\x7b\x08\xf7\xe4\x01\x08\xc8\x9a\x08\x48\x0b\x0d\x80\x7e\x00\x9a\x72\x06\xcc\x17\x28\x16\x40\x80\x11\x76\x1d\x1d"
+	"\x0c\x40\xf0\x41\x63\x8e\x86\x81\x97\xf7\x51\x02\x86\x8a\xbf\x27\x07\x0d\x2c\xa5\x6a\xab\x1c\x4d\x5c\x3d\x4b\xef\x2a\xa3\xb3\x02"
+	"\x87\xb4\x4f\xfb\xc5\x12\x5c\xe7\x28\x96\xdd\xcb\x16\x9d\x1c\x25\x46\x52\x45\xe9\x84\x94\x02\x4f\xce\x14\xa3\x51\xdb\x2a\xed\xfa"
+	"\xac\x20\x18\x27\x0a\x1e\xdf\x7f\xfe\x74\x4c\x81\x6a\xf4\x3a\x9f\xb2\x42\xa3\xe7\x7a\x22\xbf\x0d\x92\xd5\x53\x51\x4f\x70\xb3\x4e"
+	"\xd4\x15\xdd\x4d\x95\x26\x06\xac\x9b\x09\x16\xfb\x09\x27\x47\xd5\x4f\x1d\xfb\x4b\x96\x58\xdf\x37\x74\xd4\x65\x20\x5f\x28\x5c\x56"
+	"\x13\xcf\x6a\x73\xbe\x31\xd7\x01\x9e\xac\x53\x08\x21\xcc\x6d\x72\xc5\xde\xe3\xba\xd5\xf7\xa7\xc3\x97\x83\x53\x05\x6c\xc1\x81\x92"
+	"\xf4\xb2\x1c\x8f\x99\xdf\x13\x07\xd6\x6a\x11\x16\xa0\x32\x16\x78\xc5\x8e\x3c\xe9\xbd\x82\x25\x5c\x72\xe2\x25\xe0\x15\x78\xb7\xfe"
+	"\xe3\xcf\x5b\x1f\x33\x89\x27\x51\xf2\xe9\x32\x1f\x2e\xf4\x7c\x9b\x32\xf9\x86\x06\x34\x70\x6a\x03\x74\x26\x70\x3d\xdc\x2f\x32\xca"
+	"\xbc\x41\x16\x81\x1e\x39\x26\x86\x79\x8b\xae\x20\x4b\x31\xa0\x0d\xc5\x3f\xef\xad\x14\x20\xf6\xd3\xa1\x94\x66\x3d\x08\xe9\x95\x8d"
+	"\xac\xc1\x7b\x10\x31\xa9\x29\x42\x01\xf2\x52\x8b\xa4\xa1\x8f\x35\xc1\x07\x0e\xb3\x98\x63\x07\x14\xe6\x9c\xc8\x37\x46\x0f\x56\xf1"
+	"\xdc\xaa\xc1\x0f\x21\x21\x0f\xba\x0a\xfd\xc4\xe8\x4f\x92\xe6\x8d\x06\x7d\xe1\x0f\xa8\xf0\x86\x9f\xed\x8f\x8b\xe3\xb1\xa8\x7f\xc6"
+	"\xd0\xfc\x6c\x88\x29\x07\x9d\x6d\x6a\x9f\x04\xea\xf9\xad\x13\x70\x92\xa1\xa6\x52\xca\xa0\xcd\x7e\xa1\xcb\x87\x3b\xbf\xa1\x02\x53"
+	"\xee\x84\x64\xdf\xe0\x06\x34\x57\x14\x21\xf0\xad\xd9\xbb\x4f\x84\x9e\xaf\xa2\x0d\xac\x6e\xa0\x98\x9e\x22\x07\xb9\x57\xd8\x3f\xd2"
+	"\xcc\xb9\x81\xdd\x0a\x16\xb0\x18\x47\x7b\x7a\x7b\x85\xeb\x70\x63\x76\x83\x39\x10\x0c\xf0\xd0\xb6\xa3\x07\x90\xa3\x83\x30\x35\x3a"
+	"\x3f\x3d\x02\x2b\x04\x18\x98\xc6\x9e\x88\x46\x89\x65\xac\x7c\x86\x1f\xa6\xae\xbd\xe6\xb4\x81\xd3\x26\x15\xd5\xdb\x5e\x4a\x86\x30"
+	"\xc4\x43\xd7\xcc\x31\x62\x97\xdf\x8b\x1a\x0a\xf1\xd9\x03\xe0\x45\x7b\x84\xfa\x98\x6e\x59\xf5\xc9\x22\x5a\x51\x1d\xcb\xef\x8d\x4e"
+	"\xf1\x72\x36\x38\xd7\x58\x57\x97\xf2\xa7\x92\x03\xb3\x49\x01\x0a\x07\x80\x72\xc8\xc2\xac\x3f\x70\x74\xa8\x9d\x8e\x01\x0d\x06\xe8"
+	"\xa0\x15\x11\xe9\x5b\x94\x91\x3b\x38\x89\x22\x0c\x8a\x8a\x08\xae\xa4\xe0\xcf\x92\x17\x30\xe3\x3f\x27\xdb\xdf\xe0\x83\xb3\x83\x39"
+	"\x56\x27\xfa\xd0\xf0\x9b\x49\x13\xe1\x87\x71\xa3\x26\x8d\xa5\xd2\x18\xec\x3d\x8b\x96\x01\xc5\xd9\x8f\xce\xe8\x00\xb8\xa4\x63\xea"
+	"\x69\xed\x83\x20\xc2\x1d\xe0\x22\x3b\x1c\xa6\xfa\xf2\x11\x5b\xcd\x97\xd6\x8a\x45\x4b\xb5\xce\x4e\x0d\x69\x81\x10\x57\x9d\xb8\xc2"
+	"\x3a\x6e\x3e\x53\x11\x6e\xc0\x82\xb2\x99\x0a\x55\xfd\x76\xd7\x09\x21\x54\x9c\xab\xc7\x38\x04\xa4\x8e\xc9\x26\xc4\x34\x52\xa5\x20"
+	"\x32\x4f\x2d\xa1\x94\x62\x54\x32\x98\x2e\x88\x3f\x4a\x33\x69\x4b\xb4\x40\xdf\x14\x21\x59\xb2\x93\x75\x19\xba\x7c\x12\x92\xf0\x3f"
+	"\xe0\x31\x0d\x27\x0d\x48\x26\xbc\xe7\xca\xf9\xb9\xa8\x6a\x06\x19\x57\x16\x29\xc7\x0a\xeb\xad\xc1\xdc\xac\xde\xa9\x2e\x7d\x6b\xd5"
+	"\xfd\x52\xae\x04\x73\x9d\xdc\x82\xed\xc3\xd2\x26\xfd\x74\xa1\x95\xb5\xe6\xa1\x2c\x5b\xca\x02\x24\x3e\x77\x43\x2c\x61\x29\x76\xa8"
+	"\xb9\xf7\x08\xd5\x0b\x36\xfc\xe3\x6e\xf4\x29\xfc\x28\x08\xd3\xf5\x36\x8c\x7b\xd1\xfb\x1d\x28\x77\x48\x10\xfa\x21\x6a\x4d\x4f\x28"
+	"\xe0\x00\x48\x9f\x28\xed\xf8\x3c\xf4\x4f\x5c\xd9\xcc\x92\x36\xe8\xfc\xad\xc9\xc4\x26\x81\x7c\xd1\x00\xb1\xa6\x3c\x70\x0d\x69\x38"
+	"\x10\x3a\xe4\x83\xa3\xd8\xfa\x29\x82\x84\x7d\x82\xb1\xfd\xe0\x89\x12\xa3\x88\x09\x83\xfd\x4d\x70\x19\x7d\x85\x64\x0c\x6e\xcc\xfa"
+	"\x42\xf4\x4e\xc3\x20\xad\xe0\xdf\xa2\x5e\x36\xb1\x59\x04\xc1\x8a\xc1\xef\x14\x98\xaa\x7f\x21\xc3\x8b\xc5\xcb\x26\x93\x75\x68\x22"
+	"\x34\x11\x2a\xd7\xa2\x23\x80\x80\x6b\xea\x6d\x57\x22\x01\x3e\x4f\x0b\x5b\x5d\xc1\xba\x2f\x55\x61\xc0\x12\x96\x73\xd2\x8a\x53\x7f"
+	"\xa6\x94\x56\x98\x36\x35\xa4\xbf\x94\x61\x50\x44\xf7\x27\x21\x4a\x65\x24\x32\x3b\x8a\xc9\xad\x1e\x42\x6c\x12\xa4\x62\xf0\xd9\x77"
+	"\x95\x08\x42\x22\x59\x72\x05\x01\x88\x63\xfe\xc2\xab\xc0\x9a\xf1\x06\x04\x06\x60\xe0\x18\xc2\x79\xac\x0a\x46\x1a\x7d\x82\xf7\x9f"
+	"\x39\xab\x66\x9b\x98\x18\xe0\xaf\x00\x10\xf3\x69\x13\x97\x37\x03\x16\x19\x37\x25\xbe\x1b\x0e\x56\x04\x76\x90\x3f\xad\x75\x92\x97"
+	"\x71\xfc\x4b\x60\x05\xdb\x72\xdb\xd1\x03\xd8\xa5\x8b\xc2\xb2\xb1\xfe\xed\xa9\x04\x0e\xdc\x30\xa2\x7c\x58\x51\x26\x99\x60\x0d\x1b"
+	"\x7f\xaf\x43\xb0\x3a\xd4\x3f\xfd\x7e\x9b\xbc\xab\xb0\xb7\xd5\x81\x74\x9c\x5c\xf3\xcb\x21\x90\x5a\x26\x3a\x79\x99\x47\xf8\x2d\x84"
+	"\x27\x6f\xf6\x99\x7f\xa0\xce\xa3\xd1\x16\x53\x82\xb9\xe9\x85\xaa\x1a\x7c\x60\x3c\xb4\x1b\xe6\x7f\x11\x91\x71\x89\x84\x5b\xcb\xe1"
+	"\xb9\x8e\x11\x5c\xd7\x80\x09\x8f\x8f\x2c\x07\x68\x7a\x34\x32\xba\x8b\xa9\x75\xdd\x1c\xab\x59\x67\x73\xe0\x3c\x71\x6c\x54\x11\xdb"
+	"\x79\x58\x4a\xa4\x63\x26\x4e\x9b\x29\x59\xab\xfa\x83\xe0\x7f\xdf\xc2\x4b\x67\x85\x36\xf9\x8d\xb9\x0d\xa2\xfb\x4c\x5f\x57\x78\xe3"
+	"\x21\xcd\x46\x37\x31\xe0\x8e\x32\xc6\x2f\x38\x76\xb6\xe9\xdf\x71\xf2\x9c\xbc\xe4\x26\xa7\x4e\xa4\x00\x4c\x41\x6f\xd4\x8d\xb5\xe9"
+	"\x5a\xbf\xe1\xde\x6e\x68\x48\xeb\x9b\x71\x72\xd9\x3f\x66\x72\x28\x14\x3f\xd7\x95\x93\xc4\x26\xb3\x46\x74\xe2\xa3\xe7\xf6\x59\x78"
+	"\xc2\x1e\x66\x12\x4b\x99\x12\x22\xf2\xc8\x8f\xeb\x56\x26\xa6\x0c\xca\x81\x28\xe8\x07\x92\x21\x28\x68\xd2\x63\x4f\x18\x49\x92\xbb"
+	"\xb4\xe0\x0c\x93\x6a\x41\x80\x7a\xfc\x3e\xe2\x65\x04\x34\x5f\xb3\x6b\x1e\xfd\x6d\x6e\x60\x4b\x9d\x71\xfa\x70\x41\x07\xab\x25\x2a"
+	"\xb4\xe5\xce\x91\x14\xea\xf4\x42\x92\x47\x71\x40\xbe\x4f\x7f\xb8\x2e\xda\xf8\xb2\x28\xe5\xcb\x98\x13\x96\x09\x9d\x71\xc1\x30\x30"
+	"\xdd\x72\x75\xcb\x35\x21\x97\x0f\xd7\x9b\x77\x30\xe5\xe7\xbe\x78\xed\x00\x6f\xb8\x14\x35\xe8\xe5\xb3\x98\x21\xdc\xc0\xa9\x69\x26"
+	"\x45\x1a\x26\x9e\x3e\xa6\x6d\x2b\xce\xb7\xa5\xf0\x2b\xd8\x20\x40\x1b\x00\xfa\xe9\x2b\x31\x90\x69\x7d\xba\xbf\x38\xba\xa9\x24\xc5"
+	"\x1d\x66\x59\x80\xc8\x40\x8f\x3e\xa2\x1b\x4c\xad\x37\xb4\x4c\x49\x70\x92\xca\xc9\x45\x72\x76\xef\x4c\x3c\xa7\x43\x79\xd9\x3c\xca"
+	"\x20\x94\xb6\x5a\x0e\xeb\x9b\xca\x61\x8c\xc8\xba\x75\x31\x42\x87\x0d\x8c\x72\x9e\x0e\x11\x21\xc2\x69\x46\xa5\xa0\x63\xc7\xee\x52"
+	"\x51\xaf\xd0\xf1\xa7\x42\x7c\x38\xcd\x81\x35\x42\xbf\x8a\x44\x09\x75\xb0\x14\xe6\xaf\x38\x80\x2f\x9e\xf6\x69\x10\x9e\xc6\xfa\x89"
+	"\x6e\xc3\xcd\xa9\xec\xd1\x0f\xd7\x18\x27\x79\xcf\x5f\x02\x30\xe7\xd1\xa5\xfc\x35\x88\xa2\x4b\x36\xb1\x7d\x20\x2b\xa4\xfc\x22\x98"
+	"\xed\x44\xac\x5d\x48\x59\x5a\x0c\x82\x17\x35\x00\x60\xea\xb3\x07\x3c\xc8\x28\xfd\x64\x18\xf5\x60\x41\xd9\x37\xd3\x67\x40\x90\xf8"
+	"\xcb\x9d\x0c\x1b\x8e\xf8\x17\x19\xa6\xf3\xea\xab\x0e\x1b\x00\xfa\x26\xe2\x62\x94\x74\x22\x62\xbe\xc1\x97\xfd\xef\x28\xd2\xb1\x7b"
+	"\xa4\x90\xef\x4f\x49\xf1\x54\xa3\xa7\xfa\x3e\x92\xfc\x5e\x0c\x83\x80\xbc\x7d\x28\xcb\x9f\x74\xbc\x7c\x29\x3f\x9c\xcf\x87\xe0\x02"
+	"\xcf\x61\xdb\x3b\xc9\x75\xab\xb0\x4a\xdd\xd7\x30\x76\xed\xb5\x35\xd6\xb3\x6e\xe2\xc5\xc7\x47\x46\x9e\xf9\x19\x5d\x63\x8d\x4b\x3c"
+	"\xa9\x3a\x3a\x2c\x63\x2e\x76\x2b\x83\x74\x1a\xbb\x29\xa3\x12\xca\xba\xf0\xb1\xaf\x41\xc1\xa0\x15\xc1\x4a\xa5\x7d\xaf\x53\x22\xa7"
+	"\xb6\xcf\x07\x96\x6b\x4e\xc6\x0f\xad\x30\xcb\xa0\x48\xf0\x9a\x64\x16\x93\x92\xcc\x37\x39\xfd\x20\xfe\xbe\x21\xf0\xaa\x7e\x7a\xff"
+	"\x74\xbf\xac\x58\x64\x3f\x87\x60\xaa\x68\x58\x79\x93\x18\xe5\x76\x51\xe7\xd6\x5a\x2a\x3a\x1a\x7e\xfc\x61\xce\x68\x28\x6e\x74\x22"
+	"\x7c\xb5\xf4\x23\x05\x65\x90\xcf\xa9\x7e\xc2\xa2\x00\x90\xa2\xc5\x0a\x00\x4c\x29\x28\x72\xdb\x60\x39\x09\x21\x2b\x75\xad\xb0\x0b"
+	"\x01\x40\xdb\xe0\xef\x04\x35\xf2\xec\x82\xd4\x91\x55\x18\x92\x3d\x8e\xe9\xdc\xf8\xf3\x1d\x87\xe4\x61\x1e\x18\x19\x0c\x15\x38\x48"
+	"\x53\xb9\x63\x42\x41\xcc\xfb\x5a\x7b\x94\xbb\xa3\x08\x64\x8a\xa8\x7b\xb4\xbf\xa9\xce\xe0\xca\x7a\xf7\xa3\x76\x82\xcc\xa8\xce\xbb"
+	"\xe0\x68\xd2\xf1\x12\x8c\xb0\x43\x7e\x52\x3f\x0e\x18\x33\x0e\x23\x82\x01\x31\x58\x21\x8c\x02\x54\xcb\xff\x76\xd7\xbe\x2d\x0e\x86"
+	"\x74\xbb\x2f\x79\x93\xc2\xd4\xd1\xc0\x41\x1d\xf3\x5f\x00\x08\x25\x13\xe1\x2a\x99\xf9\x13\xdc\xc9\x81\x0f\xc2\x0c\x0b\x0c\x9b\x10"
+	"\x93\x6f\x31\x0c\x66\xef\x70\x04\xbd\x55\x22\xc6\x91\x28\x17\xed\x5c\xe1\xd7\x5b\x3e\x97\x80\xeb\xc3\x50\x7c\x64\xda\x3f\x02\xa2"
+	"\xfd\xe7\xe4\x8b\xdb\x8e\xd1\x86\xb4\x85\xe5\x56\xfd\x62\xb2\x7b\x30\xfa\xe0\x74\xea\x37\x8e\x6d\xd0\xf2\xf1\x85\x16\xd0\x63\x17"
+	"\x60\xb3\xb7\x63\x61\x3d\x5a\x7c\xc7\x63\x9e\xac\xcf\xbf\xb9\x38\xe0\x7a\xb2\xd2\x12\xa3\x0c\x8e\x4c\x82\xed\x28\x66\x6d\xc4\x81"
+	"\xa1\xf8\xc6\x24\xc5\x25\xfc\xde\x3a\xf0\xcf\x27\x8b\x2d\xab\x28\x69\x9a\x34\xd3\x7c\xe0\xd8\x6c\x40\x2d\xe2\x00\x90\x51\x44\x7d"
+	"\xfc\xc4\x6d\x62\x51\x25\x13\x65\x50\xf6\x8b\xab\xd9\xb9\xa9\x6a\x33\x65\x1a\x55\xc5\xa5\x59\x78\x4c\x75\x21\xc8\x61\x67\x58\x7c"
+	"\xd3\x53\x08\xf7\xfb\xc9\x55\x72\x01\x54\xa5\x33\xb3\xcb\x1f\x4c\xd1\x0e\x40\x1f\x60\x3c\xe4\xef\xf1\xd1\x5c\xcd\xe8\x06\xe5\x58"
+	"\xb1\x1c\x85\xc1\x82\x6f\xd4\x1e\xec\x2f\x8d\xbe\xb9\xd2\x2a\x5f\xca\x11\xa4\x0f\x00\x03\x89\x1a\x94\x90\x12\x3e\x5c\x3e\x94\x7f"
+	"\x78\x78\x70\x90\xa0\x2e\xdb\x40\x34\x3d\x4c\xf0\x83\x04\x65\xdc\x00\x12\x4d\xf2\x9e\xe4\x1d\x69\x5c\xa6\x93\x6a\x5c\x8e\x11\xc4"
+	"\x35\x5b\x5f\xcb\xc2\x50\x28\x94\x4a\x85\x46\x11\x04\x85\xa1\x13\x45\x10\x04\x4e\x79\x70\x82\xb8\x9e\x52\x34\x57\x2f\x5d\x3e\x36"
+	"\x13\x88\xf1\x42\x41\xb4\x80\x26\xe8\x6e\xd6\x92\xee\x66\x9d\x40\xc6\x0d\x20\xdd\xb5\xf0\x95\xf1\x24\x45\x94\x90\x12\x56\x79\xf9"
+	"\xca\x15\x80\x8e\xa0\xe0\x92\x26\x49\x63\x61\x05\x89\x29\x62\x04\x22\x90\x32\x94\x0f\x86\xe7\xf9\xe1\x8e\xfd\x5f\xad\xf3\x3d\x31"
+	"\x7a\x24\xea\x87\xa8\xb3\x3c\xec\x5e\xf7\xb2\x48\x03\x54\x50\xf5\xaa\xa5\x66\x7f\x56\xe7\xb7\x2f\xa8\xe7\x0c\x70\xeb\xa1\x95\xb9"
+	"\x7e\x29\xb0\x62\x61\xbf\x77\x49\xee\xa0\xc2\x2f\x8c\xf2\x7b\xbe\x88\xbf\x70\xe9\xe0\x44\xe3\x25\xa9\xcf\x68\xc8\xe2\xe5\x3e\xa9"
+	"\x47\xfd\x2d\xcb\x45\x17\xf6\x0f\x5b\x54\x10\x9d\xdb\x24\x9a\x78\x60\x32\x85\x94\x96\xdd\x47\x8f\xa9\x4e\x98\x6b\x81\xc6\x54\x8f"
+	"\xea\x4d\x7a\xa5\xa8\xce\x24\xf5\x14\xe8\x2e\xe4\x9f\x65\x53\x5e\xa5\x95\x61\xca\x4e\xed\xf0\x6a\x45\x5f\x0e\x98\x28\x3a\x18\x67"
+	"\x19\x54\x1d\x4b\xf7\xab\xa3\xa4\xe5\xcd\xa3\x92\x40\x26\xb6\xe3\xb8\x0f\xc2\xb4\x0a\xcb\xad\xbc\xc2\xda\x95\x47\xcd\xec\xe3\x7c"
+	"\x0f\x94\xe8\x7e\x0c\x4e\x23\xa2\x5c\xd7\x63\xb0\x44\xf7\x63\x70\xd0\xd4\x10\x3a\x90\xf0\xcc\x04\x9e\x24\xc4\xe8\x85\x48\x64\xf8"
+	"\xae\x47\x82\x24\x58\x50\xb5\x31\xbb\xa6\x28\x04\xae\xae\x85\x3f\x4b\xff\xe0\x94\xc0\xed\xf0\x10\xf4\x99\xf6\xe9\x8a\x8b\x7a\x0c"
+	"\xd4\x5c\x4a\x1b\x3d\x09\xee\xa7\x3e\x78\x54\x0c\x5e\x5f\xcb\x12\x25\xbd\x6f\xf0\x90\xc4\x0f\xcc\x6b\x32\xe1\x25\x7e\xca\x85\x4f"
+	"\xa1\x25\x4e\x46\x26\x61\xb0\xdb\x1a\x8c\xa4\xe4\xbc\x20\xbc\xfd\x81\x20\x72\x74\xde\xe8\x3e\x0c\xad\xcf\xbd\x41\x70\xa5\x63\x4f"
+	"\xc1\x63\x1f\xc5\x26\xb0\x4a\xa4\x15\x3c\xa8\x83\x0a\x84\xea\x42\xbf\xa6\x5f\x4d\x95\x72\x9c\x08\xda\x17\xd3\x81\x47\x94\x5d\x93"
+	"\x77\x81\xe7\x80\x71\x81\x4b\x9a\xa0\xa2\xc6\x2c\x0f\x38\xab\x78\x73\x7d\xc0\x4b\x98\x96\x31\xc2\x52\xd6\x31\x0c\x73\x85\xc2\x54"
+	"\x40\x62\x0d\x38\x07\x73\xec\xe3\x1c\x45\x00\x00\x08\x20\x01\x00\x17\x80\x07\x42"
 ;
\ No newline at end of file
@@ -67,54 +67,54 @@ const SpShaderInfo spShaders[] = {
 const SpPermutationInfo spPermutations[] = {
 	{ { 1 }, {  }, { 1 }, 0, 1103 },
 	{ { 2 }, { 1,2 }, {  }, 1103, 3824 },
-	{ { 3 }, {  }, { 1,2,3,4 }, 4927, 740 },
-	{ { 3 }, {  }, { 1,2,3,4 }, 5667, 740 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 6407, 8230 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 14637, 8230 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 22867, 8453 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 31320, 8453 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 39773, 8230 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 48003, 8230 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 56233, 8453 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 64686, 8453 },
-	{ { 5 }, {  }, { 5 }, 73139, 318 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 73457, 6332 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 79789, 6587 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 86376, 6113 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 92489, 6368 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 98857, 6555 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 105412, 6810 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 112222, 6336 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 118558, 6591 },
-	{ { 7 }, {  }, { 1 }, 125149, 272 },
-	{ {  }, {  }, {  }, 125421, 31 },
-	{ { 7 }, {  }, { 1,2,3,4,6 }, 125452, 1317 },
-	{ { 7 }, {  }, { 1,2,3,4,6 }, 126769, 1317 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 128086, 8271 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 136357, 8271 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 144628, 8494 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 153122, 8494 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 161616, 8271 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 169887, 8271 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 178158, 8494 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 186652, 8494 },
-	{ { 8,9 }, {  }, { 1,7,8,9,10,11 }, 195146, 1527 },
-	{ { 8,9 }, {  }, { 1,7,8,9,10,11 }, 196673, 1527 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 198200, 8515 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 206715, 8515 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 215230, 8738 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 223968, 8738 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 232706, 8515 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 241221, 8515 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 249736, 8738 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 258474, 8738 },
+	{ { 3 }, {  }, { 1,2,3,4,5,6,7 }, 4927, 1015 },
+	{ { 3 }, {  }, { 1,2,3,4,5,6,7 }, 5942, 1015 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 6957, 8230 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 15187, 8230 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 23417, 8453 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 31870, 8453 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 40323, 8230 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 48553, 8230 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 56783, 8453 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 65236, 8453 },
+	{ { 5 }, {  }, { 8 }, 73689, 318 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 74007, 6332 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 80339, 6587 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 86926, 6113 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 93039, 6368 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 99407, 6555 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 105962, 6810 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 112772, 6336 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 119108, 6591 },
+	{ { 7 }, {  }, { 1 }, 125699, 272 },
+	{ {  }, {  }, {  }, 125971, 31 },
+	{ { 7 }, {  }, { 1,2,3,4,9 }, 126002, 1317 },
+	{ { 7 }, {  }, { 1,2,3,4,9 }, 127319, 1317 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 128636, 8271 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 136907, 8271 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 145178, 8494 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 153672, 8494 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 162166, 8271 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 170437, 8271 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 178708, 8494 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 187202, 8494 },
+	{ { 8,9 }, {  }, { 1,10,11,12,13,14 }, 195696, 1527 },
+	{ { 8,9 }, {  }, { 1,10,11,12,13,14 }, 197223, 1527 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 198750, 8515 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 207265, 8515 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 215780, 8738 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 224518, 8738 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 233256, 8515 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 241771, 8515 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 250286, 8738 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 259024, 8738 },
 };
 
 const SpUniformBlockInfo spUniformBlocks[] = {
 	{ }, // Null uniform block
 	{ "DebugEnvSphereVertex", 120 },
 	{ "DebugEnvSpherePixel", 32 },
-	{ "DynamicTransform", 128 },
+	{ "DynamicTransform", 64 },
 	{ "Pixel", 1088 },
 	{ "EnvmapVertex", 16 },
 	{ "EnvmapPixel", 8320 },
@@ -145,6 +145,9 @@ const SpAttribInfo spAttribs[] = {
 	{ "a_normal", 1 },
 	{ "a_tangent", 2 },
 	{ "a_uv", 3 },
+	{ "a_worldRow0", 4 },
+	{ "a_worldRow1", 5 },
+	{ "a_worldRow2", 6 },
 	{ "a_position", 0 },
 	{ "a_tint", 4 },
 	{ "a_uv", 1 },
@@ -155,149 +158,151 @@ const SpAttribInfo spAttribs[] = {
 };
 
 const char spShaderData[] = 
-	"\x28\xb5\x2f\xfd\xa0\xcc\x13\x04\x00\x94\x7f\x00\x0a\x8d\xb8\x19\x2e\xb0\x4c\x88\xce\x01\x98\xd0\xc8\xa0\xad\xac\xa9\xb8\xc8\x6c"
-	"\xb6\xe3\x68\xd9\xfe\xa7\xd5\xb3\x0e\x21\x1f\xa6\x14\x8d\x22\x5d\x70\x30\xb0\xd1\x0d\x73\x2a\xf3\xff\xa0\xff\x00\xf0\x03\xaf\x8c"
-	"\x01\x88\x01\x9a\x01\x74\xd2\x3f\xf1\xfa\x13\xce\xcf\xfb\x13\xa1\x17\x70\x3a\x17\x07\x74\xd2\x1f\x70\x3a\xa9\x02\x70\x3e\x9a\x3b"
-	"\x07\x9b\xe6\xd2\x0c\x97\xf3\x36\x78\xb7\x04\xe7\x43\x82\xf3\xf1\xfa\x2f\x0b\x70\x7e\x5f\x66\x10\xe9\x94\x7e\x70\x3a\xa1\xe6\xf2"
-	"\xe1\x25\x5f\x01\x27\xe4\xf5\x9f\x27\xc1\x44\x0c\xc3\x97\xf5\x78\x20\x8d\x83\x21\x01\x05\xee\xb6\x5e\x66\xbf\x7b\xc9\xba\x9c\xcd"
-	"\x3c\xeb\x42\x2c\x77\x35\x6b\x49\x3c\xbb\x20\x86\x74\x36\xdb\x08\x30\xb8\x9d\x87\x61\xf8\xba\x43\xaa\x36\xab\x7d\xf9\xfe\x4e\xbc"
-	"\x05\xdc\xcd\x36\xcd\x76\x0c\x53\x71\x3a\xd3\xd6\x83\xfe\x94\x71\xc6\x00\x30\x13\x74\x42\x7f\xe4\x9d\x66\xb2\xee\xd7\x5c\x3e\x36"
-	"\x0d\xe4\x21\xa3\xfc\x7f\x7d\x7d\x38\x9f\x07\x9c\x09\x52\xc6\x14\xcc\xe9\x8a\xf3\x10\x9c\xf2\xf1\xf5\x09\x07\x7f\x62\x04\x67\xb3"
-	"\x33\x6e\xea\x0f\x2e\x4e\x6b\x2b\xa2\x12\x85\xd0\xed\xb2\x0b\xce\xfa\x18\x69\x73\x0c\x43\x54\x31\x0e\xc0\x30\x55\x74\x28\xf0\x90"
-	"\x51\x9a\x7a\xf0\x5e\x59\x81\x6b\x65\xbb\xbb\x8c\xbf\x33\xf6\xce\x30\x12\x8f\x4d\xc6\x56\xfb\x85\xf5\xc7\x30\xd5\x04\x53\x75\x1e"
-	"\xbe\x6c\xc3\xe5\x2e\x44\xc7\xdd\xd0\x32\x68\x5e\xfe\xce\x78\x61\xaa\x6e\x43\x50\xf0\x5d\xe0\x6e\x68\x33\x88\x5e\x76\x7b\x78\xd8"
-	"\xba\x6f\xab\x33\x6c\x61\xaa\x5b\xc1\x91\xc8\xba\x1f\x5e\x98\xea\xb2\x0b\x5c\x98\x53\xe8\x3e\x59\xf7\x5b\x98\x6a\xc3\xd9\x02\xed"
-	"\x70\x65\x9c\x8e\xf8\xb4\xad\xb6\x30\x12\x07\xef\xe6\xae\xe4\x72\x17\x62\x8b\x7c\x99\x01\xc5\x9b\x5c\xc7\x35\x4e\x63\x38\x7b\x8f"
-	"\x74\x82\xae\xdd\x55\x99\xd5\x38\x9d\xbf\xed\x69\x86\xa9\xb2\xc6\x1b\x77\x7a\x7b\xb0\x97\xac\xfb\x3d\xe3\x47\x5a\xb3\xc6\xdb\x5a"
-	"\x3a\x6b\xb6\xa7\x43\x9b\x31\x0c\x95\xa4\x67\x8d\x3b\xee\x7e\x02\x04\xf2\xdf\xc2\x54\x97\xf3\x3a\xbd\x81\x77\xb3\xda\xcd\x7a\x3f"
-	"\x0c\x28\x9a\x20\x8a\x10\x49\x50\x44\xd1\x49\x1d\x06\x02\xc5\x68\x44\x08\x0b\x06\xc2\xd4\x98\x54\x32\x28\x43\x6a\x34\x24\x04\x04"
-	"\x3a\x29\x35\xd1\x89\x41\x3b\x4c\x28\x5c\x17\x63\x25\x9c\x4f\x04\xe7\x47\x51\x74\xd2\x2b\x1e\x1f\xa7\x19\x3d\x60\x13\xa1\x37\x49"
-	"\x51\x74\xde\x2e\xbb\x0b\x53\x35\x66\x04\x2d\x4c\x64\x50\x09\x92\x28\xa5\x93\xbe\x1a\x70\xb0\x39\x86\x17\x70\x61\x24\x98\xd8\x4c"
-	"\x28\x5c\x44\x3b\x70\xf6\x66\x9c\x3d\x14\x93\xf2\xce\xeb\x77\xe6\x75\x97\x93\xfc\x79\x34\x5b\x5f\xaf\xa7\x33\xba\xbc\xfc\xd3\xf0"
-	"\xe7\xf5\xd6\xdd\x22\xd9\x04\xd3\x49\xbd\xbe\xbb\x34\x43\x44\xf3\x1e\xbb\xcb\xda\xaa\xcc\x06\x59\x09\x67\x83\x0c\x9d\x86\x06\x09"
-	"\xce\x86\xd7\x7f\xb1\xee\xd6\x51\x93\x36\x77\xfe\xf8\x23\x51\x34\xdb\xba\x19\x76\xb9\xd7\x37\x48\xc5\x69\xd7\xdd\x0c\x41\xf1\x34"
-	"\xf7\x47\x12\x3b\x8b\x27\x8e\x3c\xc5\xc2\x49\xb1\xcb\xd3\x49\x29\xa9\xa8\xbf\x99\xb5\xba\xc5\x75\x4d\xd7\x9d\x4b\xd7\x75\xe7\xf4"
-	"\xb2\x3b\xbb\xd0\x62\x31\xa3\xd7\x2f\x1a\x52\x03\xa2\x2e\xe8\x5a\x4c\x49\xf1\x7a\xe9\x8a\x22\x2a\xba\x1a\x8d\x05\x74\x51\x13\x5d"
-	"\xd0\x87\x97\x0b\x2a\xbc\xfc\x34\xb9\x73\x69\xf2\x07\xbc\x8c\x26\x77\x0e\x5e\x1e\x9a\xbc\xc9\x58\x6b\x36\xcd\x66\xd6\xeb\x3b\x8b"
-	"\x1b\x0b\x3a\x29\xc5\xeb\x17\x13\x9d\x26\xe3\xf5\x14\xc5\x98\x93\xe2\xf5\x93\x44\x1b\x8d\x49\x5f\x2f\x51\x0d\xc6\x84\x5e\x1f\x4d"
-	"\x18\x8c\x05\x34\xa9\xe2\xf5\xd0\xa4\x3e\x94\x6c\xed\xc8\x5d\xa7\x33\xca\x43\xb1\xcc\x62\x4d\xe7\x30\xd3\x10\x85\x04\xc7\x97\x19"
-	"\x4c\xc8\x67\xce\xdb\x97\x5b\x18\x6a\xaa\x54\xe6\x43\x56\xa4\x28\x0c\xe7\x43\x86\x4e\x25\x04\x67\x0c\x0f\xa7\xb7\x65\xb1\x2a\xa2"
-	"\x22\x1f\x2b\x73\xfb\x03\xce\x6d\xe3\x74\xa6\x25\x71\x61\x41\x22\x59\xf8\x23\x91\xdc\x39\xc3\xc2\xc4\x22\x1f\xe5\xb2\x2c\x0c\x95"
-	"\xe2\xd1\x39\x34\x69\x63\xbd\x7c\xf7\x56\x70\x66\x62\x59\x98\x8a\x4e\xc6\x01\x35\xa9\xf3\xb0\x02\xce\xd8\xfc\x59\x96\x85\xa9\x1c"
-	"\xb9\x00\xbc\x0e\x01\x1c\x9c\x92\xc5\x09\x44\x99\xb7\xc0\x82\x85\x91\x78\x34\x80\xa9\x64\xfd\x04\x11\x2e\x1e\x30\xc4\x67\x82\xc8"
-	"\xee\x30\xe4\x8a\x08\x06\x36\x04\x05\x67\x4c\x25\x81\x24\x45\x11\x04\x55\x12\xd0\x3b\xbf\x9d\x9d\xd4\x53\xbb\xed\xf5\xe9\x76\x76"
-	"\x72\x88\x7c\x4c\x48\xb8\xbc\x43\x52\xef\x90\x3c\x14\xab\xff\xd3\x3c\xa0\xa0\xf0\x90\xe0\x68\x48\xa0\x80\x83\x2b\x90\x8f\x0d\x4a"
-	"\xa2\x16\x51\x83\x82\x26\x68\x4a\x92\xce\xa8\x79\xbd\xa6\xf3\xbd\x9c\x7a\xe7\x8a\x2f\x2c\xbc\xde\xc1\xc0\x50\xcf\x00\x52\x28\xce"
-	"\x2f\xdf\x6c\x6e\x82\xee\xf2\xf5\x12\x90\x42\x89\x2c\xc4\x96\xd9\x05\xc9\x1f\x86\xad\xaf\xc7\x03\x0a\x0a\x0f\x0e\x09\x28\x27\x90"
-	"\x62\x57\x3c\x36\x77\x4e\xb1\x68\xaa\x8f\x16\xb6\xbe\x24\x0d\x2c\x9c\x41\x58\x91\x87\x04\x09\xa6\x45\x04\x76\x5b\xc7\xce\x58\x6f"
-	"\x53\x25\x45\x50\x02\x83\xe6\x35\xe8\xac\xa6\xaf\x3b\xc9\xac\x03\x45\x27\x74\xf8\xbb\x23\xaa\x1c\xd2\x85\x39\x85\x08\x7d\x59\x88"
-	"\xee\x0e\x29\xe3\x8c\x33\x7e\xba\x4e\x73\xd6\xe5\x23\x66\xfd\xce\xcb\xb6\x2d\x4c\x25\x04\xe7\xce\x5b\x35\x51\x5d\x19\xa7\x1d\xd0"
-	"\x0e\xd9\xbd\xb4\xd6\x65\xcb\x39\x58\x58\xb3\x39\xfc\x1e\xe1\xc9\xe7\x3d\xd8\x47\xd2\xce\x97\x92\xed\x7e\xb0\x9f\x22\xa8\x7e\x61"
-	"\x98\x8a\x62\x8f\xe4\xcf\xe3\x0f\x64\xa1\x18\xe4\x8a\x4b\x9a\x5b\xc1\xaf\x7f\x7c\xaf\x87\xc4\x09\x82\x26\xfd\x83\xc0\xa0\x26\xfd"
-	"\xd3\x68\x44\x93\x82\x0f\xd8\x4c\x55\x04\xab\xf8\xdd\x39\xf8\xf7\x7a\xb0\x06\x0d\x3a\xab\x65\x9c\x71\xc6\x19\x67\x1c\xed\x12\x23"
-	"\xec\xb7\x33\x9e\x26\x5e\x41\xd4\x01\x9d\x53\x44\x3f\x89\x4b\xd6\x95\x68\x9c\xce\x11\xed\x40\x21\x8d\xd3\xb9\x81\x06\x96\xdd\xb2"
-	"\x77\xc9\xba\xd0\x03\x89\x44\x22\x91\x48\x44\x11\xc9\x37\xfb\x41\x95\x91\xce\xe8\x0a\x9e\x2f\xc4\xa6\xe4\x9b\xbd\x3e\xdf\xec\xf2"
-	"\x12\x9d\x74\x91\x13\x08\x93\xd2\x09\x51\x10\x9d\x90\xe2\xcf\xa3\x8a\x07\x8f\xe1\x84\x5c\x71\x84\x29\x35\xcd\xe5\xab\x73\xc8\xc3"
-	"\x49\x00\x01\x8a\xca\x84\x28\xaf\x11\x07\xf5\x90\x08\x81\x9e\xcf\x83\x6c\x38\xb3\xe4\xeb\x77\x87\x17\x54\x14\x31\x21\xca\x9d\x47"
-	"\x4c\x4a\x79\x7d\x08\x4e\x88\x52\x4f\xb1\x10\xf4\x50\x3e\x7d\x9e\xfc\xd7\xc0\xf3\xc3\x70\xbf\x80\x6f\x45\x55\x50\x9d\x83\x33\x57"
-	"\x66\x56\xc4\xc7\x87\xf1\xdd\xc4\x5e\xf1\x70\x62\x7f\xc0\x89\x1d\x7b\x7d\x93\x59\xee\xba\x10\x76\x5b\x0c\xdc\x4b\x5b\xf7\xba\x14"
-	"\x41\x54\xc4\x61\x47\x68\xb9\x4b\x9f\xf7\xb0\x75\xd8\xa1\x1d\x20\xf6\x76\xaf\x0d\x67\x16\x44\xb9\x8b\x61\xde\x84\x02\xc1\x8c\x14"
-	"\x97\x0f\xff\x48\x70\x76\x7a\x6b\xf4\xd6\xe9\xed\x91\x14\x3d\x5c\x76\x83\xa0\x7a\x60\xc3\x19\x16\x11\xee\x3f\x50\xf7\x87\x76\x0d"
-	"\x88\x35\x08\xca\xfe\x54\xc0\xb9\xd1\xec\x8a\x87\x34\x6b\x32\x94\x21\x84\x59\xc3\x69\x9d\x61\x34\x63\x6c\xaf\x0f\xb3\x26\x12\x5a"
-	"\x8e\x43\xc0\x11\x45\x84\x90\x3f\xd5\x13\x4d\xaf\xce\x95\xef\x0d\xa8\xe8\xeb\x9b\x73\x1a\x0b\x63\x45\xde\x61\x2a\x59\x1f\xc9\x88"
-	"\xfa\xe7\x89\x52\x03\x62\x0d\x9c\xcb\xe5\x21\x70\x96\x06\x9d\x5d\x60\x5b\xad\xd2\x20\xb0\xad\xf6\x34\x5b\x5f\xf5\x10\x28\x1e\x82"
-	"\x33\x3e\x4d\xf3\xd8\x56\x7b\x34\x5d\x3e\xe6\x1b\xb7\xf4\xa4\xd7\x58\xe1\xac\xf7\xa2\xcb\x47\x6a\x02\x67\xb3\x3f\xef\x01\x83\xd6"
-	"\xa8\x82\xc3\x96\x39\xa6\x66\x44\x04\x00\x00\x00\x08\x00\xd2\x08\x00\x06\xa4\x59\x16\x66\x69\x94\x35\xe9\x12\x40\xe0\x70\x38\x8a"
-	"\x82\x20\x87\x29\x64\x8c\x21\x04\x00\x10\x01\x08\x00\x02\x80\x00\x00\x40\x00\x00\x00\x08\x04\x10\x02\xc7\x79\x1a\x5c\x0c\x02\x05"
-	"\x21\x44\x2c\x84\x64\x58\xd2\xa6\xd9\x7b\xb8\x7d\xdd\x16\xf1\xce\x35\xda\x4f\x2c\xef\x65\x1b\xdd\xc9\x8d\xe0\xee\x0d\x8f\x81\x43"
-	"\x2b\x66\x42\x69\x85\x6c\x2e\x59\xa4\x76\xea\xc0\x05\x45\x85\x56\xdf\xd9\x0a\xe9\xab\xfb\xcc\x06\xce\x08\x15\xf3\x6a\x3a\x67\xba"
-	"\x23\xf0\xa4\x1b\xd5\x2e\x0d\x83\xb1\x4a\x23\x30\x68\x49\x6d\x75\xa9\xa7\x48\x0e\x4a\x50\xd7\xd1\xd1\x6a\x7a\x61\x0e\xe0\x7e\x20"
-	"\x65\xa4\x7d\x1a\x1b\xb5\x75\xe7\x9b\x34\x21\x3c\x50\x53\x53\xf1\x9f\xbc\x91\x64\x9f\xa6\xab\x72\xe8\xca\x60\xf4\xd9\x7b\xe2\xec"
-	"\x54\xa4\x69\x25\x5c\xd1\xad\x3a\x1c\x2d\xc3\x21\xc1\x06\x25\x22\x28\x89\x00\x36\x3a\x6a\x94\xad\x12\xa9\xa3\x69\x15\x3d\xba\x95"
-	"\x2e\x49\xe8\x5a\x96\xe1\xc7\xc0\x4e\xe8\xd9\x54\xed\x1c\xb9\x35\x5d\xdb\xe5\xba\x26\xba\x15\x07\x76\xe9\x5a\x82\x86\x43\xd1\xad"
-	"\x30\xe4\x93\x56\x9e\xf9\x73\x65\x9e\x39\x6a\x85\x85\x06\xe9\x48\x27\x3b\x3b\x21\xe9\x56\xeb\xa8\x5a\x0f\x53\x08\xf4\xe8\xc4\x50"
-	"\xd8\x52\xd9\xc3\x41\x62\x5f\x57\xc3\xcf\x28\x2d\x34\x2e\x45\x53\xb5\xa6\x91\xed\x15\x94\x90\xc8\x0f\xa0\xcc\x37\xad\x73\x08\xf5"
-	"\x4a\x2a\x0d\x08\x9a\x9b\xab\x52\xb4\x8f\xb3\x96\x54\x53\x51\x60\x0c\xfa\x8e\xe1\x35\x63\x17\x5e\x71\x87\xff\xd6\xf8\x18\x8d\x73"
-	"\x9e\xf1\x74\xfd\xa2\x1a\x86\x32\x5e\xc3\xde\xcf\x99\x74\xce\x1c\x8b\x02\x21\x1e\x27\xac\xa9\x6c\x66\x93\xba\x29\x8c\x67\xb1\x61"
-	"\x7c\xe8\x71\xe2\xe0\x39\x62\xbd\xf9\x53\xad\xf6\x62\xcc\x2e\x85\x7f\x32\xa1\xc9\xf9\x4e\x01\x55\x34\xe1\x57\x93\x14\x89\xb8\xa7"
-	"\x89\x6a\x39\xa5\x7d\x56\x8b\x5e\x46\x28\x49\x87\xf4\x1d\x4c\x62\xf2\x3d\xc0\x28\x04\xba\x39\xa4\x4d\x16\xf6\xf1\x81\x07\x6f\x43"
-	"\x2b\xd6\x14\xfe\xbd\xaa\x6c\x71\xb0\x79\x31\x9b\x7d\xbb\x4d\xd0\xe7\x8d\x87\xc3\x21\x96\x80\xcf\xd5\xb6\xbc\xa9\x97\x7f\x47\x63"
-	"\xa4\xcb\x90\x84\x59\x10\x8f\xff\xc2\x4f\x8c\x06\x0d\xcf\xc1\xa7\xe1\x4b\x86\x7a\xae\x79\x63\x34\xb4\x22\x6d\x90\xcf\x0f\x67\xda"
-	"\x26\x1a\x45\xa1\xf7\x46\x0b\x68\x8e\xb2\x54\x56\x4c\x52\xb3\x02\x3e\x05\x45\x1d\x5b\x27\x55\x77\x96\x4a\x2c\x61\xe5\xd8\xfd\x0d"
-	"\x3c\x5f\x0f\x77\xeb\xb2\x30\xd0\xd0\xd9\x71\x08\x0f\x64\x09\x6c\x2d\xb5\x99\x12\x98\x90\x01\x78\x45\x80\xee\x6c\xad\xf9\xa4\x1f"
-	"\x7f\x3a\x82\x11\xf9\x9a\x14\x15\xf9\x67\x8b\xac\x5f\x5d\x38\x62\x86\x44\xec\x97\x50\xbf\xbe\x39\x24\x61\xde\x11\x6c\x79\xf9\x87"
-	"\x0b\xe2\xb3\xa4\x0d\xa6\x17\xe9\x6a\x48\x28\x8f\xd1\xe4\x18\xf4\x5e\x17\xe8\x8d\x57\x41\xee\x9a\xea\x37\x52\xd6\x39\xeb\xad\xe0"
-	"\x13\x78\x01\xee\x42\x9b\xc3\xfd\x5b\x48\x93\xc7\xbf\x5a\xde\xa9\x1f\x79\x56\xbd\x8e\xde\x02\xd2\x02\xed\x27\xd1\x02\xa5\xbf\x45"
-	"\x53\x8c\xf0\x12\xf2\x86\x85\x79\xc4\xb4\xd8\x48\x0b\x15\xec\x7c\x9c\xfe\xaa\x0e\x0e\xc8\x31\x1b\xbb\xb6\x53\xaa\x0e\xba\x39\x1a"
-	"\x2a\x6d\x22\xc2\x11\x3b\x84\x23\x90\x01\x73\xec\x45\xbc\xf6\x70\x0f\x75\xa8\xcc\xef\xc8\xe8\x6e\x8c\x04\x36\x2e\xeb\xdf\x09\x12"
-	"\x38\xe8\xf4\x95\x0b\x26\x36\x92\xaa\x8d\xcb\x15\x60\x28\x43\x00\x90\x41\xd3\x96\x89\x64\x64\xc1\x09\x12\x52\xe3\x5c\x15\x37\xf8"
-	"\x36\x7e\x67\x4c\xb0\x47\x05\xb1\xb2\x83\x02\x44\xce\x60\xb5\x41\xc3\xb3\xed\x68\xae\x19\x14\xd7\x2a\x78\xef\xa8\x95\x59\x82\xf0"
-	"\x19\x43\xc0\x8c\xe8\xe8\x33\x8d\x10\xd0\x2d\x7b\xe3\x12\xb8\x45\x30\xc0\x60\xdb\x5e\x13\xa6\x75\x69\x11\xd4\x59\xed\x10\x28\x16"
-	"\x56\x6d\x96\x70\xd8\xb5\x54\x68\x0e\xbe\x21\x0f\xfb\xac\x8b\xbb\x04\x6d\x82\xad\x69\x19\x20\x8e\x06\x68\x33\x9b\x23\x57\xc9\x3d"
-	"\xa3\x16\xf1\x3d\x04\xe6\xcc\x65\x17\x02\x1f\x83\xa8\x37\x78\x2d\x64\x83\xb4\x83\xa3\xba\x33\x68\xaa\x19\xa7\x6a\xe9\x6a\x0c\xd8"
-	"\x3d\x36\x3c\x17\x30\x8b\x95\x67\x6d\x73\x4e\x01\xa2\x35\x8c\x2f\x2b\xd7\x78\x64\x63\xf2\x97\x9f\x41\x91\x67\x70\x2d\x08\x0f\x21"
-	"\xaf\xe1\xc7\x16\x71\x4a\x12\x3a\xc9\x54\xda\x18\x2b\xbd\x58\xc0\x30\x97\xb9\xa9\x52\x79\x6c\x33\x6f\x83\xe2\x52\x67\x9a\x94\x6a"
-	"\xcd\x8d\xe7\x51\xc7\xc5\x95\x8c\xf9\xe5\x98\xec\x59\xbb\x30\x48\x7a\x07\x2b\x36\x93\x1a\x28\x52\xfe\x65\xab\x8a\x4a\x0b\x8b\x2a"
-	"\x86\xc9\x42\x2d\x6e\xe9\x24\xf5\x25\x65\x3b\x98\x3c\xf4\x3f\x2d\xb7\xe3\x14\xf7\x83\xa9\x2d\x87\x30\x90\x52\x27\x30\xe3\x47\xde"
-	"\x2e\x90\xc8\x20\xcb\x26\x8a\x10\xab\xa8\x7a\x56\x5f\x34\x58\x1a\x95\x62\xc8\x32\x38\x0b\xe2\x56\xfe\xd0\xe8\xc5\x10\xc1\x20\x2e"
-	"\xa5\x05\x91\x40\x5d\x7e\xb7\xa8\x87\xe4\xec\x07\x50\x94\x19\x09\x48\xd6\x8c\xe7\x32\x7d\x86\xe5\xa7\x3e\x02\x2d\xdc\x1c\x8b\xff"
-	"\x5d\xd6\x70\xb3\x7c\x61\x48\x05\xd3\x12\xc9\x67\x72\xc9\x8d\xd7\xc9\xad\xad\x18\xde\x46\xcf\xec\x92\x06\xac\x31\x03\x6d\x29\x50"
-	"\x45\x26\xff\x09\x4c\x42\x5e\x55\x25\x3b\x42\x34\xf8\x48\x58\x5f\x15\xb1\x88\x88\xe3\xf1\xb6\xc2\xad\x4e\x7c\x1e\xc8\xe5\x31\x08"
-	"\x85\x17\xb5\x75\x01\x8d\x4c\x00\x8d\x89\xa5\x8d\xcf\xcd\xf9\x09\xcd\x66\x2a\xdb\xc0\x3f\x23\xac\xc5\xe6\x5c\xbe\x08\x87\x58\x53"
-	"\x58\x86\x16\x7b\x86\x20\x64\x92\x8f\x1e\xe5\x0d\x2f\xc2\x76\xfe\x84\xc5\xb0\x8d\xbd\x27\x8d\x98\x30\x5c\xdd\xb4\x97\x8c\x61\xe2"
-	"\x30\x48\x7f\xbc\x06\xfe\x3b\x8c\xc1\xb0\xc4\x57\x53\xbd\x43\x62\x23\x22\x22\x86\xe1\x1c\x28\x0c\x6b\x96\x5c\xa5\xc9\x60\x22\x5f"
-	"\xb2\x62\x4a\x48\x12\x37\x93\xba\x65\x02\xd8\x5c\x57\x08\x32\x10\x09\x8c\x19\xed\x7f\x74\x33\x01\x6c\xa4\xc2\xa4\x3d\x58\x38\xb7"
-	"\xe6\xa1\x9e\x12\x2d\x2d\xcf\x32\xf5\xac\xa3\x9d\xd1\x26\x62\x32\xcb\x8d\xac\x2a\x46\x5a\xf6\x01\xdc\x8a\x17\x12\x40\xee\x3a\x43"
-	"\xc2\x94\x40\x04\x1a\x11\x25\xce\xab\x50\x89\xe3\x59\xd1\x2d\x70\x67\x54\x3a\xb1\x19\x65\x70\x88\xad\x65\x30\xc4\xfc\x75\xf6\x2b"
-	"\x59\x81\xbc\x19\x11\xa7\x14\xc3\xf7\x36\x8d\x56\x8d\xbc\x2c\x19\x76\x7f\x4b\xfe\x2e\x06\xac\x43\x46\x9c\x31\xad\x25\x12\x3b\x93"
-	"\x25\x1a\x94\x66\x35\x2e\x6a\x80\x03\x42\x8d\x83\x42\x46\xf5\x08\x0e\xa3\xc0\x36\x0c\x4a\x96\x04\x1a\x4b\x1a\xca\x2d\xf2\xda\xdf"
-	"\x36\x07\x76\x4e\xef\xa6\xc0\x12\x2e\x77\xd7\x39\x22\x16\xa4\x7b\x32\x93\x84\xc2\xc7\x8c\x99\x10\xc8\x8f\x1e\xd7\xb6\x48\x9f\x6c"
-	"\x19\xee\xfc\x48\x34\x0f\x82\x2d\xab\x0a\x26\xd5\x8b\x58\xed\xe4\x34\xae\xda\x8d\xe3\xbf\x5c\xf9\x32\xb2\x74\xad\xf8\x52\x6e\xb4"
-	"\x01\x35\x0d\x10\x83\xd6\x15\xb8\x40\x53\xba\x8b\x1c\x2f\x9e\xb0\x4d\x71\xfe\xb0\x0e\xca\x21\x83\x9c\x0d\x7a\x8c\x07\xf3\xe8\x08"
-	"\xc6\x03\x8b\x7c\x09\xdf\x59\x15\x7b\xe0\x70\x23\x6f\xa8\xde\x9b\xc2\x83\xac\xc2\x1c\x09\x32\x37\xa7\x18\x15\x02\xc5\xb0\x8b\xfc"
-	"\xbe\x31\xc8\xd8\x9b\x83\x89\xd0\xe9\x09\xe2\xf4\x2a\x93\x8b\x00\x84\x81\xa0\x76\xf1\xc0\xc2\x87\x1d\x14\xa6\xd2\xc5\x8e\x03\xc6"
-	"\x37\x7a\x6c\x98\x93\x15\x88\x3a\xc9\x3c\x98\x43\xc1\xa0\xd4\x95\x8c\xb4\xc8\xd8\xd0\x06\x46\xed\xbd\x53\xe1\xe2\x1d\x7e\x59\xe0"
-	"\x75\x2e\x23\x10\x83\x53\xc8\x0f\x48\xe3\xdd\x44\x61\x8d\x6c\xd6\x86\x14\xca\xc9\xe5\x01\x14\x86\x3d\xa2\xb6\xd2\xed\x42\xc2\x55"
-	"\x0e\x22\x4a\xef\x8f\x27\x1e\xe0\x04\x1d\xf4\x64\xf7\x83\x12\xe7\x5d\xca\x3a\x79\xe7\xa6\x86\xd8\xe8\xab\x9f\x77\x74\xef\xda\x69"
-	"\x3c\xd5\x1b\xb6\x6f\xc1\x2e\xd1\x27\xbf\x90\xe6\x28\x65\x42\xe4\x50\x64\x2b\xdc\x09\xbe\xf8\x92\x33\xcc\xe0\xb0\xe8\x21\xe9\x59"
-	"\xe7\x9b\xfc\x0e\x18\xd4\x20\x6b\xa0\x00\xa8\xac\x25\xe8\x99\x6d\x76\x85\x8f\x0a\x73\x2b\xcc\x47\x0b\x85\x06\xba\x1f\xed\xf8\x38"
-	"\x47\x88\x15\xb3\x4e\x41\x4a\x6e\x92\x30\xcf\xca\x90\x87\xc1\xf2\x71\x9d\x3d\x57\xca\x54\xd2\xd1\xd0\x8f\x8c\x3b\x57\x77\x66\x34"
-	"\xa1\x61\xfa\x79\xb7\x1b\x95\xbc\x25\x06\xa1\xa9\x01\x8c\x29\x42\x87\x04\x44\x6c\xcf\x78\x1d\xce\xe4\x4c\x5e\x78\xf4\x4a\x11\xbf"
-	"\x05\x31\x7d\x5a\x9e\x5a\x3d\xff\x6a\xf6\xa2\xc6\x60\x26\xf2\x57\x6b\xe1\x4b\xcb\xfc\xcf\x99\x49\x7d\x62\xe5\xe0\x85\x4a\x8b\x8d"
-	"\xe1\x53\xe0\x04\xe5\xb9\x79\x01\xca\x5d\x1d\xe8\xbf\x0a\x2b\xca\x38\x13\x05\x05\xb2\x51\xcc\xa6\xc3\xac\x25\xa2\x74\x21\x99\x6a"
-	"\x11\x6a\x8e\x24\x7c\xd0\xa2\x5b\x9c\xe1\x72\xb7\xf4\xc7\x50\xda\xc0\x22\xa8\x7e\x22\x8d\x01\xff\x9f\x7f\xc4\x4b\x3e\x53\xf4\x3f"
-	"\x5b\x65\x5c\x5d\x4b\x3d\x10\x01\x08\x37\x1e\x2f\x2a\x6a\x30\x0c\x89\xe2\xb2\xaf\x1f\xc5\x50\xdb\xbd\x1e\xb2\x15\x4b\x06\x47\x35"
-	"\x22\xac\x4f\x56\xc9\x2f\x94\x81\x0c\x48\xfb\xd7\x51\xbe\xbc\xe3\x15\x42\x79\x24\xff\xdc\xd5\xcb\xd4\xc2\xaa\x02\x25\x07\x48\xc3"
-	"\x9a\xdc\xf7\x9e\x74\xcd\xc2\x76\xe4\x07\xc7\x88\xcf\x89\xcf\x19\x26\x13\xa1\xbd\xf6\xd0\x2e\xa9\x92\x3a\x36\xac\x9f\x56\xe4\x50"
-	"\x5d\x18\xd3\x72\x68\x0e\x09\xca\x51\xf5\xcb\xbf\x41\xf5\xd7\x82\xa7\x52\x69\xb9\x0e\xa3\x02\x53\x5b\xfa\x05\xd6\x4c\x4c\x16\xde"
-	"\x56\x98\xdd\xb3\x48\x8a\xb5\x32\x58\xac\x02\x0d\x0f\xc2\x21\x8c\x7d\x52\x78\x6e\xd4\xf4\x32\xbe\x1f\xaf\x2d\x9a\x00\x87\xee\x57"
-	"\x34\x68\xbd\x8d\xa0\x34\x61\x6a\x84\x35\x1a\x18\x27\xb9\xc7\x15\xe6\x1e\x0d\xf8\x46\x31\xe2\x71\xa4\xb7\x53\xc8\x04\x35\x4c\x6d"
-	"\xcc\x2e\x80\x00\x72\x2c\x5c\x00\xf8\x27\x06\xc9\x12\x0d\x20\x09\x90\xb3\x8a\xda\x11\x76\x1a\x11\xa0\xd0\x70\x7b\x70\x8d\x9c\x75"
-	"\x88\xea\xf4\x14\x06\x49\x25\xc7\x41\x29\x7a\x72\x27\x98\x03\x5a\x14\xc5\x44\x81\x3d\x24\x6f\xd7\x29\xda\xd4\x3f\x78\x3c\xa8\x89"
-	"\x36\xb9\x68\xa3\x80\x53\x54\xf1\x34\xf9\x56\x1f\x25\x94\xd5\xf3\x07\x8a\x81\x0b\xaa\x82\x33\x70\x6c\xd3\x61\xb6\x8c\x50\x90\xbf"
-	"\x60\xae\x60\x80\xac\xc8\x07\x99\x3b\x6f\x19\x62\x38\x6c\xf0\x2d\x1b\xcf\xdf\xd3\x5b\xe8\x8d\x74\x55\x3c\xf2\x2a\x83\x1b\x35\x19"
-	"\x9d\x3e\xfc\xd4\x81\xa5\x86\x27\x91\x2e\xf9\x8f\xa4\xb4\x29\x5e\xe4\x67\xc3\xe2\xb9\x6d\x52\x8c\x1d\x81\x41\xac\x95\xe0\xa0\xd4"
-	"\x6e\xc0\x7d\x04\x3a\x89\xf6\x25\x9c\x03\xa4\xf3\x82\x62\x0e\x20\x6b\x8f\x44\x88\x43\x16\x6b\xfd\x8c\xfe\x87\xcc\x4f\xb4\xe6\x11"
-	"\xcd\x42\xc1\x61\x52\x50\x61\xa4\x38\xd2\xc0\x27\xe0\x5b\x1e\x84\xc5\x8b\x66\xdd\xcb\x3a\x71\x28\x2a\xbe\x78\x6c\x06\x2f\xf3\xb5"
-	"\x2d\xe6\xb8\x4f\x2d\xa5\x0d\x65\x8d\xa3\x24\x08\x8f\x66\xd0\x06\x61\x2c\x95\x32\x56\x11\xa2\x39\xf9\xba\xc2\x68\xeb\x21\x6f\x4f"
-	"\x44\xd9\x34\x55\xb9\x86\xab\x01\xdc\x4e\x5a\x48\x00\x88\xb5\xc7\x09\xfc\x49\x60\x82\x9a\x8b\xbc\x83\x50\x68\x96\x3e\xa0\xcd\xd6"
-	"\xd0\xd6\x43\xba\x69\xa5\xbc\xd9\x31\x53\xb3\xa0\xce\xc1\x33\x23\xb8\x37\x28\x2a\x81\xfc\x8f\x54\xb3\xc0\x9e\x24\x0d\x6f\x0a\x0a"
-	"\x61\xcf\x83\xb7\x3a\xcc\xb2\xf3\x86\x48\x04\x76\x8e\x71\x7c\x9f\x76\x7e\xb0\x68\x33\x15\x39\xee\x6f\x7f\x64\x8a\x60\xf4\x94\x10"
-	"\x00\x93\x89\x1c\x11\x61\x44\x08\x71\xf9\x50\x1e\x02\x02\x42\x62\x41\x5d\x76\x81\x68\x82\xa0\x60\x08\x09\xca\xb8\x41\x24\xa2\xe4"
-	"\xbd\x29\x79\x47\x1a\x97\xb3\xc6\xe5\x18\x41\x4f\xec\xf4\xf6\x87\x46\x68\xae\xd9\xfa\x5a\x16\x66\x8b\x88\x88\xa8\x54\x68\x14\x41"
-	"\x50\x18\x3a\x51\x04\x41\xe0\x94\x07\x27\x88\xeb\x69\x84\xe6\xea\x3f\x49\x97\x8f\xcd\x04\x62\xbc\x34\xa0\x08\xba\x9b\xf5\xe4\x53"
-	"\x77\xb3\x4e\x20\xe3\x06\x91\x08\xaa\xbb\x16\xbe\x32\x9e\xa4\x28\x22\x8c\x08\x2b\x0d\x01\x80\x9b\xa0\x11\x4a\xa3\x01\x45\x0b\x51"
-	"\x05\x89\x29\x62\x08\x22\x84\x43\x76\x78\x55\xb3\x41\xee\xf0\x09\x8a\x65\xf8\x34\x5f\x22\xaa\x97\xe5\xa4\x6d\xd4\xcb\x72\x0a\xab"
-	"\x92\x4f\x30\x99\xba\x2d\xf4\x9f\x5f\xa3\x90\x3d\xaa\xde\x5f\xf3\xd5\xb9\xee\x48\x36\x80\xfb\xd9\x25\x5e\x1c\x92\x2f\x89\x72\x3f"
-	"\x9c\x24\x8a\x27\xe2\x88\x91\xd7\x7a\xe4\x99\x42\xce\x1f\x15\xaa\x62\xa4\x1e\xaf\xfb\xce\x6c\x5a\xae\x91\x89\x9a\x97\x1b\xad\xdd"
-	"\x3a\xcc\x32\x1d\x80\x1d\x88\xd3\x47\x1d\x2d\x72\x2e\x5a\x8e\x15\xed\x33\x1b\xad\x89\x68\xff\xe0\xc3\x55\x42\x6a\xda\xf4\xbb\xff"
-	"\x43\x88\xba\xb5\x6b\xc1\x16\x1d\xef\xda\x9f\x26\x82\xdf\xdc\xbf\x93\x2e\x9f\x2d\x67\x1b\x94\xdd\xde\x15\xff\xab\x10\x60\x6b\xc6"
-	"\xb0\x8d\xa3\xad\x18\xff\x21\x9b\xa1\x92\xf0\xe2\xf9\xc5\x4e\xde\xfe\x0a\xf8\x31\x7f\xa3\x21\x7b\x39\x5c\xc1\x65\xae\x8e\x81\xe9"
-	"\x47\x92\x76\xbb\x05\x94\xba\x3e\x02\x4b\x57\x83\xcc\xa1\xc4\x67\x25\xf6\x34\x25\x66\x2f\x64\x1a\xc3\x77\x05\x12\xc4\xc1\x8c\xa2"
-	"\xb9\x91\x8b\x14\x09\x70\x6e\x05\x53\x96\xd6\xa1\x52\x2c\xb7\x0e\x3b\x4b\xcf\x6d\xfb\x57\xb6\x58\x4f\x3e\x4a\x49\x68\xd3\x62\xb8"
-	"\x44\xf8\x21\x93\xe6\xd3\xe2\x6c\xa0\xba\xc2\x59\x70\x52\x3e\x38\xf8\x8b\x16\x7c\x0e\xa1\x6f\x62\xb9\x50\x5e\x49\x0e\x7b\xde\xb3"
-	"\xd0\xa4\x68\x85\x04\xe3\x58\xc0\xb3\x10\x96\x48\x0c\x3e\x61\x62\xf6\x0b\xce\xce\x4a\xc0\x55\x34\x6f\xa1\x63\x82\xee\x33\x01\x18"
-	"\xd8\xaf\x63\xa7\x70\xd0\x43\xd1\x02\xab\x8e\x64\xe1\x44\x61\x03\xff\xe5\x58\x0a\x40\x6f\xa2\x7f\x31\x14\xa1\xef\x4e\x6e\x58\x74"
-	"\xe1\x50\x5d\x9a\x48\x0a\x27\xb0\x6e\xfb\x53\x4d\x4c\x37\x54\x7b\xed\xa2\xb4\xaf\xf1\xc8\xf9\xb5\x5f\x59\xbd\x9a\xd0\x6c\xcf\x3a"
-	"\xd9\xcf\x21\x05\xba\x86\xdc\x0b\x44\x3f\xc5\x44\x5b\xfb\x0e\x81\xe8\x8b\x3c\x45\x00\x00\x08\x0a\x01\x00\xc8\xd3\x03\x21"
+	"\x28\xb5\x2f\xfd\xa0\xf2\x15\x04\x00\x14\x82\x00\xfa\x8d\xe8\x19\x2f\xc0\x4c\x88\xcc\x31\x00\x0b\x21\x6b\x54\xd9\x08\xc2\xb2\x43"
+	"\x48\x7d\x5d\x46\xdd\x2d\xd7\x62\xd7\x8f\xda\x16\x43\x60\xaf\xb1\x6a\x50\xac\x73\x31\x7c\xac\xb3\xd8\x7f\x53\x14\xf4\xdf\x4e\x04"
+	"\x90\x01\x8a\x01\x9d\x01\x9f\x37\x21\x9d\xf4\x12\x5a\x97\xdf\xec\xb8\x4b\xf8\xbc\x80\xd3\xa9\x40\xa0\x93\xfe\x80\xd3\x49\x17\x78"
+	"\xb3\xa1\xb9\x73\xaf\x69\x2c\xcd\x70\x35\x6e\x7b\x77\x47\x6f\x36\x44\x6f\x36\xbc\xfe\x8b\xc2\x9b\x5d\x97\x17\x80\x74\x46\x47\x38"
+	"\x9d\x4f\xf3\xf8\xcf\x8a\xaf\x78\xd3\xf1\xfa\x8e\x73\xc0\xc0\xeb\xc2\x56\xd5\x20\x1d\x4d\x83\x21\x01\x06\xee\xb6\x1c\x66\xbb\xfb"
+	"\xa8\xba\x9a\xc5\xb8\xea\x3a\xac\x76\x27\xb6\x72\x70\xec\x7a\xd8\xb1\x59\x6c\x23\xb0\xc0\xdd\xb8\xeb\xc2\xd6\x1b\x11\x95\xd9\x49"
+	"\x97\xef\x6f\x84\x53\x40\xbb\x58\x36\xb1\x1b\xc3\x50\x9a\xc6\x74\x05\xa1\x2f\x65\x9c\x31\x00\xcc\x03\x3a\x9f\xcb\x78\xa7\x91\xaa"
+	"\xdb\x35\x8f\x87\x4d\xe3\x80\xc0\x24\xff\x5f\x5f\xff\x4d\x29\xbd\xa9\x10\x65\x2c\xc1\x9a\xae\x38\xff\xbc\x19\x0f\x5f\xaf\x80\x70"
+	"\x09\xa1\x37\x9b\x9d\x71\x53\x8f\x60\x69\x5a\x57\x94\x0a\xf4\x3d\x77\xc3\xae\x37\xeb\x21\xa4\xcd\x2f\x1c\x41\x41\x38\x00\xc3\x50"
+	"\xb0\xc1\x00\x04\x26\x69\xea\xbd\x6b\x65\x06\x6e\x95\xed\xde\x32\xfe\xce\x98\x3b\xc3\x38\x38\x6c\x32\xb6\x93\x5b\x58\x77\x0c\x43"
+	"\x3d\x60\xa8\x8d\xc3\x96\x75\xb8\xda\x8d\xd8\xb4\xfb\x59\x86\x09\x97\xbf\x33\x5e\x18\x6a\xdb\x11\x12\x7c\x17\xb4\xfb\x59\xec\xa1"
+	"\x96\xcd\x20\x20\xb2\xed\xdb\x6a\xec\x5a\x18\xea\x56\xf0\x03\xaa\x6e\x87\x17\x86\xb2\x6c\x03\x16\xd6\x18\x6c\x97\xaa\xdb\x2d\x0c"
+	"\x95\x61\x4c\x01\xfd\x60\x61\x9a\xa6\x5c\xda\x76\xb2\x30\x0e\xee\xdd\xad\x5d\xc8\xd5\x6e\x44\xf6\xe8\xf2\x02\x12\x2e\x72\x1b\x9f"
+	"\x68\xfa\xc2\x99\x3b\xa4\xd2\x63\xed\x8d\xc2\xec\x44\xd3\xb9\xdb\x9c\x66\x18\x2a\x6b\xbc\xf1\xa6\x33\x08\xfb\xa8\xba\xdd\x33\x3e"
+	"\xa4\x35\x6b\xbc\x6d\xa5\xb1\x66\x73\xfa\xb3\x18\xc3\xd0\x28\x7a\xd6\x78\xd3\x6e\x27\x40\x08\xef\x5e\xef\xd5\xf8\x6e\x61\xa8\xab"
+	"\x71\x9b\xce\xbc\x9b\xd9\xc9\xcd\x7a\xcb\xc5\x03\x49\x0f\x4d\x80\xa2\x07\x9a\xe8\xa4\xce\x22\x61\x5a\x30\xa0\x04\xc5\x22\x41\x62"
+	"\x4c\x1a\x17\x74\x11\x31\x18\x51\x42\x02\x9d\x74\x92\xa8\xc4\xa0\x1f\x22\x12\x6d\x83\xb0\xf2\x4d\x09\xbd\x39\x4d\x74\xd2\x27\x0e"
+	"\x0f\xa5\x09\x49\xaf\xa1\xe8\x2c\x4e\x13\x9d\x77\xc3\xee\xc2\x50\x8c\x09\x3d\x0b\x03\x17\x34\x7a\x22\x4a\xe9\xa4\xaf\x06\xdc\x6b"
+	"\x7e\xe1\xc5\x5b\x18\x07\x0c\x6c\x22\x12\xed\xa1\x1f\x34\x7b\x33\xc6\x24\xbd\x62\xbc\xf3\xfa\x8d\x71\xdb\xd5\x20\x97\x0d\xcd\xd6"
+	"\xd6\xeb\xe9\x84\x1e\x1f\x2f\x1d\x2e\x5f\x5f\xdd\xec\x81\x45\x30\x9d\xd3\xeb\x37\x4b\x33\x3c\x26\x5c\xc3\xde\xb2\xae\x2a\xd3\x21"
+	"\x56\xbe\xe9\x10\x3f\xc7\xc1\x21\x7a\xd3\xe1\xf5\x5f\xaa\x9b\x6d\xd3\xa4\xcd\x9d\x37\x5c\x42\x12\xcd\xae\x2e\x76\x5d\xed\xf5\x0e"
+	"\x9b\x4e\x9c\x6e\xdb\xcd\x11\x12\x4e\x6b\x97\x10\xb8\x59\x1c\x71\xe2\xe9\xf5\x4d\x7a\x3d\x9e\x4e\x3a\xc5\x44\xfd\xc5\x6c\xb5\x29"
+	"\x2c\x4b\xb2\xee\x3c\xb2\xac\x3b\xa7\x96\xdd\xd8\x7d\x14\x8a\x09\xbd\x5e\xc1\x88\x18\xcf\x64\x3d\x96\x62\x46\x89\xd7\x47\x16\x04"
+	"\x4d\x90\xc5\x60\x28\x1e\x6b\x92\xa8\x82\xfe\x7b\x54\x4c\xdf\xe3\xa5\xc8\x9d\x47\x91\x4b\xef\x11\x8a\xdc\xb9\xf7\xf8\x27\xf2\x26"
+	"\xe3\x49\x93\x4d\x2c\x56\xbd\x7e\xb3\x98\xa1\xa0\x73\x4a\xbc\x5e\x21\x51\x69\x2e\x5e\x3f\x4d\x8b\x29\x25\x5e\x2f\x45\x94\xc1\x98"
+	"\xf4\xf5\xd1\xc4\x58\xcc\xe7\xf5\x50\x64\xb1\x50\x3c\x93\x26\x5e\xff\x44\xea\x3f\xc8\xd6\x8d\xbc\x6d\x1a\x93\x48\x7a\x61\x16\x4f"
+	"\x74\xfe\x30\xed\x60\xa0\xd0\xe8\xf2\x02\x0f\xe2\xb3\xc6\xed\xab\x2d\xcc\x24\x55\x2a\xb3\x21\x56\x22\xe8\xfb\x66\x43\xfc\x9c\x4a"
+	"\x52\xd3\xbb\xb2\x17\xa5\x12\x0f\x2b\x33\xbb\xf4\x66\x96\x69\x1a\xd3\x10\xb8\xb0\x00\x81\x2c\x5c\x42\x20\x77\xce\xb0\xf0\x60\x89"
+	"\x87\x71\x59\x16\x06\x2a\x71\xe8\xfc\x99\xb4\xb1\x5c\xbe\x7b\x2f\x38\xf3\x60\x59\x18\x8a\xce\x05\xc2\x34\xa9\xf3\xaf\xe2\x4d\xd8"
+	"\x5c\x2e\xcb\xc2\x50\x4e\x54\xc0\xbb\x0f\x01\xdc\x9b\x91\xc5\x09\x40\x18\xd7\x80\x02\x06\x30\x54\xac\xaf\xe0\xa1\x41\x04\x06\x59"
+	"\xc1\x63\x6f\xd8\xf1\x04\x65\x47\x48\x1c\xd8\x11\x12\x8c\x31\x14\x05\x51\x04\x41\xcf\x43\x51\x40\xef\xfc\x6e\x36\x52\x4f\xed\xb6"
+	"\xd6\xa5\xbb\xd9\xc8\x1d\xf1\x50\x41\xe1\xf1\x0d\x48\x7d\x03\x22\xe9\x55\x7f\xd9\x44\xc0\x80\x01\x84\x42\xc3\x21\x81\x02\x10\xbe"
+	"\x20\x1e\x32\xa6\x68\x52\x40\x8c\xe9\x91\x9e\x19\x45\x3a\xa1\xe6\xf5\x13\x9d\xaf\xe5\xd4\x3b\x4f\x7c\x61\xe1\xf5\x0d\x06\x86\x7a"
+	"\x06\x4f\x22\x71\xfe\xf8\x66\x6b\x15\x6c\x8f\xaf\x87\x78\x12\x09\x64\x23\x32\xcc\x2e\x40\x2e\x19\xb6\xb6\x1a\x22\x60\xc0\x00\xa2"
+	"\x01\xf1\xa2\xe4\xd1\xeb\x89\xc3\xe6\xce\xe9\x05\x49\xf5\xd0\xc2\xd6\x16\xa4\x41\x85\xb1\x88\xea\x01\xa1\x40\x81\xa4\x98\xc0\x6e"
+	"\xdb\xd8\x19\xeb\x4c\xa2\x22\xe8\x51\x60\x98\x70\x0d\x36\x3b\xd1\xd6\x8d\x60\xf6\x41\xa2\x15\x36\xdc\xbd\x01\x51\x8d\xc8\xc2\x1a"
+	"\x03\x8a\xb6\x6c\xc4\xf6\x46\x94\x71\xc6\x19\xcb\x6d\xd3\x5a\xf5\x78\x0a\x8e\xec\xbc\x64\x19\x54\xf9\xbc\xb9\x21\x59\xf9\xbc\x99"
+	"\xa1\xe7\x12\x6e\x3a\xbb\x6c\xb6\xb6\xb2\x46\xda\x74\xb6\x65\xab\x3d\x54\x78\x62\xf3\xd7\x1d\xc2\x11\x48\xf1\x4c\x94\xa2\x1d\xa4"
+	"\x8e\x83\xb0\x87\xa2\x9d\xaf\x24\xdb\x0d\x61\x2f\x41\x4f\xfd\xc2\x30\x14\xbd\x24\xe4\xb2\xe1\xd2\xb1\xd0\xcb\xf1\xc4\x21\xcd\xad"
+	"\xe0\xd7\x77\xaf\x77\x40\xe9\x79\x26\xbd\x4c\x58\x4c\x93\x5e\x32\x18\xd0\xa4\x9e\xf4\x1a\x89\x82\x1e\x05\xbb\x3b\x01\x0d\x36\x3b"
+	"\xc9\x18\xda\x85\x62\xbb\x9d\xf1\x3e\xf5\x4c\x08\x74\x4a\x10\xed\x1c\x3c\xaa\x2e\x64\xa2\xe9\xfc\xd0\x0f\xf4\x99\x68\x3a\x3f\xd0"
+	"\xa0\xb2\x59\xe6\x1e\x55\xf7\x91\x8e\xc7\xe3\xf1\x78\x3c\x12\x8f\x7c\xb1\x23\xd4\x08\xe9\x84\xbe\xe0\xf9\x46\x6c\x49\xbe\xd8\xeb"
+	"\xf3\xc5\x60\x7c\x44\x27\x5d\x22\xf3\x20\x61\x52\x3a\x9f\xe9\x99\x94\xce\x27\x71\xd9\x40\x41\x84\xc3\x6f\x3a\x9e\x78\xc2\x8c\x9a"
+	"\xe6\xf1\xd5\xb9\xe3\xdf\x24\x80\x80\x44\x65\x3e\x92\x57\x48\x41\xa8\x77\x40\xe8\x78\x64\xc7\x39\x32\x8c\x55\x54\x7c\xfd\xde\xb0"
+	"\x62\x82\x28\xf3\x91\xdc\x39\x65\x52\xc9\xeb\x3f\x6f\x3e\x12\x89\x7d\x1e\x29\xb9\xd4\x71\xf1\xdd\x03\x54\xc7\x41\x3c\xff\xfb\xf6"
+	"\x0b\xf8\x4e\xfc\x80\x2f\xa8\xce\xbd\x99\x2b\x33\x27\xe0\xe1\x3f\xf8\x2d\x62\x9f\xf8\x37\xaf\x4b\x6f\x5e\xbf\x5e\xdf\x60\x56\xb3"
+	"\x6e\x84\xdd\x95\x03\xd7\xd2\xd5\xb5\x1e\x41\xcf\x04\x69\xb8\xf1\x59\xad\xe3\x70\x43\x3f\x44\xec\xec\x5a\x16\xa6\x69\x08\xf4\x43"
+	"\x86\xb1\xea\xa1\xda\xbd\x2e\x2e\x22\x91\x60\x42\x89\xc7\x7f\x97\xd1\x9b\x9b\xce\x9a\x4d\x67\x11\x04\x61\xd9\x4c\x02\x2a\x82\x0c"
+	"\x63\x17\x44\xf9\xf6\xe5\xb3\x5d\xd2\xad\xf1\xf0\xe4\x79\xb0\xcb\x8a\x37\x33\x8a\x3d\xf1\x8f\x62\x4d\x7e\xb0\x84\x0f\x6b\x34\xad"
+	"\xb1\x8b\x62\x8b\xec\xf5\x5f\xf3\xf8\xac\xa6\x21\xd0\x80\x28\x9f\xe3\x92\x92\x90\xf4\xea\x58\xf9\xde\x00\x8a\xbe\xbe\xb9\xa6\xaf"
+	"\x0f\x56\xe2\x1d\x86\x8a\xf5\x50\xa4\xd4\x4b\x09\xa3\xc6\xc3\x13\x6f\x2e\x8f\x97\x20\xfe\x9b\xce\xd2\x60\xb3\x0d\x6c\x3b\xa9\x34"
+	"\x08\x6c\x3b\x81\xb2\xd9\xda\xaa\x97\x20\xf1\xcf\x9b\x50\x36\x4d\xc3\xb6\x93\x43\xd2\xe3\x61\xbe\x70\x47\x2e\x72\x4d\xf5\xcd\x7a"
+	"\x0e\x7a\x3c\x9c\x24\x6f\x36\xbb\xe3\x1e\x83\xcc\xa8\x62\xc3\x94\x73\x4c\xa1\x19\x11\x11\x49\x92\x24\xc3\x01\x22\x09\x10\x06\x84"
+	"\x59\x94\x65\x59\x8e\x3b\xaa\x07\x12\x40\xe0\x70\x34\x89\x82\x20\x87\x29\x83\x88\x21\x84\x10\x42\x0c\x11\x11\x11\x91\x40\x44\x44"
+	"\x44\x44\x92\x24\x49\x07\xea\x73\x6d\x3f\x0c\x12\xf3\xe1\x15\xcc\x59\xa6\x34\x44\xc6\x4d\x6c\x5b\xa3\x0d\x32\x01\x49\x96\xdd\x10"
+	"\x9a\x09\xa5\x09\x45\x9c\xdb\xad\xef\xee\xfd\x62\xdf\xf1\xc7\x07\xf1\xf4\xed\x5d\xd7\xb3\x35\x14\x04\x34\xb1\xd1\x89\xee\x6c\x74"
+	"\x59\xda\x8b\x95\x5a\x08\x67\x47\x2e\x73\xbb\x7e\x41\x60\x58\xb3\xbf\x3a\x85\xe8\xeb\x85\x7d\x13\x9a\xd9\x1d\xc2\x1c\x60\xa1\x03"
+	"\x1e\xd8\x38\x9e\x46\xb3\xb6\xb4\xb9\xd1\x79\xbd\x10\x8a\xed\x4a\xdf\x3f\x35\xa2\x1f\xa5\x1f\x9f\x77\x03\xb9\xb5\x11\x4c\x55\xa3"
+	"\xca\x64\xb3\x77\xe7\x3f\xed\x3e\xc2\xb2\x06\xeb\x36\x09\x5b\xe8\x96\xae\xa4\x42\xbb\x3d\xea\x59\xbb\x2b\x23\x26\xcc\x35\x58\xa7"
+	"\x7d\x47\x6e\x4d\xeb\xe8\x72\x5d\x53\x1d\xc4\x81\x5d\x5a\x07\x41\xc3\xa1\xea\xa0\x87\x7c\xd2\xc2\x5e\x99\x67\xe6\x03\x58\x68\x90"
+	"\x40\x4b\xf6\x23\x14\x4a\x6b\x35\x34\xda\x8e\x86\x07\xba\x8f\x4e\x0c\x89\x96\x92\x6b\x38\x48\xdc\x5d\x72\xf8\x19\xe3\xee\xad\x6a"
+	"\x76\xe4\x3d\x99\x54\x6a\x20\x91\x18\x81\x32\xdf\xb4\x97\xe5\xa5\x39\x09\x5d\xf2\xb7\xb0\x5b\xa9\x2f\xe4\xcd\xb9\xda\xb3\x96\xb1"
+	"\x9c\xf9\xd4\x37\x93\x55\xcd\x54\x6d\x66\x62\x38\x66\xf2\xcf\x97\xa9\x1f\x93\x26\xc6\xd1\xe4\x4e\xd3\xf5\x8b\xf2\x7a\xfa\x79\xaf"
+	"\xbd\x1b\xe8\x7f\x87\x8e\xcc\x63\xc9\x14\x44\x2a\xd5\x1b\x4c\xcc\x6c\x2a\x9a\xfa\xf3\x0c\x6c\x58\x98\x60\x93\x5f\xd8\x98\x70\xd7"
+	"\x90\x5f\xa6\x6a\x29\x39\x00\x2e\x97\x27\x97\x0e\xad\xe9\xf6\x65\x9a\x3a\xb4\x4b\x28\x7e\x69\xaa\x09\x87\xb4\x63\x0a\x60\x8b\x9f"
+	"\xc9\x67\x4b\x5a\x55\xa2\xc2\x46\x2d\x44\xce\x8c\xf9\xe0\x27\x36\x80\xc8\x71\x98\x73\x0d\x1f\xb9\xd4\xb0\xa0\x9f\x24\xac\xd8\xda"
+	"\xaa\xa2\xe6\x7c\xe0\xfe\xf1\xfa\xa9\x32\x86\x2e\x63\x08\xdf\x24\x2e\x96\x1e\x3a\x47\xb5\xec\xd4\xa3\xd8\xe1\x6e\x60\x24\x21\x11"
+	"\x49\x4e\xfe\x25\x89\xfc\x8c\x17\x65\xa0\xf4\xe6\x33\x2b\xb3\x22\xb9\xee\xc4\xc2\x9d\x2f\x1d\xda\xf1\xd1\xfc\x99\x71\x1f\x8d\xea"
+	"\xad\xfe\xd8\xb0\x0b\x69\x90\x0a\x11\x69\x4a\x16\x24\x9f\x42\xce\x3e\xe9\xe3\xa4\xc2\xf0\xa5\xe2\x9d\x70\x77\x14\xfc\x8b\xd2\xce"
+	"\x08\x0a\xd4\x04\x0f\x9d\xdf\xa6\x33\x4b\x79\xad\x20\xe2\x5f\x6d\x40\x02\xe6\x94\xc3\xd3\x4c\xf5\xd0\x8a\x11\x8d\x37\x71\x76\xdc"
+	"\xd0\xa9\xfc\xaf\xf9\x7e\x7c\x6a\xdc\xed\x51\xef\x90\xc5\x2c\x2e\x31\xf3\xd5\xc6\xb2\x8a\x28\x71\x00\x2d\xea\x00\xac\xda\x91\x4b"
+	"\x72\xa4\x78\x84\xcb\x4d\xbd\x0f\xd6\x00\xda\x96\x38\xf3\x85\x96\xab\x4c\xf5\x44\x29\x00\xf2\xc7\xc8\x55\xcf\x9a\x4f\xe9\x23\x50"
+	"\x7f\xe1\x6a\x64\xff\x84\x87\x7a\x82\x13\x49\x86\xbf\x1c\x0f\x15\x1c\x42\x28\x58\x2d\xe5\xc1\x51\x76\x21\xe7\x2f\xec\xe5\x18\x1f"
+	"\x22\x0a\xcc\xf1\xc5\xd1\x94\xde\x2a\x68\x34\x83\xa2\x3c\xb6\x56\xd0\xd8\xd4\x2f\x93\xea\xd0\x3c\x2c\x84\x20\xef\x0f\x70\x05\xeb"
+	"\x65\x0e\x48\x14\xbc\xa2\xde\x47\x88\x48\x15\xec\xf1\x4b\x35\x72\x34\xfc\xfc\x14\x04\xc4\xde\x8b\xf9\x5f\x25\x53\x21\x3d\xa8\xcd"
+	"\x2b\x3f\xe1\xe3\xf2\x9b\x2b\xb7\x87\xbc\xe9\xff\x0f\xcc\x44\xaa\x50\x84\xa0\xc1\x66\xb0\x06\x60\xd3\xdb\x32\xad\x4a\x14\x74\x0d"
+	"\x6e\x14\x48\x47\x16\x14\xf6\xd1\x2c\x2e\x04\x3b\x87\xfd\x36\x10\x17\xa6\x2b\xf4\xf6\x22\x1e\x7c\x5b\xce\xd8\xfd\x70\xd9\x2c\xe2"
+	"\x67\x67\x0b\x8f\xc1\xfd\x11\x4d\x53\x84\xcd\x46\xad\xcc\x12\x08\x2d\x0c\x01\x33\xe2\x68\xcd\x34\x42\xf0\x0e\xf7\xc6\x25\x98\x43"
+	"\x82\x01\x1e\xda\xf6\xad\x00\x72\x04\x06\xf3\xa8\xf3\x3b\x49\x20\x62\x00\x03\x24\xc7\x13\x9d\xa6\xa8\xed\x17\xcc\x80\x73\x06\xad"
+	"\x15\xa5\x32\x96\xdb\x64\x24\xed\xba\xb7\x62\x0c\x86\xa1\xbd\x19\x66\xcc\x41\xe1\xf7\x28\x20\x51\x33\x69\x80\x15\x7a\x99\x3a\x15"
+	"\x48\x24\x21\xfb\x18\xde\x26\xdd\x93\x70\xa5\x9f\x27\xa7\x9c\x41\xfd\x2c\xa8\xfe\x12\x15\x56\xaf\x80\xd9\x79\x96\x4b\x05\x8c\x41"
+	"\xe5\xe8\xc0\x9c\x53\xc0\x3d\x84\x17\x88\xec\xca\x18\xf9\x25\x22\x28\x62\x50\x54\x7c\x70\x69\x8b\x47\x4e\x5e\xc9\xc7\x98\x4c\xb6"
+	"\x4c\xf4\x69\xfe\x66\x72\xac\x7a\x99\xc3\x83\x57\x86\x7d\xe0\x8e\x22\xe6\x79\x9b\x85\x94\x30\x91\xe9\x78\x28\x96\x31\xcd\x39\x54"
+	"\x56\xb3\xdb\x0f\x8e\x49\xf3\x75\xd8\x07\xf6\x77\xe0\x77\xde\x28\x97\x7e\xc9\x57\xd9\x02\xa2\xad\xf8\x2c\x4c\x4d\x37\xd2\xea\x37"
+	"\x4b\x75\x9a\xdc\xd0\xf9\x73\x13\xcd\xfb\x12\xe1\x16\x2c\x28\x9b\x94\x08\x95\xd8\xba\x9e\xea\x4b\x52\x43\x87\x53\x13\x9b\xb4\x4d"
+	"\x38\x85\x58\xac\xd6\x1c\x44\x66\xde\x32\x08\x52\xac\x2e\x03\x80\x04\x71\x4e\xa9\xda\x6d\x09\x2b\x3c\x9c\xc2\x24\xcb\x26\xae\x4b"
+	"\xc5\xcb\xac\x90\x54\xca\x01\xca\x87\x54\xa2\x82\x64\x5c\x3d\xd7\xba\xcf\x24\xcf\x28\xb8\x4a\x65\x8d\x73\xec\x61\x45\xf5\x07\xf3"
+	"\x94\x80\xd5\xa6\x48\xab\xca\x4f\xce\x85\x59\xd4\xc8\x8d\xea\xf4\x54\x2c\xe9\x52\x3a\x5a\x11\xc7\x3c\x40\x82\x97\x38\x41\x9a\x7d"
+	"\xb7\x5d\x63\x2a\x2a\x81\x31\xe1\x8f\xb0\xc8\xc6\x06\xe1\x4d\xc4\xfb\x85\x2f\x05\x61\x6d\xde\x76\x70\x1a\xfa\x89\x03\x45\x51\x1a"
+	"\x84\xa2\x45\xed\x57\x13\xda\x4a\x00\x4a\x24\xa4\x1d\x1f\x01\xed\x27\x78\x9b\xf1\xdc\xc6\xd5\x46\x3b\x06\xb1\x21\x17\x5f\xd8\x65"
+	"\xac\x31\xb7\x6a\x21\x2f\x15\x9c\x4e\xf9\xf0\x20\xe2\xa0\x8a\xe0\xc5\x3d\xf1\xf2\x69\x1c\x44\xe9\xd5\x31\x61\x48\x7f\xd3\x2e\x26"
+	"\x51\x27\x19\x03\xcd\x93\xb0\xb4\xdf\xc5\x30\x60\x3e\xf8\xc2\xaa\x77\x44\x6c\xfa\x42\x20\xc4\x84\x0d\x05\xe4\xc5\xb8\x7b\xb8\x7a"
+	"\xf2\x55\x8b\x64\x35\x49\xf0\x24\xfa\xcb\x5a\x7c\x04\xf2\x73\xe5\x99\xc3\xba\x48\xe0\x3d\xb4\x19\xa2\xf3\x49\xc3\xaa\x2a\xcc\xd4"
+	"\xc2\x8a\x41\xda\x13\xf5\x50\xca\xf1\x49\x80\x69\xfc\xf4\x85\x19\x68\x89\x8c\xe0\x0f\x9c\xae\xda\x89\x60\x37\x2a\x58\x2b\x3f\x10"
+	"\x4d\xcc\x80\x8f\xa3\xec\x1b\x52\xd4\x53\xa4\x1e\xf5\x23\x30\xe7\x18\x56\x8c\x14\x28\x33\xee\xe8\xf5\x08\x06\xcd\xf0\x16\x08\x1b"
+	"\xca\xc0\x86\x41\x9a\xde\xad\xd5\xea\xf7\x26\xa3\xa8\x0d\x3e\xa0\xd6\x8c\x6b\xc7\xcc\xcb\xe1\x07\x8f\x4b\x91\xfc\x65\x03\x33\xf3"
+	"\x33\x0b\x46\x0b\xe9\xa4\x4b\x0e\xb9\x14\x50\x8e\xce\xcc\xf6\xd5\x3b\xf1\xb3\xcf\xa4\xac\x04\xdd\xf8\x10\x03\xcb\xaa\x39\x6f\x9a"
+	"\x0d\xa5\x66\xa8\x75\x6c\xfc\x2d\x05\xc1\xe0\xfc\x86\x7c\xc3\x65\xf2\xae\x42\x6d\x56\x21\xd2\x25\x56\x0d\xe4\x6a\x44\xd0\x4c\x5e"
+	"\xe4\xe5\x3c\x82\xb7\xa0\x9d\x7e\xb2\x20\xf9\x23\x5d\x1e\x22\xb6\x7e\x10\x6c\xff\x5e\x9d\x6a\x33\x99\xf1\x53\x6e\x08\xfc\xb3\x94"
+	"\x55\x75\x02\xfa\x49\xfd\xb2\x43\x49\x42\xdd\x01\xe8\x12\x30\xa0\xfc\x72\xd3\xe3\x94\x35\x55\xdc\xa2\x3d\xe4\xd8\x75\x8d\x96\xb3"
+	"\xcf\xb6\x39\xa2\x8a\xd8\xb0\x87\xd3\xa1\x1c\x9d\x6a\xd8\xc6\x92\xfd\xd4\xe7\x08\x7f\xf5\x4e\xb2\xcd\x57\x1c\x21\x0b\xa0\xcb\x80"
+	"\xdc\xa7\xa9\x70\x05\xe1\x78\x78\xf6\xe7\x08\x06\x68\x63\x70\x83\xe5\xb8\x8e\xed\xef\x0f\x8c\x35\x77\x4d\x48\xc1\xc6\x4d\x23\xa1"
+	"\x2d\xd3\x7f\xfe\x31\x33\x7b\x6a\x1b\xdf\x16\x0c\xdd\x99\xba\xc2\x15\x52\xce\xe4\x6b\x0b\xc1\xe0\xf5\x75\x25\x26\xc9\x65\xf6\x0f"
+	"\x16\x44\xfc\xec\x34\xfa\x81\x20\xb6\xc4\xab\xfe\x55\x47\x9b\x9e\x6f\x15\xd7\xa8\x98\x78\x9b\x57\xaf\x6c\xd6\x1f\x93\xa2\x2f\x10"
+	"\x0f\xc3\xdc\x48\x22\xa4\x0a\xcd\xd6\x36\xf9\x51\x04\x37\x87\xf7\x2f\xce\x46\x06\x6e\xf5\x14\xee\x9d\x5a\x5c\xb9\x0c\x37\x55\x2d"
+	"\x40\x7f\x46\x56\x59\x1a\xe8\xe3\xdf\x95\x94\x5b\x80\x62\xc5\xa3\xcd\x40\x0a\x20\xee\x54\x53\xa2\x6b\xf2\xa0\xd8\xb6\x28\xec\x26"
+	"\xa1\x9b\x47\xf9\xf0\x2a\xdc\x55\x55\xa4\xf5\xd0\x95\x13\xa7\x93\x97\x3f\x70\x33\xec\xec\xc3\x60\x6f\x78\x22\x1a\x6e\x33\x4f\xac"
+	"\x35\x06\x08\xa0\x29\xb2\x22\xc5\x73\x4b\x35\x86\x31\x24\x2c\x69\xab\x0c\x1d\xfe\xe6\x0f\x3e\xeb\x9c\x6a\x8b\xac\x72\xaa\xb9\xd1"
+	"\x07\x53\x77\xe0\xca\x2d\x87\x2f\x0b\xf3\xdf\x30\xa1\x8f\x0c\x1d\x53\x0f\xbd\x16\xa0\xf5\x47\x4c\xd1\x88\x11\xd2\x57\x81\x09\xe4"
+	"\x51\x23\xc2\x19\xaf\x8b\x32\x9a\x88\x84\x26\xfb\xcf\xbb\x94\xe1\xd5\xdb\x2d\x22\x34\x46\xc0\xa4\x1e\xe8\x80\x6a\x44\xf8\x62\x4c"
+	"\x0a\x31\x79\xea\x2f\x15\xeb\x15\x3a\xfe\x54\x84\xc9\x69\x3a\xbc\x2a\xe5\xab\x18\x2c\x41\x07\x13\x3e\x7f\xa9\x36\xf8\x46\xb4\x17"
+	"\x69\x39\x33\xbe\x4f\x74\x1b\x1e\xac\xf2\x69\x63\x18\x95\x9c\xa6\x7b\x2e\x29\x00\x19\xa7\x9b\xf8\xdf\x71\x8a\xe2\xac\x89\xcf\x02"
+	"\xe9\xf8\xf3\x2b\x66\xb6\x13\xb1\xf2\x90\x0b\x69\xb1\x28\x2f\x1f\x0e\xd0\xf8\x7b\x1d\xf2\xf8\xb9\x24\xcd\x60\xd4\x85\xc5\x7d\x1f"
+	"\x8b\xa2\x81\xe9\xc4\xd7\x7c\xb1\x6d\xe6\xe3\x0f\xb9\x18\x06\x4a\xf7\x3d\xe1\x00\xc8\x9b\x7b\x2e\x72\xa4\x73\x04\x13\x5a\x5e\x96"
+	"\xf7\x8e\x62\xcc\xee\x1a\x85\xac\x7e\x4a\x16\xa1\xda\x87\xd5\x97\x97\xe4\x17\xc0\x80\x04\x04\xff\xdb\x56\x7e\x9b\xe3\xa7\x8b\x72"
+	"\xbd\xf8\xbc\x03\x17\x31\x87\x0d\x95\x94\x9c\x51\x85\x95\x72\xdf\x24\xb4\xab\xa8\xed\xdc\x1e\xc4\x16\x9f\x19\x9f\x7d\x7c\xe6\xcd"
+	"\xe8\x5a\x71\x5c\xe2\xa2\xea\xfa\x61\xe5\x73\xb5\x6b\x1f\xb8\x43\xd8\x61\x19\x25\x48\xd6\x85\xdb\x2e\x07\x05\x83\x56\x64\x2b\x95"
+	"\xf6\x0d\xac\x25\x98\xb5\x1d\x34\xb0\x5c\xdd\x64\x63\x61\x85\x55\x3e\x45\x3a\xab\x2d\xb2\x48\xe9\x64\xf6\xbb\x19\x17\x62\xed\x5b"
+	"\xc1\x7b\x29\xd1\xdb\xb4\xfb\x55\xc4\x22\x59\x71\x68\x40\x45\x05\xec\xcd\xc9\x28\x73\x45\x59\x5a\xf3\xc6\xd2\x59\xf7\x03\x1b\x73"
+	"\x9c\x86\x9c\x46\xf7\xe3\x2b\xa5\xbf\x51\x10\x05\xf9\x95\x2a\x90\x28\x09\x87\xcd\x2c\x96\x01\x90\xfc\x06\x06\xb7\x0d\x92\x33\x10"
+	"\x4a\xa9\x35\x87\xdd\x88\x0d\xb4\x0d\xb3\xae\xfb\x48\xf7\x76\xbc\xfe\xb8\x1f\x20\x15\xe7\x18\x56\x0a\x43\xee\xd4\x0c\x07\xdc\xc6"
+	"\xec\xc1\xa8\xc0\x34\x34\xfd\x1e\xb3\x17\x22\xa9\xaf\xab\x46\x89\x34\x8a\xc5\x53\x20\xe5\xe3\xfb\x4d\x75\xc6\x28\xeb\xfe\x0f\xbf"
+	"\x06\xb6\xaf\xba\x16\xc3\x91\x4a\x07\x33\x18\x7b\x87\xfc\x6f\x7e\xdc\x30\x82\x5c\x46\x44\x03\xa9\x74\x28\x8e\x1a\xa8\x96\xfb\xed"
+	"\x6e\xa2\x6d\xba\x44\xba\x26\x1f\xfb\x5f\x61\x30\x4d\x26\x4f\x1f\xba\x12\x28\xa9\x79\x89\x68\x2a\x81\x22\xf9\xf1\x64\x5b\x24\xad"
+	"\x8d\x05\xdc\x6e\xf2\xdd\x67\x1e\x06\x90\x5b\x8c\x82\x96\x6b\x03\xe5\x11\x5c\x8c\xb6\x46\xe1\x03\x20\x47\x16\x65\x71\xc0\x64\x69"
+	"\x24\x6d\x36\x01\xdf\xfe\x57\xe8\x1f\x8e\x3e\xa1\x66\x1e\x95\x05\x0a\x67\x58\x0a\x4a\x4d\x8a\xae\x1a\xac\x4c\x7c\xa9\x06\x6e\xd1"
+	"\x85\x68\xf6\x46\x76\x98\x4e\x8b\x3f\x3f\xde\xc7\xbf\xf7\x6b\x8b\x91\xab\x6f\x4d\x6a\x22\xca\xc2\xad\x99\xd0\x1e\xa5\xb2\x9d\x8b"
+	"\x31\x11\xc6\x58\xa5\x10\x0a\xc5\x8b\x04\x1e\x6b\x37\x6a\xb3\x10\x25\x92\x26\xa0\x6c\x2a\x1c\xef\x76\x51\x0b\x2c\x00\x30\xbe\x6a"
+	"\x8c\x3f\x23\x9b\xa0\xc2\x32\xb8\x01\xc0\x7e\xf0\x94\xc9\x1d\x57\xdb\x97\xe9\xa1\x2a\x9c\x9a\xb7\x98\x28\x6a\x9d\x9c\x20\xc3\xc8"
+	"\x9b\x12\xc5\x4a\x86\x7f\x8c\xb2\x15\xb8\x96\xa4\xff\x8b\xcd\xc0\x3a\xef\xc0\xec\x00\x23\x43\xde\x1e\x1f\xf9\x6a\x34\x8a\xae\x24"
+	"\x53\x18\xac\xb9\x46\x39\x88\x48\xfd\x73\x99\x03\xb7\x36\x84\x0f\x00\x03\x89\x1a\x94\x8f\xf2\x45\x3c\xfe\x8b\x8f\x88\x88\x70\xa0"
+	"\x98\x2c\xdb\x00\x24\x45\x48\x70\x44\xf4\x64\xdc\xe0\x01\x49\xf2\x96\xe4\x0d\x4d\xb4\x4c\x27\x9d\x68\x19\x42\x8f\xd6\x6c\x6d\x2d"
+	"\x0b\x43\xa1\x50\x2a\x15\x0a\x41\xcf\xf3\x7d\x0e\x04\x3d\x8f\x37\xe3\xbd\xe9\xe1\x7a\x4a\xd1\x5a\x7d\xf4\x78\xd8\x48\x1e\xc6\x0b"
+	"\x05\x10\xe3\x99\x60\xbb\x59\x47\xb6\x9b\x75\x02\x19\x37\x78\x6c\xb7\xc2\x56\xc6\x52\x04\x51\x3e\xca\x57\xe3\xe3\x2b\x4f\x80\x8d"
+	"\xa0\xe0\x92\x26\x49\x63\x61\x05\x89\x29\x62\x04\x22\x10\x32\x95\x0f\x35\x70\xb3\xe1\x8e\x2d\xde\xff\xb7\x4b\x44\xeb\x91\x43\x1b"
+	"\xac\xce\x72\xfd\x77\xd3\xcb\x72\x0a\x50\x91\xa7\x39\x8b\xca\x16\xf9\x9f\x5f\xa3\x80\x9e\x57\x47\xb9\xeb\x55\x73\xfd\xd2\xc4\xc4"
+	"\xc2\x7e\xef\x92\xbc\x2f\xaa\xb9\x30\xca\xef\x6c\xf3\x56\x21\xf9\xbf\x8a\x16\x3c\x56\x2f\x5b\xb0\xc5\xcb\x0d\xdc\xae\xf7\xf7\x97"
+	"\x8b\x2f\xdc\x1b\x6a\xd1\x3e\x85\xb6\x24\x9a\x73\x50\x14\x95\x14\x97\x2d\xc7\x9e\xa8\x4e\x98\x6b\x41\x4e\x94\x8f\x4e\xd3\x0e\x27"
+	"\x3f\xc3\x78\x52\xd2\x32\xae\x4f\x69\xd3\x8f\x3f\x0f\x34\xeb\xea\x96\x86\x2d\xbb\xb7\xc3\xab\x15\x7d\x79\x12\xa2\xe8\x60\x9c\x65"
+	"\x50\x75\x2c\xdd\xaf\x8e\x5a\x5b\x37\xcf\xfc\x01\x99\xd8\x8e\xe3\x3e\x08\xd3\x2a\x2c\x50\xeb\x0a\x8b\x6a\x1d\x35\xb3\x8f\xf3\x3d"
+	"\x50\xa2\xfb\x31\x38\x8d\x88\x72\x5d\x8f\xc1\x12\xdd\x8f\xc1\x41\x53\x43\xe8\x40\xc2\x33\x13\x78\x92\x10\xa3\x17\x22\x91\xe1\xbb"
+	"\x1e\x09\x92\x60\x41\xd5\xc6\xec\x9a\xe2\x4b\xb6\xba\x16\xfe\x2c\xfd\x83\x53\x02\xb7\xc3\x43\x48\x4c\xda\xa7\x2b\x2e\x3a\xb6\x4f"
+	"\x73\x29\x6d\x1c\xe7\xb7\x9f\x2c\xd2\x51\x31\x78\x7d\x75\x41\x94\xf4\x22\xa4\x43\x62\xc3\x2f\xaf\x91\x49\x97\xf8\x29\x17\x3e\xed"
+	"\x59\x38\x99\xfd\x83\xc1\xe5\x58\x30\x89\x89\xd9\x2f\xc8\xfb\x95\x80\xab\x38\x78\x17\x3a\x26\xb4\x3e\x13\x80\x81\x7f\x1d\xeb\xba"
+	"\x1d\xfb\x28\xa9\x80\x55\x22\xaf\xba\xa9\x6c\x00\xff\x72\x2c\x05\xda\xb3\xda\xdb\x8e\xa8\xba\x26\x27\xdb\xce\x01\x1b\xdb\x96\x74"
+	"\xc0\x84\x8d\xd9\xa1\x6d\x53\xf1\xe1\x16\x6d\x87\x30\xd9\x02\x87\xa5\xac\x63\x20\xc7\x0a\xe5\x52\x80\x44\x9e\x6d\x0e\x28\xd3\xc7"
+	"\x39\x45\x00\x00\x08\x09\x01\x00\xee\xd5\x03\x21"
 ;
\ No newline at end of file
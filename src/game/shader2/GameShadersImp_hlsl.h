@@ -67,54 +67,54 @@ const SpShaderInfo spShaders[] = {
 const SpPermutationInfo spPermutations[] = {
 	{ { 1 }, {  }, { 1 }, 0, 1364 },
 	{ { 2 }, { 1,2 }, {  }, 1364, 4439 },
-	{ { 3 }, {  }, { 1,2,3,4 }, 5803, 1030 },
-	{ { 3 }, {  }, { 1,2,3,4 }, 6833, 1065 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 7898, 9437 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 17335, 9437 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 26772, 9672 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 36444, 9672 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 46116, 9472 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 55588, 9472 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 65060, 9707 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 74767, 9707 },
-	{ { 5 }, {  }, { 5 }, 84474, 487 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 84961, 6977 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 91938, 7233 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 99171, 6760 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 105931, 7016 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 112947, 7212 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 120159, 7468 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 127627, 6995 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 134622, 7251 },
-	{ { 7 }, {  }, { 1 }, 141873, 435 },
-	{ {  }, {  }, {  }, 142308, 125 },
-	{ { 7 }, {  }, { 1,2,3,4,6 }, 142433, 1628 },
-	{ { 7 }, {  }, { 1,2,3,4,6 }, 144061, 1670 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 145731, 9484 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 155215, 9484 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 164699, 9719 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 174418, 9719 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 184137, 9526 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 193663, 9526 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 203189, 9761 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 212950, 9761 },
-	{ { 8,9 }, {  }, { 1,7,8,9,10,11 }, 222711, 1825 },
-	{ { 8,9 }, {  }, { 1,7,8,9,10,11 }, 224536, 1860 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 226396, 9712 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 236108, 9712 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 245820, 9947 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 255767, 9947 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 265714, 9747 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 275461, 9747 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 285208, 9982 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 295190, 9982 },
+	{ { 3 }, {  }, { 1,2,3,4,5,6,7 }, 5803, 1357 },
+	{ { 3 }, {  }, { 1,2,3,4,5,6,7 }, 7160, 1392 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 8552, 9437 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 17989, 9437 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 27426, 9672 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 37098, 9672 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 46770, 9472 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 56242, 9472 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 65714, 9707 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 75421, 9707 },
+	{ { 5 }, {  }, { 8 }, 85128, 487 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 85615, 6977 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 92592, 7233 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 99825, 6760 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 106585, 7016 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 113601, 7212 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 120813, 7468 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 128281, 6995 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 135276, 7251 },
+	{ { 7 }, {  }, { 1 }, 142527, 435 },
+	{ {  }, {  }, {  }, 142962, 125 },
+	{ { 7 }, {  }, { 1,2,3,4,9 }, 143087, 1628 },
+	{ { 7 }, {  }, { 1,2,3,4,9 }, 144715, 1670 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 146385, 9484 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 155869, 9484 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 165353, 9719 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 175072, 9719 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 184791, 9526 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 194317, 9526 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 203843, 9761 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 213604, 9761 },
+	{ { 8,9 }, {  }, { 1,10,11,12,13,14 }, 223365, 1825 },
+	{ { 8,9 }, {  }, { 1,10,11,12,13,14 }, 225190, 1860 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 227050, 9712 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 236762, 9712 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 246474, 9947 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 256421, 9947 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 266368, 9747 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 276115, 9747 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 285862, 9982 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 295844, 9982 },
 };
 
 const SpUniformBlockInfo spUniformBlocks[] = {
 	{ }, // Null uniform block
 	{ "DebugEnvSphereVertex", 120 },
 	{ "DebugEnvSpherePixel", 32 },
-	{ "DynamicTransform", 128 },
+	{ "DynamicTransform", 64 },
 	{ "Pixel", 1088 },
 	{ "EnvmapVertex", 16 },
 	{ "EnvmapPixel", 8320 },
@@ -145,6 +145,9 @@ const SpAttribInfo spAttribs[] = {
 	{ "a_normal", 1 },
 	{ "a_tangent", 2 },
 	{ "a_uv", 3 },
+	{ "a_worldRow0", 4 },
+	{ "a_worldRow1", 5 },
+	{ "a_worldRow2", 6 },
 	{ "a_position", 0 },
 	{ "a_tint", 4 },
 	{ "a_uv", 1 },
@@ -155,162 +158,164 @@ const SpAttribInfo spAttribs[] = {
 };
 
 const char spShaderData[] = 
-	"\x28\xb5\x2f\xfd\xa0\x14\xa8\x04\x00\x54\x81\x00\x8a\x8e\xf8\x19\x2f\xa0\x6c\xc6\xcc\x01\x28\x97\xa4\x28\x63\x2e\x26\xf6\x86\xa9"
-	"\xa9\x95\x53\xee\xb5\xdb\x02\xab\x9d\x2c\x96\x2d\x92\x08\xba\x50\x00\x9a\x20\x24\xc5\x48\x81\xd9\x53\x18\x2f\xc7\x85\xc7\x0b\x9b"
-	"\x9c\x01\x87\x01\x9a\x01\xf4\x04\x9c\x4e\xba\xc0\x9b\x0e\x78\xe7\x1e\x84\xd9\xed\x6e\xc3\x94\xde\x74\x48\x6f\x3a\x5e\x7f\x84\xc2"
-	"\x9b\x5d\xa7\x39\xb8\x2e\xcc\x8a\x74\x4a\x4f\x38\x9d\x10\xbc\xfc\x67\x5d\x3e\xe3\xcd\xc7\xeb\x3b\x2e\x82\x26\x5e\x17\x66\x51\x1c"
-	"\xcf\x03\x36\x1a\x0a\x30\xe0\x6e\xcb\x65\xb6\xbb\xd9\x66\x1c\xe5\xda\x7c\x2f\x96\x92\x5d\x0f\x7b\x44\x08\xd2\x36\xdb\x0c\x1c\x5c"
-	"\xcd\x5d\x17\x66\x35\x24\xbd\x69\xc9\xdd\x76\x43\xf2\xcd\xb6\x8b\x85\x34\x55\xa4\x7b\xb3\x97\x4e\xbb\x5f\xa0\xe0\x4e\xb8\x06\x37"
-	"\x73\xdb\xbb\x0f\x34\xe3\x0c\x53\x24\xf8\xd3\xbe\x95\x6c\x1f\x00\x68\x22\x68\x99\xdb\x37\x23\x9a\x2a\x3e\x91\x4e\xe8\x8f\xbc\x03"
-	"\x61\xc6\x5d\x5e\x3f\x6b\x9d\xdf\x7c\x1e\x6f\x2e\x48\x1a\x56\xc1\x32\xce\x38\xff\xbc\x29\x1f\x61\xfd\x42\xc2\x9f\x18\xbd\x19\xed"
-	"\x68\x6b\x09\x56\xc6\x98\x82\xc9\x44\x1f\x74\x75\x76\xbd\x59\x1f\x23\x85\xbf\x30\x4b\x15\xa3\x00\x31\x4e\xb8\x35\x0c\xd6\x7b\xd7"
-	"\xd2\xde\x34\xd5\xe6\xb0\x64\xd3\x50\xc3\xec\x45\x73\x98\x65\x1d\x6e\xbe\x16\x9d\xef\x67\x1b\x2e\x9c\x76\xbd\x2d\x15\xec\x32\xe4"
-	"\xfb\xd9\x8c\x5a\x76\x93\x48\x36\xfd\x9b\xc1\x20\xd1\xd6\x30\x44\x53\x59\xf6\x00\x0b\xcb\x0f\x6e\xbe\x96\x0d\xcb\x1a\xe0\x07\x2b"
-	"\xcb\x18\xf3\x4f\xde\x33\x76\xc0\x5e\x24\x18\x9c\x11\x4d\x04\x8f\x74\x02\xf3\xdd\x1a\xab\xdc\xfc\x04\x8f\xdc\x7c\x2d\x1b\xa4\xd3"
-	"\x1c\x54\xb8\xc9\x6d\x3c\xdf\xeb\xe2\x26\x14\x49\x04\xf2\xf0\xee\xce\xb7\x93\x6c\xfa\x13\x94\xd9\x4b\xc6\x5a\x57\xd1\xb0\x2f\xdb"
-	"\x48\xd3\x54\x11\x9a\xca\x00\x49\x04\xf2\x04\x6f\x18\x70\x29\x9a\xdd\x5a\xc3\x24\x9b\xfe\xd6\x30\x0e\xd1\x54\xb4\xe1\x00\x01\x42"
-	"\x03\x05\x1c\x3c\x3c\xc1\x35\x8c\x6d\x4c\xe3\x4d\x62\x2f\x6d\x8b\xb3\x0b\xd1\x44\x70\x3d\xc1\xf2\xde\x0c\x24\x0f\xc8\x37\x85\xcb"
-	"\x5b\x07\x0b\x05\x6a\xc1\x88\x14\x14\x0b\x85\x89\x31\xa9\x5c\xd0\x85\xc4\x60\x48\x0a\x0a\x74\x52\x6a\xa2\x53\x03\x7e\x98\x54\xb2"
-	"\x7e\xcc\x7c\x7f\xa2\x37\xbb\xee\x12\x45\xd1\x49\x9f\x78\x7c\x9c\x66\xf4\x78\x10\x83\x37\x49\x51\x74\x5e\x9d\x5d\x44\x53\x31\x66"
-	"\x04\x21\x9a\xb8\xa0\x12\x24\x51\x4a\x27\x7d\x55\x70\x0f\xfe\xc2\x10\x4d\xe5\xc1\xed\x62\x33\xca\xeb\x3d\x44\x13\x41\x13\xbd\x4f"
-	"\x2a\x19\x82\x1f\xb2\xbd\x1a\x96\xfd\xa1\x52\xde\x79\xfd\xce\x38\x7d\x73\xe4\x8f\x03\x6e\x6c\xbd\x9e\xce\xe8\xf2\xf2\x8f\xc3\x9f"
-	"\x7a\xca\xdd\x20\xd9\x04\xa3\x93\x7a\xbd\xb6\x70\x03\xe4\xc2\x39\xb6\xd6\x30\x25\x33\x1d\x64\xe6\x9b\x0e\xf2\x73\x1c\x1c\xa4\x37"
-	"\x1d\x5e\x7f\x84\x44\x4d\x0a\xef\xdc\xf1\x27\x92\x80\x9b\x72\xb3\xeb\xe6\xd7\x3b\x5c\x92\x89\x53\xad\xaf\x66\xa9\x70\x38\x47\xa2"
-	"\xb6\xd8\x04\xde\x91\xa7\xd7\x37\xe9\x75\x79\x3a\x29\x25\x13\xf5\x37\xb3\x14\x7d\xef\x52\x61\x59\x93\x75\xe7\x92\x65\xdd\x39\xb5"
-	"\xec\xce\x2e\xa4\x50\xcc\xe8\xf5\x0a\x86\xc4\x80\x28\x0b\xb2\x14\x53\x4a\xbc\x5e\xb2\xa2\x88\x8a\x2c\x06\x43\x01\x59\xd4\x44\x15"
-	"\xd4\xfa\xe3\xbf\x4b\x05\xf5\x5d\x7e\x9a\xdc\xb9\x34\xf9\xe3\x5d\x46\x93\x3b\xf7\x2e\x0f\x4d\x0e\x35\xec\x72\x78\xb7\xcd\xdc\xb6"
-	"\xfa\xf5\xda\x62\x0c\x05\x9d\x54\xe2\xf5\x8a\x89\x4e\x73\xf1\x7a\x8a\x5a\xcc\x29\xf1\xfa\x49\xa2\x0c\xc6\xa4\xaf\x97\x28\xc6\x62"
-	"\x42\xaf\x8f\x26\x8b\x85\x02\x9a\x34\xf1\x7a\x68\x52\xff\x45\x36\x6e\x68\x5a\xe3\xac\x72\x7a\x65\x16\xbb\x60\xed\xcb\xf0\xe3\xc1"
-	"\x42\xa3\xd3\x1c\x44\x90\xa7\xa6\x4c\x66\x3a\x64\x46\x8a\xbe\x6f\x3a\xe4\xe7\x64\x3e\x6f\x46\x3a\xe9\x9f\x68\xfd\xf9\x66\xc7\xfd"
-	"\x89\xd0\x13\x9c\x4e\x45\x02\x9d\x01\x55\xe2\xd1\x39\x34\x29\xb4\x9c\x76\xf7\xb6\x5f\xf0\x26\x02\x02\xd1\x54\x74\x2e\x12\x28\xe8"
-	"\xfc\xcb\x78\x33\xc2\x3f\x08\x04\xa2\xa9\x1c\xd9\xc0\xbb\x0f\x01\xdc\x9b\x92\xc5\x0a\x88\x32\xee\x80\x06\x0a\x9a\x4a\xd6\x43\x00"
-	"\xc9\x31\xa1\xe1\xd2\x03\x01\x64\x6b\xec\xf1\x04\x06\xc2\xb6\x54\xb0\xac\xa9\x1a\x90\xa4\x28\x82\xa0\xaa\x01\x7a\xe7\x57\xdb\x49"
-	"\x3d\xb5\xdb\x5a\x9f\xae\xb6\x93\x3f\xe4\xe3\xc2\xc2\xe5\x1b\x91\xfa\x46\xe4\xa1\xf5\x0b\x97\xfe\x48\x16\x1a\x0e\x05\x24\x48\xf8"
-	"\x02\xf9\xc8\xa0\x24\x4a\x11\x31\x28\x68\x82\xa6\x24\xe9\x8c\xe0\xeb\x2f\x58\xbb\x96\x53\xef\x3c\x71\x06\x86\xd7\x37\x1a\x1a\xea"
-	"\x1b\xbc\x4a\xc5\xf9\xe5\xe1\xce\x10\xe8\xcb\xd7\x47\xbc\x4a\x25\xb2\x96\x2d\xb3\x0c\x91\x3f\x0d\x1b\x5b\x0e\x05\x1e\x3c\x90\x34"
-	"\x22\x9e\x9c\x3c\x78\xf9\x48\xaf\x27\x1e\xe9\x84\x20\xbc\x73\x1a\x4d\xf5\x11\xc3\xc6\x56\xe4\x01\x0a\x96\x59\x28\x10\xc9\x42\x03"
-	"\x93\x82\x01\xbb\x6d\x63\x6b\x18\xde\x26\x09\x92\x6c\xba\x5a\x50\x28\x1e\xd0\xf6\x42\x51\xd3\x84\xad\x3b\xc9\xac\x24\x55\xf0\x82"
-	"\xc6\xba\x28\x8a\x20\xa8\x21\x59\x58\x7e\x80\xc1\x96\xb5\xe8\xeb\x8e\xeb\xb8\x3f\x50\x6b\x9c\x29\x97\xc7\xbc\x6e\x6d\xdb\x10\x4d"
-	"\xe6\xf3\xe6\xd6\xb6\xca\xca\x32\x4e\x00\x3f\x64\xd7\xc2\x97\x4b\xc6\x97\xd6\x6c\x7e\xa0\x60\x17\xab\x7d\x53\xf7\x48\xc2\x26\x92"
-	"\xee\x52\x77\x49\xea\x38\x89\x7d\x14\x6d\xed\x56\x34\xbb\x25\xb6\x22\x9a\xa6\xa2\x4f\xe4\x8f\xe3\xcf\x03\x01\x5f\x4f\xaf\x44\x7d"
-	"\x3c\xf1\x08\xbc\x19\xec\xf5\x8e\xee\x41\x61\x9c\x20\x68\xd2\x3f\x0a\x0b\x6a\xd2\x3f\x0c\x46\x34\xa9\xf7\x78\x70\xaa\xa2\x57\xc5"
-	"\xee\x4e\xc2\xbb\xd7\x7b\x55\xbe\x43\x34\xd5\xcd\x9c\xc6\x9b\x77\x37\x7b\xb9\x1a\xde\x9f\x9e\x05\x14\x4d\x10\x55\x88\x24\x28\xa2"
-	"\xe8\xa4\x4e\xf1\x79\x1e\x10\x08\x04\x02\x81\x40\x26\xed\x66\x4f\xa8\x32\xd2\x19\x7d\xc1\xb5\x6b\xd9\x15\x4d\xbb\xd9\xe5\x25\x7a"
-	"\xc9\x08\x0a\x93\xd2\x09\x51\xd0\xa4\x90\x4e\x28\xe1\xa8\x62\xc2\xe3\x37\x1f\x4f\x5c\x61\x4a\x10\x5e\xbe\x3a\x7f\xfc\x9b\x03\x0c"
-	"\x90\xc8\x4c\xa8\xf2\x8a\x49\xa8\x7f\x3c\x8f\xa7\xe3\x1e\x1b\x96\x51\xe4\xeb\xb7\xc6\x2c\x05\x15\x61\x26\x54\xb9\x73\xcc\xa4\x95"
-	"\xd7\x7f\xde\x84\x2a\x5a\xc5\x42\x10\x54\xf9\xf4\xe7\xa9\xa7\x95\x4f\x1d\x27\xdf\x21\x70\xed\xdf\xb7\x9f\xe0\x3b\x51\x17\x54\xe7"
-	"\xde\xd4\x32\x53\x4b\x3c\x5e\x4f\xec\x13\xff\xe6\xf5\xc7\x9b\xd7\xaf\xd7\x3f\xca\x6c\xb6\xae\xc5\x6e\x0a\x84\x6b\x61\xca\xb5\x2e"
-	"\x45\x10\x15\x65\xac\xf1\xd9\x7c\xa9\xe3\x3e\x41\x92\x4d\x63\x0d\xfc\x60\xd9\xdb\xb5\x36\x2c\xa3\x44\x09\x82\x22\x5a\x59\x60\x46"
-	"\x89\xcb\x7f\x7f\xa4\x37\x35\xde\x20\xc4\x9b\xc6\xdb\x23\x29\x92\x58\x76\x5b\xa0\x52\x60\xc3\xb2\x8b\x46\x98\x0f\xf3\x61\xbe\xf8"
-	"\x07\xd2\x7f\xa8\x86\xa0\xec\x4f\xc6\x9b\x5b\x3d\xcd\x9e\xf8\x47\xb3\x7a\x28\x53\xf8\x32\x98\x31\xce\x2e\x9a\x2d\xb6\xd7\x7f\xd9"
-	"\x06\xf9\x6c\xce\x0c\x1a\x11\xe6\x7b\xfc\xa9\x9e\x68\x7a\x75\x2c\xed\x5e\x41\x45\x5f\x0f\x9f\xf1\xf5\xc5\x8c\xbc\xd3\x54\xb2\x3e"
-	"\x92\x98\xfa\xe7\x89\x12\x9d\x14\xc2\x2d\xdf\xcc\x9b\x0b\x60\x93\x6f\x3a\xf5\x0f\x68\x7b\xc0\xb6\x97\x4f\xf5\x0c\xb6\xbd\xc4\x07"
-	"\x6e\x6c\xd5\x2f\x00\x9f\xf8\xe7\xcd\xd8\x71\x0f\x84\x8e\x6d\x2f\x8f\xa6\xcb\x47\xa8\xdd\xb8\x25\x27\x39\x48\xf9\x66\x3d\x77\x1a"
-	"\x5d\x3e\x52\x93\x37\xe1\xee\xb8\x3f\x9b\x62\xaf\x0a\x93\x91\x8f\x99\xb9\xfd\xf1\xe6\x06\xb7\x8c\x33\x1c\x89\x0c\x0c\x91\x48\x64"
-	"\xf8\x13\x89\xdc\x79\x03\x43\x04\x84\x7c\x94\x08\x44\x43\x83\xf5\xa8\x72\xd3\x94\x31\xc6\xcc\x8c\x40\x00\x00\x00\x28\x02\x09\x00"
-	"\x86\xc3\x61\x16\x46\x69\x8e\x5d\x18\x12\x40\xc0\x68\x34\x89\x82\x1c\x08\x52\x08\x19\x43\x0c\x21\x04\x08\x80\x00\x00\x04\x00\x00"
-	"\x20\x00\x04\x00\x02\x00\x02\x7d\x69\xc2\x9a\x18\x2b\xaf\xb3\xc7\x5e\xa8\xc5\x17\x5e\xa8\x43\x05\xc8\xf5\xaf\xdb\x00\xc2\x49\x2b"
-	"\xf9\x00\x0a\x62\xb7\xaa\xd6\x65\x48\xe9\x6f\x27\xd3\xf5\xed\x53\xbc\x77\xe3\xd8\x6c\xb3\x57\x56\x5b\x3a\x4c\x0d\x1b\x2f\x54\xa7"
-	"\x5a\x9d\x12\xc1\x3a\xb9\x76\x2f\x25\x6c\x23\x11\x97\x86\x2c\xbe\x38\x28\x71\xc3\x26\xa5\xfb\x35\xf5\xbb\xae\x62\x39\xa3\xc3\x3c"
-	"\xa2\xf2\x87\x22\x8b\x1e\x17\x5f\x0c\x3d\x1f\x51\x16\xf9\x67\x63\x17\xa6\x90\x68\xad\x6f\xea\xc0\x23\x27\xfd\x0a\x1d\xcb\xf4\x25"
-	"\x44\x10\x02\xcc\x20\xab\x38\x36\xc3\xd2\xe4\xe9\x45\x09\x2a\x63\xfb\xf5\xd5\xce\x73\x26\xca\x49\x4b\x67\x1d\xca\x25\x1a\x80\x6f"
-	"\x93\x00\x23\x14\x80\xb1\xe9\x4d\x54\xaf\x33\x1b\x2a\x66\x30\x91\x7f\xd3\xcc\xf8\x9e\xdf\x67\x2c\x30\xa0\x46\x2f\x06\xe6\x47\x62"
-	"\xe4\x80\x6f\x39\xee\x71\xaa\x0c\x40\xae\xe1\xde\xe3\x09\x1d\x1f\xa2\x1f\x1a\x06\x7e\xfe\x20\x31\xf4\xb3\x5e\xb1\xd0\xbf\x0b\x74"
-	"\xea\x8b\x6d\x66\x12\x7e\xdb\xa0\x50\x7b\xd7\x64\xa5\x48\x94\x1a\xae\xd7\x10\x54\xca\xad\x27\x16\x0b\xfc\x87\xe1\xf7\x00\x93\xb1"
-	"\x7d\x8c\x71\x9c\x07\xa2\x1e\xa7\x10\x83\x70\x43\x95\x6b\x2b\x75\xda\xa0\x38\x01\x5a\xe9\x9d\x57\xbc\x16\xb5\x2e\x59\xd4\x5b\x8e"
-	"\xb8\x06\xfd\xa9\xac\xf1\x81\x20\x0b\x54\xd1\x77\xd9\xd3\x27\x59\xe2\x21\x71\x0f\x07\x0a\xac\xbc\xf4\x10\x1c\xa5\x85\xd4\x34\x49"
-	"\x72\x30\x8f\x0c\xa1\xc6\x3a\x89\x48\xf8\x70\x6a\x45\x2e\x46\x5e\xe2\x06\xb9\x96\xea\x49\x00\xca\xae\x0e\x37\x59\x02\x1d\x95\x31"
-	"\x93\xf5\xf7\xf4\x86\x42\x9f\x12\xa6\x0e\x70\x28\x49\x9f\x8a\xf7\xa5\xca\xd1\x8e\x67\xc4\x80\xc5\xb5\x3c\xdf\xe0\x33\x21\x95\x7a"
-	"\xae\xb6\x55\x85\xba\x7b\xf1\xb9\x6f\x9b\xb3\xc0\x35\xb7\x86\x71\x99\xff\x6c\x08\x9e\x06\x5e\xc9\x3c\xac\xd0\xec\x0c\x70\x74\x28"
-	"\x54\x44\x2d\x3b\xc3\xa5\x9d\x15\x8b\x9d\xa7\xb3\x8d\x72\x9d\xaf\x1b\x30\x11\x8a\x0e\xcc\xf6\xdd\x0a\xa8\x77\xc4\x5e\xd9\x62\xb1"
-	"\x7a\x16\x44\x1c\x13\x2b\xfa\xda\x03\x78\x39\xa1\xd7\x4f\x1c\x8f\x21\xf5\xfb\x94\x7d\xa2\xf0\x2a\xe9\xb3\x87\x41\x83\x4f\xc6\x68"
-	"\x45\x71\x31\x5a\xc1\x5f\xf0\x77\xa4\x81\x46\x93\xb3\x4c\xce\xf7\x11\x8d\x37\x97\x6a\xa2\x9a\xf3\xc5\xa8\x17\x85\x16\x74\xa4\xd8"
-	"\x19\x69\xdf\x43\x1f\xb2\xbb\x21\x9b\x76\xea\x24\xc1\x57\x12\x99\x6c\x68\x0f\x70\xc2\xb9\x60\x80\x39\x8c\xe3\x10\x20\x4e\x17\x22"
-	"\x47\x6a\x64\x8b\xe6\x3b\x3c\xc8\x92\xb2\xb4\x8b\xc3\x33\x6a\xd1\xb7\x21\x97\x2a\x9f\xe0\xc8\xc1\xdd\x00\xeb\xce\x9a\xa4\x63\x98"
-	"\x82\x0d\xa9\x5c\xfa\xd6\x4a\x0c\x85\x85\x56\xd9\x97\xa9\xfe\x3b\xc4\xf4\x52\x42\xa1\xbe\x96\x17\xe1\x5e\x76\x69\xed\xc4\xb6\xd2"
-	"\xe9\x79\x05\xd8\x89\xc2\x40\x71\xa4\x1f\x22\x70\x95\x7e\xda\xed\x1c\xd3\x6e\xa7\x0d\xad\x34\x61\xb9\x38\xd2\xb3\x0b\x55\x71\x05"
-	"\x60\x01\x06\xee\x2e\x7c\x09\x43\xed\xf4\xcc\xcb\x99\x93\xc4\x2c\xb3\xac\x8a\xa9\x22\xc9\xeb\x05\x0e\x40\x04\x35\x1a\x58\x2b\xed"
-	"\x6a\x61\x80\x30\xd7\x30\x9c\x0a\x2b\xa7\x19\x48\x18\xa1\x50\x44\x53\x1d\x1b\x84\x01\x1d\x9d\x33\xa8\xf2\xef\x93\x33\x39\x09\x07"
-	"\x36\x17\xc9\xbc\x06\x4e\x37\x36\x39\x12\xde\xf4\x31\x58\x02\x9f\xe4\xb4\x75\x9d\xbc\xf7\xff\x04\x4d\x31\x3a\xf1\x6a\xd3\x24\x94"
-	"\x13\x72\x96\x11\x67\x6b\x09\xe0\x64\xd3\x37\x1e\xda\xaa\x65\xd2\xbf\x75\x8d\x96\x27\x6c\xda\xc7\x5f\x9c\xc7\x0f\x3d\xb0\x48\x31"
-	"\xa7\x3d\x89\xf8\x3d\x6c\x58\xe4\x98\xbc\x5d\x08\x3c\xc8\x66\x45\x1e\x8d\x31\x67\xa0\xa4\x61\x00\x49\xfa\x88\x98\xa3\x03\x5f\x11"
-	"\xfd\x01\xff\xdb\x15\xbe\xee\x13\xa7\xa2\xce\x35\x80\xa5\xfa\xa2\x96\x85\xd5\x89\xe8\xed\x82\xd9\xa3\x9d\x6b\xee\x15\xa0\x77\x20"
-	"\x63\xc2\xe8\x05\x6d\x44\x21\x91\x7f\x11\x75\xae\x1c\xdf\xe8\xd0\x70\xcf\x40\x44\xcb\xfd\x37\x75\xa4\x2d\x40\xe1\xf2\x0b\xf3\x8a"
-	"\xb8\x76\x05\x25\x42\xa3\xce\x74\x22\x49\xfc\x34\x74\xc8\x96\x24\x00\x84\x12\xcf\x3e\xf6\x94\xfd\x8e\x1c\xbd\x67\x5d\x13\xba\x5b"
-	"\xcf\xa1\x05\x96\x95\x2d\x15\xe5\xdf\x72\x93\x42\x6f\x65\x91\x55\x0a\x62\xe6\xd4\xa1\xfe\x3b\x5d\xbe\x06\xf5\x5e\x83\xb4\x41\x13"
-	"\xf5\x72\x7d\xa2\x47\xe7\xbf\x29\xb7\xf7\x61\x54\x8b\xfc\x2d\x7d\x22\xaa\x8a\x6b\xb6\x18\xc7\xa0\x60\x70\xf3\x30\x7b\x05\x54\x72"
-	"\x95\xdc\x09\x70\x7c\x8c\xeb\xa4\x9c\xea\x6f\x3d\xef\x26\x50\xac\xcc\xf6\x6b\x10\x3f\x44\x2c\x62\xb6\x06\x48\x3e\x54\xf1\x81\x8a"
-	"\x69\x5a\x10\x91\x2d\xbb\x70\x30\x61\xbd\x91\x51\x5a\x3d\x8a\xb5\x51\x64\x07\x05\xd3\x08\x3c\x21\x7d\xd8\x94\x25\x45\xf5\x73\x48"
-	"\x6d\x16\xda\xf2\xfc\x60\xb8\x43\xf5\x79\x8a\x93\x63\x0a\xe8\x41\xa8\xe8\x9b\x80\xc0\x23\x02\x98\x17\xea\xf0\xf5\x8b\xe9\x6c\x71"
-	"\xc1\xe7\x80\xcf\xc3\x69\x43\xb4\x32\x8d\x38\x4f\x66\x3d\xc4\xd7\x1a\xdc\xa6\x82\x12\xc0\x1b\xbc\xb7\x69\xcc\x9a\x89\x04\x91\x41"
-	"\xc1\x44\x0c\xe1\xc4\xd7\x9e\x15\x92\xfc\xad\x3a\x94\x75\x49\x13\x4f\x4b\x56\x53\xd0\x18\x66\x68\xdd\xb4\x82\x04\x2c\x12\x08\x88"
-	"\xf7\x24\xcc\x77\x41\x90\x5c\xbf\xb7\xe1\x62\xc0\x31\x3d\x43\xdb\x6b\x11\x7c\x28\x20\xd6\x28\x8c\x6e\xb7\xd8\xbc\x56\x2f\x04\xa9"
-	"\x2c\x0f\x57\x89\xc5\x13\x90\x2c\xc3\x29\xd2\x3e\x2a\xb7\x45\x04\xa3\x7a\x3b\x80\x09\x5a\xc2\x72\x4b\xe3\x27\x21\x51\xb0\x4e\xa2"
-	"\xa3\x56\x85\x11\x05\x9f\x20\xcb\xbb\x65\x0b\x7d\x47\x45\xa4\x21\x5e\xa2\x57\x55\xe3\x8e\xc9\xcf\x48\xc1\x3f\xe3\xa9\xef\x02\x04"
-	"\xc1\x8c\x85\x43\x66\x93\x0b\x38\x10\xcb\x63\xb0\xfe\x14\x16\x7d\x43\xd3\x91\x40\xe2\xce\x74\x78\x4e\x36\xe8\xdf\x23\x27\x24\x34"
-	"\x16\x3f\xec\x0b\x3f\x4c\x5a\x04\xad\xb9\x04\x35\x27\x12\x19\x62\x5a\xfd\xab\xf4\x55\x71\x8d\xb2\x30\xd9\x40\x64\xf4\x12\x69\xbe"
-	"\x9d\x6e\xeb\xcd\xbe\xa4\xd7\x38\x52\xb5\x6f\xc7\xe8\x48\x6f\x00\x68\x75\x09\x9f\x63\x2b\xdb\x84\x5d\xe9\x69\xc3\x19\x2d\xe0\xc5"
-	"\x44\xbe\xaf\xe5\xeb\x8c\xdf\x7e\x86\xf1\x04\x58\x93\x01\x0a\xc2\x91\x89\x7b\x14\x0d\x9f\x40\x9e\xc5\xb7\xf6\x0b\x0e\x9e\xeb\x69"
-	"\x39\x1c\x20\x9c\x00\x35\xe0\xe1\x1e\xce\xa2\xed\xa8\x82\x3b\xe6\x32\xb3\x23\x1f\x98\x8d\xbc\x1e\x23\xda\x5d\xd4\x80\x85\xb4\x83"
-	"\x8e\x5c\xef\x73\xe0\x02\xf7\xf4\x53\x23\x38\xac\x85\x0b\x55\x02\x29\x64\x13\x9e\xb8\xbc\x21\x8a\x98\x29\x00\x5b\x28\xb4\x47\x60"
-	"\x67\x2a\x80\xff\x68\xa1\xec\x70\x01\x2c\x46\xf9\xa6\x1b\x4f\x73\x73\x44\xf1\xdb\x6d\x49\x58\x66\x1b\x60\x59\x62\x73\x30\x88\x17"
-	"\x0c\x30\x87\xa8\x43\x82\x20\x29\x80\xa4\x40\xb8\x0b\x90\x4d\x44\xfa\x59\x9f\x83\x23\x90\x37\x5c\xeb\x25\x22\xa9\x0e\xeb\x32\x17"
-	"\x31\x25\x9c\x68\xe2\x1c\xc1\x71\x7d\x21\xab\x83\x84\x2e\x0e\xa0\x5f\xe7\x42\x8e\x8e\xaa\xe3\x0a\xcc\x69\x25\xf5\x5d\x27\x46\x1e"
-	"\x23\x9e\xdc\x50\x8e\x3a\x64\xa4\xcf\x6f\x4f\xe1\x4d\x08\xdb\x79\xba\x2b\xa6\x49\x3d\x9e\x8a\x07\x1a\x5d\xdc\xca\xb1\xe0\xb6\x54"
-	"\x5b\x02\xfc\x12\x09\xa3\x66\x47\xbd\x0a\x31\x5a\x99\x00\x08\x3c\x43\x0d\x99\xf6\x96\xc0\x1d\xa0\xa5\x2f\xbb\x96\x7a\xcd\x6b\x5e"
-	"\x5a\x56\x30\x74\xc4\xd2\x52\x29\xe6\x18\x42\xfa\x03\x9a\x78\xca\x24\xae\x64\x07\x56\x93\x8e\x16\x28\x56\xda\x42\xdd\x76\xa5\x61"
-	"\xd7\xd0\x5c\x2c\x44\x56\xcf\x7d\x23\x1a\x63\x77\x1b\xed\x0f\x4f\x12\xd2\x73\x74\x7b\x20\x73\xd2\xd0\x4e\x8d\x78\x57\xd6\xfd\xee"
-	"\x67\x73\xa8\x93\xce\x79\xf4\x9a\x3f\x4e\x83\x78\x28\x13\x18\xd5\xe4\x34\x32\xb8\x11\xb4\x0e\xfd\x67\x09\x0c\x43\x59\xc8\x80\x06"
-	"\xae\x96\x43\xad\x58\xda\xac\xd4\xff\xc8\x05\x83\x75\x86\xd4\x48\xe2\xbe\xd0\x00\xd4\x1b\xda\xa1\x88\xe4\x4d\xbd\xea\x83\x38\x29"
-	"\x41\x8a\xf4\x77\x88\x9e\xe0\xf7\x4e\xd6\xf6\xa4\x5e\xa1\x82\xe3\x62\x9f\x02\xea\x24\x6d\xc3\xaa\x01\xb5\x5d\xae\xaa\xda\xa2\x7e"
-	"\x80\x40\x0a\xa4\x1a\x89\x3e\x03\x9f\x9a\xf4\x0b\x1f\xb5\x89\x95\xb3\x5f\xbd\x2d\x4a\x2c\xc2\xc8\xc5\xbb\x8d\xda\x8f\x12\xf3\xd4"
-	"\xae\xe6\x94\x2a\x54\xf7\x65\x1b\x0a\x83\xaa\x9f\x06\x2c\x28\x68\x81\x3f\x17\x02\x65\x77\xb2\x29\xc1\x52\x83\xe3\xd4\xc0\x7c\x90"
-	"\x04\x47\x4d\x60\xa4\x15\xf8\x27\xb7\x31\x71\xbb\x26\x77\x43\x8d\xfd\x45\x84\x43\x69\xb0\x8e\xbb\x51\x41\x53\x89\x0a\xf4\xdb\x5f"
-	"\xa9\xfa\x6f\x1e\xa2\xbf\x84\x8b\x54\x3c\x5f\x41\x08\xab\x96\x3e\xc7\xf5\x4a\x9f\x82\xc0\x80\x58\x06\x4a\xb9\x86\x80\x88\x87\x63"
-	"\x5c\x49\xfc\x06\x4f\x48\x1b\x28\x3a\x60\x78\x86\xbe\x4c\x35\x64\xaf\x78\xd4\x88\x31\x7d\x69\x8c\xe4\x9a\xbc\x00\xee\xdf\x7a\x69"
-	"\x99\xa5\xf5\x97\xd4\xd1\x35\x92\x5c\x91\xb7\x39\x4c\x2a\xa1\x16\x73\x98\xd2\x12\x28\x59\x82\x65\x0e\x27\x6c\x2a\xba\x6c\xa8\xaa"
-	"\x60\xf5\xe3\x83\x6e\x19\x18\x4e\x0a\x87\x0e\xf1\x18\xbe\xec\x03\x4e\x43\xaf\xe1\xf4\x8a\x06\x7a\xf8\x0b\xfc\x4d\x35\x0c\x99\xf7"
-	"\xc0\xa7\x13\x85\xb4\x5b\x61\x8f\x44\x98\x56\x5d\x97\x58\xab\x44\xae\x8c\xe2\x59\x48\x78\xca\x96\x91\xa4\x49\xd8\x15\xc6\x1d\xa9"
-	"\x2f\x37\x1c\x9c\x8a\x5b\xce\x9e\x4c\x6c\x6a\xb1\xd7\x3c\x20\x3c\x13\xb1\x2f\x83\x45\x0a\x90\x53\x20\x0c\x62\xf8\xdd\x5e\x2b\x69"
-	"\xfc\x04\x1c\x78\x10\x28\x97\x9b\x87\xff\xcc\x0a\x1c\x18\x67\x3f\x4c\xe5\xd6\xeb\x43\x40\x96\x47\xb0\x7c\xec\x41\xb8\xba\x72\xd3"
-	"\x52\x8d\xb6\x3f\xa8\x35\x6d\xae\xb5\x71\xf7\xa3\x52\x79\x4b\x87\xd4\xcf\x16\x17\x8d\x71\xea\x9f\x82\xbd\x02\xa5\x01\xa4\xf4\x67"
-	"\x4a\xa6\xd9\x29\xbb\x9c\x9e\xd1\x2a\x67\xfc\xbe\xa1\xe6\xb5\xf0\x7f\xcf\x0d\x9c\xd7\xe2\xc0\x28\xd9\x97\xbf\x6d\xff\xd1\x83\x58"
-	"\xe2\x21\xb3\xb3\x48\x32\x7b\x33\x7c\xaf\x0f\xad\x66\x04\x89\x62\x8b\x66\x3b\x31\x81\x85\x52\xfc\x97\xd3\xa3\x6f\x89\x2e\x08\x7f"
-	"\x54\x52\x52\x80\x49\xb7\xae\x2d\x49\x54\xf9\xa1\x0a\xd0\x8e\x50\x84\x39\x23\xfc\xb5\x34\x6c\x00\xcd\xb6\x36\x68\x80\xe7\xca\x01"
-	"\xe8\x32\x4c\xa6\x63\x66\x6c\x6f\x4c\xd2\xd5\x13\x43\xab\x72\xc1\x3a\x60\xdc\xa3\xfc\x24\x4f\xe5\x5e\x50\x25\x0c\xb3\xb2\x23\xa2"
-	"\x03\x10\xaa\xbc\xec\x79\x54\xcc\x0c\xd0\x07\xe0\x77\x13\x4f\xb3\xe0\x8b\x51\x8f\x6a\xd2\xd0\x28\x5d\xb5\x1e\xdc\x85\xce\x15\xee"
-	"\x59\x10\x95\xdd\x21\xa1\xfe\x08\x04\x31\x90\x84\x21\x41\xf2\x59\x88\x7d\x97\xd8\x65\x12\xe8\x37\x0a\xcc\x43\x7f\xe3\xfb\x66\x7e"
-	"\x00\xd4\x3b\x95\x67\x03\x53\xea\x9b\x38\xfc\xad\xc5\x82\x48\xc4\x12\xd5\xb2\x81\x7c\xc3\x2a\x3e\x7d\x03\x20\x4c\x5f\x7e\xa6\xd4"
-	"\xff\x44\x6a\x0b\x16\x8b\xce\x70\xc2\x37\xc2\xb3\xc7\xb2\x81\x0d\xb2\x3e\x45\xad\x39\x11\x23\x65\x8d\xc1\xab\x42\x31\xb0\xf3\x2e"
-	"\x21\x1f\x52\xbe\xaa\x1a\x5e\xbe\x0f\x7b\x70\xd6\x09\x45\x21\x64\x20\x0e\xc5\x83\xd2\x4f\xce\xe4\xd3\x44\x01\xe0\x8f\x3c\xc6\xe0"
-	"\xbd\x09\xce\x9b\x04\x0f\x5a\xc7\xd5\xe6\x8a\xde\xdf\x29\x51\xde\x43\x00\x59\x98\xcd\x0b\x17\x7a\x40\x09\x3f\xb4\xb3\xdf\xc8\x0c"
-	"\x60\x22\x3e\xd9\x88\xb9\x27\x0e\x59\xc3\x93\xf3\x7f\x61\x23\x02\x8f\x42\x67\xaa\x4f\x7a\xcc\x1a\x00\xd3\x0c\x26\x98\xcf\x72\xf9"
-	"\x2a\x7e\xf2\x16\x8b\xe5\x0a\x2a\x9a\x2c\x15\xcc\x22\x41\x1a\xf6\x00\x24\xaa\x68\x7b\x57\xb4\x1d\x5d\xb2\xa6\x5d\xb2\x16\x23\xe8"
-	"\x89\x1a\x6f\x7f\x28\x06\x67\xb8\xb1\x85\x40\x34\x1b\x06\x83\xc9\x64\x68\x14\x41\xd0\xf7\x39\x51\x04\x41\xde\x94\xf7\xa6\x87\xd5"
-	"\x53\x0c\xce\x9f\xa4\xcb\x47\x0f\xfb\xc4\x80\x18\xd0\x57\xc3\x93\x4f\x90\xbe\x1a\x2e\x40\xc3\x1e\x80\x5c\x8c\xbe\x14\xcc\xd2\x30"
-	"\x89\xfd\x24\x45\x10\xe6\xc3\x7c\x98\x0f\xf3\x65\x20\x86\x45\x4c\x45\x75\x5b\xc3\xaa\x08\x11\x5e\x41\x54\x02\x9d\x53\x44\xbb\x08"
-	"\x2e\x51\x6e\xe4\x92\xb1\x06\xc1\x0f\x14\xba\x64\xac\x21\xf0\x00\xc5\x6e\x1a\x17\x80\xfa\xa0\x81\x32\x9a\x01\x81\x80\x8e\x02\xf1"
-	"\x04\x49\x29\x65\x0c\x42\xe8\x84\xf4\xf8\xe7\x6d\x9c\x3e\x30\x67\x06\x7e\x07\xfd\x0b\xd8\x1d\xb1\x69\xf2\xfc\x4b\xa9\x8a\x35\x70"
-	"\xaa\xba\x87\xf0\xe7\xf0\xf9\xa2\xbd\x50\x00\xd3\x6a\xfe\x3d\x82\xcb\x03\x95\x07\xd2\x75\x25\xbd\x9a\x2f\xf8\x23\x55\x07\x6e\x0d"
-	"\x75\x85\xbf\x0a\x1d\xc9\x5a\xd4\xee\xad\xf3\x2b\x7c\x6c\x03\xa8\xe3\xde\x1a\x16\x33\xe6\x1c\x3d\x5a\x08\xef\x2c\xc6\x6f\xb4\x8b"
-	"\x4d\xf5\x01\x15\xe5\xa1\x2d\xbb\x07\x13\xa5\x79\x53\xe3\x41\xa2\x7a\x2e\x10\x81\x92\x2a\xda\xd1\xbf\x35\x7f\x50\x81\x38\x7b\x29"
-	"\xd7\x8e\xde\x1f\x17\xe1\x0a\xb5\x44\xf2\xa8\x20\x35\xa9\xaf\x76\xa4\xf1\x6f\xc3\x41\xa1\x5b\x74\x48\x25\x08\x94\xe0\xf4\x43\x2e"
-	"\x76\x25\xde\xbb\x32\x28\x3b\x5f\x47\x56\x3d\x42\xe8\x14\x38\x84\x07\x49\x5e\xfe\xe5\x63\x96\xe9\x28\x41\xfd\x1c\x71\x58\x70\xc1"
-	"\xdf\x32\x72\x77\x7d\xa0\xd8\x04\x90\x71\x0e\x96\x76\x7f\x07\x98\x66\xe4\x72\xd7\xf7\x60\x79\xd7\x77\x80\xa7\xa9\x43\xfe\xa1\x89"
-	"\x9f\x3d\xf1\x4f\x13\x63\x0e\x38\x32\xad\x01\x78\x31\x62\x11\xb7\xfd\x88\x3f\x3e\xf3\x97\x10\xb4\xe2\x55\x55\x34\xe3\xf9\xbd\x20"
-	"\x13\xbf\xc8\x3d\xcf\x95\x90\x1a\x27\x78\xf6\xe7\xaf\x30\xdc\x29\xcc\xb7\xb8\x86\x87\xe9\x66\xad\x73\x2c\xe5\x8a\x09\x5f\xc8\x6f"
-	"\x11\x72\x27\x74\x22\x98\x63\x66\x12\x31\x66\x90\x19\x45\xd7\x0b\x95\x5f\x32\x85\x98\xac\x2a\x00\x2f\xac\xfe\x42\x7d\x51\x66\xcb"
-	"\x82\xf8\x6a\x86\x9f\x10\x00\x66\x36\xd7\x33\x43\x64\xd7\x7b\x45\x44\x90\x18\xe7\x01\xca\xa1\x45\x9e\x55\xd4\xbf\x9b\x90\x53\x9c"
-	"\xb7\x22\x33\x16\xc3\xd3\x92\x6f\xa2\xf0\xfe\x2b\x04\x41\xbf\xe4\x3c\x99\x0c\x16\xf8\x0c\xae\x83\xe6\xf9\x92\x1e\x21\xd3\xf2\x35"
-	"\xca\xd5\xa9\x48\x5f\xab\xb9\x4e\xff\xdc\xc0\x43\x71\x1c\x75\xbc\x6d\xfb\xe7\x4e\xc9\x00\xeb\xd5\x43\xe1\x9a\x53\x80\x3e\x99\x36"
-	"\x23\x18\x10\x45\xa7\x43\xe9\x9b\xe5\x20\x14\x47\x05\xf4\x4e\x86\x3f\x92\x50\x8c\x6c\x26\x84\x2f\xc4\xdd\x18\x4e\xcc\x35\xa4\xb8"
-	"\xf7\xb7\x95\xa3\x00\xa0\x73\xa8\x5c\x77\x7f\xce\x0b\x97\x41\xd1\x7f\x6e\x36\xa5\x1f\xc0\xa6\x07\xc1\xd8\xa8\xb8\xaf\x58\xaf\xa3"
-	"\x82\xf6\x30\x3f\x2a\xa6\x26\xe1\x0d\xa9\x38\x66\x72\x98\x91\x0a\xa9\x43\xed\xfd\xde\x00\xe3\x2a\x4f\x87\x4c\x2d\x28\xd1\xf8\x13"
-	"\x1e\x37\xae\x07\x4e\x85\x7e\xb9\xb4\x99\x8d\xc5\x6a\x5f\xcb\x74\x91\xc5\x44\x05\xa9\x32\x83\x8c\x0d\xcb\x9c\x90\xd0\x99\x8b\x39"
-	"\xd0\xf3\xe2\x04\xa5\xac\x91\xb3\xb3\x4c\xf0\x91\xda\x04\xad\x8d\xf1\x0a\x11\x26\x74\xa5\x4f\x8a\xbd\x0b\x24\xb3\x52\x3a\x2c\x52"
-	"\x02\x33\xa1\x3e\x82\xb5\x2c\x05\x81\xa5\xac\x82\x59\x2b\xa4\x42\x07\x79\xa9\xae\x90\x28\x53\x35\x5b\x16\x04\x61\xf9\x1a\x74\x36"
-	"\x02\xa1\xb1\x61\x33\x03\xa0\x19\x41\x73\x48\xde\x1b\x41\x9b\x34\x91\xa7\xaa\x83\x02\x81\x6d\x40\x65\x6e\x16\x78\x0b\xda\x6f\x83"
-	"\x6a\x61\xd7\xc7\x55\x04\xc2\x4b\x50\x78\x20\x7b\x6c\x32\x47\x0e\x72\x4e\xcd\x41\x45\x00\x01\xef\xa8\x0e\x38\x9a\x83\x0f\x28\x88"
-	"\x95\x80\x18\x95\xc8\x14\xc4\x79\xdf\xc6\x02\x46\x65\x7b\x5b\xd9\xcf\xb5\x55\x01\x00\x20\x79\x77\x79\x77\x08\xf0\x21\xe0\xf7\x2b"
-	"\x02\x0e\xe1\x01\x8c\x80\x26\x9e\xc9\xf4\x1f\x75\xb0\x30\x99\xb7\x2a\xbc\x99\xe0\xdd\x22\x40\x3b\xa5\xc0\xb9\x8d\x0f\x15\x01"
+	"\x28\xb5\x2f\xfd\xa0\xa2\xaa\x04\x00\x84\x84\x00\x3a\x8f\x14\x1a\x2f\xa0\x6c\xc6\xcc\x31\xa8\xa7\xed\x02\x5f\x61\xf5\xae\x50\x0f"
+	"\xfe\x5a\xfb\x12\xc4\x31\xf3\x41\x5f\x9e\xce\x53\x97\x49\x64\xdd\x37\xe8\x9d\x96\x20\x62\x1a\x9b\xf0\x3a\xbc\x0e\x16\x16\x6c\xae"
+	"\x9f\x01\x88\x01\x9c\x01\x09\x95\xd6\x13\xf0\x4a\xeb\x02\x8f\x3a\xe0\x9d\x7b\x10\x62\xb8\xc3\x0d\x54\x7a\xd4\x21\x3d\xea\xb8\xfd"
+	"\x11\x0a\x8f\x76\x5d\xe6\xc0\xb2\xae\x2a\x56\x1a\x3d\xe1\x95\x3e\xf0\xf2\x5f\x75\xf9\x8c\x47\x1f\xb7\xef\xb8\x08\x9a\x68\x59\x57"
+	"\x45\x71\xcc\x07\x6c\x34\x14\x60\x00\xde\x97\xc3\x6e\x87\xf5\xc5\x38\x0a\xbe\x1a\x5f\x2e\x05\xc3\xde\xf5\x88\xcf\xb3\x5d\x6c\x33"
+	"\x70\x80\x37\xce\xb2\xae\xaa\x11\x6d\xda\x26\xc1\xfb\x6e\x88\xc6\x98\x76\xb9\x90\x86\x8a\x75\x6b\xf7\xd2\x65\xf8\x0b\x14\xe0\x09"
+	"\xd7\x00\x6b\x6e\x7b\xf8\xa1\xea\x8c\x65\x8a\x24\x5f\xda\xb8\xa2\xef\x03\x00\x4d\x84\x4c\x73\x1b\x6b\x44\x43\xc5\x19\x2b\x7d\x3e"
+	"\xe5\x1d\x08\x31\xee\x72\x7b\x6a\x2d\xfd\xe8\x9c\x1e\x5d\x88\xb2\xab\x72\xe9\x9c\x71\xfe\x79\x54\x3e\x42\xfb\x85\x84\xcf\x18\x3d"
+	"\x0a\x6d\x68\x67\x09\x95\xce\x99\x82\xc9\x40\xdf\x83\x37\x0c\x7b\xd4\x3e\xc6\x0a\x6f\x5d\x16\x2a\x46\x01\x62\xa4\x70\x67\x17\xb4"
+	"\xf7\x70\x95\xbd\x69\xa8\xcd\x65\x89\xb6\xc1\xec\xba\x97\x8d\xbb\xaa\xeb\x80\x35\xb6\x6c\x1a\x7f\xb7\xe1\xc2\x65\xdf\xb6\xa5\x72"
+	"\x61\x06\x8d\xbf\x8b\xd5\xea\x6a\x12\x89\xb6\x1d\x67\x2e\x08\xb4\xb3\x0b\xd1\x50\xd5\x3d\xa0\xba\xf4\x03\xac\xb1\x45\xbb\xb0\x06"
+	"\xf9\xa1\xc2\x74\xc6\xfc\x92\x77\x9d\x1d\xb8\x17\x09\x26\x6b\x44\x13\xc1\x63\x9d\x40\x8d\xf7\x76\x55\xb0\x7e\x82\x47\xb0\xc6\x16"
+	"\x0d\xd2\x65\x0e\x2a\xdc\x04\x37\xae\xb1\x65\x71\x13\x8a\x24\x02\x79\x78\x78\x6b\xdc\x49\xb4\xed\xd2\x83\xdd\x8b\xce\x59\x57\xc9"
+	"\xae\x4f\xdf\x48\xd3\x50\x11\x1a\xca\x00\x49\x04\xf2\x04\x6f\x18\x80\x29\xd9\xdd\x5b\x76\x49\xb4\xed\x3b\xbb\x38\x44\x43\xd5\x86"
+	"\x03\x04\x08\x0d\x14\x70\xf0\xf0\x04\xcf\xf2\xb5\xaf\x2d\x6b\x92\xfb\x68\xdf\x8c\x59\x88\x26\x82\x6f\x93\x4b\xef\xcd\x40\xf2\x80"
+	"\x7c\x53\x38\xbd\xb7\x95\x56\x67\xa1\x30\x2d\x18\x90\x82\x62\xa1\x20\x31\x68\x95\x8b\xba\x88\x18\x8c\x48\x41\xa1\xd2\x3a\x49\x55"
+	"\x6a\xc8\x0f\x93\x8a\xde\x1e\x33\xdf\x67\xf4\x68\xd7\x3d\x9a\xa6\x4a\xeb\x13\x8f\x8f\x12\x85\xa6\x07\x31\x59\x93\xd3\x54\x29\xde"
+	"\x30\x8c\x68\x28\x06\x85\x1e\x44\x13\x17\x35\x7a\xa2\x5a\x2b\xad\xb7\x0a\xee\xc1\x5b\x17\xa2\xa1\x3c\xa8\x5d\x2e\x46\xb9\xbd\x87"
+	"\x68\x22\x68\xa2\xf7\x49\x45\x43\xf2\x83\xbe\x38\xbb\xb0\xcf\x2a\xe5\x9d\xdb\x6f\x8c\xdb\xb0\x8e\x7c\x3a\xe0\xce\xd5\xed\x2b\x85"
+	"\x2e\x2f\x3f\x1d\x3e\xed\x29\x58\x83\x60\x93\xab\xd2\xe9\xf6\x5b\x95\x1b\x20\x17\xce\xb1\xb7\x2c\x53\x32\xd4\x41\x66\x3e\xea\x20"
+	"\x3f\xc7\xc1\x41\x7a\xd4\xe1\xf6\x47\x44\x13\xad\xf0\xce\x1d\x9f\x91\x04\xdc\x14\x8c\x59\x58\xdf\xde\xe1\x91\x4c\xbc\x6e\x1b\xce"
+	"\x2c\x15\x2e\xeb\xcf\x48\xdc\xee\x35\x81\x77\xe4\xab\xf5\xd1\x6a\x5d\xbe\xd2\x3a\xc9\x84\x3d\xc6\x2e\x65\xbb\x77\xa9\xa8\x2a\xa9"
+	"\xba\xf3\xa8\xaa\xee\xbc\x56\x77\x63\xf8\x51\x28\x28\x74\x7b\x05\x23\x62\x3c\x53\xf5\x54\x0a\x1a\x25\x6e\x1f\x55\x10\x34\x41\x15"
+	"\x83\xa1\x78\xaa\x49\xaa\x8a\x5a\xfd\xf1\xdf\xa5\x62\xfa\x2e\x2f\x4d\xee\x3c\x9a\x7c\x7a\x97\xd0\xe4\xce\xbd\xcb\x3f\x93\xc3\xec"
+	"\xba\x1c\xe2\x7d\x35\xb7\xef\x76\xfb\xed\x5e\x0c\x45\xa5\x53\xe2\xf6\x0a\xa9\x4a\x74\x71\xfb\x69\x5a\x50\x29\x71\x7b\x29\xaa\x0c"
+	"\x06\xad\xb7\x8f\x26\xc6\x82\x3e\xb7\x87\x26\x8b\x85\xe2\xa1\x35\x71\xfb\x67\x62\xff\x45\x76\x6e\x64\xdb\x96\xb1\xca\xab\x85\xdd"
+	"\xeb\x92\xb3\x0f\xcb\x8f\x07\x0b\x8d\x2e\x73\x10\x41\x7e\x92\x32\x19\xea\x90\x99\x08\xfa\x3e\xea\x90\x9f\x93\xf9\x3c\x1a\x2b\xad"
+	"\x9f\xb1\xfa\xfc\x68\xc7\x7d\xc6\xe7\x09\x5e\xa9\x22\x15\x5e\x2e\xc3\x7b\xdf\x2f\x78\x13\x01\x81\x68\xa8\x4a\x17\x09\x13\xad\xd5"
+	"\xf9\x97\xf1\x68\x84\x9f\x08\x04\xa2\xa1\x1c\xd9\xc0\xc3\x0f\x01\xdc\xa3\xd1\xbd\x0a\x80\x30\xee\x80\x06\x0a\x1a\x4a\xda\x43\x00"
+	"\xd1\x31\xa1\x61\x42\x00\xd9\xdb\xf5\x78\x02\x03\x61\x5b\x2a\x17\xd6\x50\x0d\x44\x11\x04\x3d\x0f\xd5\x40\xbd\x73\xbc\xdd\x89\x7d"
+	"\xbd\xfb\x56\x97\xf0\x76\x27\x7f\xc8\xc7\x85\x85\xcb\x37\x22\xf6\x8d\xc8\xac\xf6\x0b\x8f\x3e\x25\x0b\x0d\x87\x02\x12\x24\x7c\x81"
+	"\x7c\x64\x4c\xd1\xa4\x80\x18\xd3\x23\x3d\x34\x92\x95\x42\xf0\xf6\x97\x9c\xe1\xca\xb1\x77\x9e\x38\x03\xc3\xed\x1b\x0d\x0d\xf6\x0d"
+	"\x5e\xa5\xe2\xfc\xf2\x70\x6b\x08\xb6\xcb\xdb\x47\xbc\x4a\x05\xba\x16\x0d\xbb\x0c\x91\xcf\x86\x9d\x2b\x87\x02\x0f\x1e\x48\x1a\x11"
+	"\x4f\x4a\x1e\xbc\x7c\xac\xd6\x13\x8f\x95\x3e\x10\xde\x79\x85\x24\x7b\x88\x61\xe7\x2a\xf2\x00\xe5\xc2\x2c\x14\x88\x64\xa1\x01\x49"
+	"\xc1\xc0\xdd\xb7\xb1\xb3\x2b\x6b\x52\xf4\x48\x16\x14\x8a\x07\xb6\x7b\x99\x26\x49\xca\x15\x9e\x60\x37\x8a\x2a\x79\x61\xbb\x3a\x08"
+	"\x82\x9e\xa7\x11\x55\x97\x7e\x80\xc9\xd5\xb5\x6c\xdf\x3a\xae\xe3\x3e\xe1\xb6\x65\x4d\xb9\x3c\xc6\xee\x4c\xd3\xa0\xcc\xe7\xd1\x0d"
+	"\xcd\xcc\xe7\xd1\x0c\x7a\x3e\xe3\x96\xb5\xcf\x9d\x2b\x0d\x4a\x5b\xd6\x2e\x3a\x5b\x5b\x76\xf5\x03\xe5\xba\xdc\xec\x93\xba\x43\xd1"
+	"\x35\x91\x74\x8f\xba\x47\x0a\x68\x7a\xa4\x8a\xc9\x0e\x51\xc7\x49\xee\x21\x68\x67\xb8\x92\xdd\x2d\xb9\x16\xd1\x34\x54\x9d\x91\x4f"
+	"\xc7\xe7\x03\x01\x6f\x5f\xad\x84\x7d\x3c\xf1\x08\xc4\x99\xeb\xf6\x8e\xee\x51\x61\x94\x9e\x87\xd6\x4f\x85\xc5\x44\xeb\x27\x83\x01"
+	"\xd1\xea\x4d\x0f\x4a\x54\xf4\xa8\xd8\xdd\x49\x78\x77\x7b\xcf\xca\x77\x88\x86\xc2\x9a\xdb\xb2\xe6\x61\xed\x5e\x70\x96\xf7\xa5\xb9"
+	"\x78\x20\xe9\xa9\x0a\x50\xf4\x40\x53\x73\x3e\x20\x10\x08\x04\x02\x81\x48\x19\xc6\x9e\x60\x65\xac\x14\xfa\x82\x67\xd8\xb2\x2b\x59"
+	"\x86\xb1\x28\x1f\x55\x4b\x46\x50\xa0\xb5\xd2\x67\x7a\x68\xad\xf4\x49\x38\xa8\x98\xf0\xf8\xd1\xc7\x13\x57\xa0\x11\x84\x97\xb7\xce"
+	"\x1f\xff\xe8\x00\x03\x24\x32\xf4\xa9\xdc\x46\x4c\x82\xfd\x23\xce\xc7\xec\xb8\x87\x76\x61\x14\x4a\xde\x7e\x6f\x57\xa5\x98\x20\x0c"
+	"\x7d\x2a\x77\x8e\xa1\xb5\x72\xfb\xcf\xa3\x4f\xa5\x72\x9f\xe7\xa9\x5c\xfa\x9c\xf6\xb5\x72\xa9\xe3\xe4\x3b\x04\x9e\xfd\xfb\xf6\x13"
+	"\x7c\x27\x4e\xc0\x17\x58\xe7\x1e\xcd\x32\x34\x4b\x3c\x7e\x9b\xdc\x27\xfe\x51\xeb\xd3\xa3\xd6\xad\xdb\x1f\xc2\xae\xae\xb0\xe5\x6e"
+	"\x0a\x04\x5c\x65\x0a\xae\x1e\x41\xcf\x04\xe9\xab\xf1\x5d\xdd\x71\x97\x1e\x89\x76\x35\xf2\x83\x65\x6b\xb8\xaa\x30\x9d\x13\xc8\x0f"
+	"\xda\x85\x51\x9e\x5a\x59\x80\x42\x89\xcb\x7f\x9f\xd2\xa3\x5b\xd6\x20\xdc\xb2\x16\x41\x92\xea\x6a\x0b\x50\x0a\x68\x17\x66\x41\x98"
+	"\x0f\xf3\x7d\x3e\xdb\x67\xdd\x9e\x07\xfb\xcc\x78\x54\xb3\xaf\xd8\x13\xff\x2a\x66\xff\x60\x0a\x1f\x06\x75\xce\x98\x55\xb1\x85\x76"
+	"\xfb\x0f\x83\x90\xef\x6a\xcd\xa0\x01\x61\xbe\xc7\x27\x35\x21\xe9\xd6\xa9\x32\x7c\x05\x54\xbd\x3d\xbc\xce\xd6\x17\x33\xf2\x4e\x43"
+	"\x49\x7b\x48\x62\xec\xe7\x8c\x51\xa5\x15\x42\x4d\x63\xcc\xa3\x0b\x5c\x93\x8f\x3a\xf6\x0f\x6c\xf7\x80\x7d\x2f\x97\xec\x19\xec\x7b"
+	"\x89\x13\xee\x5c\xd9\x2f\x00\x9f\xf8\xe7\xd1\xd8\x71\x92\x0e\x42\xc7\xbe\x97\x43\xd2\xe5\x23\xcc\x70\xdc\x92\x93\x1c\xa4\x7c\xd4"
+	"\x9e\x7b\x85\x2e\x1f\x27\xc9\xa3\x70\x77\xdc\xe7\xa6\x5c\x8b\xc2\x64\xe4\x63\x86\x6a\x9f\x1e\xd5\xa0\xa6\x33\x96\x23\x91\x81\x21"
+	"\x12\x89\x0c\x9f\x91\xc8\x9d\x37\x30\x44\x40\xc8\x47\x89\x68\xa0\x12\x8f\xce\x1f\x1a\x83\xf8\xa8\x72\xdb\x92\x39\xc5\xcc\x8c\x88"
+	"\x48\x92\x24\x69\x0d\x02\x09\x10\x86\xc3\x59\x92\x45\x51\x8a\x75\x34\x0f\x12\x40\xc0\x68\x34\x89\x72\x20\x08\x52\x08\x19\x62\x08"
+	"\x21\x86\x10\x11\x11\x11\x09\x44\x44\x44\x44\x24\x49\x92\x74\x74\x7a\xe9\x70\x10\xc7\xca\x1b\x9a\x5a\x7c\xe1\xac\x05\x15\x20\x37"
+	"\x0f\x91\x80\xc8\x53\xd3\x0a\x02\xd6\xda\x61\xcb\x90\xf2\xd0\x4e\xa6\xeb\x38\x4a\xad\xe2\xc6\xb1\xde\xc1\x5f\x59\x2d\x55\x1c\x62"
+	"\x68\x46\x77\x14\xa5\xfe\x1e\x93\x8b\xdd\x36\x12\xf1\xac\xa1\x41\xbc\xea\x4a\x14\x38\xbf\xa4\x11\x57\xf5\x4e\xfd\x16\xa3\x70\x45"
+	"\x38\x61\x77\x26\x9c\x8d\x12\x3e\x4a\xc2\x63\x8e\x70\xf3\x3c\x01\xe0\x95\xb0\x13\x48\xd8\x87\x29\x24\xda\x55\x20\x47\xd8\x3c\x42"
+	"\x6d\xa4\x49\x1d\x8e\xf4\xc5\xb0\x10\x5d\x4f\xcd\x0a\xc2\xc6\xc8\x1d\x40\x92\x04\x16\x95\xae\x2c\xcc\x97\x6a\xa2\xcd\xc8\x9f\x97"
+	"\xea\x88\x65\x84\x46\xe5\xbf\x24\x13\x72\x93\x61\x30\x6b\x2c\xa3\x22\xd8\xb5\xd6\x6c\x5c\xc4\x48\x41\x31\x14\x88\xfc\x6a\x00\x58"
+	"\x8c\x10\xc3\x58\x54\x00\x69\xab\xad\x3c\x71\xad\x45\x07\x80\xbe\xc8\x16\xc6\x3c\x85\x0c\xc6\x6b\xc4\x47\xae\x5c\x07\xc6\xe1\xe5"
+	"\xd8\xa2\x1c\x3a\x8d\x95\x98\x54\x9a\x54\xc6\x42\x65\xae\xc8\xd2\x03\x90\x69\xc4\x74\xcd\xcb\xd6\xc7\x78\x57\x40\xa5\xd3\x94\xd4"
+	"\x75\x77\xf4\x01\xb3\xdc\x32\xcf\x3d\x54\xf3\xfa\x44\x19\x30\xc6\x1e\xb7\xa9\x56\xf2\x04\x43\xcd\x50\x9e\xdf\x17\xd8\x21\x4d\x50"
+	"\x74\xeb\xb8\x03\x2d\x88\x2e\xc2\xc7\x92\xc6\x58\x49\x84\xe5\x42\x70\xd4\x25\xfd\x68\x7c\xc8\xb7\x54\xf5\x89\x3e\x27\x3e\x7d\x87"
+	"\x25\x0a\xb4\x8e\xdd\x1a\xea\x09\xeb\x53\xe8\xa8\x8c\x4a\x4d\xa9\x1b\x7d\x15\x9b\x0a\x83\x33\xe9\xa4\xd5\xc1\xef\x1b\x2b\x69\xe1"
+	"\x93\x6a\xb9\x91\x74\x75\xca\x4e\x52\xad\x3e\x24\x04\xf7\xcd\x23\xce\x69\xc1\x90\x18\xe1\x92\x66\x84\x5f\x9c\x92\x47\x5b\xe7\xf7"
+	"\x2c\x49\xc1\xc5\x7f\x49\xd9\x80\xc9\x04\x3c\x63\x4a\x44\xab\x96\xe4\xf9\x13\x9f\x01\xb5\xe4\x34\xc1\x7c\x89\x06\x14\x55\x9d\xe8"
+	"\x27\xf9\x2c\xd8\x6a\xe0\x7e\x74\x02\x03\x88\x44\x79\x8a\xe6\x7e\xec\xf2\x94\xe4\x36\x12\x56\x30\x83\xfc\x63\xa5\x67\x04\x1d\x62"
+	"\x12\x1d\x36\x9a\x4a\x34\x4f\x5e\xad\x02\x43\xff\x61\xd2\x99\x66\x99\xa2\x0e\x52\x43\x3a\xdc\xa1\xae\xb8\xe2\x1c\xc4\x61\xe1\xe1"
+	"\x5c\xa9\x74\x27\xf5\x59\x90\x45\x89\x2d\x2f\x9f\x45\x9f\x2b\xea\x7d\x13\x40\x11\xf0\xcb\x50\x6a\x5a\x78\xe0\x4a\x5d\xf0\x67\x21"
+	"\xd1\x6f\xa2\xe9\xd7\xca\xb2\x91\xce\x03\x21\xcb\x6b\x5a\xbc\x12\x59\xee\xf1\x36\xea\xc8\x72\x9b\xf6\x5f\x4c\x96\xbb\xa3\x5e\x81"
+	"\x60\x85\xa8\x14\x82\xa4\x0a\x3d\xf4\x71\x91\x1d\x59\x6c\xb6\x05\xc1\x31\xbc\xb9\xc2\x55\x87\xf4\x05\xa4\x88\x83\xf7\xf3\x40\x5f"
+	"\x66\x99\x84\x92\xf0\x4d\x87\x88\x21\xb2\x37\x0f\x98\xd1\x6b\x0a\x19\x72\x6c\x69\x6a\xf5\xd2\x5c\x59\x3d\x84\x26\xd5\xa5\xd9\x2b"
+	"\x6d\x59\xca\x10\x3c\x02\xd9\xad\x0e\x93\x5e\x8b\x06\xf1\x05\xe7\xa5\x4a\x9b\x5c\x61\x2f\x2c\x0c\x30\xa9\x49\x4c\xf2\x4f\xc2\x68"
+	"\xdb\xe1\x24\xbb\xf2\xb6\xe2\xdd\x15\x6e\x57\x3b\xb1\xad\xa8\x15\xaf\x30\x1a\xa2\x30\x50\x88\xd6\x21\x02\x57\x11\x5a\x6f\xcb\x99"
+	"\xef\x92\x76\x0e\x43\x13\x96\xcb\x68\xc9\x2e\x54\xc5\x14\x7a\x04\x18\xdc\x3b\xe1\xbf\x2b\x3c\x74\xb1\xe4\xe3\xf2\xe1\x84\x44\x9b"
+	"\x85\x49\x76\x90\x10\x7b\x63\xf4\xe2\x4a\xf8\xbf\x28\x97\xa0\x37\xcf\x84\x48\xc8\xe2\xc6\x50\x0d\x96\x3f\x44\x64\x06\x19\x0c\xe5"
+	"\x0e\x16\x7e\xed\xd9\x60\xc3\x65\xf6\x21\x9c\xc5\x58\x99\xf8\xd8\x09\x47\x27\x09\x1f\x5d\x0c\x15\x63\x07\xb1\xa4\xf8\x6b\xb8\x2a"
+	"\xb0\x4b\x38\x76\x19\x8c\x67\x75\x22\x44\xca\x22\x27\x09\xd0\x35\x59\x9c\x30\x58\xeb\xcb\x85\x13\x9e\x8e\x91\xa7\xd9\x12\xc0\x09"
+	"\x6c\x59\x74\x3e\x12\xfb\x43\xff\x31\xa3\x3e\xe4\xb0\x31\x62\xfc\x29\x25\x8e\xe7\x81\x78\x1c\x4b\xad\x8f\xac\xf4\x61\xb1\xce\x6c"
+	"\xf2\xfe\x67\xc1\x43\x49\x76\xeb\xf6\x0e\x48\x8c\xad\x1b\x4d\x49\x5c\x53\xda\x11\x21\x03\x37\x6e\x38\x9b\x7d\x27\xe3\xd7\x7d\x12"
+	"\xf1\x54\x8f\x01\x78\xc1\x73\xf0\x6a\x1d\x3a\x95\xf4\x82\x82\x95\xd4\x76\xf5\xaa\x39\x16\x7d\x01\xb2\x44\xfc\x72\x1a\xf3\x5b\xc4"
+	"\x1c\x98\xc4\x07\x95\xe9\x1a\x3a\x34\x84\x67\x20\x4e\x66\x0b\x1b\x56\x7d\x1b\xae\x13\x0e\x4c\xb0\x52\x0b\xa7\x13\x08\x23\x84\x95"
+	"\x4c\x47\x28\xc9\x44\x43\x67\x96\xc7\x5c\x5d\x97\xf8\x4d\x31\x4b\xf5\xfb\x67\xd0\xfb\xa2\xb5\xc9\xbb\xbd\x15\x82\x4f\xc9\xdd\x96"
+	"\x55\xfe\x2d\x14\xf9\x78\x2b\xeb\x01\x54\x86\x94\xb0\x8f\xd8\xff\x3b\x59\xfe\x11\xf5\xbe\xcb\x24\xe7\xbf\xa2\x0e\xee\x44\x4f\x09"
+	"\xa3\x1f\x63\x0f\x70\x84\x98\x2b\xb6\xa1\x0f\x96\xf5\xe0\x9a\x89\x88\x53\xce\x8a\x01\x40\xc7\x88\x10\xda\x7b\xd1\x20\x15\x17\x9b"
+	"\xa9\x60\xca\x21\x29\x6b\x57\x7f\x2b\xf6\x4a\x76\x2d\xd6\x56\x37\x06\xcb\x0c\xb1\x48\xba\xa8\x91\x04\xf9\x70\x81\x0f\xb2\x4c\x7b"
+	"\x9b\xac\x6c\xed\xe1\xe0\x99\x6b\x8d\x05\x95\x36\xb8\xfa\x40\x14\x41\xbb\x60\x92\x02\x9e\xdc\x7d\xa4\xce\x2f\x00\xea\x87\xdd\xb4"
+	"\xa1\x00\xcb\x53\xbb\xeb\xbe\xcb\x6f\x52\xe5\x62\x0a\x47\xb3\xa3\x82\xdf\x00\x82\x88\x5f\x1a\xe6\x02\xfa\xaf\x5f\x40\xc4\x16\xc4"
+	"\x9b\x42\x98\xb7\x21\x6a\xca\xc6\xb2\x24\xf3\x1b\x42\xed\x1b\x2c\xbb\x82\xae\xc0\xb3\xa0\xc7\xd6\x58\x51\xdb\x5c\x0c\x49\x7a\xb1"
+	"\xaf\x6b\x41\x5f\x9e\xc1\x90\xc8\x5b\x05\x70\xaa\x18\x4d\x30\x94\xec\x0d\xd8\xe1\x53\xa1\xb0\xd5\x9a\x2f\x3e\xdb\x0c\x3f\x6b\xf2"
+	"\xeb\xf4\x48\xc6\x43\xb7\xc9\x44\x53\x63\xf7\x0c\xcb\x5c\x7d\xf1\x1f\x40\x06\x40\x39\x8b\x24\xc4\xf9\xd2\xf1\xc2\xc1\x08\x5e\xbd"
+	"\xce\xb4\x14\x1c\xae\x31\x5c\x21\x0d\xaf\xd2\xb8\x89\x3a\x68\x6a\xc7\x15\x61\x4f\x10\x62\x39\xd4\x4d\x88\x14\xe2\x90\x58\xb7\xd5"
+	"\x67\x3c\xde\xf0\x82\xe9\xa3\xbf\x25\x42\x47\x21\x2a\xe8\xaf\xc2\x51\x0d\xb0\x6e\x93\x07\x45\x7d\x77\x13\x1e\x6f\x3a\xf8\xb7\x60"
+	"\x74\x24\xcc\x28\x2f\x61\xce\x5e\xce\xe0\xf0\x00\xaa\xc0\x1f\x06\xc7\x5a\xd0\x84\xa2\x03\x4e\xf9\x02\xe2\x1f\xd1\x83\xdf\x89\xc7"
+	"\x9f\x88\xc7\xdf\xdb\x46\x76\xf3\x42\x68\x96\x87\x2d\x9a\x5f\x8e\x38\x68\x5f\x09\x0c\x33\x1a\x53\x5f\xcf\x4d\xeb\xc5\xe1\x4c\x27"
+	"\x93\x7a\x5e\x97\xb0\x6a\x2c\xaa\x6e\x1b\x8e\x3c\x82\x2b\x00\xec\xba\xf6\xf0\x63\xac\xdb\xfd\x32\xe9\xd7\xc1\xd9\xa1\xc0\x92\xd0"
+	"\x2d\x59\xfb\xec\x1a\xa2\x6f\xa1\xc9\x5c\xb8\xe6\x02\x38\xf7\xb7\x15\xee\x5e\xb4\x92\x02\xe6\x8b\xfd\xb6\x7d\x4e\xcf\xad\xaf\x19"
+	"\x7a\x0e\x13\x26\xd5\x84\x41\x7a\x9c\x61\xc7\xa3\x45\x76\x6a\xe6\xec\x4c\x7e\x2e\xf6\xfb\x35\xd4\xd2\x71\xa1\x01\xcc\xd9\x1f\x18"
+	"\xe2\xfb\x3c\xa3\x2e\x44\xe3\xdf\x68\xf9\x40\x45\xf0\xdf\x91\x09\xc4\x48\x99\x16\x80\x61\x2d\x3a\x59\xaf\xd0\x7e\x2f\xa4\xa1\x4c"
+	"\xd4\xa8\xcc\x06\x27\x11\x48\x65\xca\x1f\x1f\xc6\x40\xa9\x86\x4b\xe3\xb7\xa7\x2b\x5b\x7a\xfb\x70\xc3\x1a\x67\x7b\x64\xd5\xc8\xaa"
+	"\x48\xcf\x8f\xfa\x47\x17\xc8\x84\x5c\x8f\x8b\xae\xf5\x8d\x9b\x66\x1d\xc8\xeb\x86\xe4\x59\x79\x0b\x99\x3f\x93\x74\xc2\x14\xae\x6d"
+	"\x98\x6d\xce\x20\x67\x97\x15\x6e\x4f\x93\xa5\x41\x06\x6b\xe6\x72\x5b\xc7\x66\x02\x82\x4a\x72\x5e\x68\xb5\xd1\xc9\x66\x39\x67\xd9"
+	"\x02\x7c\xce\x39\x27\x6e\x47\xcd\x24\xdc\xe3\xdc\x16\x73\xb6\x8e\x77\x18\x2c\x3a\xc7\x31\x7e\x07\x72\x0e\xef\x26\x9f\x8b\xe1\x8a"
+	"\x42\xb6\xc6\x96\x0e\x61\xe1\x33\x74\x08\x04\x07\xa9\xdb\x72\x55\x64\x52\x93\xa2\x6a\x40\x15\x3e\x10\xe9\xab\xd6\x95\xdf\xd2\x35"
+	"\x3e\x76\x4e\x50\x9b\xbf\x7a\xb9\x6f\x34\x71\x02\xcd\xac\x38\x19\x34\xa8\xea\x6b\x46\xe4\xb0\xda\x49\x86\xe6\x0c\x97\x01\x49\xba"
+	"\x57\x1e\x94\xf6\xc4\x1b\x15\xdb\x66\x93\x04\x94\x47\x7b\x8f\xd6\x01\x30\xf4\xa5\x8e\xf5\xe0\xfa\xf6\x81\xc7\x85\x40\x1b\x84\xd9"
+	"\x92\x3b\xa2\x09\x4e\xa4\x6d\xb0\x8c\xde\x40\x60\x32\xa5\x71\xba\x95\xee\xdc\xfc\xae\x27\xf3\xe2\xd4\xce\x7b\x9e\x2f\x62\xb9\x14"
+	"\x48\x50\xd7\x6e\x1c\x79\xe8\x50\x26\x14\xda\xb7\xf7\x6e\xa2\x0e\x21\x33\x71\x4e\xed\xba\x42\x18\x31\x3d\x94\x15\x1e\x5d\xc0\xd5"
+	"\x68\xaf\x15\x40\xcd\xa1\x7e\x1e\xb9\xd0\x46\x67\x20\x1b\xc9\xcb\x0f\x4d\x52\xf5\x26\x3b\x94\x8f\xfc\x32\x5f\xd7\x82\xf8\x63\x50"
+	"\x5f\xfd\x59\x5f\xef\xdf\x7b\xdf\xd4\x78\xa1\xce\xb3\x3e\xd9\xd9\x90\x02\xb1\x49\x1a\x63\xab\x21\x5e\xb8\x5c\x0e\xd8\xf6\xf6\x01"
+	"\x2b\x93\x31\xd5\x18\xf1\x19\xd3\xd4\xec\x5d\x78\xe9\x9e\x18\x93\xfb\x25\x6b\x71\xd8\x14\x26\x59\xec\xbe\xa8\xb3\x5f\xe2\xa1\xb4"
+	"\x2b\xde\xcb\x04\xa1\x7b\xdf\xc6\x8e\x45\x95\xe1\x42\xc4\x00\xb0\xd3\xf0\x96\x3b\x74\xee\x24\x22\x51\x96\x07\x07\xd8\x01\x94\x03"
+	"\x12\x04\x2c\xb0\xc0\x15\xd8\x9c\x40\xc6\x59\xdb\xbd\x49\x40\x7d\xfb\x5f\x4e\x1c\xb2\x0b\x96\x82\x36\xe0\x5b\x13\x02\x04\xea\x26"
+	"\x5c\x09\x52\xd2\x99\x4b\x7f\x05\x14\xf9\x1f\x5f\x33\x56\x56\xcf\x1d\xe7\xeb\x4d\xfd\x8a\x02\x06\xd7\x32\x70\xd3\x35\xf0\x38\x78"
+	"\x60\x9d\xd5\xb3\xdd\xd0\x63\xab\x0d\x47\x2a\x18\xdc\xa1\x87\x71\x35\x80\x53\x8c\xe7\x71\xb7\xf0\x65\x88\x92\x93\xfa\xe2\xa1\xfe"
+	"\x4d\x1a\x9a\x39\xd3\x7e\x89\xf3\xb8\x9e\x96\x5b\xa6\x94\xcc\x19\x89\xfb\x3e\x69\xf2\x42\x1f\x48\xe2\xd9\x49\x0a\x09\x4b\xb2\xae"
+	"\x1b\xa8\x2a\x38\xdc\x09\x83\x6e\x63\x60\x68\x8b\xe2\xd9\x9f\xdb\x67\xa7\x86\x9e\xd5\xff\x8a\xae\x7e\xf8\x24\x30\x35\xe9\x04\xda"
+	"\xde\x5b\x97\x0e\xa3\xdd\x4e\xac\xb1\x37\xa1\xba\xcc\xf2\x5a\x86\xe5\xb2\xdb\x9e\xf5\xf5\xd1\xbe\x2c\x15\x92\xf8\xa6\xc8\xef\xd8"
+	"\xf7\x72\xc8\x20\x02\xbb\x2f\xde\xc9\xfc\x40\x91\xbb\x79\xc7\x00\x1e\x23\x7c\x95\x31\xcc\x08\x32\xee\x11\xb0\x20\x75\xe6\xa6\x26"
+	"\x8f\xb8\xb7\x3a\x00\x10\x62\xd0\x86\x1e\x22\xff\x25\x78\x4a\xc4\x9f\x61\x3e\xb6\x7a\x2d\x11\x12\x1e\x73\xe4\x03\x0d\x4e\x69\xf5"
+	"\x5d\x3b\xd5\x21\x33\xa8\xd6\xb5\x67\xd4\x1e\xf1\x3d\x9a\xeb\x87\x79\xc8\xd2\xc1\x70\xb1\x93\x4f\xb1\x7f\xf8\xdf\x80\xed\x03\xa9"
+	"\x29\x98\x2a\x0c\x7b\xb9\x2e\x82\xcf\x60\x62\x9e\xd6\x4c\x51\x69\xe1\xd8\x6a\xde\x0d\x99\x16\x66\x00\x2c\x81\xe4\xb8\x63\xfe\x8a"
+	"\xdb\xd8\x42\x90\xc0\xc7\x4a\x82\x78\xe8\xc3\xae\xb6\xac\x76\xf5\x10\x05\xff\xca\x16\xb3\x08\x32\x94\xee\x30\xcb\x8f\x22\x99\xbf"
+	"\xb4\x27\x51\xa7\x6c\x77\x9d\xee\xd7\x96\xcc\x51\x97\x37\xd2\x40\xc1\x85\x6a\x5e\x66\xb4\xae\xd1\xc2\x06\x95\x29\x75\x03\x10\xf5"
+	"\xdc\xe8\x05\xba\xf9\xc9\xcd\x9c\xa1\xc6\x28\xcc\x52\xea\x21\xaa\x15\xe7\xde\x30\x40\x54\x6e\xb2\xb6\x0f\x39\xb4\x20\xb7\x0f\x07"
+	"\x72\x56\xe1\xac\x08\x1d\x81\x99\xa0\x51\xe9\x50\x82\x3e\x53\x88\x9b\x9b\xb6\x05\xcd\x17\xb5\xa4\x12\x0d\x23\xde\xaa\x55\xea\x5c"
+	"\x20\x59\xe1\x9b\x65\x50\x65\x4b\x49\x28\x3d\x94\x23\xee\x4c\x82\xad\xa0\x7a\x2d\xc8\xbc\xba\xe6\xf2\x9b\xc5\x35\xc5\xcc\x19\xf4"
+	"\x16\x5c\xd8\x3f\x01\x38\xef\xa6\x86\x0b\x16\xa5\x0f\xd8\xc9\xe6\xe6\x2f\xa2\xf4\xa5\x08\xcb\x5b\xf9\xc8\x55\x8a\xea\x09\x80\x80"
+	"\x34\x6a\xa6\x95\x54\x4d\x6c\x4e\xe1\x24\x26\xfc\xf7\x17\xf9\x2f\x5b\x37\x0b\x3d\x20\xf7\x51\x6e\x9a\x45\x61\xca\x57\x01\xf0\x09"
+	"\x28\xff\xdc\x86\x96\x8a\x3a\x4a\xe0\x2a\x09\x2f\xa5\x33\x38\x38\x7c\x42\x8f\x22\xca\x19\x66\x88\x57\xa0\xdf\xf3\x80\x36\x93\x19"
+	"\xa0\x18\x32\x20\x83\xc7\x28\xa8\x8c\x13\x96\xdb\x1d\x99\x3d\xa7\x77\x77\x5b\x47\xa9\x4a\x41\xbb\x41\x20\x20\x98\x74\x07\x40\x2b"
+	"\xa1\x08\x87\x9b\xd2\x20\xdf\xe2\x25\x15\xa9\x60\x3f\x21\x71\x1c\x22\x61\x42\x28\x45\x20\x79\xaf\x33\x10\x51\x2b\x14\x19\x00\x73"
+	"\x8c\x25\x98\xcf\x72\x79\x2a\x7e\xf2\x16\x8b\xe5\x8a\x09\x92\x2c\x95\xcb\x12\x3d\xd9\xf5\x00\x04\xaa\x64\x7b\x57\xb2\x0d\x5d\x74"
+	"\x56\x69\xbd\xe8\x2c\x42\x8f\x86\x3b\x57\x08\x44\x83\xc1\x60\x32\x99\x0a\x41\xcf\xf3\x7d\x0e\x04\x3d\x8f\x47\xe5\x3d\xea\x5d\xf6"
+	"\x15\x93\x75\x74\xf9\x78\x21\x1a\xc6\xc3\xc0\x86\xb3\x3c\x79\x36\x9c\xe5\x02\xb2\xeb\x01\x08\x46\x72\x37\x4c\xb9\xaa\xec\x92\xdc"
+	"\x4b\x11\xf4\x60\x3e\xcc\x87\xf9\xac\xcc\x40\xc5\x03\xdb\xbd\x4c\xd7\x85\xa1\xa6\x6e\x67\xd7\xa6\x22\x44\x38\xf5\x4c\x09\x95\x4a"
+	"\x50\xed\x22\x78\x44\xc1\x91\x8b\xce\x19\x24\x3f\xd4\xe7\xa2\x73\x86\xc0\x03\x94\xab\x65\x9c\x25\x80\xdd\xa0\x71\x3a\xa2\x49\x61"
+	"\xd9\x37\x01\x05\x07\x21\x64\x88\x21\x44\x21\x65\x1f\x6a\xe5\x6d\xb6\x4f\x76\x66\x54\x21\x83\x1d\xac\xca\xcf\xf3\x2f\xa9\xc5\x1a"
+	"\x38\x59\xc9\x87\xf8\xcf\xe1\xf3\xa5\x5e\x28\x80\x69\x55\xff\x1e\x21\xe4\xd1\xe1\x81\x07\xaa\x1b\x0a\xf7\x2a\x5f\xf0\x81\x61\x1c"
+	"\x70\x8f\xd4\x5e\x21\xe2\xf1\x74\x5b\xb8\x15\x68\x40\x85\x55\x79\xeb\xb5\xe1\x62\x3a\xb9\xa8\x38\x2a\xfc\xd7\x0b\x74\x24\x7d\x7b"
+	"\x6d\xab\x87\xca\xaa\x3f\xb5\xcb\xee\x41\xb1\x53\xa6\x6d\x2d\x07\x62\xa7\xb3\x67\x54\x98\xbb\x72\xed\xe8\xff\xe3\x22\x1c\xa3\x94"
+	"\x48\x96\xb2\x8a\x9d\x8a\x7e\x71\xb1\x55\xf7\x76\x8d\xba\xa0\xd1\x72\xce\x46\xc3\x63\x3f\x0c\xaa\x4e\xa4\xd3\x73\x9c\x09\xd5\x54"
+	"\xf9\x71\x20\x82\x79\xfe\xca\xc4\xd6\xe6\x02\x06\x0d\x54\x0d\xef\x05\xd5\xe8\x1c\x01\xe4\x5f\x81\xe4\xdc\x4e\x01\xd1\x09\x99\xcc"
+	"\xdd\x2d\x48\xca\xd5\x15\xb0\xd1\xd6\x23\x78\xac\xe4\x66\x4a\x16\xf3\xb4\x18\x81\x89\x96\xcc\x02\xba\x0a\x01\x24\xec\x21\xf2\x2f"
+	"\x9e\xf3\xa5\x88\xd3\x73\xee\xa4\x9a\x19\x8f\xdf\xd5\x4c\xc9\xa6\xec\xe7\x9e\x1d\xb3\x79\xaf\x67\x4f\x5e\x73\x23\x93\xdd\xd9\x38"
+	"\x82\x3b\xd7\xdb\xdd\xe8\x11\xa8\x57\x79\x3f\x3c\x76\x73\x0f\x72\x27\xc4\xc4\x35\xc7\xcc\xd2\xea\x6d\xd4\xa2\xf2\x0b\xec\x6d\x97"
+	"\xad\x41\x3a\x3d\x58\xe9\x1b\x6d\x59\x27\x72\x35\xf3\x3b\xc0\x8c\xce\xea\x99\xa1\x88\x9e\xc4\x5a\x30\x6f\x43\x6b\x69\x15\x40\x39"
+	"\xb4\xc8\x67\x45\xf4\xbf\x09\x39\x65\x79\x56\x64\xc6\xe2\xbc\x96\x7c\x23\x15\xef\x53\x95\x20\xe8\x97\xe5\x73\x32\x58\xfc\x41\xb4"
+	"\xb6\x06\xd5\xcb\x37\x51\xaa\xa6\x22\x7d\x49\x9d\xeb\xc0\xdf\x0e\x3c\x94\xf9\x82\x4d\x0d\xa4\x3a\xd7\x72\x42\x0d\x3e\xd8\xa0\x86"
+	"\x48\x7d\x96\x6e\x94\x8f\x69\x50\x55\x40\x07\xc9\xf0\xc3\x99\x86\x91\x3e\x81\xa1\x4e\xb4\x5b\x72\x06\xb8\x17\x52\xdc\xc1\xd7\xe2"
+	"\x58\xc0\xd2\x40\x51\x5d\x37\x5f\xf0\x25\x72\xb9\x34\x70\x5a\x02\x16\x81\x9a\x4f\xc3\xef\x95\x1a\x82\x0c\x11\xcf\x7d\x61\x04\x35"
+	"\xa0\x3a\xb9\x97\x50\xc3\x30\xc1\x81\x19\x86\x1a\xb4\x86\x1c\x40\xef\x7b\xa3\x90\x54\xf1\x74\x58\xa9\x05\x25\xfa\x3f\x89\x83\x7b"
+	"\xc8\xe0\xa9\xd0\x2f\x9f\x3a\x57\xb6\xb0\xda\x6a\x9d\x2e\xa6\xb8\xff\xcc\xa8\x0a\x8e\xf2\x6d\x12\x32\x20\xfa\x3e\x33\x46\x40\xe7"
+	"\x7d\x0c\x83\x35\x33\x18\x6e\xf0\xa8\x8d\x61\x85\x7f\x06\xd3\x99\x70\xf1\xc5\x90\x3c\x24\xbb\x2c\x64\x17\x49\xa0\x18\xf8\x47\xb0"
+	"\xd6\x53\x21\x5c\x87\x77\x85\x59\x2b\x4d\x87\x82\x44\x01\x60\x20\x0a\xb0\x20\xcc\x28\xe9\x4b\x28\x6a\x61\x59\x39\xa4\x9a\x72\x60"
+	"\x43\x52\x74\x32\xa9\xb0\x02\xc8\x84\x2d\xaf\x59\xe0\x2c\x64\xe5\xda\x75\x4a\xa0\xdc\x6d\x56\x23\x1e\x3e\x09\x72\x02\x91\x21\xf6"
+	"\xd8\x99\x9d\x1e\xb8\x04\x10\x70\x46\x75\xc0\x69\x2a\x43\x08\xa8\x95\x80\xf8\x2a\x91\x29\x88\x6d\x8f\xc9\x02\xae\x62\x8f\x7d\xc2"
+	"\x09\x8d\x01\x00\x28\x75\x79\x77\x79\x77\x0a\xf0\xea\xa5\x44\xe3\x3c\x9e\xa2\x11\x0a\x80\x11\xd0\x80\x4f\x99\xe0\x47\x1d\x2c\xcc"
+	"\xf2\xb1\x04\x6f\x46\x5e\x57\x74\xd6\x2a\x78\xf3\x74\x53\x7e\xc3\x3f\xad\xe8\xb3\x4f"
 ;
\ No newline at end of file
@@ -67,54 +67,54 @@ const SpShaderInfo spShaders[] = {
 const SpPermutationInfo spPermutations[] = {
 	{ { 1 }, {  }, { 1 }, 0, 1715 },
 	{ { 2 }, { 1,2 }, {  }, 1715, 5659 },
-	{ { 3 }, {  }, { 1,2,3,4 }, 7374, 1167 },
-	{ { 3 }, {  }, { 1,2,3,4 }, 8541, 1167 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 9708, 11731 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 21439, 11731 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 33170, 12408 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 45578, 12408 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 57986, 11731 },
-	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 69717, 11731 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 81448, 12408 },
-	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 93856, 12408 },
-	{ { 5 }, {  }, { 5 }, 106264, 623 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 106887, 9161 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 116048, 11199 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 127247, 8746 },
-	{ { 6 }, { 3,2,9,10 }, {  }, 135993, 10784 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 146777, 9838 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 156615, 11900 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 168515, 9423 },
-	{ { 6 }, { 8,2,9,10 }, {  }, 177938, 11485 },
-	{ { 7 }, {  }, { 1 }, 189423, 445 },
-	{ {  }, {  }, {  }, 189868, 100 },
-	{ { 7 }, {  }, { 1,2,3,4,6 }, 189968, 2196 },
-	{ { 7 }, {  }, { 1,2,3,4,6 }, 192164, 2196 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 194360, 11783 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 206143, 11783 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 217926, 12460 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 230386, 12460 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 242846, 11783 },
-	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 254629, 11783 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 266412, 12460 },
-	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 278872, 12460 },
-	{ { 8,9 }, {  }, { 1,7,8,9,10,11 }, 291332, 2089 },
-	{ { 8,9 }, {  }, { 1,7,8,9,10,11 }, 293421, 2089 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 295510, 12099 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 307609, 12099 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 319708, 12776 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 332484, 12776 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 345260, 12099 },
-	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 357359, 12099 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 369458, 12776 },
-	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 382234, 12776 },
+	{ { 3 }, {  }, { 1,2,3,4,5,6,7 }, 7374, 1493 },
+	{ { 3 }, {  }, { 1,2,3,4,5,6,7 }, 8867, 1493 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 10360, 11731 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 22091, 11731 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 33822, 12408 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 46230, 12408 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 58638, 11731 },
+	{ { 4 }, { 3,1,2,4,5,6,7 }, {  }, 70369, 11731 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 82100, 12408 },
+	{ { 4 }, { 8,1,2,4,5,6,7 }, {  }, 94508, 12408 },
+	{ { 5 }, {  }, { 8 }, 106916, 623 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 107539, 9161 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 116700, 11199 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 127899, 8746 },
+	{ { 6 }, { 3,2,9,10 }, {  }, 136645, 10784 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 147429, 9838 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 157267, 11900 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 169167, 9423 },
+	{ { 6 }, { 8,2,9,10 }, {  }, 178590, 11485 },
+	{ { 7 }, {  }, { 1 }, 190075, 445 },
+	{ {  }, {  }, {  }, 190520, 100 },
+	{ { 7 }, {  }, { 1,2,3,4,9 }, 190620, 2196 },
+	{ { 7 }, {  }, { 1,2,3,4,9 }, 192816, 2196 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 195012, 11783 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 206795, 11783 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 218578, 12460 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 231038, 12460 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 243498, 11783 },
+	{ { 4 }, { 3,1,2,4,11,12,13 }, {  }, 255281, 11783 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 267064, 12460 },
+	{ { 4 }, { 8,1,2,4,11,12,13 }, {  }, 279524, 12460 },
+	{ { 8,9 }, {  }, { 1,10,11,12,13,14 }, 291984, 2089 },
+	{ { 8,9 }, {  }, { 1,10,11,12,13,14 }, 294073, 2089 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 296162, 12099 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 308261, 12099 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 320360, 12776 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 333136, 12776 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 345912, 12099 },
+	{ { 10 }, { 3,1,2,4,5,6,7 }, {  }, 358011, 12099 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 370110, 12776 },
+	{ { 10 }, { 8,1,2,4,5,6,7 }, {  }, 382886, 12776 },
 };
 
 const SpUniformBlockInfo spUniformBlocks[] = {
 	{ }, // Null uniform block
 	{ "DebugEnvSphereVertex", 120 },
 	{ "DebugEnvSpherePixel", 32 },
-	{ "DynamicTransform", 128 },
+	{ "DynamicTransform", 64 },
 	{ "Pixel", 1088 },
 	{ "EnvmapVertex", 16 },
 	{ "EnvmapPixel", 8320 },
@@ -145,6 +145,9 @@ const SpAttribInfo spAttribs[] = {
 	{ "a_normal", 1 },
 	{ "a_tangent", 2 },
 	{ "a_uv", 3 },
+	{ "a_worldRow0", 4 },
+	{ "a_worldRow1", 5 },
+	{ "a_worldRow2", 6 },
 	{ "a_position", 0 },
 	{ "a_tint", 4 },
 	{ "a_uv", 1 },
@@ -155,235 +158,237 @@ const SpAttribInfo spAttribs[] = {
 };
 
 const char spShaderData[] = 
-	"\x28\xb5\x2f\xfd\xa0\x02\x07\x06\x00\x94\xb3\x00\x9a\xca\x18\x24\x2f\xb0\x4e\x6a\xca\x01\xd0\x81\x5c\x19\x5a\xab\x72\xf0\x36\xc2"
-	"\xe5\x90\x58\xe5\x64\xb5\xa9\xa8\x04\x6b\x97\x6b\x40\x2e\x49\x92\x24\x05\xa2\x55\x4d\x92\xa4\xec\xfe\xa0\xff\x40\xff\x93\xa3\x01"
-	"\x4c\x02\x1f\x02\x42\x02\x8f\x02\x0a\xd8\x56\x86\xbc\xf9\xb3\x32\x54\xb1\xad\x75\xca\x27\x6d\xb5\x18\xe3\x5b\x9f\xa3\x8d\x37\xaf"
-	"\x37\xc6\x1b\xdf\x7b\xf3\x4d\x77\xdf\x9c\xc6\x19\x2f\x86\xf2\xcd\x0a\xdf\x7b\x92\x5e\x37\x1b\x6f\x3e\xe1\xb5\x8f\x3e\x6b\xf1\x95"
-	"\xd0\x62\x8c\x31\x8e\x0f\x63\xf7\xde\x5c\xda\x0b\x6d\x95\x90\xd6\x88\xdf\xc5\x18\xe3\x89\xaf\x83\x6f\x1e\x69\xac\xb4\x5a\x4c\xad"
-	"\x7c\xd5\xca\x8a\x31\xc6\xf6\x56\xe8\x5e\xe3\xcd\xa1\xa3\x79\xd6\x1c\xbb\x12\xb1\x27\x05\xc9\xb2\xa6\x28\x72\x06\x67\x1e\xe4\x0c"
-	"\x9e\xac\x2b\x8a\xdd\xa2\x0c\x49\x26\x29\x8b\x26\x07\x06\x16\x14\x26\xd2\x02\x08\x8a\xe2\x58\x59\xae\x88\x72\x6b\x8e\xe3\x38\xd7"
-	"\x12\x14\x49\x59\x42\xe2\xd5\x14\x4d\x0f\x67\xfa\xac\x72\x74\x3d\xb4\x43\xae\xb4\x24\x3f\x9c\x47\x57\xf0\xc8\x14\x95\x25\x13\x69"
-	"\x01\x6d\x5d\x10\x08\xf4\x3c\xd2\x18\xe4\x80\x80\x20\x80\xa5\xa9\x6c\x4f\x7b\xaa\xa8\x46\x44\x82\x2c\x0b\x92\x48\xd0\x10\xe0\x8f"
-	"\xae\x26\x29\x02\xfd\x01\x6d\x6b\x92\x22\x19\x7a\x1e\x91\x72\xf4\x78\x96\x44\x72\x45\x0d\x00\x00\x02\xc2\x05\x42\xc2\xbe\xa6\x4b"
-	"\xd5\xb5\x75\xf5\x1c\x3c\xa3\xb4\x33\xda\x72\xb7\xaf\xc9\x49\xd0\x9b\xc6\xed\x6b\xca\x1c\xc3\x60\x6e\xa1\xb9\x04\x45\xa0\x6a\xaa"
-	"\xb0\x60\x5c\xc9\x30\xf7\x64\x07\xbe\x5c\x69\x6f\xbe\xd0\xe0\x8c\xa2\x60\x2e\xee\x06\x4f\x35\x4d\x0f\x84\x8b\x8a\x0b\x8b\x98\x41"
-	"\x6d\x45\xfa\x02\x73\x2e\x46\xe7\xcd\xff\x2b\xd7\x7b\xd3\x0e\xa1\x50\x5c\x8c\x0e\x01\xcd\x15\xa5\x6d\x09\x6a\x0d\x74\x71\xc1\x9b"
-	"\xef\x6b\x52\x26\x26\x1e\xc8\x81\x24\x24\x8e\xe9\x47\x6a\x40\x3f\x1a\x70\xa2\xc8\xb7\x04\x5d\x67\x2a\x0d\x81\x5c\x0e\x09\x89\xc7"
-	"\xe8\x9c\x81\x94\xb7\x25\x4d\x8f\x33\x13\x13\x12\xe4\xe8\x48\xde\x96\x84\xc4\x25\xe8\xed\x9a\x26\xca\x6b\x7a\x5f\x0e\xa8\xda\x3b"
-	"\x67\x09\x9a\x98\x70\x70\xa2\xc8\x27\x8c\xb2\xa4\x9a\xa4\x84\x89\x09\xe5\x49\x8f\x29\x6a\x95\xb6\x2e\x09\x89\x4b\x13\xb4\x21\x6b"
-	"\xa2\x9c\xc9\xe5\xbe\x26\xe7\x49\x50\x96\x5c\x20\x24\x58\x17\xf4\xe4\x07\x5d\x69\x0a\xab\xd2\x59\x66\x90\x5c\xd2\xad\x4d\x11\x81"
-	"\xf4\x83\x4a\x67\x39\xfa\x84\xef\xc9\x94\xe3\x50\xd6\xb5\x05\x04\x11\xb7\x04\x3d\xd9\x81\x07\xaa\x18\xb0\x9e\x40\x41\x91\x02\x13"
-	"\x04\x4f\x54\x4d\x15\x9f\xd8\xdc\x79\x8a\x20\xff\x8f\x70\x01\x02\xa6\x77\xa5\x23\x74\xa5\x29\x28\x88\x89\xb4\x40\xe4\x72\x68\x85"
-	"\xef\xc7\x55\x6d\x0b\x01\x21\xe1\xfa\x91\x29\x4b\x4b\xb2\xf4\x88\x04\x59\x17\x02\x82\x03\x0a\xf7\x48\x20\xab\xc1\x23\x81\x2c\x04"
-	"\x07\x0e\x28\x7a\xb6\xe5\x44\x79\x6b\x89\x01\xd7\xcf\x15\x3d\x24\x68\x80\x98\xbe\xf7\x26\x84\x11\xde\x28\x21\xac\xd5\x5a\x2c\xa3"
-	"\xbd\xd4\xbd\x33\xf7\xca\x8b\x5f\x94\x18\xcf\x8b\xa3\x7b\x18\x83\xb5\x89\x3d\x07\x9b\x6c\xf0\xc9\x9b\x63\xcd\xf2\x89\xae\x2e\x6b"
-	"\xa2\x30\x4d\x65\x89\x96\xa6\xfd\xc9\x30\x14\x4b\xa7\x45\xf9\xa6\x85\x9b\x28\xd0\xc1\x99\x9b\x28\xcd\x29\x96\x0e\xe6\x26\x93\x8b"
-	"\x27\x23\xac\xd6\x56\x8b\xe1\xb3\x18\xbf\x37\xae\x28\x34\x56\x0a\x1f\x9c\x2f\x62\x4a\xa3\xb4\x95\xce\x8a\x89\xfa\xf2\x08\xb1\x9d"
-	"\xd4\x4e\xfa\x1c\xfc\x72\x1a\xa1\xa4\x13\x4b\x1c\xab\x8d\xd8\x45\x88\x30\x61\x7c\x31\xca\x2a\xab\xc4\x91\xc6\x48\xa3\x7c\xef\xdd"
-	"\x27\xa1\x7c\xef\xb9\xf7\xc6\x80\x63\xed\x10\x08\xc3\xb0\x33\x70\x44\x2a\x88\x09\x82\x2a\x6b\x09\x8a\xae\x44\x66\xb9\xb2\x2c\x6f"
-	"\x6f\xbe\xa3\xcb\xd2\xd5\x65\x84\x0e\xe4\xcd\x25\xb9\xca\x54\xc4\x99\x86\xb6\xa7\xe7\xcd\x5d\xa4\x5f\xfe\x70\xa6\xf9\x43\x53\x10"
-	"\x91\x03\x7a\x78\x78\x78\x78\x78\x78\x78\x90\x16\x16\xf7\xcd\x0b\x21\xad\x53\xc2\x0b\x31\x85\xf7\x4e\x49\xeb\xad\x16\x4a\x96\x65"
-	"\xed\x0d\x03\x73\x0d\x5f\xbe\xdc\x22\xc3\x9c\xa2\x3c\xf7\x5a\xa4\x27\x3a\x3a\xa3\x3c\x67\x32\x37\xb9\xce\x28\x05\xfc\xb9\xf7\x03"
-	"\xae\x3c\xf7\xee\xe0\x98\x6b\xc0\x9a\x6b\x3e\x91\x16\x90\xcb\x31\x37\xc1\x13\x5b\x2c\x5f\xb4\x52\x56\x68\x2b\x74\xef\x8c\x2b\xd4"
-	"\xca\x79\xf1\xa5\xd8\xbe\x39\x6d\x8d\x72\x4a\xf7\xbe\x3c\x7b\xee\x96\x5b\x60\xce\xa1\xbd\xf9\xe4\x6a\x38\x13\xd1\x68\xfb\xa1\x23"
-	"\x88\xae\xde\xfc\xe1\x72\x69\xfc\x69\xed\xb8\x1e\x55\x44\x49\x20\x2a\x1d\x51\x92\x6c\xe5\x68\x23\xe0\xc0\x80\x47\xea\xea\xda\x98"
-	"\xde\xd6\x42\x67\x72\x06\x96\xa5\x25\x8a\xc8\x35\x55\x67\x20\x10\xe8\x79\x44\x34\x9c\x71\x60\x48\xa0\x01\xbd\xf3\x15\xe5\x89\x56"
-	"\x9a\x64\x5c\x59\xfe\x20\x2d\x73\x0f\xf2\xe5\xcf\x3d\xba\x34\x9a\xeb\x28\x3f\xac\xfa\x64\x53\x3e\xca\xd3\xce\xf8\x7b\xf2\x8e\xf4"
-	"\x13\xe7\x9b\x13\x52\x29\xe1\x7b\xef\xc1\x5a\x5d\x7c\xf3\x7a\xeb\xc5\xd2\x46\x1c\xdf\x94\x18\xd2\x67\x52\x7a\xe1\xc3\xf5\xca\xf9"
-	"\xe0\x23\x5f\x94\xf2\x4d\x09\x2b\x8d\xd5\x49\xf9\x44\x8b\xa1\x8d\x70\x46\x79\x63\xa4\xee\xc5\xe7\xcd\x0a\xe5\xb4\x55\x52\xfc\x30"
-	"\xae\xf0\x81\xd5\x52\x5a\xe7\x7d\x96\xce\xf9\xea\x7b\x9e\x7b\x67\xaa\xa3\x51\x25\xfb\xf2\xe9\x68\x67\x5c\x3a\x5a\x3b\xa3\x60\x5f"
-	"\xa2\xa3\xb5\x33\xae\x60\x5f\x0e\x1d\xad\x49\x90\xa4\x51\x92\x1c\x05\x37\x20\xe1\xbd\xf9\x96\xa0\xf6\x6a\xca\x2a\xb6\x68\x6f\x18"
-	"\x08\x09\xcb\x97\x57\x34\x67\x94\x6a\x63\x9d\xd6\xce\x89\xa3\xc4\xb1\x61\x90\x04\x73\x15\x53\xa0\x64\x12\xe4\x96\xd6\xbc\x02\x2b"
-	"\x3b\xb0\xb3\xe4\xb3\x39\x02\x3b\x4b\x2e\x15\xa6\xed\xe9\x69\x4e\x41\x86\x39\x65\x72\x31\xad\x61\x67\xc9\xe3\xfc\x72\xa5\x49\xfa"
-	"\x5b\x82\x2a\x9d\x32\xc2\x5a\x81\x95\x25\x74\x4e\x8f\x76\x44\x59\x46\x88\x19\x38\x2d\x9e\x96\x4e\x0b\xa7\x55\xf6\x97\x2b\xd7\x97"
-	"\x5f\xad\x7d\x49\xc8\xae\xf8\xe5\xf3\x41\xfb\xb0\x7d\xf7\x62\xcc\xed\x4f\xae\x33\xfb\x91\x21\x8f\x8a\x85\xa3\xce\x60\x8e\x6a\x10"
-	"\x44\xaa\x9a\xa2\x29\x62\xb9\xa2\x2c\x95\x32\x48\xe8\x3c\x78\x10\x11\xc1\x70\xa6\xe1\xc1\x99\x88\xb6\xa7\x27\xe2\x8c\x33\x3c\x48"
-	"\x50\x18\xf3\x4a\x0c\x61\x85\xf0\xe1\x09\x1f\x74\xaf\xbd\x41\xbe\x24\xbd\x77\xbe\x83\x5f\x9c\x61\x3c\xb3\xc0\x5c\x3b\x93\xc0\xb8"
-	"\xb2\x5c\x01\x4c\x43\xd0\x04\x70\xcc\xc9\x0c\x25\x10\xa3\xcb\x01\x05\x0c\x58\x9a\x5b\x00\x51\xbd\x35\x60\x60\x2c\x80\xd8\x16\xf4"
-	"\xbc\xf1\xc0\xa6\x88\x40\xd1\xa5\x94\x31\x42\x98\x30\xf1\xce\xb8\xb6\xb2\xa3\xf9\xcb\x3b\x3f\x9f\x0a\xf2\x81\x2a\x06\x2a\xa6\x27"
-	"\x53\x58\xda\xca\x8e\x33\xd8\x12\xe4\x80\xe9\x7d\x57\xbe\x09\x69\x9c\x52\xda\x8b\x9f\xbc\x50\x59\xae\x2c\x28\x44\x7c\xf9\x42\x73"
-	"\x85\x08\xfa\x60\x2a\xcd\x17\x2e\xcf\x38\x0b\x0a\x0f\x09\x5c\x34\x78\x73\x48\xa1\xd3\x0e\x81\x28\x74\x94\xe5\x75\x42\x1a\x5f\xbc"
-	"\x93\x5e\x28\x6f\x74\x55\x32\x49\xfa\x61\x34\x7f\x0e\x9e\xf1\xc6\x1f\x3c\x78\x73\x05\x06\x86\x08\x06\x2c\x12\x61\x5c\x59\xde\x76"
-	"\x65\x81\xf5\xe5\xcd\x23\xb0\x48\xcc\x14\x54\x94\x1f\x44\x9c\x61\xd8\xd3\xd3\xd0\x26\x60\x80\x01\x47\x21\xe2\x58\xfb\x72\xe5\x41"
-	"\xde\x80\xc4\x89\xbd\x79\xc4\x1e\xec\xe9\x89\xa8\xe0\x01\x45\x14\x0f\x08\x67\xe1\xb2\xe2\x8a\x2b\x9e\x98\x55\x22\xef\xac\xb0\x25"
-	"\x68\xa2\x22\xd3\x82\x05\x4d\x64\x84\x0e\x65\x7d\x61\x72\x4d\xae\x8a\x2f\x57\x98\x66\x59\x53\xf5\x78\xb3\x25\x6a\x42\xca\x22\xc3"
-	"\xdc\x7e\x67\x24\x37\xa1\xd3\xde\x9c\x9a\xd0\x39\x03\x99\x1f\x63\xfe\x84\x73\x72\x39\x93\x47\x09\x39\xe2\x96\x74\x44\xca\xdb\x99"
-	"\x5c\x26\x3c\x51\x35\x49\x30\x41\x10\xe9\x67\x92\x48\xaa\x09\x62\x49\xb9\x82\xe0\x01\x49\xb2\x94\x35\x6e\x5f\x53\xf3\x6b\xa7\xf3"
-	"\xd9\xbc\x32\x0c\x9d\x72\x36\x97\x11\x6f\x1e\x1b\x1c\x1e\xc4\xe1\x8d\x2b\x11\x12\xd4\xb4\x05\xf4\xe6\x0d\x13\x87\xa7\xc0\xd7\x24"
-	"\x24\x0e\x25\x24\xbe\x25\x2d\x89\xe4\x0a\xf2\xb0\xa4\xd6\xce\x59\xe7\xab\x01\x17\x90\x4e\x09\x21\x22\x8e\x38\xe2\x88\x23\xae\xd5"
-	"\x3a\xb5\xda\x57\x6d\xad\xf6\x55\x1b\x31\x04\x04\x04\x04\x04\x44\xc4\x11\xcb\x5b\xe5\xad\x11\x47\x1c\x71\xc4\x11\x47\x1c\x71\xc4"
-	"\x74\xd2\x49\x27\x9d\x11\x47\x1c\xf1\x93\xf5\xc9\xfa\x64\x7d\xb2\x52\x58\x29\xac\x14\x56\x0a\xeb\x64\xaa\xa5\xf3\xd2\x77\x69\xb5"
-	"\x74\x5e\xe8\x28\xb6\x37\x4b\xbc\x83\x4b\x3a\x52\x1a\xc5\x8e\x48\x3a\x7a\x73\x49\x47\x12\xf4\x20\xbe\xb6\x26\x38\xd0\x3b\x25\xc5"
-	"\xa6\x12\x94\xe5\x0f\x82\xab\x7b\x14\xba\x07\x1b\x67\x1a\x1a\x5c\xc9\x9c\xc3\x1b\xa7\xd0\xca\x5b\xed\x7c\xd6\x49\xc6\x1d\xb0\x8c"
-	"\xd5\x71\xf0\x89\x0b\x4a\xe0\x58\x65\xac\x4e\x3b\x04\xc2\xcd\x65\xac\xce\xa3\x69\x72\x34\x2a\x9a\x3b\x2c\x77\x60\x26\x57\x3b\x33"
-	"\xb9\x1c\x28\x28\x7a\x2c\xdf\x16\x84\xe5\x7b\xee\xc1\x48\x3b\xe3\x15\xcd\x65\xf3\x5b\xa9\x73\x09\x23\x51\x46\x20\x84\x4c\xf3\x17"
-	"\xf9\x9c\x5c\x93\x6b\x72\x45\x30\xb9\x26\x97\x84\xf0\x45\x20\xbd\xf4\xd2\x4b\xef\x95\xf0\x4a\x48\x2f\xbd\xf4\x42\x05\x29\xa3\x90"
-	"\xc2\x8c\xc2\x86\x71\xcc\x49\xbb\xf1\xe6\xef\xd1\xc6\xc1\x31\x27\xbd\x47\x1d\x0b\x27\x35\x32\x45\xc1\x1c\xa4\x59\x0e\x26\x73\x90"
-	"\x33\x98\x83\x5c\x42\xce\x20\x46\xb9\x7a\x34\x45\xde\x8f\x07\xf4\x33\x3d\xf4\x83\x19\x58\x27\xae\x93\xd6\x59\xe7\x74\xf1\x0c\xbd"
-	"\x16\x5b\x0b\x21\x7d\xf5\xca\x8a\x71\x8d\x12\x46\xfa\xb0\x8d\x55\xce\x1b\xa7\x8d\xb6\x5e\x3b\x71\x6b\x15\x13\x45\x27\xc4\x78\xde"
-	"\x47\x1f\x7d\x57\x62\x2c\xad\x7d\xee\xc9\xf8\xa6\x95\x52\xca\x78\xa3\x8d\x93\x61\x82\xc0\x11\xa9\xac\x47\x48\x63\x05\x29\x64\xb9"
-	"\x9a\x5c\x9f\xd0\xa1\x2c\x48\x61\x82\x80\x62\x53\xfa\xa1\xa0\xe8\xf1\x89\x4d\x0a\x62\xa3\x7d\x79\x76\xc6\x51\xe9\x7c\xc1\x9c\x35"
-	"\x51\xad\x35\x6b\xa2\xac\x89\x7a\xa4\xd2\x39\x83\x28\xa3\xf3\x64\x8a\x82\x84\x09\x28\x28\x82\xbc\x22\xab\xb6\x5a\x48\x23\xa4\x11"
-	"\xd2\x48\x31\xc4\xf6\x52\x0c\xb1\xbd\x90\x46\x6b\x2b\x9d\x32\x42\x47\x81\x34\xda\x17\xed\x8b\x0c\xb4\xce\x3c\xab\x61\x90\xa4\xc6"
-	"\x1a\x21\xac\xd1\xa2\x3d\xd2\x35\x55\x2d\xc3\x1c\xd3\xfc\x45\x67\x2c\x30\x47\x51\x08\x9d\xcb\xe8\x8d\x67\xd1\x9b\xef\x17\x35\x09"
-	"\x92\xc0\xc8\x66\x51\xab\xa6\x29\x8a\x2e\xf5\xe6\x59\x94\xe5\xaa\x42\x20\xcb\x55\x95\x1d\x0a\x02\xd2\x08\x69\xac\xc8\x9e\xc4\xf0"
-	"\x49\x4c\xe7\x94\x4c\x84\x0f\xe2\x6b\x9b\x47\x09\x82\xf0\xe1\x6b\xeb\x7c\xc3\x78\x24\x1d\x85\x8a\xa8\x83\x17\xcb\x20\x85\x50\xa9"
-	"\x11\x12\x08\x00\x20\x02\x00\x43\x13\x40\x50\x50\x60\x30\x94\x4a\x53\x69\xd6\x96\x03\x13\xc0\x40\x46\xc7\x04\xc2\x68\x28\x18\x8e"
-	"\x06\x72\x20\x89\x51\x0c\x86\x31\xc8\x10\x02\x80\x01\xc0\x18\x62\x80\x51\x6a\x4a\x46\xdb\x08\x02\xf1\x5a\x7c\xa8\x97\x88\xf0\x72"
-	"\x1d\x24\x1b\x82\x89\x0e\x51\xfb\xe0\x46\x34\x69\x78\x63\x86\xf0\x5b\x05\x67\x93\xf7\x2a\xb6\xc7\x25\x19\x2c\xa3\x20\x3b\x21\x1b"
-	"\xe4\x99\xf7\x88\x98\xbe\x4a\xc4\x73\x46\x17\xc1\xc8\x55\xfc\x11\x1e\xdc\x3e\x15\x5b\x77\x12\x34\xf3\x4f\x3c\x55\x9c\x4d\x51\xf5"
-	"\x5b\xc2\xc8\x4d\xa7\x4f\x45\xd2\xb4\x36\xa0\xa7\x7f\x6e\xc0\x8c\x82\x2d\xe7\x22\xaf\x80\x8e\x00\x34\x33\x4a\x39\x9f\x76\xd0\xbf"
-	"\xd9\xc2\xc1\x5c\x5e\xc1\x00\x8b\xa2\xa9\x76\xed\x4a\xf6\x14\x16\x46\x6c\x3f\xe4\xee\xd6\xd4\x36\x48\xce\x2a\x93\x41\x2f\x49\x50"
-	"\xda\x6e\x22\x5f\x36\xd0\x5d\x02\x4c\x26\x0e\x83\x67\xa8\x81\xea\xc1\xee\xac\x1b\xc9\x06\xb9\xad\x42\x11\x71\xbf\xe8\x90\x58\xf9"
-	"\x99\x60\xe8\xae\x9b\x10\xb5\xa3\x87\xe3\x0b\x19\x9c\x72\x28\x38\x79\xcc\x07\x07\x1e\x3a\x1f\xf2\x9d\x79\xf8\x2b\x9f\xd6\x43\x16"
-	"\x61\xc9\xd6\xd2\xb0\xd5\x02\xe6\xc1\x76\x5c\x7e\xd1\x88\xc5\xe0\xed\x5a\x75\x3c\xbe\xd8\xdb\x8b\x5a\x80\xce\x21\x70\xb3\x13\xcb"
-	"\x4c\x1e\x60\x23\xac\xa4\xc4\xc3\x4b\x69\x38\xb6\x67\x8d\x54\x73\xa7\x07\x6e\x2d\x0d\x50\x93\x06\xa7\x29\xc7\xae\x89\x20\xaa\x32"
-	"\xd8\xc4\x97\x2a\x6a\x23\x34\x1a\x5a\xe7\x06\x2d\xd3\x81\xc5\x66\xf4\xb8\xa6\xd9\xdc\x67\x92\xab\x24\x1d\x2f\xee\x05\x9b\x22\x6e"
-	"\xc6\x9c\xe8\x2e\x68\x81\x52\x0a\x7a\x96\x78\x9a\x14\x75\x14\xa3\x04\xc4\xa5\x42\x48\xa4\xc9\x06\x42\x3d\x39\xe7\xb1\x69\x08\x5b"
-	"\xc5\xbe\x38\x03\xc2\x91\x35\x55\xea\xdf\xbe\xc6\x50\xe8\x46\x44\x82\xf3\xd0\xb8\x88\x91\x43\xff\x42\xd7\xdb\xa6\xde\x95\xa1\xe0"
-	"\x28\xf1\x43\xd5\xc2\xb8\x13\x7c\x69\x69\x27\x85\x98\xa3\xf2\xd2\x0b\x70\x88\x5e\xa2\xe8\x8a\x4d\x4a\x2c\x27\xb8\xfa\x7e\x9f\x36"
-	"\xe7\x9b\x99\x2a\xb9\x88\xa9\xc9\x7e\x27\xe1\xe0\x0c\xf8\x08\xf4\xe2\x06\x58\xc4\x10\xa0\x81\x38\xc2\x1c\x92\xd4\x7f\xe5\xb0\x6a"
-	"\x2d\xb9\xa0\xb9\xf6\x76\x00\xe0\x52\x2c\x02\x9f\xd1\x06\xf8\xb4\xac\x52\x17\x4e\x20\x96\x62\xda\xb5\x60\x45\x51\xaa\xdb\xfb\xf7"
-	"\x49\xc1\x80\xdf\xfe\xfd\xf4\x2e\x23\xcc\xcb\x96\x8d\x2e\x03\x9e\x53\xe3\xf3\x90\xaa\xee\xa0\xc9\x3a\x20\xe7\x7a\xb4\xd4\xb5\xcb"
-	"\x37\x55\xfb\x00\x12\x82\xc1\x1e\x0a\xa2\xe4\x7d\xa7\x6d\x3e\x0e\xa3\x8b\x8a\xc9\xe3\x6a\x67\x14\x5f\x04\xb4\x9b\x9e\x56\xe0\x9b"
-	"\xf7\x20\xeb\x52\x99\xc8\x92\x74\x36\x5c\x6b\x5d\x4a\x24\x72\xe4\x1f\xf2\x98\xa4\x29\xbc\xe1\xef\x0c\xcd\x28\x65\x40\xfe\xc4\xa0"
-	"\xfc\xcc\x2a\xa9\x63\xe3\x90\x88\x0c\x91\xec\x86\x32\x41\xe8\xcc\xec\xe3\x33\xde\x02\x0d\xec\x07\x75\x7c\xe9\x8a\x41\xbe\x1c\x5d"
-	"\xde\xa7\x31\xa4\xd8\x64\x29\xe8\xa1\x3e\x94\xb4\x41\x21\x45\xa5\xe4\x47\x0b\x90\xc5\x2d\x41\xdb\x99\xec\x2d\x4a\x09\x48\x51\xad"
-	"\xc9\xc2\x62\x16\x52\xc3\x73\xce\x87\x33\xc0\x25\xa8\x8a\x54\x1f\x27\x43\xb7\xd2\x6b\x13\xb1\x8c\xb3\xbc\x32\x62\x60\x02\x95\x61"
-	"\x75\xbe\xe7\xcb\x7a\x57\x40\xb7\xfa\x0f\x7f\x1c\x5f\x3d\x70\xdd\xac\xb6\x1d\x9f\x11\xcf\x18\x87\xfe\xb2\x6f\x94\xff\x02\x6d\x18"
-	"\x54\x01\xf2\x84\xd4\xb4\xf4\x65\xc9\x5a\xfb\x4c\xaf\xd0\x83\x38\x14\xa6\x4f\x87\x1a\x67\x3d\xa4\xa1\x98\xe5\x85\x53\x82\xa5\xb1"
-	"\x1e\x05\x17\x57\x62\x6b\x45\x3f\x90\xd5\x34\x7f\x5b\x70\x21\x94\xa8\xe5\xb5\x11\x9f\xc4\xf9\xf0\xa8\x94\x2f\xc5\x17\x97\x26\x35"
-	"\xd8\x98\x0f\x62\xf0\xb3\xd3\x45\x3c\x44\xa1\x31\x20\x54\x2d\x5b\x19\x3d\xdf\xfc\x42\x92\x6a\xb6\x80\x4f\x50\x89\xa4\x87\x7f\x5e"
-	"\xe7\x43\xf4\x10\x50\x4f\xa4\xb6\xec\x4f\x58\xa6\x8a\x25\x8f\xb4\x31\xd3\x02\x5f\x1f\x56\x63\x87\xc5\x62\x21\xbc\x74\xdf\x9f\x58"
-	"\x80\x6e\x16\xab\xaf\xac\x75\xf0\x05\x06\xfb\x2f\x46\x0e\x91\xc5\x17\x07\x84\x74\xaa\x7e\xb0\x38\x8a\x15\x9a\x39\xc9\xe2\xa4\x2b"
-	"\x1f\xc9\xf2\x64\x38\x77\x5d\x38\xb9\x89\xb9\x22\x12\xb3\x2e\xb1\xa3\xa7\x46\x3b\xf6\x55\xe6\x31\xe0\x95\x0d\xde\x16\x07\xaf\x4c"
-	"\x0e\x49\x77\xeb\x28\x51\x0d\x3b\x35\x44\x61\xb6\xd4\x00\x06\x58\x04\x5e\x46\xff\x05\x24\x87\xba\xec\xf2\x7e\xed\x3a\x73\xf8\x54"
-	"\x4d\x9b\xbc\x0b\x66\xde\xfb\x32\x29\xda\xaa\x95\xa1\xa2\x24\xb3\xb1\x05\x3e\xdd\xc6\xec\xe9\xdc\x83\x56\x53\x57\x9a\xe0\xe5\xd3"
-	"\xe3\x25\x8d\x46\x2e\x79\x76\x45\x7e\xe9\xeb\xd0\xa5\xc7\xe9\xec\x9e\xb3\xcf\xe7\x2d\xfd\x4c\xc0\x10\x0a\x9c\xf8\xd4\x02\x65\x35"
-	"\x2b\x04\x17\x2d\x6c\xd2\x32\x79\xe3\xe3\xd5\xea\x0f\x74\x22\xff\xb9\x63\xc8\x61\x34\x13\xed\x41\x57\x9d\xd6\xec\xfa\x8e\xb2\x30"
-	"\x84\x2b\x97\x26\x19\x77\x60\x80\x9e\x11\x90\x3c\x5e\x6e\xd5\x41\xf7\x63\x8b\x3f\x8e\x1c\x4c\xd7\xee\x12\x47\xaa\xf6\x9c\x2b\x02"
-	"\x4a\x00\x3e\xab\xac\x15\xba\x95\xd9\xbd\xf9\x1a\x44\x1c\x2e\xf4\x22\x46\xf0\xa4\xc1\x5a\x20\x2b\x28\x2a\x0b\x18\x3c\x0e\x35\x1a"
-	"\xde\xd8\x4d\xde\x26\x88\x73\xb6\x33\x48\x90\xed\x32\x18\x31\x0d\xf0\x97\x07\xc0\xda\xb4\x72\xc2\x78\x27\x02\x8e\x28\xb7\x1e\xc5"
-	"\xac\xdc\x34\x76\x40\xbf\x70\xdb\x95\x29\xcb\x22\xcc\x6a\xf3\x05\x69\x57\x09\x0e\xfa\x45\x02\x5b\x68\xac\xe2\xf7\x7c\xaf\x37\x0a"
-	"\xc8\x56\xf7\x30\xba\x29\x18\x17\xfb\xed\x1f\x04\xcf\xbb\xf4\xf9\xa2\x27\x6a\xb7\x1f\xc8\xd6\xac\xc9\x4a\x7c\x7a\xd5\x08\xc8\xcb"
-	"\x58\x03\xb8\x6a\x73\x82\x05\x64\xff\xb0\x10\x11\xcd\xe8\x43\x12\x4a\x27\x66\x7d\x61\x62\x17\x8e\x86\x1e\xda\x7a\xa3\x2d\xea\xf9"
-	"\x46\x98\x9a\xb6\x8d\x37\x6c\x67\xd2\x2f\x2c\xe6\x90\xb3\xc0\x74\x71\xd4\x43\x04\x84\x79\xd9\x04\xe0\x1c\xac\x3f\x46\x75\x83\xa4"
-	"\x40\x61\x3d\xec\xc2\xa9\xbe\x7e\x8d\x63\xdd\x9c\x9b\x0e\x7a\x2b\xe0\x60\xec\xa4\xf9\xce\x5b\x92\xee\x1a\xc7\x3b\x8e\xc1\x8d\xf8"
-	"\x91\xf9\xb1\x20\x3b\x1d\x92\xcb\x0d\x35\x61\xa0\xf0\x81\x61\x96\xc7\xf8\x78\x13\xab\x58\xc6\xc4\xed\xfa\xcb\x62\x74\x07\x94\xd6"
-	"\x38\x3e\x51\x4a\xaa\x24\x48\x4f\xda\xdb\xf2\xc4\x92\x00\x0a\xf4\x82\x98\x80\x8b\xec\xc7\xea\xc8\x68\xee\xa3\x5e\xdd\xc6\xf7\x81"
-	"\xcc\x19\x78\x4d\x8a\xbe\x89\x3d\x9b\x79\xb5\x4d\x4d\xf8\x5a\xb2\x2e\xcf\x85\xb5\xaf\x5d\xd4\x73\xfc\x3f\x9f\x01\xca\x41\x2e\xe5"
-	"\x19\x70\x92\xb9\x96\x6e\x11\x84\x2d\x17\x7e\xc6\xe2\xd6\x3e\x45\x7c\x9f\x21\x16\x28\x9b\xfc\xae\x4a\x7d\xa0\x55\xc3\x5a\x89\xd3"
-	"\x0b\x9a\x51\x07\x7c\xc7\x88\xe6\x21\xda\x93\xd8\x4e\x9d\x78\xa0\xbb\xd7\x84\x40\xa1\x2f\x9e\xe0\x7b\x34\x0e\x54\xd8\x02\x4b\xd8"
-	"\x3d\x2c\x09\x50\x85\x5b\x61\x2c\xf4\x83\x1a\x2e\xca\x30\xc4\x3a\xeb\x48\xf3\x00\x69\x57\x9d\xa3\x84\xa1\x9f\x9d\x09\x56\xec\x2c"
-	"\xab\x90\x5e\x7e\x6b\x4b\xdb\x9c\x69\x47\x59\x64\xa7\x98\x47\xf8\x98\x0e\x02\x5a\xd9\x91\xd4\xec\xac\x2b\x75\x7b\xdf\x17\xa1\x73"
-	"\x31\xb2\x78\x19\x2a\xb3\xf2\xbc\x5e\x29\x12\xf7\xe6\x15\xd4\x08\x9f\x29\xbd\x01\xb7\xc8\x02\xba\x97\x2c\xb4\xf2\x70\xcb\x66\x12"
-	"\x8b\x71\xfb\x00\xc3\x2f\x97\x07\xf5\xc3\x47\x3a\xc7\x46\x66\xc2\xdf\x61\xad\x4a\x6a\x0d\x68\x5c\xae\xc9\x70\x64\x8d\xeb\xda\xd4"
-	"\x0b\xc6\x53\xc6\x62\xe0\x62\x5a\x92\x43\x88\x51\x8c\x3d\xe0\x88\xeb\x63\x10\x49\xa9\xd7\xb0\x60\x29\x7b\x56\xe6\x0f\x6f\x23\x60"
-	"\xa2\xb0\xb0\xff\x86\x30\xe0\xb0\x95\x2c\x08\xa7\x2d\xdd\xa3\x55\x42\xc2\xc5\x23\x2e\x7a\x02\x62\xac\xdc\xad\xcf\xb4\xe0\xd2\x21"
-	"\x21\xed\x7b\x73\x45\x01\xf6\x45\x21\x86\xa6\xe1\xfb\x55\x5b\xb7\x1b\xbc\x18\x89\x29\x5e\xc4\x5d\x81\xec\xb9\x1f\x39\x86\xaa\x6c"
-	"\x51\x62\x18\x88\x0c\x4c\xba\xf6\xdf\x41\x11\x1f\x61\x25\x9d\xba\x2d\xd6\x08\x54\xfb\xd2\x96\x2c\xf8\x30\x68\x58\xcd\x73\xbf\xf6"
-	"\xf8\x75\xfb\x94\x14\x9f\x9d\x33\xd9\x2d\xb4\x2f\xd1\x15\xb8\x95\x84\x20\x1b\xdf\x02\x54\x83\x65\x9b\x56\x7d\x13\x5f\xb3\x72\x7e"
-	"\x8e\x93\x09\xa1\x78\x70\xbc\x4e\x38\x1c\xac\x42\x9e\x59\x4b\x82\x1a\x63\xb8\x1c\xd7\x08\x5c\xcd\xc8\x07\x6f\x6c\x50\x00\x00\x6d"
-	"\xd5\xb0\x30\x8e\xd3\xd0\xf3\x77\xde\x97\x9d\x3d\x0b\xae\x58\x10\xdc\x32\x94\x08\xb0\x5f\x62\x96\xf8\x1a\x93\xec\xea\xbe\xe0\x6c"
-	"\xf8\xfe\x00\x29\xd5\xbc\x34\x38\xf7\x7e\x8b\x59\x01\x68\x4b\xec\xf4\x4c\x8f\xa3\x20\xad\xe6\x1d\xc5\x11\xd6\xc0\xeb\x95\xaa\xc8"
-	"\x4f\x9e\x34\x28\x6e\xd0\xe2\x7b\xce\x81\x27\x3f\xff\xd3\xf6\x84\xa9\x77\x33\x93\x80\x22\xcd\x9e\xdd\xf9\xda\x9d\xea\x41\x17\xfd"
-	"\xa4\xf4\x0d\x78\x12\xc5\xb6\x31\x08\x2d\x28\x64\xb7\xa9\xb4\x00\x68\x9c\x5e\xfd\x01\x99\xb4\x69\xa4\x87\x70\x73\xfa\x46\x4e\xb2"
-	"\x88\xa2\xa0\x5e\x7c\x18\xd4\xf4\x08\x09\x31\x85\x89\x26\xca\x36\xa5\xf7\x80\x40\x4d\x46\x1c\x5a\xa6\xe5\x4a\x01\x2d\xc4\x9c\x9b"
-	"\x8c\x05\x74\x94\xeb\x36\xb0\xda\x63\x31\x8a\x36\x85\x73\x56\xc5\xa6\x41\x8b\x2d\x40\x21\x66\x8a\x6e\x4e\x69\x16\x30\x61\xd9\x89"
-	"\xc0\x20\x8c\xde\x68\x83\x7d\xcd\x0c\xfc\xd6\xd3\x0c\x2e\x8e\x8c\x5d\x4e\x00\xf3\xf2\xf9\xd2\x9c\x98\xbd\x63\xb3\xca\xe1\xb1\x6c"
-	"\x42\xd5\xa6\xb4\x58\x33\x06\xac\xdf\xac\xf4\x97\xb3\x0d\xec\xfd\xc5\x29\x9f\xca\x55\x4e\xf1\xf0\x31\xae\x29\x68\x20\xbe\xb1\x2d"
-	"\xf5\x8e\x21\x0f\x9c\xdd\x3f\xbb\x69\x5e\x4b\x8b\xd8\x60\xc4\x02\x3b\x9f\x1b\x62\xe3\xaf\xc1\x0d\x8f\x24\x5d\x94\x2f\x63\x18\x31"
-	"\xcb\xcd\xcc\xca\x50\xe4\x99\x3d\x91\xb4\xdb\x2c\x70\xdd\x20\x5e\x80\xae\xa3\xf5\x46\x7a\x8e\xe8\xdc\xf0\x6b\x9a\x89\xa5\xe5\xca"
-	"\xa9\x94\x7f\xf3\x6e\xc0\xa3\xe8\x4a\x4f\xbd\xba\xac\xd8\x19\xc6\x7d\x64\x56\xa1\xce\x3f\xb3\xec\x02\xe0\x09\x77\x38\x11\x43\xf9"
-	"\xf1\x31\x9a\x19\x4f\xe7\xd8\xfe\x36\xe1\x3e\xf1\xd6\x73\x47\x40\x0e\x17\x48\x15\xc8\xa3\x57\x12\x3f\x39\xb7\x22\xbd\x68\xd4\x62"
-	"\xe9\x76\xb0\x6c\x73\x7b\x5c\x24\x70\x7c\x9a\x6b\x91\x41\x32\x8e\xfb\xa0\xf7\x30\xcb\x64\x98\xc8\xdf\x86\x84\x05\xc6\x18\x9b\x15"
-	"\x0a\xbe\x93\xe2\x16\xa0\x42\xa9\x7c\xed\xa3\xfe\x74\x87\x5d\xd0\xfa\xed\xfe\x99\x13\x43\x42\x49\x60\x18\x80\x60\x5e\x11\x61\xeb"
-	"\x23\xff\x66\x48\x17\xc4\xa4\x42\x9e\xcf\x32\x96\x87\xb4\xab\x16\x01\x08\x15\xd0\x98\x91\x18\xc7\x2c\x1c\xb0\x5d\x1f\x36\x88\x68"
-	"\x19\x82\x4c\xf2\x6f\x73\x95\x06\x33\xa1\x02\xd3\x28\x7f\x19\x19\x26\xef\x27\xe5\xbe\xbb\x37\xda\xc1\xa3\x4e\x97\x6f\xe5\x2c\xd0"
-	"\x2f\xf6\x1e\x06\x65\x25\x1a\x97\x0f\x65\x04\x9e\xdf\xc2\xa3\x48\x12\xaa\x15\x8b\x38\x27\x31\xdc\xf5\x5a\xee\x9f\xb7\x40\x7c\xa5"
-	"\x23\xcb\xa3\x09\xf0\x20\x28\x12\x6c\xc2\x45\x65\xaf\x32\x0b\xfa\xcb\x18\x55\x0b\x4b\x17\x52\xa5\x4f\xdc\x05\xb0\x36\x8a\x44\x15"
-	"\x94\x34\x7d\xf8\xdd\x8e\x81\x49\x99\x3d\xe9\xe1\x51\x42\x3e\xc0\x1c\x00\x4e\xad\x19\x00\x3e\xdf\x42\x87\xe3\x9f\x37\x4b\x88\x50"
-	"\x59\xda\x56\xbc\x79\xaf\x0d\x2d\xbd\x49\x7f\x78\x59\x6a\x81\xe4\x2b\x44\xea\xc1\xf2\xe5\xda\xb3\x98\x42\x27\x85\x30\x54\x74\x5e"
-	"\x58\xc9\xdb\xfe\x9b\xf9\x2a\xb9\xbc\x94\xe3\x61\x93\x6e\x99\x9d\xd3\x14\x51\xf3\xb9\x44\x56\x72\x00\x76\xeb\x1b\xb5\xcc\x76\x05"
-	"\xac\x75\x61\x7b\x12\x63\x21\xa0\xe0\xd3\xcb\xed\x4d\xcc\x8c\x9d\x42\xcc\x81\xdc\xe9\x16\x8d\x67\xec\x62\x90\x33\xb2\x81\xfc\xee"
-	"\x62\x0d\xc1\x76\x61\x21\x8f\x60\xbf\xdc\x37\x2e\x9a\xac\xae\xc6\xf4\xf4\x36\xdb\xdc\xfd\x72\x21\x6f\x92\x60\x42\x89\x39\x7f\x47"
-	"\xa5\x19\xb2\x9e\x8d\x1b\xb0\x2a\x41\x42\x78\x3b\x4a\x04\x33\x51\x0a\xe9\x04\x07\xa2\x9b\x25\xa8\xad\xd5\x0b\xdc\x3a\x99\xc4\xe3"
-	"\x3d\xf7\xd7\xec\x75\x47\xea\x48\x55\x84\xe3\xfe\xe7\x8e\x02\xe9\x65\xb5\x2d\xf2\x63\x3a\x8d\x6c\xfc\x4d\x2f\x74\x0b\xc0\xde\x6f"
-	"\x00\xb2\x96\x21\x81\x09\xd9\x01\x12\x7e\xd0\x73\xaa\x29\xee\x6e\xda\x95\xb1\x09\x96\xa8\x99\xc3\x60\x40\x8b\x39\x08\x9b\x31\x0b"
-	"\x10\xec\xe8\x2c\xa5\xe4\x57\x04\x68\x1d\xa9\x70\x4c\x25\x46\x9a\xa6\x08\x9d\x04\xdf\x2a\x48\x29\xbd\xa0\xff\x08\xd5\x0f\xb4\x8b"
-	"\xed\xb4\xcd\xfd\x43\x84\xa1\xe2\x7e\x67\xc9\x05\x1c\xcc\x4b\xc1\x59\x52\xc9\x6b\xf7\x5c\x5f\x89\x62\x36\x54\xf5\x14\x08\xdc\xbe"
-	"\xab\xb2\x51\x60\xa3\x98\xbd\x3f\x46\xd6\x06\xf2\x63\xf7\x56\x51\x91\x6e\x76\x03\x76\x16\x27\x13\x88\x93\xb5\xaf\x30\x3f\xcc\x68"
-	"\x7e\x62\xd3\x0c\x9e\x03\x91\x0e\x28\x9b\xc6\x5a\xf4\xf5\xd5\x2d\xfb\xb1\x89\x84\x3d\xee\x55\x5e\x38\x16\x85\x37\x64\x22\x59\x98"
-	"\x14\x05\xb3\xf9\xa9\xe6\x1d\xa1\x47\x72\x53\x23\x7e\xc6\xfe\xe1\xdc\xfb\xf2\x06\x8e\xda\x19\x11\xb8\x96\xc2\x36\x76\x19\xbd\x13"
-	"\x0d\xaa\x2f\x26\x1d\x26\x03\x56\x72\xcc\xd4\xf4\x20\xc4\x8a\x19\x4b\xbf\x97\x0f\xe2\x75\x3d\x2f\xff\x58\xc7\x0d\x60\xac\xb7\xc6"
-	"\x7b\xd9\xc5\x9d\x0f\xe4\x1e\x2a\x89\x0e\xa1\xcb\x8e\x28\x32\x54\xa6\xb2\x6c\x6c\xe1\x2c\x6c\x9b\x30\xc4\xd3\xa5\x8a\x4b\xa9\x31"
-	"\xb4\x4e\x8d\x21\x05\x58\x06\xe9\xe3\x2e\x01\xd6\x00\x40\xcc\xd4\x5a\x12\x46\xbe\x44\x79\x06\xef\x9b\x52\x3b\x78\xe5\x69\x2b\xa5"
-	"\x45\xc1\x62\x26\x6d\xb4\x60\x3c\x19\x06\xa7\xb6\x49\x57\xa4\x74\x24\x17\x61\x34\x0a\x82\x20\x63\x50\xd4\xf5\x3b\xca\x86\x81\x79"
-	"\x31\x29\xb1\x84\x6d\x24\xa8\xcc\xd7\xe8\xba\xd5\x9d\x55\xc5\x14\x39\x46\x78\x48\x04\x9b\xa7\x20\xde\x8c\x7d\x41\x44\xf7\x24\x61"
-	"\xe2\xd4\x4d\x9c\x12\xd4\xfd\x5e\xc8\x2e\x87\xe0\x4d\xf1\x4a\x5f\x83\x0d\x55\x9c\x3c\xf8\xd8\x06\x75\x37\xd5\xfc\x78\x2d\x83\x48"
-	"\x34\xa1\xa1\x91\x36\x56\x58\x71\x5c\xf4\xab\xac\x2b\x55\xb1\xd9\x4e\xe3\x24\x05\xbc\xc0\x21\xa2\x1b\x23\x96\x14\x00\x16\xb5\x8d"
-	"\xe2\x9a\x6d\xee\xa8\x95\x11\x73\x3f\x02\x7e\x98\xbf\x88\x6e\x5f\x97\x5a\x23\xf0\xf9\x6d\x9c\xfa\x17\xc0\x5b\xab\x5c\x07\x77\x86"
-	"\x65\x8d\x28\x6d\x02\xdd\xb1\xc3\x93\x2d\x2f\x04\x85\x37\xf4\xa2\x01\x09\x37\xd0\x85\xd7\xa3\xe4\x45\xb8\xd2\xe1\x72\xd8\x65\x18"
-	"\x53\xd8\x68\xe3\xcf\x97\xb2\x3d\x6d\xce\x28\x10\x02\x52\x54\xf3\xf6\x7f\xe7\x7f\xfa\xfc\x4d\xfe\xba\x9a\xe4\xfb\xb9\x58\xe9\xc2"
-	"\x42\xe7\xbb\x24\xbb\x76\x5e\x43\xc7\xbd\x86\xc1\xb8\xaf\x95\x65\x3a\x77\x95\xf7\x6b\xec\x56\x77\xd6\x7d\xf2\xa0\xab\x57\x02\x0f"
-	"\x68\x2c\x09\x00\xd2\x4b\x76\xe4\x4b\x0b\x3a\x84\xf8\xa4\x9b\x7b\x63\x82\xb9\x60\x9a\x90\xa9\x0f\x59\x69\xce\xb2\xac\xb9\x6b\x75"
-	"\x68\x77\x99\xc4\x3c\xd1\x77\x2d\x36\x69\x96\xaa\x7d\xf1\x78\x59\x94\xf0\x58\x4d\x97\x83\xe7\xa5\x0d\xe7\x4f\x93\xac\x1d\x97\x08"
-	"\x2f\x4b\x52\x06\x1b\x17\x51\x0c\xca\xb2\x3b\x22\xe1\x2a\x83\x2c\xba\x4a\x60\xe6\x4a\x88\x68\xc1\x69\x77\x25\x20\xc6\x5d\x72\xc2"
-	"\xfd\xad\x12\x34\x6f\xb1\x48\x03\x24\xd6\x3c\x0c\xff\xa4\xc5\xc8\x74\x06\xf4\xb3\xd3\x30\x63\x08\x71\x02\x0f\x61\x50\x37\x0f\x9d"
-	"\x2a\x18\x5e\x37\x9b\x00\x9e\x42\x46\xc2\x32\xc3\xbb\xe7\x14\x73\x43\x0f\x6f\x9e\x42\xc8\x42\xa2\xd3\x79\x00\x19\xcf\xc8\xb0\xe1"
-	"\x2c\x59\x17\x14\x79\x71\x08\xbe\xb0\xcc\x8d\xbb\xd2\xdc\x0f\x8c\x18\x45\x81\x86\x8d\x37\x80\xa0\x1e\xc1\xd2\x0b\x53\x52\x00\x95"
-	"\xee\xb2\x99\x1c\x0a\x89\x45\x34\x17\x38\x08\xbd\x76\x10\xc5\x18\x87\xdd\x9c\x6d\xa0\x51\xee\x76\x51\x37\xe8\xf6\x3f\x2f\xd2\xb8"
-	"\x85\xc8\xd2\x83\x93\x19\x10\x2e\x9c\xc2\xbf\x58\xc0\x6f\xc2\x0d\x5a\x3a\xfc\xa1\x97\x8a\x14\x57\x7e\x2f\x87\x6e\x60\xf1\x7f\xbd"
-	"\x58\x2c\x08\x04\x45\xb1\x3e\xd1\xb4\xfb\xb2\x02\xd2\x22\x95\x1d\x81\xeb\xdb\x47\xdb\x7f\x6f\x6e\x2b\x9f\x7d\xa2\xe9\x0a\x7c\x1e"
-	"\x00\xa6\x53\x35\x1f\x60\x89\x8b\x01\x58\x5b\x89\x06\xd4\x0d\x3a\xad\x61\x66\x1d\x31\x00\x1c\xa7\xcc\x4f\x49\x52\xee\xd2\xd6\xaa"
-	"\x60\xd0\xc9\x01\x25\x00\x26\x00\x30\x00\xb9\x5f\xab\xb5\x3a\x9f\xd7\x6a\xad\xd6\xea\xd6\xb7\x36\x9b\xcd\x26\x93\x69\xad\xd6\xca"
-	"\xf7\x7d\xff\xf7\xfb\xfd\x30\x49\x42\x34\xda\x98\x84\xb5\x8a\xbf\xdf\xef\x67\x2a\x53\x99\xca\x54\x54\x54\x54\xaa\xfa\xab\x5f\xfd"
-	"\xca\xd2\xd2\xd2\x52\x51\x51\x51\x31\x93\xf5\xb3\xbe\xfe\x5a\x61\xee\x31\x31\xf7\x18\xce\x00\x99\xd1\x70\x1a\x02\x84\x85\x22\xa1"
-	"\x51\x60\x90\x71\x2c\x0f\x06\x80\x84\x01\xe3\x3c\x76\x7f\x89\xdf\xaf\x7e\x45\x4a\xba\x2c\xa9\x91\x2e\xa9\x91\xfe\x7e\xbf\x57\xbe"
-	"\xf2\xf7\xfb\xd5\x2f\x0f\x04\x15\xf5\x81\xec\x06\x1c\x22\xca\xa3\x24\x11\x88\x92\x2c\x28\x66\x5e\x10\xd7\x30\x66\x5e\x1c\x0d\x53"
-	"\x0f\xe2\x7a\xfd\x72\x48\x10\x97\x43\x42\x27\x6c\xb0\x54\xf3\x1a\x3d\x6c\x71\x50\xc0\x68\x38\x8d\x40\x81\x20\xa0\x41\x16\xb7\x2a"
-	"\x82\x7e\x00\xb1\x85\x00\x18\x64\x10\x19\x9a\xaa\xd9\x01\x43\x43\x5a\xef\x0e\xc7\xf7\x8d\x26\x7c\xeb\x1a\x34\xba\xc9\x65\xba\x5f"
-	"\x21\xa5\x89\xc9\x27\x4d\x58\x3c\xc6\x54\x85\x92\xce\xce\x88\x31\x9b\xe4\x52\xb9\x84\xf5\x62\xc5\x50\xe8\x48\xd8\x14\x4e\x45\x40"
-	"\xf7\xcc\xe4\xf4\x59\x1c\x7c\x72\x44\xc1\x3d\x1f\x94\x33\x4d\x54\x87\xcc\x29\x8d\xf3\x94\x52\x90\x69\xf0\xd0\x2b\x01\xdb\x2c\x03"
-	"\xce\x47\xbd\x6c\x5d\x20\x27\xb1\xcd\xa5\x1a\x69\x65\x99\x0e\xf9\xc2\x46\x9c\x21\x3d\x41\x1c\xd4\xb1\x31\x20\x6c\x75\x4c\xbc\x6c"
-	"\x11\x35\x56\x11\x63\x99\x47\xf5\x42\xf4\x91\xb7\x32\x61\x88\x50\xca\x3f\x15\x86\xd2\xcb\xf2\xb9\x30\xec\xf4\xa5\x8f\x6e\xe0\xbc"
-	"\x53\x9c\x23\x3d\x0c\x65\x08\x06\x01\x31\xec\xb7\x4f\x08\x09\x91\x70\xde\xf9\x45\x45\x9f\x3c\x33\xea\xa0\x71\xf8\x37\x11\xbb\x0a"
-	"\x23\x97\x68\xff\x3e\xc6\x8c\x26\x98\x0f\x04\x35\x79\x49\xdc\xbe\x7b\x02\x15\x8e\xfe\x28\x3b\x75\x46\xd0\x61\x62\x97\xc4\x24\xad"
-	"\xa5\x82\xe3\x05\x32\xf2\x78\xf4\x08\xf9\xf7\xc1\xf4\xc8\x4a\xc6\x03\x64\xea\xd0\xaf\xe6\xfb\xb8\x41\xe2\xe5\x29\xd7\x0d\x59\x45"
-	"\x2e\xd8\xb9\xd6\x61\xc6\xc1\x5d\xe2\x1e\xa3\x4e\xd4\x31\x4f\x95\xf0\xa4\xc1\x81\xcc\x37\x32\xc9\x1c\x2d\x14\x13\x7b\x8c\x8e\xc3"
-	"\x37\x6a\x4b\xb1\x6b\xdc\x29\x88\x72\xb5\x48\x24\x04\x4f\x85\x14\xe2\x22\x90\x0a\x71\xee\x99\x6a\x6c\xf1\x0a\x95\x7f\x5a\x1b\x53"
-	"\xde\x09\x16\x15\xf7\xe6\x0a\xef\xba\xf4\x89\x76\x98\x97\x2d\xe0\x89\x29\x95\x46\x7c\x34\x28\x73\x50\xb9\xae\x99\x18\x45\x9d\x2e"
-	"\x8c\x42\x11\xf0\x9e\x4a\x12\x21\x6f\x68\x17\x17\x38\x4c\x47\xc1\x24\xd1\xca\x2e\x60\xd2\x3c\x98\x84\x82\xd5\xa1\x42\x2d\x4e\x51"
-	"\x9d\x13\x46\xa6\xa3\x30\x5d\xec\x29\x2b\xd4\xfb\xd7\x48\x75\xd3\xa8\x6e\x97\xd2\x98\x94\xd3\x34\x6f\x88\x54\x13\x0a\xb8\xd9\x7a"
-	"\x24\x5a\x42\x3b\x15\xf9\x9c\xe0\xe2\x40\x96\xa7\x0e\xa6\x98\x25\xf3\xce\x29\x13\x61\x60\xc3\x29\x5b\xb5\x2a\x0b\xaa\xbc\xa9\x51"
-	"\xc9\x06\x3c\x65\x0c\xf1\x1c\x2f\xb9\xf7\x0d\x7b\xd1\xe7\x8a\x9f\x18\x47\x98\xa5\xad\xda\x58\xc8\x54\xb9\x94\x71\x85\xa6\xa9\x36"
-	"\x28\x06\x14\x7e\x06\x60\x35\x40\x78\x3c\xca\x5e\xd5\x60\x33\x81\x1a\x97\x18\xe0\x2f\x91\x4c\x3b\x9d\x3b\x44\xf7\xe4\x5f\x89\x70"
-	"\x34\x45\xb3\xb9\xfc\x0a\xec\x28\x4a\x4f\x9a\x5e\xc5\x03\x4c\xcb\xb9\x93\x0b\x98\x5e\x40\x9c\xf9\x8b\x9d\x5a\x1a\x63\x2a\x0b\x3d"
-	"\xfb\x33\x19\xcb\x7a\xbe\x0f\xe1\x23\x21\x93\xe4\x37\x4c\x27\x54\x26\x30\x99\x0b\xc5\x80\x94\xe4\x91\x38\xf3\x3f\x24\x8d\xb5\x03"
-	"\xbb\x89\xf6\x73\xd0\xd4\x23\x10\x20\x26\x28\xd7\x2a\x8a\x1c\x84\xa6\x19\x6f\xec\xd3\x76\x45\x2c\x16\xf1\x82\x5b\xe6\xe6\x9b\x8b"
-	"\xce\x93\x82\x99\x54\xeb\x6a\x01\x28\x77\xd6\x5f\x74\xb9\xa5\xba\x42\x51\xf3\x28\x36\x87\x47\x42\x3e\x4d\xa1\xb2\x2b\x44\x46\xa1"
-	"\xa5\xd1\xa8\xf5\x38\x4a\x5e\x85\xee\x6e\xc7\x6a\x9b\xe5\x36\xb0\xd8\xb6\xba\x08\x25\x21\x8b\x9b\xf6\xe6\xce\xea\x69\x8f\xea\xc6"
-	"\xee\x88\x7f\x68\xaa\x92\x37\x30\xbd\x03\x6f\x60\xa6\x14\x32\xca\x53\xf5\xa7\x95\x96\xab\xe0\xc7\xf6\xeb\x29\x8c\xa8\x2c\xf4\xec"
-	"\xcf\x64\x2c\xeb\xf9\x7a\x08\x5f\xbd\xe1\x49\x7e\xc3\x74\x42\x65\x72\x48\x4c\x48\xbe\x6f\x62\xfc\x37\xad\x1a\x20\x11\xcd\x8c\xd8"
-	"\x1b\xe3\x71\xd1\x4f\x87\xd8\x09\xae\x44\x3d\xd9\x86\xfb\x1b\x13\x14\x14\x00\x42\x4b\x24\x1e\x50\x67\xec\x28\xb1\xfa\xf1\x56\x25"
-	"\x41\xbe\x22\x5b\xa9\x55\x35\xa6\xb9\x29\x5b\x23\x49\x23\xd2\xe2\x9a\xcc\xcc\x34\x27\xff\x34\xd7\x9c\xb2\xfd\x67\xd9\x32\x7e\x79"
-	"\x24\x72\x90\xf7\x5e\x32\x33\x3b\x65\x66\x66\x66\xe7\x02\xd8\x26\x6f\xe9\xb7\xd4\x3b\x61\x68\xbb\xbb\x78\x8c\x8b\xc7\x55\x30\xee"
-	"\x2a\x93\x82\xf1\xd5\x4c\xa8\x81\x06\x99\xd4\x43\xc6\x88\x10\xf1\xbf\x58\xa8\x5d\x55\xf4\x3c\x46\x16\x00\x76\x55\x3f\x8f\x74\x10"
-	"\xa7\x11\x5d\x87\x2c\xa4\x7a\xc8\x3c\x5a\x46\x12\x9d\x5e\x87\x24\xb4\x6f\x94\x82\x46\x78\x7b\x1f\x2c\xef\x84\xc1\xe9\x40\xa3\x38"
-	"\x24\xc8\xa4\x51\x1c\x0a\xa4\x80\xbf\xa0\x51\xbe\xa2\x29\x28\x68\x00\x71\x05\xc7\x19\x04\x06\x21\xa9\xa9\xda\x01\xae\xb2\x2c\x61"
-	"\x1d\x26\xc0\xfe\x9b\xca\x93\x75\x04\x48\x0c\x83\x4e\xd3\x53\xda\x21\x7f\x6c\xf3\xc5\xa7\xd6\xe3\x43\x7d\xd8\x36\x3a\xff\xa6\xf2"
-	"\x58\x94\xc3\x7a\x09\x04\x14\xd4\x28\x1e\x29\x25\xd1\x43\x6b\x80\x82\x62\xdd\x21\x60\xb3\x00\xf1\xff\x62\x4c\x7c\x6d\x09\x10\xff"
-	"\x9e\xa3\xbe\x70\x89\x44\x6e\x84\x03\x88\x3e\x1a\xe0\xfa\x49\xc7\xe8\xc1\xd3\x26\x15\x83\x74\x40\x23\x3c\x28\x4e\xd7\x64\x4e\x76"
-	"\xb3\x97\x3f\x11\xe7\xb2\x28\x38\x9a\x42\x5b\x79\xee\xd1\xbe\xb5\x62\xcf\x69\xf4\x28\x9e\xaf\x83\xd8\x16\xf9\xee\x87\x58\x08\xe7"
-	"\xbe\xa9\x48\x60\xaa\xb7\x8d\xa0\x53\x25\xc9\xc4\x04\x1d\x31\x29\x0e\xeb\xa2\x26\x50\xa4\xe2\x74\xc4\x4c\x4b\xf4\x7e\x8f\x40\x41"
-	"\xb1\x6e\xa4\x96\xfe\xee\x27\x0d\x81\x4c\xda\xfb\xf8\xc5\xf2\xff\xc8\x8d\x30\x44\xa5\xb4\x4b\xd0\x29\x22\xf0\x57\x76\xc8\x1f\x1a"
-	"\xda\xc5\xf7\x31\x23\x7c\xfa\x20\xb5\x88\x60\xf0\xb5\xad\x80\xeb\x17\xc5\x7e\x8c\x01\xcc\xcc\x74\xd6\x09\x56\x66\x07\x02\x8e\x05"
-	"\xbb\x8f\xe2\x46\xa3\x09\xf5\x70\x44\x70\x84\x19\x60\x1e\x09\xc1\xd2\x32\x69\x9f\x82\x00\x9a\x08\x01\x01\x50\xd8\xb3\x00\xff\xb5"
-	"\x64\x1a\x0b\x52\x33\x44\x85\x86\xa3\xc6\x4c\x87\x3c\xc0\x34\x5d\x8f\x00\x2a\x6a\xd3\xe4\x4c\x77\x96\x02\xec\x74\xe0\x23\x4c\xeb"
-	"\x5a\x51\x27\x1c\x4a\x74\x6e\xd2\xb1\x48\xcf\x4d\x67\x58\xc5\x6d\x4d\xc1\x5e\xe8\x5b\xf3\xb1\xee\x73\x42\x47\xf0\xc4\xc0\x11\xcc"
-	"\x0d\x24\x29\x83\x23\x48\xc2\xe0\x08\xc2\x1b\x10\x91\x7a\x5e\x83\x12\xb5\x50\x28\xbd\xf8\x62\x48\x8e\x79\x2a\x5c\x4b\x8a\x8e\x3b"
-	"\x50\x96\xc2\x17\x49\x0e\x4a\x52\x6d\xcd\x82\xc2\x19\xa3\xc1\x2c\x36\x3a\x8a\x2f\xf7\x9b\x4c\x6e\x09\x8e\xbe\x27\xeb\x13\x35\xf4"
-	"\x96\x1b\x00\xf6\x0c\x18\xf6\x68\x83\x6b\x7f\x2d\x88\xa0\x87\xe2\x48\x56\x88\x87\x45\xd9\x39\xd0\xa1\x1c\xf4\xe2\xc2\xc7\x7b\x00"
-	"\xca\x91\x09\x81\xcf\xa9\xfc\x8d\x3a\x40\x6a\x03\xf9\x66\x10\xf3\x27\x77\x8a\xc1\xd8\x5d\x0d\xce\xe7\x6e\x73\x74\xc1\x4e\x78\xcd"
-	"\x60\x4f\x07\x00\x6b\xb0\x55\x8a\x37\xb7\xce\x3f\xee\xda\x41\x50\x03\xe4\x7d\x78\x02\x45\x00\x00\x08\x6c\x01\x00\xfe\xfe\x40\x08"
+	"\x28\xb5\x2f\xfd\xa0\x8e\x09\x06\x00\xcc\xb6\x00\x7a\xca\x14\x24\x30\xa0\x6c\x6a\xac\x0e\xf0\xbf\x69\x04\x03\x62\x98\x38\xbe\xa2"
+	"\xdb\xb6\x32\x92\x2b\xff\xef\x0e\x50\xbb\xb7\x9f\xf9\xf8\xb9\xe5\x36\x4a\x53\x3a\x18\xe2\x8c\xbe\xba\x34\x39\x5e\x0e\x3d\x9e\x04"
+	"\x1a\x4f\x02\x1d\x02\x42\x02\x8f\x02\x0a\xc0\x2e\x0c\xb9\xf3\x77\xe1\x88\xde\x4a\xa9\x8c\x2f\x56\x5a\xef\xbd\x96\x3e\x37\x1b\x77"
+	"\x4e\x6d\xb7\xed\xf7\x9e\x7c\xd2\xd9\x3b\x9f\x2d\xdb\x5e\x18\x9f\xa4\xf0\xbd\x17\xa7\x75\xb2\x71\xe7\x12\xda\xfa\xe6\xab\xf5\xda"
+	"\x08\xeb\xbd\xf7\xde\x7e\xf7\xba\x77\xe7\xb1\x5a\x58\x69\x84\x93\xf6\x7d\xf6\xde\x7b\xe5\xb5\x0e\xde\x79\xcf\xa6\x93\xd6\x3b\x6b"
+	"\x7c\xb4\x46\x7a\xef\xbd\xd5\x52\xe8\x5e\xe3\xce\x21\x85\xf3\xcd\xb9\xf6\xc5\x81\x51\x0b\xd3\x75\x51\x52\xe4\x0b\xde\x3c\xc8\x17"
+	"\x40\x38\x5b\x15\x98\x22\xe1\x48\x42\x4d\x9b\x44\x3d\x2c\xc0\xb0\x30\x99\x14\x48\x58\x96\xe7\xda\xb0\x85\x84\x15\xe5\x79\x9e\xe7"
+	"\x79\x8a\xa4\x09\x4b\x48\xdc\xa2\x24\xea\xf1\x50\x97\x16\x96\xb2\x47\x7e\xc0\x56\x96\xe0\xc7\x03\xe5\x09\x1e\xb8\xaa\xb0\x64\x32"
+	"\x29\x90\xaf\x0c\x02\x89\xa0\x4b\x59\x8b\x1e\x12\x12\x04\xb8\x72\xb5\x61\x14\x46\x59\x55\x23\x32\x45\xd7\x15\x49\x20\x68\x08\x70"
+	"\x28\x5b\xd4\x14\x89\xfe\x88\xb0\x8b\x9a\x22\x38\x82\x1e\x99\xb0\xf4\x38\x96\x44\xb0\x55\x0d\x00\x40\x42\x42\x84\x04\x05\x2c\xa3"
+	"\x3e\x59\x19\x96\xad\xe7\xe0\x9b\x45\x39\x43\x61\xee\xb0\x8c\x72\x53\x74\xc7\x71\x58\x46\x6d\xae\x69\x34\xc7\xe0\x7c\x8a\x22\x91"
+	"\x45\x59\x5c\x30\xbe\x6c\x9a\x83\x70\x03\x67\xbe\x28\x77\xce\xc0\xe0\xcd\xb2\x68\xae\x31\x06\x90\x45\x51\x8f\x08\x16\x11\x2e\x7a"
+	"\x83\xf9\x92\x72\x04\xcd\xb9\xee\xe7\xce\xff\x2f\xd9\xbb\xa3\x1c\x52\xb1\xb8\xee\x87\x00\xe7\xcb\xa2\x60\x53\xa4\x38\x51\x84\x0a"
+	"\xee\x1c\xcb\xa8\x65\x62\x02\x8a\x9e\x48\x42\xe2\x5a\x86\x26\x06\xf2\x83\x81\x47\x8a\x1c\x9b\xa2\xec\x8d\x95\x21\x90\x8c\x42\x42"
+	"\xe2\xdd\xcf\x17\x4c\x18\xbb\x26\xea\xf1\x66\x62\x62\x8a\x9e\x1c\xc1\xd8\x25\x21\xf1\x29\xba\x92\x51\x93\xe5\x29\x19\xcb\x28\x22"
+	"\x0b\xc3\x30\x9e\xa2\x89\x89\x87\x47\x8a\x5c\x42\x09\x4b\x2c\x6a\x52\x98\x98\x58\xde\xf4\xa0\x24\xc5\xca\x57\x26\x21\xf1\x89\x8a"
+	"\xb0\xe8\xa2\xaa\x67\xf2\x88\x65\xd4\xf3\xa6\x08\x4b\x22\x24\x28\x5c\x59\x04\x61\x88\x6c\xe5\x8a\xcb\xca\x1b\x6e\x90\x64\xd3\x2f"
+	"\xac\x22\x12\xe5\x07\x56\xde\xb0\x74\x09\x1f\x84\xab\xe7\xa9\xae\xe7\x8b\x28\xa2\xb1\x29\x82\x70\x03\x50\x64\x2d\x70\x5d\xa1\x8a"
+	"\xa4\x04\x28\x08\x90\x64\x51\x16\x97\x9a\xc4\x30\x25\x41\xfe\x3f\xa1\x82\x04\x2d\x63\x56\x76\x64\x2b\x57\x54\x11\x93\x49\x81\x48"
+	"\x46\x91\x17\x8e\x3d\x32\x0b\xbb\x12\x12\x14\x9e\x1f\xb8\xba\xb2\x04\x4f\x8f\x4c\xd1\x95\x25\x24\x38\xa8\x70\x90\x24\xba\x18\x40"
+	"\x92\xe8\x4a\x70\x40\x11\x49\x10\x76\x3d\x12\xc6\xb2\xa4\xc1\x33\x94\x49\x8f\x29\x1a\x20\x54\x3e\x7a\xe7\x7b\x4f\x42\xd8\xd0\x76"
+	"\x84\x90\xd2\x5a\x6f\xec\x6a\xa7\x7b\x6f\xac\x8d\xf6\xbe\x8e\xf7\x4a\x7b\xdb\x3d\xad\xd1\x14\xa9\x3d\x07\x95\xc8\xe0\x93\x3b\xd7"
+	"\x1c\xe6\x93\x6c\x65\x17\x55\x69\xb9\xc2\x92\x3c\x51\xd8\x65\xd3\xcc\x1b\x9f\x8e\x4f\x5e\xb8\xc9\x02\x9f\xbb\xb9\xc9\xe2\x7c\xde"
+	"\xf8\x68\x6e\x32\x89\xf0\x62\x43\x5a\x2b\xad\x17\xbe\x7a\xef\x7b\xe3\xcb\x32\x9b\x4e\xf8\xa0\x7c\x7d\xe7\xec\x58\xe9\x94\x16\x54"
+	"\x75\xe6\x0d\x6f\x95\xb3\xca\xf9\x1c\x3c\xf3\xd9\x30\x4e\x79\xe3\x6d\x5a\xfb\xba\x86\x09\x12\xf6\xeb\x8e\x34\xd2\x78\x7b\x76\xcf"
+	"\x8e\xef\x3d\xfb\x22\x8c\xef\x3d\xf7\xee\x34\xb8\xa6\x1c\x12\x69\x9a\x46\x11\xb1\x22\x28\x08\x16\xce\x53\x24\x7d\xe9\x86\xf9\xc2"
+	"\x30\x57\xee\x1c\x93\xb2\x2b\x5b\x8f\x0d\x1f\xc8\x9d\x4b\xb0\x85\x2b\xc7\x1b\x07\x05\xa3\xa0\x3b\x77\x3d\xcf\x1c\xe2\x8d\xf3\x47"
+	"\xae\x22\x24\x8a\x08\x02\x02\x02\x02\x02\x02\x02\x22\x5e\x5c\xd8\x27\x2d\x84\x93\xca\x08\x2d\xbc\x13\x5a\x2b\xe3\xa4\x96\x5e\x2c"
+	"\xdb\xb6\x29\x77\x18\x9a\x73\x38\x73\xe6\x17\x9b\xe6\x96\xe5\xb9\xa7\x48\x79\x92\xa5\x37\x0b\xf4\x66\x73\x93\xec\xcd\x52\xc0\x9f"
+	"\x7b\x37\xe0\xcb\x73\xef\x0e\xae\x39\x07\x4d\x71\xce\x27\x93\x02\x91\xb9\xe6\x26\x57\xde\x7a\xe3\xeb\x1a\x23\x85\x95\x42\xf7\xce"
+	"\xf8\x32\x6b\x94\xf6\xda\x79\xeb\x93\xb2\xd2\x8e\x32\xba\x77\xe6\x1b\x74\xc7\xfc\x42\x73\x0f\xca\x9d\x4f\x32\x87\x37\x8e\x86\x82"
+	"\x3d\xb2\x04\xc9\xd6\x9d\x43\x3c\x32\x8d\xbf\x9c\x29\xb2\x87\x25\x55\x92\x08\x2b\x4b\x95\x04\x5f\x58\xc2\x0e\x70\xd0\x00\x8a\xd9"
+	"\xca\x30\x2d\x63\xb5\xc2\x67\xf2\x05\xd7\x95\xa7\x8a\x48\x46\x59\x6f\x20\x90\x08\x7a\x38\x1c\xde\x3c\x34\x20\xc0\x40\xc6\x70\x26"
+	"\xe1\x49\x5e\x18\x5f\x98\x3f\x88\xb2\xb9\x07\x39\xf3\xe7\xde\x64\x1a\xce\xb3\x84\x1f\x17\x85\x36\x19\xa1\x05\x52\xce\xf8\x83\x30"
+	"\x26\x65\xa8\xe5\x93\x12\xce\x18\xe1\x7b\xef\x41\x4a\x5d\xdf\x39\xb5\xd4\xde\x58\xfb\xf6\x93\xf1\xc2\x09\xc9\x39\x2d\x7c\x97\xda"
+	"\x28\x1f\x84\xe2\xeb\x18\x9f\x8c\x90\xce\xa6\x2e\x46\xa8\xeb\x85\xb5\xa1\xec\x68\xbb\xa7\x7b\x0d\x3d\x49\x61\x94\x95\xc6\x79\xdf"
+	"\xbd\x14\x42\x90\xd6\x39\xa9\xb4\xaf\x4e\x29\x1f\x7d\xd0\x73\xef\x0d\xa5\x50\xe6\xb2\x9d\xb9\xa4\x50\xce\x78\xa4\x50\x94\x37\x8b"
+	"\x76\xa6\x29\x14\xe5\x8c\x2f\xda\x99\x43\x0a\x45\x99\x22\x89\x52\x49\xb0\x14\xce\xb1\x29\x52\x6e\x51\x1b\xbd\x17\xca\x1d\x46\x82"
+	"\x02\x73\xe6\x16\xce\x9b\x85\xd6\xa6\xb2\x56\x29\x6f\xc7\xdb\x8a\x16\x49\x34\x47\xaf\x04\xcb\x36\x45\x8e\x51\x9c\x4f\x70\xe1\x06"
+	"\x30\x2c\xb9\x74\x7e\x00\x86\x25\x8f\x4b\xa3\x60\x14\xe4\x5c\x82\x4d\x73\xcb\x24\x7b\x26\x8a\x03\x86\x25\xf2\xcc\x17\x65\xca\xc7"
+	"\xa6\x88\x4e\x19\x1b\xd2\x09\x2e\x2c\x99\x92\x82\x32\x85\x84\x63\xc3\xdb\x40\x59\xaf\xac\x53\x56\x28\xeb\x82\x9d\xf9\x92\x9d\x79"
+	"\xa6\x28\x67\x14\xb6\xac\xcf\x5c\x3e\x58\xdf\xad\xcf\xda\xab\x39\x6c\x92\xbd\xc1\x1e\x18\xf2\x5e\x2e\x5c\xf5\x46\x73\x95\x02\xa1"
+	"\x2b\x8b\x92\x28\x07\xf3\x65\x61\xe8\x6c\x88\xf0\x79\xf0\xc0\xe1\x68\x78\xe3\xf0\xe0\x8d\x43\xc1\x28\xc8\x71\xc6\x1b\x1e\x28\x2c"
+	"\x0c\x69\xe3\x85\x90\x42\xf8\xae\x84\x0f\xba\xa7\x9c\x01\xce\xa6\x8c\x61\xf8\x0e\x1e\xe1\x0d\xe3\xdb\x85\xe6\x94\x37\x0a\x8c\x2f"
+	"\xcc\x13\xd0\x32\x04\x27\x80\x6b\x2e\xe2\x08\x81\x96\xb2\x06\x12\x68\xc0\x38\xa7\x20\xc2\xba\xc2\xa0\xa1\xa1\x20\x02\xbb\x22\xe8"
+	"\x8d\x4d\x73\x0e\x60\x15\x91\x48\x7a\x8c\xb1\x1b\x42\x85\x89\x77\xc6\xf3\x85\x29\x9c\x3f\x8c\x61\xe8\x72\x21\x42\x91\xb5\x80\x05"
+	"\x05\xe1\x8a\x2b\x5f\x98\xe2\x0b\xb0\x29\x7a\xb8\xd3\x3e\x1b\x9f\x84\xb3\x65\x8c\xd5\xde\x17\x2d\x5c\x98\x2f\x0c\x0b\x8e\x33\x67"
+	"\x50\x9c\x2f\x38\xe6\x03\xe9\x88\xce\x19\x1e\xdf\x3c\x0c\x0b\x10\x08\x44\x60\x70\xe7\x70\xc2\x47\x39\x24\x9a\xf0\x59\x98\x53\x09"
+	"\x67\xbf\xb6\x72\x5a\x18\x6d\x3b\x2a\xa1\xa6\xcc\x70\xfe\x1c\x3c\xe3\x8d\x3f\x78\x70\xe7\x0b\x0d\x0d\x8e\x06\x2d\x12\x61\x7c\x61"
+	"\xae\x60\x16\x05\xd7\x99\x3b\x77\x68\x91\xc6\x15\x95\x84\x1f\x38\xde\x34\x60\x14\xe4\xa0\x44\xb0\xc0\x02\xcf\x82\xe3\x9a\x72\xe6"
+	"\xcb\x83\xbc\x01\x69\xa9\xdd\x79\x6b\x0f\x30\x0a\x72\x4c\xf0\x88\xa4\x8a\x47\xc4\xc3\xf0\x48\x2f\xbd\xf4\x4e\x48\x2a\x81\x31\xbc"
+	"\x80\x4d\x11\x55\x45\x28\x86\x2b\x9a\xc4\x86\x4f\x75\x31\x4c\xb2\x49\x66\xc1\x7c\x69\x94\xeb\xa2\xac\xc7\x1d\x6c\xaa\x24\xac\xfa"
+	"\x62\xd3\x1c\xd6\xcd\xc5\xa6\xb9\xa9\xe1\x9b\xe5\xa2\xaa\x37\x18\x05\x55\x8f\xf2\xa2\xaa\x4b\x09\x9f\x2f\xa0\x3d\xa1\x7c\x16\x14"
+	"\x44\xc4\xef\xc6\x97\x50\x4e\xb2\x67\xf2\x8e\x11\x45\x63\x53\x8e\x4c\x18\x7b\x26\x8f\x12\x8b\x82\x5c\x13\xb6\x20\x3c\x22\x09\x9e"
+	"\x36\xc7\xb9\xad\xf2\xb9\x74\x4e\x9b\x29\xa3\x74\x1e\x1d\x77\xde\x0e\x0f\x0f\xf2\xf0\xc6\x17\xc7\x14\x29\xf9\x22\xba\x73\x87\xc9"
+	"\xc3\x5b\xe0\x53\x24\x24\x0e\x25\x24\x8e\x4d\x59\x12\xc1\x16\xe4\xdd\x38\x6b\x95\x32\x70\xca\xf8\x10\xd1\xb7\x6f\xdf\xbe\x7d\x29"
+	"\xad\x0f\xa5\xf5\xd1\x4a\x69\x7d\xb4\xf6\x8d\x88\x88\x88\x88\x88\xe8\xdb\x37\x5a\x1a\x2d\xed\xdb\xb7\x6f\xdf\xbe\x7d\xfb\xf6\x9d"
+	"\x72\xca\x29\xa7\xec\xdb\xb7\xef\x8b\xf4\x45\xfa\x22\x7d\x91\x4e\x48\x27\xa4\x13\xd2\x09\xa9\x6c\x68\x9d\xd2\xce\x67\x27\xad\x73"
+	"\xca\x52\x2b\x77\x98\xbe\x83\x4f\x59\x52\x2a\xb0\xc8\x94\xa5\x3b\x9f\xb2\x34\x45\x0f\x5e\x5b\xe9\xb4\x32\xf6\x53\x81\x55\x0a\x0b"
+	"\xf3\x07\xb9\xd4\xbd\x09\xdd\xfb\xdf\x78\xe3\xc0\xe0\xcb\xe6\x1e\xde\xf8\x84\x35\x5a\x5a\xe5\xab\x2e\x32\xfe\x70\x63\xd3\xc7\xc1"
+	"\x27\x32\x28\x71\x9b\xc6\xa6\xcf\x75\x1e\x9b\x3e\x97\x28\x8a\xa2\x71\xe7\x0e\x0b\xe7\x0f\xcc\x1f\x9a\x49\xa6\xbc\x99\x64\x0f\x55"
+	"\x24\x3d\x98\x63\x57\x74\xe3\x7b\xee\xc1\x88\x72\xc6\x2d\x2a\xb0\x2a\x3b\x8f\xce\x2d\x9d\xcf\x23\x8c\x74\x8c\x40\x08\x1b\xe7\x2f"
+	"\x72\x39\xc9\x26\xd9\x24\x7b\x60\x02\x5f\x64\xda\x69\xa7\x9d\xd6\x46\x68\x23\x9c\x76\xda\x69\x17\xb6\x09\x27\xdc\x26\x74\x18\xd7"
+	"\xdc\x84\x35\xee\xfc\xbd\xe9\x38\xb8\xe6\xa6\xf7\xe6\x73\xe1\xa6\xc6\xb2\x2d\x8b\xe6\x20\xca\x45\xd1\x6c\x0e\xf2\x46\x73\x10\xc8"
+	"\x17\xb4\x84\x2d\x28\x57\x60\xec\xe1\x40\x86\xa8\x47\x86\x1e\x1b\x48\xe5\xa5\x72\x52\x49\xa5\x74\xfd\x66\xda\x7a\x6b\x85\x70\x3e"
+	"\x6a\x23\xbd\x97\x76\x84\x3d\xdf\xad\x4d\xa3\xb4\x2d\x6b\x57\x6a\xab\xbc\x8a\x62\x41\x55\x53\xc2\x7b\xa5\x7d\xf3\xcd\x67\xe3\xbd"
+	"\xb1\xd6\xe7\x5e\xec\x27\x6b\x8c\x31\xb6\xed\xda\xb2\x81\x82\x40\x11\xb1\xae\x37\x9c\x6d\x45\x0b\x1b\xb6\x26\xd9\x25\x7c\xaa\x2b"
+	"\x5a\xa0\x20\x54\x60\x55\x86\x20\xc9\xa2\x20\xa0\x20\x54\x91\xf4\xb8\xd4\x24\xe8\x86\x72\xe6\xdb\x1b\x37\xe3\x73\x46\x73\x17\x55"
+	"\x29\x8a\x72\x51\x55\xcf\xf8\x7c\x41\xc7\x7e\x20\x5c\x49\xa0\x10\x41\x15\x49\x90\x5b\x6c\xb4\xd2\x0a\x67\xc3\xd9\x70\xf6\xbc\xf0"
+	"\x56\x3b\x2f\xbc\xd5\xc2\xd9\x95\x4e\x19\x1b\x3e\x70\x76\x7d\x5d\x5f\x37\xf0\x7a\xf3\x2e\x45\x8b\x24\xb4\x69\x43\x48\xfb\x42\x81"
+	"\xa6\x8c\xb2\x94\x4d\x73\x8d\xf3\x27\xbd\xb9\xd0\x5c\x35\x21\x7c\x1e\xa5\x37\xbe\x49\x77\x8e\x3d\x49\x99\x22\x09\x94\xea\x26\x29"
+	"\x16\x45\x49\x92\xad\xee\x7c\x93\x36\x6c\x59\x07\x6c\xd8\xb2\xf0\xa3\x44\xc0\xd9\x70\xb6\xc5\xf6\xe2\x85\x2f\xde\x29\x65\x54\x68"
+	"\xf8\xe0\xb5\xd5\x79\x4f\x11\x84\xef\xda\xaa\xf0\x20\xef\x30\xa0\x29\xbf\x81\xc2\x7b\x85\x8d\xa8\x93\x17\xc3\x22\x85\x4e\xa9\x11"
+	"\x12\x91\x24\x49\x0a\x1d\x63\x13\x40\x40\x48\x60\x2c\x14\x0a\x23\x49\x11\x65\xe8\x03\x13\xc0\x00\x47\x66\xf2\x60\x34\x14\x0c\x87"
+	"\xe3\x38\x8e\xa4\x28\x06\xe3\x18\x64\x8c\x21\xc4\x10\x62\x88\x31\xc4\x28\x35\x25\x33\xdb\x0c\x63\x65\x58\x7c\x7a\xb1\x89\xf0\x2a"
+	"\x1a\x4c\x30\x8a\xcf\x8d\x7d\x62\xd5\x90\x16\xd4\x76\x33\xbf\x52\xaf\x9d\xbc\x57\xd6\xd8\x0d\x1d\x58\x62\xa2\xb7\x66\x9a\x25\x43"
+	"\xa8\x73\x9c\x02\xf7\x29\x13\x1e\x25\xaa\x26\xb4\xf1\xa0\x7a\x3c\xf7\xa9\x84\xb8\x21\xd0\xf6\xfe\x35\xad\xe0\x5c\x0a\xf2\x81\x22"
+	"\x98\x52\xd1\x3e\xd5\xd7\xa4\x63\x0b\x2d\xe7\xf3\xa0\xe6\x9e\xaa\x7c\x99\x9c\xb4\x4d\x87\xc8\x99\xb7\xe5\xfa\xa6\x9f\xfb\x86\x9f"
+	"\x23\xa8\x8d\xbf\x01\x8a\x7e\x13\xef\x62\xf1\x61\x4f\xe4\x66\x41\xc5\x29\x86\xc8\x47\x24\xb5\x59\xf5\x42\x10\xd1\x0b\x4d\x9b\x96"
+	"\xa2\x1d\xd2\xc8\x06\x12\x95\x7c\xd5\xf3\x00\x13\xb2\xe1\x94\xcc\x0b\x74\x5c\x13\xda\x92\x55\xad\x2a\x15\x2d\x71\x1b\x17\x97\x76"
+	"\xea\x57\x14\xa0\x42\x47\x54\x0b\xaf\x85\xab\x47\x44\xcb\x7e\xf5\xb6\xb8\x0b\x63\xf1\xac\xde\x16\x6e\xbb\x33\x0f\xf3\x4f\x3f\x74"
+	"\xbc\x69\x12\xb8\xcf\x18\x3c\xb3\x80\x79\x30\xe4\x15\xa0\xb2\xd1\x99\xf8\xdc\x03\x85\xc0\xc7\xa7\x79\x1b\x69\x02\x78\x33\x31\x30"
+	"\x5b\x8f\x21\x91\xa3\x52\x8c\x5c\x72\xf9\x38\xba\xf6\x8b\xc4\x1f\x77\xac\x60\x63\x91\x14\x37\x1f\xc7\xfd\x7b\x9c\x39\x0e\x72\x02"
+	"\xac\xe2\x48\x92\x53\x48\x12\x47\xa2\x61\x05\x8f\xdb\x76\x55\x50\xe1\x47\xf9\x1e\x0a\x1b\x0a\x15\xb9\x0f\x32\xe9\xc5\x09\x1f\xbd"
+	"\x03\x63\x87\x5e\x30\x2a\x82\x6f\x82\x32\xd1\x2f\x5e\x38\xf1\xd7\x1e\x3d\x63\x9b\xc0\x01\xe9\x44\x64\x82\x16\x6e\x4f\x38\x1e\xa9"
+	"\x78\xd5\x59\x3d\xb1\x51\x43\xce\x58\x58\x92\xff\x42\x02\x5b\x72\xce\xa4\x32\xfe\x8f\xd1\xe4\xc6\xf7\xfb\x2b\x60\xed\xb8\x39\x30"
+	"\x16\x7d\x03\xbe\x83\xdb\xd8\x1b\x08\xd2\x2c\xf8\x2d\x26\x6b\x1a\x55\x7f\x2f\x3e\x54\x35\xac\xc4\xe1\xe0\xb8\x4b\xcf\xee\xff\xea"
+	"\xf3\x51\x43\x25\xf0\x35\xf4\x03\x9f\xf2\x7a\x0c\xa7\x02\xf5\xf4\xa1\x34\x71\x97\x76\x35\xb7\xcf\x32\x38\xb0\x18\x8e\xe0\x98\x18"
+	"\x7b\x16\xe5\x04\x0d\x36\xf0\x0d\x16\x87\x21\xfb\x7f\x80\xaf\x8e\x25\x21\xd0\xec\xf7\x16\x25\x80\xef\x5b\x4f\x67\xc1\xef\xb0\xb2"
+	"\xb8\x6e\x0d\x40\x91\x4e\x40\xdc\xc1\x45\x67\xdf\x0d\x25\xc8\xdc\x82\xb1\x44\x7b\xe4\xe3\xac\x8c\x20\x5e\x06\x60\xb4\x60\x42\x1a"
+	"\x3f\xcd\x2b\xa7\x3a\xb4\xc9\x3a\x08\xce\x75\x78\xa9\xeb\xe0\xdf\xba\xfb\xc2\x64\x22\x5a\xdd\xc1\x40\x05\xbc\xaf\xdf\x9a\x4f\xd5"
+	"\x78\xab\x8d\x49\x85\x75\x74\x93\xd6\xeb\x18\x61\x74\xfe\x03\xfa\x5b\xdb\x71\x80\xfb\x03\x92\x6e\x9d\x79\x1a\x6a\xa7\x7f\x47\x2c"
+	"\xff\x6e\x85\x9a\xf0\x12\x6f\x84\x65\x7e\xb8\x1d\x7b\xdc\xa2\x26\x62\x5b\x67\x28\xa1\xcc\x8a\x1d\x5e\x2b\x5b\x02\xd9\x02\xa0\x4c"
+	"\x55\xcc\x0c\xa7\xf1\x99\xb6\x40\xd3\xec\x79\xcb\x83\xb0\x3b\xe4\xf4\x7d\xa3\x2b\x70\x8d\x04\x38\x92\x4d\xd2\x91\xa0\x87\x1a\x3e"
+	"\x2b\x94\x76\xa4\x47\xdc\x02\x90\x1b\x4b\x48\x69\xa7\xb1\x2c\x91\x31\x01\x59\x14\x12\xaf\x96\x83\x54\x92\xd2\x10\x57\x0a\xe7\x25"
+	"\x08\x08\xe9\xcf\x56\xa4\x11\xe4\x19\x79\x6c\x3d\x56\xe3\x6e\xa0\x02\x53\x6f\x41\xab\xed\x7d\xbe\xd7\xdb\x96\x56\x81\xac\xfd\x31"
+	"\x1e\x83\xfd\x87\xa6\x17\xad\x99\x4c\x1a\x29\xe8\xec\x42\x43\x04\xb3\x47\x2b\x7f\x8a\x79\xcc\xe9\x91\xb9\x5b\x83\xae\x74\xa0\xb9"
+	"\xf3\xb9\x01\x05\x39\x89\x11\xf4\x1b\x8e\xb6\x56\x28\xe6\x81\x47\x78\x2a\x31\x46\xe4\xac\xe0\x83\x31\xd2\x40\xbc\x9a\x20\x05\xf2"
+	"\x65\xa6\xae\x5f\xe5\xb7\x88\x3e\xc4\x67\xe1\x8e\x86\x08\x67\x5e\x72\x68\xde\x61\x27\x71\x5c\x77\x10\x2a\x2e\xb7\x2e\x62\xdb\xf6"
+	"\x76\x07\x8e\x28\x0a\xc4\xae\x5c\x38\x20\xf0\xbc\x49\xc7\xd9\xa2\x62\x1a\x9c\xd2\x07\xcc\xe0\xa5\x98\xd4\xa9\x33\x95\x29\x88\xf4"
+	"\xf1\xa1\x0b\xce\x75\xd3\x7f\x4f\x25\xd7\x69\x25\x8a\x54\x49\x24\x84\xa9\x85\x8b\x4e\x03\x6e\xe8\x3f\xc7\x3b\xd3\x72\x72\x56\xb6"
+	"\x44\xda\x7a\x33\xc4\x70\x92\x6e\x56\xc5\xf8\x12\xef\x46\x89\xa4\xf9\x53\xd8\xd9\x8e\x4b\x48\x24\xec\x21\x9c\xe3\x1e\x08\xaf\x16"
+	"\xc6\xd1\x3e\x62\xd7\xb2\xc7\xdb\xae\xcf\x53\xef\x78\x4f\x2d\xf2\x03\x53\xe1\xde\x03\x17\x48\x86\xc3\x1f\xc8\xee\x4c\x9e\x33\xe1"
+	"\xde\xf7\xde\xc6\xa7\x61\x72\xc2\x26\x01\x1a\x16\xdf\xbd\xd9\x49\x23\x59\xbc\xd5\x19\xff\x97\x78\xa1\xb1\xce\x2b\x97\x45\x51\xd3"
+	"\x71\xf2\x4b\xcb\x45\x53\xf2\xbe\x3c\x1f\xb3\x90\xe3\xc1\x8a\x9b\x25\x03\x33\x78\xa0\x7a\x83\x40\x1e\x80\x3a\xe5\x5e\x8a\xb8\x1b"
+	"\x44\xfc\x05\x75\xce\x6b\x50\x5a\xbb\x8c\x10\xbd\xf3\xb8\x0f\x80\x04\xef\x48\x70\x0a\x0f\x4e\xd8\x8e\x5c\x92\xe6\x7e\x86\xfe\x51"
+	"\x94\xb6\x85\x16\x9b\xed\x9f\xbb\x49\xcb\xe4\xdd\x95\x57\xc3\x45\xc1\x61\x0f\xaa\x0b\x06\x70\xe1\x1e\x64\x9c\x30\xd9\xce\x73\xf2"
+	"\x98\xd9\x2d\x92\xb2\xec\x16\xf7\xb1\x34\xcb\xf8\x01\x5d\x18\x21\x77\xd9\x42\xf2\xaa\x8c\x0d\xb2\xe0\x14\x79\x89\xd6\x5d\xcb\x3b"
+	"\xe5\x9e\x2d\x7e\x00\x03\xf8\x24\x98\x3d\x5f\x9c\x31\x43\x3b\xff\x04\xb1\x53\xb9\xbd\x38\x72\xbc\x78\x3c\xf9\xcf\x79\x6a\x99\x19"
+	"\x2f\x56\x8a\xdc\x10\x9f\x38\xc4\x5d\x29\x60\x21\xa7\xe3\x25\x14\xdb\x38\x1e\xab\x46\xac\xab\x9c\x34\xd6\xdc\xc1\x35\x6f\x78\xe7"
+	"\xfc\xbb\x3c\x0a\x6e\xaa\x10\x1e\x5b\xad\x9b\xdf\xdf\xc1\x62\xcd\x05\xa3\xee\x43\x5b\x93\x35\x4f\x32\x1e\x87\x2a\xa1\xb5\xea\x22"
+	"\x59\x5a\xb5\xf5\xf1\x58\x2f\xdb\xe9\xca\x14\x5a\xd0\x99\x78\x89\x1b\x1c\xb8\xe1\x5e\xfc\xa5\xf9\x13\x88\x8e\x5c\x04\x2b\x21\x5d"
+	"\x6c\xaa\x24\x53\x9d\x6e\xe9\x94\xb8\x1b\xf3\x08\xd7\x4f\xae\xf4\x56\xb2\x7f\xa2\x22\x22\xfc\xae\xa4\x85\xd4\x44\x1a\x22\x93\x7e"
+	"\x3f\x34\x62\xa0\x83\x30\x37\xa7\x41\xd2\x3c\x1c\x3b\x8a\x0d\xb7\x9c\x15\x85\x5d\x5f\x0b\x1b\x3b\x8d\xd2\x88\xa0\xaa\x2b\x52\x1d"
+	"\xc9\x89\xa4\x61\x83\x77\x9a\xdf\xb9\x79\x2c\x11\x7c\x88\x31\x02\x3d\xe0\x95\x52\xc9\x03\x45\x49\x75\x5d\xd4\x38\xd6\x6d\xbd\x56"
+	"\x02\xcc\x40\x0a\xc6\xf2\x08\xce\x5f\xbe\xd4\xed\x91\x78\xff\xd7\xe0\x68\xfe\x67\x44\x96\xc1\x4e\x1f\xb4\x6e\x0e\x37\xe1\xea\xa0"
+	"\x1f\xed\x18\x42\x5c\xd5\xa8\x8e\xb0\x8c\xa9\x3d\x32\x41\x8b\x7d\xe1\xc4\xaa\x93\xbd\xad\xb0\x79\x25\xfc\x34\x02\xbc\xed\x85\x58"
+	"\x22\x20\x15\x6f\xa8\x04\x3a\x93\x7d\x2a\x1c\x55\xc0\xfd\x53\xd5\x63\xfb\xfd\x72\x56\x04\x36\x9c\x5a\x1f\x1b\xf6\xdd\xe9\x1a\x52"
+	"\xbb\x96\x14\xff\x45\xde\xe2\x9d\x8b\xea\x7c\xce\x0f\x38\x41\xa0\xa0\xe8\x1e\x04\x48\x59\x63\x20\xe8\xc2\x2f\x2a\xbe\x2c\x99\x58"
+	"\x5b\xd8\x67\x81\xb1\x4a\xc4\xa6\x90\x8d\x95\xc7\xe1\x3d\xba\x55\x91\x59\x09\xdf\xf3\xc0\x94\xb9\xf4\xad\x90\xef\x68\xb0\x34\xf9"
+	"\xc7\x9f\x62\xdc\xb4\x43\xd7\xcd\x40\x3b\x2c\x1e\xa0\xbd\x7e\x4d\xeb\xcb\xf2\x88\xf0\x51\xf2\xe3\x68\xe7\x75\xe5\xbc\x30\x0e\x6a"
+	"\x86\x54\x16\x10\xbb\x06\x76\x37\x21\x36\x08\xab\xd3\x2e\x61\xec\xfe\xd8\x50\xaa\xc7\x4e\xae\xcc\x5f\x2a\xb4\x9d\xd9\x20\x5c\x47"
+	"\x2d\x64\x27\x2a\xa4\x30\x5c\x1d\x76\x5a\x99\x90\xb4\xd2\xad\x6b\xf3\x76\x7e\xac\x47\xe7\x22\xe0\xe2\x45\x6d\xd9\xe8\xf3\xcc\xa5"
+	"\x38\x73\x6f\x08\xf1\x70\xef\x17\x5c\xef\xe0\x1e\x16\x60\x88\x65\x50\xab\xb5\xed\x52\x02\x09\x58\x4c\xe5\x07\x2c\x00\x8c\x28\xb2"
+	"\x10\xca\x74\x33\x0b\xc0\x04\x12\x0d\x18\x2a\xf6\x37\xe0\x70\xc9\x6b\x83\x4b\x75\x5c\x85\xa7\x52\x48\x06\x84\x52\x8f\x7f\x56\x28"
+	"\xb9\x0d\x4a\x4f\x24\x15\x7e\x9a\x16\x09\x44\x27\x0f\x92\x5a\x03\x94\x9c\x97\xc9\x97\x8b\x05\x70\x0b\xcf\x34\x7e\x89\x09\x7b\xd8"
+	"\x72\x87\xc3\x54\x21\x9d\x5f\xac\xe4\x98\x13\x8a\x64\xeb\x1d\x53\x13\xb8\xce\x18\x3a\x63\xa5\x73\x4c\x40\xef\x6d\xa6\x0b\xb4\x2c"
+	"\x23\xb0\x87\x0c\xff\xa3\xb4\xf5\xb4\x8d\x56\xae\x91\x6e\x87\x5b\x8c\x41\x42\x16\x7c\xf3\x28\x2d\x08\xb9\x3d\x61\x84\x1c\x81\xa9"
+	"\x82\x1d\xcb\x28\x22\x22\xac\x1d\xa4\xa7\xc5\xa2\x1d\xaa\x49\x0c\x48\x16\x71\xf0\x6b\x58\x94\x71\xaf\xca\xb1\x61\xfb\x73\x2b\x19"
+	"\x76\x46\x46\x21\xb4\xa7\x07\x97\xde\x8a\x2f\x41\xf6\x72\x0b\x05\x8a\x85\x98\x35\x37\x41\xa7\x52\xaa\x4f\x96\x13\xf8\x87\x10\xe7"
+	"\x70\x10\x8a\x70\xae\xbc\xca\x03\x33\xc1\x08\x96\x2d\x43\xf2\xcf\x30\x42\x25\x8b\x7d\x70\x75\x8d\xaa\x00\x40\x5c\x1b\x0b\x2b\x3c"
+	"\xe6\x78\x7e\xcb\xf7\x65\x3e\xc5\x02\x9f\x0a\xa2\xe7\xe8\x35\x02\x7a\x62\x82\x00\x29\x74\xc6\xd1\xd2\x08\xc1\x41\xf8\x7b\xa0\xb2"
+	"\x3b\xca\xa5\x7d\xdd\x7b\xc8\x62\xe2\xf4\x04\x7d\xa7\x37\x4e\x1c\x81\xd0\x16\x1c\xb3\xd1\x60\x65\x06\x8e\x33\x2d\x71\x7c\x93\x46"
+	"\x87\xb1\x08\xfa\x1e\x73\xad\xe4\xe7\xff\x5e\xd1\x76\xe3\x7b\x89\x0a\x80\x90\x3f\x4b\x80\x79\xc0\x76\x92\x9f\x72\x4b\x9e\x8c\xb5"
+	"\x81\x7d\x12\x43\x9b\x6a\xa0\x3d\x80\x5c\x34\x70\x3e\x8e\xde\x38\xd5\xf9\xda\x91\xa5\x5d\x98\xde\xc2\x29\x33\x4c\x1e\x92\x69\x55"
+	"\x7e\x79\x45\x9e\x6d\xd2\x3b\x24\x39\x29\x2b\x1a\xbf\xed\xe0\xef\x91\x14\x6b\x66\xe1\xd0\x6c\x2d\x58\x0a\xc0\x42\x0f\x09\xa2\xe6"
+	"\x28\xee\x56\xc8\x66\x06\x45\xd0\xbf\x28\xc4\xb0\xaa\x39\x8d\x5a\x2d\x74\xe8\xdc\xc7\xd4\x13\xd3\xdc\xcf\x30\x13\x05\x0a\x3c\x20"
+	"\xd4\x7e\x74\x84\x4c\xf7\x90\x21\x66\x3b\xd3\xca\x4c\x11\xb9\xcb\xd8\x90\xe8\xf7\x5b\x60\x21\x56\x21\xac\x35\x88\x6f\xcb\x49\xa8"
+	"\xb2\xbe\x2d\xd6\x8d\x01\x1f\x18\xbc\x7c\xfb\x4b\x52\xce\x29\xf7\xca\xab\x7a\xfd\xf8\x87\x2c\xa0\xa0\xbd\x31\x3e\x34\x71\x6f\x30"
+	"\xe4\xa5\xb8\xfb\x4f\xdd\x68\x83\xab\xa8\xf7\x36\x59\x29\x53\xe8\x80\x43\x00\xf5\x9d\xba\x61\x01\xf5\x4a\xa6\x23\xc1\xb7\x65\x2b"
+	"\xcb\x15\x17\xc8\x00\x95\x9b\x65\x58\x12\x61\xf5\x4e\x90\xc6\x7a\xd7\x08\x47\x5c\x50\xe1\x1d\x9b\x6d\xcf\x2b\x87\x42\xa5\x6a\x98"
+	"\x1a\xe0\x00\xd7\x89\xf9\xde\x13\x5d\xdf\xe1\xfd\xf8\xdb\x9d\x38\x85\xc2\x7f\xcd\xb2\x4f\x4b\x50\xe4\x52\x1e\x06\xa9\xbd\x7a\x8c"
+	"\xd2\x18\xce\x36\x1c\x7f\x6c\xf1\x09\x65\x2b\xdc\x02\x68\x30\x74\x85\x88\xc2\xa4\xf7\xa2\x80\x4d\x1c\x65\x8e\xe4\x0d\x55\x19\xef"
+	"\x9f\xd1\xc3\x14\x19\xf7\x15\x5c\x4a\x60\x14\x11\x2e\x19\xcb\xbd\x70\xf7\xd7\xbb\x6b\x6e\x59\xf2\x02\x44\x2c\xe8\xee\x9d\x41\xd3"
+	"\x70\xdd\x1f\xb7\x2e\x56\x22\xcc\x0f\x6e\x59\xe5\x2f\x00\x99\x99\x81\x4c\x0b\xd8\x68\xb9\x90\x40\xc8\x00\x13\xa6\xd0\xe0\x83\xed"
+	"\xd9\x94\x91\x49\x75\x8b\xbc\x36\xeb\x2d\x01\xf1\x2c\x33\x7b\x48\xa3\x95\xf0\x40\xd8\x8a\xa9\x18\x17\xac\x66\x11\x0b\x8a\x66\xe6"
+	"\x44\x0e\xc8\x54\x89\x7a\xbf\x7a\x1f\xcd\x98\xc0\x62\x2b\x61\xd0\xe0\x6c\xe8\x2d\x61\xff\xf0\xd4\x84\xbc\xb1\x96\xbf\xd0\x60\x2e"
+	"\x3c\xb8\x0e\xdd\x23\xf1\xf1\x67\x7c\xdd\xc0\x30\x04\xe4\x50\x7f\xa6\x87\x9d\x46\x6f\x71\x9f\x9c\xff\x29\x0f\xb1\x54\x21\xde\x39"
+	"\xb3\x18\x76\x5a\xf2\x2a\xcb\x8a\x20\xf0\xe9\x4c\xa3\xb7\xc9\x6c\x68\x48\x47\x77\x3b\xc1\x9e\x4b\x6f\x49\x3a\x16\x92\x11\xc5\x85"
+	"\x20\x16\x82\x0c\x37\x01\x29\x91\x26\x1d\x64\x21\x56\xed\xe9\x94\x3f\xa3\x04\xbe\x05\x8f\xb4\xc9\xeb\x50\x4e\x16\xff\x41\x65\x4a"
+	"\x0f\x62\x17\x13\xf9\xe6\xc6\xc9\xb8\x76\xfa\xc1\x34\x78\xa3\x70\x8c\xaf\x66\x87\xb4\x69\xa5\x4f\xca\xd9\x33\xd8\x8b\x8c\xa7\xf2"
+	"\x18\xea\xd8\x44\x54\x07\xde\xaf\x69\xa6\x1c\xf4\xf7\xeb\x03\x28\x75\x4c\xd9\x90\x14\x2d\x7c\xcd\x19\xb2\xa4\x14\x4d\x06\x5c\x5c"
+	"\x8c\xcd\xcc\x3c\x2e\xaf\x86\x7a\x58\xc7\xce\xfc\x39\x01\x77\x6a\x81\x2f\xc8\x66\x45\x44\x50\x7e\x7d\x5f\xcb\x1c\x41\xc0\x82\x2e"
+	"\xbc\x13\x06\x99\x80\x91\x1b\xd1\xcb\xb5\xdb\x63\x8a\x92\x81\xb8\x32\xb9\xcd\x59\x1c\x87\xc9\xc4\x00\xd4\xc9\xee\xb5\x27\x5e\x96"
+	"\x44\x92\xbf\x4b\x77\xc4\xa9\x4c\x6a\xe3\x70\x72\xd9\x3e\x26\x40\x7f\xb1\x4d\xc6\x1f\x2e\x64\x69\x12\x68\x28\x2d\xe9\xab\x54\x9a"
+	"\xfa\xd6\x6b\xe1\xde\xa0\x72\x23\x28\xa4\x1d\xc1\x81\x99\xe4\x86\xb0\x4d\x04\x44\xb2\x4a\x90\x6a\xeb\x20\xb8\x39\x5b\x89\x87\x68"
+	"\x06\xdc\xac\x54\x39\x95\x9f\x74\x21\x1c\xd2\xd3\xcd\x79\xe9\x91\xd5\x6a\xe3\xe9\xba\xd3\x30\xf0\x37\x4d\x42\x17\xd1\xf0\xfd\x16"
+	"\xca\xb2\x7e\x0a\x6c\x75\x99\x05\x39\xe8\x9f\xd3\xc9\xf3\xee\xfd\xb6\x4c\xed\xc1\xb2\x8f\x39\xfc\x02\x8a\xfe\xe0\xdb\x8c\x19\x05"
+	"\xa1\xac\xce\x62\xb2\xfe\x0a\xa2\xad\x2f\x3f\x7b\xa9\x5c\x1f\xa6\xa9\x49\x47\xee\xb9\xea\x52\xa5\x97\x84\xbf\xfa\x74\xc9\x28\xc0"
+	"\xb3\xd3\x3c\x4d\x37\x81\xa4\xc5\x41\x5f\xd2\x2e\x50\x27\xaf\x0e\x27\xc9\xa5\x53\xbd\x07\xed\x95\xa8\x64\x83\xc9\xa7\xd8\xc7\x6d"
+	"\x96\x2a\x9b\xf0\xf6\x14\x03\x11\xc5\xd8\x67\x03\xd5\xde\xc5\x81\x54\xb4\x0c\x76\x33\x7c\x16\xb3\xd9\x8d\x13\x84\x50\x98\x0d\xa6"
+	"\xa0\xfd\x84\x36\x2a\x78\x1a\x38\x1d\x81\x6f\x1a\xe8\xeb\x7b\x52\x3c\x76\xe9\x77\x44\x42\xa2\xbb\xda\x5e\xe0\x68\x76\x32\x38\x22"
+	"\x11\x8f\x14\x01\x65\x93\x51\x7d\x72\x04\xaf\xcf\x5d\x9f\xfd\xd9\xe0\x1c\x2e\xbe\x37\xb4\xc0\x41\xcb\x16\xe9\x65\x3e\xdb\x30\x2e"
+	"\x8b\x06\xd1\xc4\x73\x91\x9a\xc3\xe4\xde\x72\x02\xb3\x06\x3d\xb1\x4a\x31\xb0\x1f\x91\xe1\xc9\xba\xae\x3b\x99\xf2\xd6\x95\x81\x8a"
+	"\x75\x50\x23\x86\x25\x8a\xf9\xc0\xa2\x87\x70\xa6\xc3\x96\x21\x13\x97\x39\x95\xc8\x2e\x7b\x5b\x77\x9e\xed\x2a\x07\xdf\x75\xa9\xe2"
+	"\xb2\x87\x11\x2d\x27\xe3\x19\x01\x21\x70\xb4\xb9\x4b\x94\x35\xeb\x11\x9f\x2b\x4b\xc8\x48\x27\xa1\x8c\xe0\xe2\xa7\x6c\x21\x6f\x5d"
+	"\xdb\x7e\xe0\xa2\x79\x31\x59\x47\x5a\x01\x4f\x96\xfa\x51\xdb\xfd\x57\xba\x23\x7e\x1f\xb9\x36\xca\x03\x40\x25\x28\xec\xee\x37\xb9"
+	"\x1e\x43\x30\x77\x52\x0c\x01\x36\x6b\xa0\x34\x9f\x87\xeb\x14\x3b\xf1\x14\x13\xe7\xd8\xc2\xe3\x01\x52\x31\xa1\x78\x1a\xf5\x43\x15"
+	"\xdd\x0e\x31\x63\x4e\xde\xd4\x9f\xa0\x1f\xf2\x32\xad\x3d\xfe\xdf\xec\xe3\xf3\x35\x24\x2b\x8a\xa3\x09\x53\xe3\x2d\x0b\xd7\xc1\x0f"
+	"\x01\x64\x90\x0d\x13\xa2\x27\x27\xdb\x74\xe7\xfe\xeb\x57\x31\xad\x16\x6b\xb3\x9c\xa6\x80\x48\xc6\x4b\xb5\x11\x4d\x27\xf1\xbb\x00"
+	"\x48\xd0\x5a\x15\x47\x32\xdc\xae\x1c\x30\x31\x86\xc7\x9b\x1d\xf8\x05\x7c\x0b\x7b\x7c\xa2\xd4\x29\xde\x82\xec\xbe\xd0\xd3\xca\xda"
+	"\x55\x6a\x44\x98\x59\x10\x29\x24\x40\x30\x36\x98\xb2\xf6\xca\x47\x9f\x1b\x71\xa3\xb9\x0e\x0a\xd0\x85\x06\x4e\xbe\x21\xd4\x09\xcf"
+	"\x45\xd5\x1c\x1c\x33\x6c\xcc\xd7\xcf\x2f\x59\x8d\x63\x5a\x2a\x4d\x03\x55\x49\x23\x2c\x8e\x89\xfe\x72\xd1\x9b\x02\x46\x37\x55\x57"
+	"\xc4\x75\x1f\x8d\x25\x4a\xe7\x9a\x8d\xde\x3d\x82\xee\xfd\x5a\x83\xf5\x6c\x2d\x82\xe9\xfc\xf7\x4e\xc1\xc3\xb4\xba\xd2\xe9\x93\xf9"
+	"\x5e\x5d\x2a\x90\x3a\x63\x29\x1e\x50\x59\x99\x01\x5f\x8a\x44\x42\x08\x9c\x74\x4a\x52\x58\x05\x39\x98\x11\xc8\x54\x75\x5b\x01\x2b"
+	"\x59\xb9\x15\xd7\xba\xff\xee\x5e\x20\x45\xa2\xef\xda\x9d\x34\x2e\x55\x30\xe3\x07\xb8\x9c\xeb\x11\x4a\x17\xd4\x9e\x07\x30\x8c\x1d"
+	"\x27\x41\x0c\x3c\x44\x64\x5a\x22\x17\x68\x50\x28\x8d\xa0\xa4\xde\xf1\x37\x0e\x14\x64\x25\x95\xef\x7f\x34\x8d\x08\xc6\xe0\x57\xff"
+	"\x04\x48\x35\x95\xa6\x70\xd9\xab\x7c\xc1\x6c\x2c\xbe\x83\xe4\x67\x0f\x92\x3d\x21\x1b\x89\x90\x7b\x3e\x2d\x0d\xa7\x69\x2b\x8e\x6b"
+	"\x42\x68\x77\x17\xdb\xd3\xcf\xc3\x53\x47\x82\x10\x8d\xe2\x11\x80\x7a\xca\xfb\x77\x27\xd9\xa1\xf9\x69\x68\x34\xc0\x62\xa1\x2b\x46"
+	"\x20\x49\xdf\x68\xe6\xe3\x84\xed\x3e\xb2\x60\xe3\x80\xf3\x63\xc1\x2f\x67\x4c\x53\xaf\x58\x55\x85\x25\x0d\x2c\x37\x20\x77\x3d\x28"
+	"\xa7\x57\x76\xae\x20\x34\xbd\x9a\xf3\x1c\x17\x26\x00\x36\x29\x58\x11\xec\xdd\x81\x93\x51\x7f\x76\xbf\xfd\xd1\xb7\xb8\x33\xa7\xd2"
+	"\xf1\xdf\xff\x40\x22\xec\x96\x58\x36\x1e\x78\x51\xc1\x3b\xb5\x55\xe8\xc4\x0b\xd5\xad\x02\x85\x0e\xd4\x7a\xc8\x9b\x98\xa2\xa1\xef"
+	"\x93\x2a\x1a\x10\xb9\xae\x12\x2d\x85\xfe\x3e\x9f\xd6\xfb\x48\xd3\xca\xd6\x37\xb1\xdd\x84\x2e\xe5\x72\x08\xa1\xad\xd2\x35\x9b\xa0"
+	"\x63\x2b\x3b\xa2\x03\x44\x1e\x00\x26\x55\x39\x1f\x50\x8b\x8b\x0d\xd8\x6c\x30\xc2\xa5\x16\x7f\x65\x06\x85\x39\x11\xcc\x78\x5a\xf6"
+	"\xe6\x96\x5c\xdb\x38\x23\x6a\x33\x8b\xad\x35\x29\x00\x29\x00\x35\x00\xb9\x5f\xdb\xda\xae\x7e\xf5\xb5\xad\x6d\xbd\x5e\xaf\x6f\xeb"
+	"\xb6\x5c\x2e\x57\x51\x51\xd1\xda\xd6\x56\xaf\xd7\xeb\xbf\xdf\xef\x87\x4b\x12\x62\x61\x15\x26\xa1\x25\x02\x67\xbf\xdf\xef\xf7\x2b"
+	"\xb2\x22\x2b\xb2\x22\x23\x23\x23\x53\xd5\x9f\xfd\xec\x67\x4e\xa7\xd3\xa9\xa8\xa8\xa8\x98\xcb\xd6\xd3\xbe\xf5\xf5\xda\x30\xf7\x98"
+	"\x98\x7b\x0c\x8e\x67\xc0\x41\x40\xd5\x78\x38\x9e\x02\xc6\x42\x91\xf0\x2c\x38\x10\x74\x20\x4d\xc4\x01\x20\x71\xe0\x38\x22\xbb\xbf"
+	"\xf5\x4f\x20\xf1\xfb\xd9\xcf\x48\x49\x9b\x25\x35\xe9\x92\x9a\xf4\x67\xbf\xdf\x2d\x6f\xf9\xfb\x3d\x92\x09\x2a\x6a\xa1\x64\xb2\x1b"
+	"\x80\x68\x40\x86\x82\xa2\x81\x8c\x84\x59\x1a\x26\xcc\xc2\xc0\xd8\xd5\x28\xf7\x38\x76\x35\x90\xc7\x51\x14\x5f\xaf\x6f\x10\x0b\x62"
+	"\x83\x58\xe8\x84\x0f\x4e\x75\xad\x29\xa2\x78\x81\x60\xd0\x78\x04\x81\x0d\xa0\x11\x16\xa9\x2b\xc3\x7e\x06\x91\x85\x84\x18\x64\x10"
+	"\x21\x22\x64\x54\x0f\xdc\x23\xad\x07\x1e\x36\x0b\x49\xd3\xc3\xf1\xe6\x47\x0c\xaf\xd0\xbc\x2f\xb0\xf5\xf4\x2d\x24\xd6\xa3\xfd\x04"
+	"\xc2\xd6\x2b\xd4\x3b\x71\xd0\xb1\xa9\x6d\xac\x65\x17\x31\x26\x35\x9a\x57\x52\xc1\x7a\xad\x94\xa8\xa3\x21\x05\xb7\x7a\x24\x09\xe8"
+	"\x5e\x2c\x94\x3d\x16\x3f\xbf\x1f\x51\x70\xf3\xa6\x49\xb5\xd8\x9c\x1a\x8c\x46\x54\x93\x8b\x29\xf0\xd5\x83\x24\xde\x58\xaa\x45\x83"
+	"\xaa\x73\xb5\x40\x4e\x06\x45\x4b\x95\xc8\x95\x65\x3f\x14\x45\x2b\xc4\x3e\xc4\x13\xe4\x21\x1d\x1a\x03\xc2\xd6\xc3\x84\x5e\x8e\xa2"
+	"\xc6\x0a\x51\x3f\xc7\x03\xbe\x9c\xda\x24\x64\x4e\x9f\x40\x16\xb0\x8f\x2c\xdf\x92\x39\x43\xbb\xf8\xd5\xb1\x45\x53\x14\x70\x10\x92"
+	"\x0a\x68\xa4\xcb\x9c\xba\x01\x0a\x87\x54\x12\x72\xd1\x7a\x1e\x19\x29\x89\xff\x29\xda\xa4\x8a\xc4\x25\xc4\x57\xb9\x4a\x39\x65\x7f"
+	"\xaf\xd0\x81\xa0\xa6\x2f\x89\x0f\xdd\x1e\x7c\xc2\xe8\x8b\xa2\x53\x67\x92\x0e\xc5\x58\x96\x7a\x72\x14\x0c\xa2\x35\x63\x6f\x86\xa2"
+	"\x50\xa6\xcb\x79\x37\x83\x9c\xdc\xcd\xd2\x41\xbf\xda\xef\xe2\xe3\x66\x55\xe8\x38\x23\xc4\xd7\xd6\x68\xbd\xcc\x39\xf8\xa2\xb1\x99"
+	"\x76\x39\x45\xc2\xa5\x0a\x61\xa5\x22\x27\x32\x3f\xba\x1a\x9d\x1e\x55\xcd\x3a\x5a\x88\x8c\xc3\x37\xea\x4a\xb1\x2b\xd8\x29\x8b\x70"
+	"\xb5\xe8\x24\x05\x4f\x91\xa4\xe2\xad\x45\x2b\x0b\x47\x08\x60\x1d\xaf\x57\xc3\x72\x4d\x8f\x1c\xfe\x72\x66\x50\x3b\x94\xe6\x72\x80"
+	"\x91\x64\xc2\xee\xc3\x26\xcc\x14\xb5\x0e\xc9\x00\x06\x98\x8d\x2a\xc5\x30\x88\x50\x29\x61\x19\x16\x58\x0a\x05\xbc\x29\x05\xb2\x8b"
+	"\x50\x29\x63\x2c\xba\xd6\xdc\x7f\xcc\xc7\x0a\x58\xb9\x52\x26\x35\x59\xa3\x37\xcd\x83\x51\xef\x5f\xa3\x2a\x9a\x42\x7d\xbb\x86\xc6"
+	"\xa4\x9c\x26\xe2\x67\xca\xd6\xa9\x9e\x2f\x80\xb4\x50\x6e\xa7\xe8\x37\x25\xfe\xff\xdc\x90\x0e\x40\x35\xeb\xce\x8b\x09\x41\x04\x0e"
+	"\xad\x4d\x65\xab\x46\x5d\x45\x97\x47\x35\x2a\x99\x02\x4d\x31\x02\xbc\xc7\x4b\xe3\x7d\xc3\x64\xe4\xb9\x22\xe7\xc4\x3b\x5c\x3a\xbb"
+	"\xe9\x32\x50\xe0\xae\x84\x50\x6e\xa6\x10\xd0\xf9\x39\x80\xaa\x83\xf8\x78\x94\x0d\x55\xc3\x47\x08\x52\x83\x11\x03\xf1\xab\xd9\xeb"
+	"\x93\xd4\x10\x72\x7a\x8a\x88\x80\xfa\xa4\x7f\x47\x6a\xb4\xa3\xb5\xb9\xdc\x4a\xed\x39\x5a\x9f\x9b\xae\xec\x09\x4e\xd7\xb1\x89\x85"
+	"\x9b\x5c\x40\x9c\xf1\xb7\xed\x5a\x6a\x23\x0a\x0b\x7f\xfc\xb1\xbc\xcb\x7e\x78\x0f\xe0\xf5\x3c\x3b\x09\xb6\xad\x17\xa8\x66\x90\xcc"
+	"\x85\x72\x60\x22\xdd\x64\x57\xce\x1f\xf8\x8d\xf7\x90\x0d\x1d\x74\xf5\x08\x08\x10\x17\x94\x73\x15\x0a\x39\x00\x4d\x31\xd0\xc4\xb1"
+	"\xe5\x44\x2c\x2a\xe2\x8d\x9b\x0c\x7f\x72\xa5\x62\x5c\xaa\x75\x5b\x02\x34\xee\x9c\x27\xe8\x7a\x23\x75\x85\x74\x1e\xa3\x48\x85\x3d"
+	"\x12\x04\x91\x26\x4a\x9b\x13\x7b\x68\xfc\xa3\x41\x79\xf2\xbf\x22\x34\xd2\x89\x18\xdd\x46\xb6\x9b\xea\xc9\x0d\xa5\xdf\x96\xd5\x85"
+	"\x59\xa3\xf5\xdc\x54\xe5\x9e\x70\xba\x33\x3d\x60\x26\x1d\x40\xb7\x55\xd2\x56\x05\xf8\xa4\x9d\x2a\xdd\x88\xf2\xc5\x9f\x7f\xa6\xcc"
+	"\x85\x1f\xbb\xc7\xf0\xd5\x1b\x88\x06\xdb\xd6\x0b\x54\x73\x23\x2d\x28\xfd\xbe\x89\xf9\x3f\x9b\x00\xd2\xa8\xc5\xd2\xef\xcb\x8c\xd8"
+	"\x1b\xe2\xa1\xdb\x5f\x4f\xec\x90\xa1\x0c\x78\x1a\x32\xa3\x0f\x96\x64\x12\x00\x12\x4a\x20\x1c\x60\xb5\x6e\x94\x7a\xbb\xfc\xfb\x97"
+	"\xaf\x8d\x2c\x66\xae\x01\x76\x0c\x29\x43\x46\x32\xaf\x54\x0b\x39\x8a\x82\x4b\x1f\x9b\xd2\x14\x65\xfb\x71\xd9\x32\x76\x69\x64\x41"
+	"\x1d\xce\xb9\x64\x66\x66\x66\x66\x66\xe6\x01\x73\x4f\xbb\xa5\xde\x10\xd3\x76\xf7\x71\x08\x1f\x87\x1b\x3d\x47\xa2\xe7\x99\xbc\xf7"
+	"\xfe\xab\x0a\xd9\x55\x2d\x62\x24\x72\x11\xec\xaa\x7e\x1a\x49\x1d\x54\x1f\xba\x9a\x5c\x12\x79\xe9\x7d\xb1\x88\x04\xb6\xae\x26\x03"
+	"\x6d\x72\x0e\x0d\xe0\xed\x1d\xb0\x56\xbd\x21\x46\xd1\xc2\xe4\xb8\x64\xc8\x64\x72\x5c\x22\x68\x80\xaa\xa0\x00\x75\x92\xc2\x72\x71"
+	"\x05\x87\x19\x44\x88\x31\x32\x22\x47\x0f\x22\xb0\x2c\x21\x3a\x4c\xc0\xe8\x35\x87\xf5\xe8\xf0\x6a\x0b\x97\x30\x1f\x1b\x12\xd5\x8e"
+	"\x4e\xa6\xa5\xb5\x63\xfe\xdc\xe6\x15\x7c\xca\x25\x0c\x0a\x1f\x03\x60\x24\x1f\xeb\x8e\x80\xed\xff\x0b\xf4\x5f\x8c\xc0\xab\xbd\xff"
+	"\x45\xfa\x73\xe8\x89\xec\x2e\x81\xc8\x8d\xa0\xeb\xd2\x47\x03\xb8\x5e\xd2\x31\x7a\xf3\xba\x41\xe1\x20\x1c\x68\xee\x62\x2c\x93\x49"
+	"\xc5\xa3\xd3\xcd\x86\xfc\x93\x93\x53\x5c\xf0\xfe\x32\x45\xd2\xb7\x9f\x7a\x74\xdb\x58\x31\xc7\x6d\x74\xc5\x0f\x6b\x1c\xb9\xd0\x8d"
+	"\xf4\xe4\x87\x5c\x00\xe7\xbe\xa9\x13\xa8\x9c\x80\x2a\xb3\x91\x2e\x66\x85\x75\x10\x2d\xf1\xdb\x37\x7d\x74\xd1\xd3\xde\x1f\xa7\xd8"
+	"\x8d\x2e\xf8\x5b\xd4\x46\x0c\x91\x11\x5d\xc7\xd9\x92\x21\x1a\x29\xa9\xb8\xfc\x95\x85\x78\x28\xbf\x98\x22\x00\x45\xc8\x49\xf0\x6b"
+	"\x5f\xc0\x75\xa2\x0b\xfe\x8c\x03\xc3\xc8\x3e\x1f\x07\xc7\xd2\x76\xed\x34\x76\x64\x67\x7c\xc9\xdf\x2d\x4b\x13\x3c\xdc\xc7\x85\xd1"
+	"\xc7\x00\x38\xa4\x2c\x1a\x2d\xa3\x3d\x4a\x16\x4d\x33\xe1\xcc\x4f\x28\xd8\xb3\x40\xff\x2b\xc9\xd0\x82\x2a\x30\xb4\x60\xec\x28\xd8"
+	"\xe9\xe0\x0f\x31\x5d\x57\x6a\xb9\xa8\x41\x77\x92\x00\xec\x74\xdc\x70\xd4\xba\xe1\xf5\xe0\x42\x5f\xc5\xf7\xde\xdb\x0e\x28\x2d\xfc"
+	"\xd5\xd2\x22\x9d\x64\x5a\xb4\x1b\x37\x2d\x24\x49\xb7\x59\xe2\x57\x90\x94\x91\x2b\xc8\x2d\x24\x29\x03\x87\x00\x29\x23\x57\x10\x6f"
+	"\x21\x21\xf5\xba\x86\x02\x35\x50\x20\x67\xf1\x65\x48\x8e\xf4\x56\x5e\x9e\x80\xc6\x1b\x50\x76\xb0\xa3\xa6\x03\x65\x23\xa7\x7f\x44"
+	"\xc3\x19\xa3\x29\x13\xdf\x0e\xe7\xf3\x0e\x21\x93\x57\xc2\xd0\x3f\x02\xab\xf0\xa3\x7e\xb9\x26\xa2\x49\xf8\x72\xd0\x6c\xf7\x52\xb1"
+	"\x0b\x24\xc2\x24\x90\xac\x10\x5f\x8a\xfe\xdd\x8d\x27\xea\xa0\x2e\x5c\xe2\xb0\xde\xc7\x25\xe7\x57\x3c\x89\x93\x23\x83\x48\xbf\xa2"
+	"\xc6\x4e\x84\x14\xcd\x83\xf5\xc5\x7a\xf0\x2d\x9e\xcc\x30\xf6\x2b\xbe\xda\x8e\x9e\xed\xa4\xcb\x59\xee\x36\x68\x8d\xf4\x3e\x8c\x45"
+	"\x00\x00\x08\x72\x01\x00\x8a\xf1\x81\x10"
 ;
\ No newline at end of file
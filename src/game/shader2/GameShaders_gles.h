@@ -9,7 +9,7 @@
 #define SpShader_TestDepthPrepass 3
 #define SpShader_TestMesh 4
 #define SpShader_TestSkin 5
-#define SpShaderDataSize 269813
+#define SpShaderDataSize 270363
 
 #define SP_SAMPLE_SHADING 0
 #define SP_SHADOWGRID_USE_ARRAY 1
@@ -41,7 +41,6 @@ struct UBO_DebugEnvSpherePixel {
 struct UBO_DynamicTransform {
 	static const constexpr uint32_t UboIndex = 3;
 
-	sf::Mat44 modelToWorld;
 	sf::Mat44 worldToClip;
 };
 
@@ -137,5 +136,5 @@ extern const SpShaderInfo spShaders[6];
 extern const SpPermutationInfo spPermutations[43];
 extern const SpUniformBlockInfo spUniformBlock[11];
 extern const SpSamplerInfo spSamplers[14];
-extern const SpAttribInfo spAttribs[12];
-extern const char spShaderData[4691];
\ No newline at end of file
+extern const SpAttribInfo spAttribs[15];
+extern const char spShaderData[4725];
\ No newline at end of file
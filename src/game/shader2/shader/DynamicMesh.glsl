@@ -6,6 +6,11 @@ layout(location=1) attribute vec3 a_normal;
 layout(location=2) attribute vec4 a_tangent;
 layout(location=3) attribute vec2 a_uv;
 
+// Per-instance rows of `modelToWorld`
+layout(location=4) attribute vec4 a_worldRow0;
+layout(location=5) attribute vec4 a_worldRow1;
+layout(location=6) attribute vec4 a_worldRow2;
+
 #pragma permutation SP_SAMPLE_SHADING 2
 
 #if SP_SAMPLE_SHADING && defined(SP_HLSL)
@@ -24,15 +29,15 @@ PER_SAMPLE varying vec2 v_uv;
 
 uniform DynamicTransform
 {
-	mat4 modelToWorld;
 	mat4 worldToClip;
 };
 
 void main()
 {
-    vec3 p = mul(vec4(a_position, 1.0), modelToWorld).xyz;
-    vec3 n = mul(vec4(a_normal, 0.0), modelToWorld).xyz;
-    vec3 t = mul(vec4(a_tangent.xyz, 0.0), modelToWorld).xyz;
+	vec4 pos = vec4(a_position, 1.0);
+	vec3 p = vec3(dot(a_worldRow0, pos), dot(a_worldRow1, pos), dot(a_worldRow2, pos));
+	vec3 n = vec3(dot(a_worldRow0.xyz, a_normal), dot(a_worldRow1.xyz, a_normal), dot(a_worldRow2.xyz, a_normal));
+	vec3 t = vec3(dot(a_worldRow0.xyz, a_tangent.xyz), dot(a_worldRow1.xyz, a_tangent.xyz), dot(a_worldRow2.xyz, a_tangent.xyz));
 
 	v_position = p;
     gl_Position = mul(vec4(p, 1.0), worldToClip);
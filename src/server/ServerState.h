@@ -545,6 +545,8 @@ struct SoundComponent : ComponentBase<Component::Sound>
 	float pitchVariance = 0.0f;
 	bool loop = false;
 	sf::Vec3 offset;
+	float priority = 1.0f; //! Importance of the sound when there are more playing sounds than voices
+	uint32_t maxInstances = 0; //! Maximum number of audible instances of the same sound, zero for default
 };
 
 struct RoomConnectionComponent : ComponentBase<Component::RoomConnection>
@@ -1085,8 +1085,19 @@ template<> void initType<SoundComponent>(Type *t)
 		sf_field(SoundComponent, pitchVariance),
 		sf_field(SoundComponent, loop),
 		sf_field(SoundComponent, offset),
+		sf_field(SoundComponent, priority),
+		sf_field(SoundComponent, maxInstances),
 	};
 	sf_struct_base(t, SoundComponent, Component, fields);
+
+	{
+		ReflectionInfo &info = addTypeReflectionInfo(t, "priority");
+		info.description = "Importance of the sound when there are more playing sounds than voices";
+	}
+	{
+		ReflectionInfo &info = addTypeReflectionInfo(t, "maxInstances");
+		info.description = "Maximum number of audible instances of the same sound, zero for default";
+	}
 }
 
 template<> void initType<RoomConnectionComponent>(Type *t)
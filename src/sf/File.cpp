@@ -12,6 +12,11 @@
 	#include <sys/stat.h>
 	#include <dirent.h>
 	#include <stdio.h>
+	#if !SF_OS_WASM
+		#include <sys/mman.h>
+		#include <fcntl.h>
+		#include <unistd.h>
+	#endif
 #endif
 
 namespace sf {
@@ -333,6 +338,180 @@ bool containsDirectory(sf::String path, sf::String dir, uint32_t maxDepth)
 
 #if SF_OS_WINDOWS
 
+struct MappedFile::Data
+{
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = NULL;
+
+	~Data()
+	{
+		if (mapping) CloseHandle(mapping);
+		if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+	}
+};
+
+bool MappedFile::open(sf::String name)
+{
+	close();
+
+	sf::SmallArray<wchar_t, 256> nameBuf;
+	if (!win32Utf8To16(nameBuf, name)) return false;
+
+	Data *d = new Data();
+	d->file = CreateFileW(nameBuf.data, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (d->file == INVALID_HANDLE_VALUE) {
+		delete d;
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(d->file, &fileSize)) {
+		delete d;
+		return false;
+	}
+
+	if (fileSize.QuadPart > 0) {
+		d->mapping = CreateFileMappingW(d->file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (!d->mapping) {
+			delete d;
+			return false;
+		}
+
+		data = MapViewOfFile(d->mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!data) {
+			delete d;
+			return false;
+		}
+	} else {
+		data = "";
+	}
+
+	size = (size_t)fileSize.QuadPart;
+	imp = d;
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (!imp) return;
+	if (size > 0) UnmapViewOfFile(data);
+	delete imp;
+	imp = nullptr;
+	data = nullptr;
+	size = 0;
+}
+
+#elif SF_OS_WASM
+
+struct MappedFile::Data
+{
+	sf::Array<char> buffer;
+};
+
+bool MappedFile::open(sf::String name)
+{
+	close();
+
+	Data *d = new Data();
+	if (!readFile(d->buffer, name)) {
+		delete d;
+		return false;
+	}
+
+	data = d->buffer.size > 0 ? d->buffer.data : "";
+	size = d->buffer.size;
+	imp = d;
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (!imp) return;
+	delete imp;
+	imp = nullptr;
+	data = nullptr;
+	size = 0;
+}
+
+#else
+
+struct MappedFile::Data
+{
+};
+
+bool MappedFile::open(sf::String name)
+{
+	close();
+
+	sf::SmallStringBuf<512> nameBuf(name);
+	int fd = ::open(nameBuf.data, O_RDONLY);
+	if (fd < 0) return false;
+
+	struct stat sb;
+	if (fstat(fd, &sb) != 0) {
+		::close(fd);
+		return false;
+	}
+
+	if (sb.st_size > 0) {
+		void *ptr = mmap(NULL, (size_t)sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (ptr == MAP_FAILED) {
+			::close(fd);
+			return false;
+		}
+		data = ptr;
+	} else {
+		data = "";
+	}
+
+	// The mapping keeps the file referenced
+	::close(fd);
+
+	size = (size_t)sb.st_size;
+	imp = new Data();
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (!imp) return;
+	if (size > 0) munmap((void*)data, size);
+	delete imp;
+	imp = nullptr;
+	data = nullptr;
+	size = 0;
+}
+
+#endif
+
+MappedFile::MappedFile() : data(nullptr), size(0), imp(nullptr) { }
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+MappedFile::MappedFile(MappedFile &&rhs) : data(rhs.data), size(rhs.size), imp(rhs.imp)
+{
+	rhs.data = nullptr;
+	rhs.size = 0;
+	rhs.imp = nullptr;
+}
+
+MappedFile &MappedFile::operator=(MappedFile&& rhs)
+{
+	if (&rhs == this) return *this;
+	close();
+	data = rhs.data;
+	size = rhs.size;
+	imp = rhs.imp;
+	rhs.data = nullptr;
+	rhs.size = 0;
+	rhs.imp = nullptr;
+	return *this;
+}
+
+#if SF_OS_WINDOWS
+
 struct DirectoryMonitor::Data
 {
 	OVERLAPPED overlapped = { };
@@ -40,6 +40,32 @@ void appendPath(sf::StringBuf &path, sf::String a, sf::String b, sf::String c, s
 
 bool containsDirectory(sf::String path, sf::String dir, uint32_t maxDepth=UINT32_MAX);
 
+// Read-only view of a whole file mapped into memory. `data` stays valid
+// until `close()`, on platforms without mapping support the file is read
+// into a heap buffer instead.
+struct MappedFile
+{
+	MappedFile();
+	~MappedFile();
+
+	MappedFile(MappedFile &&rhs);
+	MappedFile &operator=(MappedFile&& rhs);
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile &operator=(const MappedFile&) = delete;
+
+	bool open(sf::String name);
+	void close();
+
+	bool isOpen() const { return imp != nullptr; }
+
+	const void *data;
+	size_t size;
+
+	struct Data;
+	Data *imp;
+};
+
 struct DirectoryMonitor
 {
 	DirectoryMonitor();
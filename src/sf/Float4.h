@@ -65,6 +65,7 @@ struct Float4
 	sf_forceinline Float4 sqrt() const { return wasm_f32x4_sqrt(imp); }
 	sf_forceinline Float4 rsqrt() const { return Float4(1.0f) / wasm_f32x4_sqrt(imp); }
 	sf_forceinline Float4 abs() const { return wasm_f32x4_abs(imp); }
+	sf_forceinline Float4 flipSign(const Float4 &rhs) const { return wasm_v128_xor(imp, wasm_v128_and(rhs.imp, wasm_f32x4_splat(-0.0f))); }
 	sf_forceinline Float4 round() const {
 		float a = __builtin_rintf(wasm_f32x4_extract_lane(imp, 0));
 		float b = __builtin_rintf(wasm_f32x4_extract_lane(imp, 1));
@@ -86,6 +87,12 @@ struct Float4
 
 	sf_forceinline bool anyGreaterThanZero() const { return wasm_i32x4_any_true(wasm_f32x4_gt(imp, wasm_f32x4_const(0.0f,0.0f,0.0f,0.0f))); }
 	sf_forceinline bool allGreaterThanZero() const { return wasm_i32x4_all_true(wasm_f32x4_gt(imp, wasm_f32x4_const(0.0f,0.0f,0.0f,0.0f))); }
+	sf_forceinline uint32_t maskGreaterThanZero() const {
+		v128_t m = wasm_v128_and(wasm_f32x4_gt(imp, wasm_f32x4_const(0.0f,0.0f,0.0f,0.0f)), wasm_i32x4_const(1,2,4,8));
+		m = wasm_v128_or(m, wasm_v32x4_shuffle(m, m, 2,3,0,1));
+		m = wasm_v128_or(m, wasm_v32x4_shuffle(m, m, 1,0,3,2));
+		return (uint32_t)wasm_i32x4_extract_lane(m, 0);
+	}
 
 	sf_forceinline Vec3 asVec3() const {
 		float a = wasm_f32x4_extract_lane(imp, 0);
@@ -185,6 +192,7 @@ struct Float4
 		return e;
 	}
 	sf_forceinline Float4 abs() const { return _mm_andnot_ps(_mm_set1_ps(-0.0f), imp); }
+	sf_forceinline Float4 flipSign(const Float4 &rhs) const { return _mm_xor_ps(imp, _mm_and_ps(rhs.imp, _mm_set1_ps(-0.0f))); }
 	sf_forceinline Float4 round() const { return _mm_round_ps(imp, _MM_FROUND_TO_NEAREST_INT |_MM_FROUND_NO_EXC); }
 	sf_forceinline Float4 min(const Float4 &rhs) const { return _mm_min_ps(imp, rhs.imp); }
 	sf_forceinline Float4 max(const Float4 &rhs) const { return _mm_max_ps(imp, rhs.imp); }
@@ -201,6 +209,7 @@ struct Float4
 
 	sf_forceinline bool anyGreaterThanZero() const { return _mm_movemask_ps(_mm_cmpgt_ps(imp, _mm_setzero_ps())) != 0; }
 	sf_forceinline bool allGreaterThanZero() const { return _mm_movemask_ps(_mm_cmpgt_ps(imp, _mm_setzero_ps())) == 0xf; }
+	sf_forceinline uint32_t maskGreaterThanZero() const { return (uint32_t)_mm_movemask_ps(_mm_cmpgt_ps(imp, _mm_setzero_ps())); }
 
 	sf_forceinline Mask4 compareLess(const Float4 &rhs) const { return _mm_cmplt_ps(imp, rhs.imp); }
 	sf_forceinline Float4 selectOrZero(const Mask4 &rhs) const { return _mm_and_ps(imp, rhs.imp); }
@@ -315,6 +324,10 @@ struct Float4
 		return e2;
 	}
 	sf_forceinline Float4 abs() const { return vabsq_f32(imp); }
+	sf_forceinline Float4 flipSign(const Float4 &rhs) const {
+		uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(rhs.imp), vdupq_n_u32(0x80000000u));
+		return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(imp), sign));
+	}
 	sf_forceinline Float4 round() const { return vrndnq_f32(imp); }
 	sf_forceinline Float4 min(const Float4 &rhs) const { return vminq_f32(imp, rhs.imp); }
 	sf_forceinline Float4 max(const Float4 &rhs) const { return vmaxq_f32(imp, rhs.imp); }
@@ -330,6 +343,10 @@ struct Float4
 		uint64x2_t b = vreinterpretq_u64_u32(vcleq_f32(imp, vdupq_n_f32(0.0f)));
 		return (vgetq_lane_u64(b, 0) | vgetq_lane_u64(b, 1)) == 0;
 	}
+	sf_forceinline uint32_t maskGreaterThanZero() const {
+		static const uint32_t bits[4] = { 1, 2, 4, 8 };
+		return vaddvq_u32(vandq_u32(vcgtq_f32(imp, vdupq_n_f32(0.0f)), vld1q_u32(bits)));
+	}
 
 	sf_forceinline Vec3 asVec3() const {
 		float a = vgetq_lane_f32(imp, 0);
@@ -431,6 +448,8 @@ struct Float4
 		sf_forceinline Float4 round() const { return { roundf(a), roundf(b), roundf(c), roundf(d) }; }
 	#endif
 
+	sf_forceinline Float4 flipSign(const Float4 &rhs) const { return { rhs.a<0.0f?-a:a, rhs.b<0.0f?-b:b, rhs.c<0.0f?-c:c, rhs.d<0.0f?-d:d }; }
+
 	sf_forceinline Float4 min(const Float4 &rhs) const { return { a<rhs.a?a:rhs.a, b<rhs.b?b:rhs.b, c<rhs.c?c:rhs.c, d<rhs.d?d:rhs.d }; }
 	sf_forceinline Float4 max(const Float4 &rhs) const { return { a<rhs.a?rhs.a:a, b<rhs.b?rhs.b:b, c<rhs.c?rhs.c:c, d<rhs.d?rhs.d:d }; }
 
@@ -439,6 +458,7 @@ struct Float4
 
 	sf_forceinline bool anyGreaterThanZero() const { return a>0.0f || b>0.0f || c>0.0f || d>0.0f; }
 	sf_forceinline bool allGreaterThanZero() const { return a>0.0f && b>0.0f && c>0.0f && d>0.0f; }
+	sf_forceinline uint32_t maskGreaterThanZero() const { return (a>0.0f?1u:0u) | (b>0.0f?2u:0u) | (c>0.0f?4u:0u) | (d>0.0f?8u:0u); }
 
 	sf_forceinline Vec3 asVec3() const {
 		return sf::Vec3(a, b, c);
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "sf/Float4.h"
+
+// 8-lane companion to `Float4`. Uses AVX when the build targets it (see the
+// `--avx2` premake option) and falls back to a pair of `Float4` otherwise,
+// so kernels can be written once against `Float8` on every platform.
+
+#ifndef SF_FLOAT8_FORCE_FLOAT4
+#define SF_FLOAT8_FORCE_FLOAT4 0
+#endif
+
+#if SF_ARCH_X86 && defined(__AVX__) && !SF_FLOAT4_SCALAR && !SF_FLOAT8_FORCE_FLOAT4
+	#include <immintrin.h>
+	#define SF_FLOAT8_AVX 1
+#else
+	#define SF_FLOAT8_AVX 0
+#endif
+
+namespace sf {
+
+#if SF_FLOAT8_AVX
+
+struct Float8
+{
+	__m256 imp;
+
+	static sf_forceinline Float8 zero() { return _mm256_setzero_ps(); }
+	static sf_forceinline Float8 loadu(const float *ptr) { return _mm256_loadu_ps(ptr); }
+	sf_forceinline void storeu(float *ptr) const { _mm256_storeu_ps(ptr, imp); }
+
+	sf_forceinline Float8() { }
+	sf_forceinline Float8(float f) : imp(_mm256_set1_ps(f)) { }
+	sf_forceinline Float8(__m256 m) : imp(m) { }
+	sf_forceinline Float8(const Float4 &lo, const Float4 &hi) : imp(_mm256_insertf128_ps(_mm256_castps128_ps256(lo.imp), hi.imp, 1)) { }
+
+	sf_forceinline Float4 getLo() const { return _mm256_castps256_ps128(imp); }
+	sf_forceinline Float4 getHi() const { return _mm256_extractf128_ps(imp, 1); }
+
+	sf_forceinline Float8 operator+(const Float8 &rhs) const { return _mm256_add_ps(imp, rhs.imp); }
+	sf_forceinline Float8 operator-(const Float8 &rhs) const { return _mm256_sub_ps(imp, rhs.imp); }
+	sf_forceinline Float8 operator*(const Float8 &rhs) const { return _mm256_mul_ps(imp, rhs.imp); }
+	sf_forceinline Float8 operator/(const Float8 &rhs) const { return _mm256_div_ps(imp, rhs.imp); }
+	sf_forceinline Float8 &operator+=(const Float8 &rhs) { imp = _mm256_add_ps(imp, rhs.imp); return *this; }
+	sf_forceinline Float8 &operator-=(const Float8 &rhs) { imp = _mm256_sub_ps(imp, rhs.imp); return *this; }
+	sf_forceinline Float8 &operator*=(const Float8 &rhs) { imp = _mm256_mul_ps(imp, rhs.imp); return *this; }
+	sf_forceinline Float8 &operator/=(const Float8 &rhs) { imp = _mm256_div_ps(imp, rhs.imp); return *this; }
+
+	sf_forceinline Float8 sqrt() const { return _mm256_sqrt_ps(imp); }
+	sf_forceinline Float8 rsqrt() const {
+		// One Newton-Raphson step to match `Float4::rsqrt()`
+		const __m256 mm3 = _mm256_set1_ps(3.0f), mmRcp2 = _mm256_set1_ps(0.5f);
+		__m256 e = _mm256_rsqrt_ps(imp);
+		e = _mm256_mul_ps(_mm256_mul_ps(mmRcp2, e), _mm256_sub_ps(mm3, _mm256_mul_ps(_mm256_mul_ps(e, e), imp)));
+		return e;
+	}
+	sf_forceinline Float8 abs() const { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), imp); }
+	sf_forceinline Float8 round() const { return _mm256_round_ps(imp, _MM_FROUND_TO_NEAREST_INT |_MM_FROUND_NO_EXC); }
+	sf_forceinline Float8 min(const Float8 &rhs) const { return _mm256_min_ps(imp, rhs.imp); }
+	sf_forceinline Float8 max(const Float8 &rhs) const { return _mm256_max_ps(imp, rhs.imp); }
+	sf_forceinline Float8 flipSign(const Float8 &rhs) const { return _mm256_xor_ps(imp, _mm256_and_ps(rhs.imp, _mm256_set1_ps(-0.0f))); }
+
+	// Broadcast within each half, matching `Float4::broadcastX()` etc. for both
+	sf_forceinline Float8 broadcastX() const { return _mm256_permute_ps(imp, _MM_SHUFFLE(0,0,0,0)); }
+	sf_forceinline Float8 broadcastY() const { return _mm256_permute_ps(imp, _MM_SHUFFLE(1,1,1,1)); }
+	sf_forceinline Float8 broadcastZ() const { return _mm256_permute_ps(imp, _MM_SHUFFLE(2,2,2,2)); }
+
+	sf_forceinline bool anyGreaterThanZero() const { return _mm256_movemask_ps(_mm256_cmp_ps(imp, _mm256_setzero_ps(), _CMP_GT_OQ)) != 0; }
+	sf_forceinline bool allGreaterThanZero() const { return _mm256_movemask_ps(_mm256_cmp_ps(imp, _mm256_setzero_ps(), _CMP_GT_OQ)) == 0xff; }
+	sf_forceinline uint32_t maskGreaterThanZero() const { return (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(imp, _mm256_setzero_ps(), _CMP_GT_OQ)); }
+};
+
+#else
+
+struct Float8
+{
+	Float4 lo, hi;
+
+	static sf_forceinline Float8 zero() { return Float8(Float4::zero(), Float4::zero()); }
+	static sf_forceinline Float8 loadu(const float *ptr) { return Float8(Float4::loadu(ptr), Float4::loadu(ptr + 4)); }
+	sf_forceinline void storeu(float *ptr) const { lo.storeu(ptr); hi.storeu(ptr + 4); }
+
+	sf_forceinline Float8() { }
+	sf_forceinline Float8(float f) : lo(f), hi(f) { }
+	sf_forceinline Float8(const Float4 &lo, const Float4 &hi) : lo(lo), hi(hi) { }
+
+	sf_forceinline Float4 getLo() const { return lo; }
+	sf_forceinline Float4 getHi() const { return hi; }
+
+	sf_forceinline Float8 operator+(const Float8 &rhs) const { return Float8(lo + rhs.lo, hi + rhs.hi); }
+	sf_forceinline Float8 operator-(const Float8 &rhs) const { return Float8(lo - rhs.lo, hi - rhs.hi); }
+	sf_forceinline Float8 operator*(const Float8 &rhs) const { return Float8(lo * rhs.lo, hi * rhs.hi); }
+	sf_forceinline Float8 operator/(const Float8 &rhs) const { return Float8(lo / rhs.lo, hi / rhs.hi); }
+	sf_forceinline Float8 &operator+=(const Float8 &rhs) { lo += rhs.lo; hi += rhs.hi; return *this; }
+	sf_forceinline Float8 &operator-=(const Float8 &rhs) { lo -= rhs.lo; hi -= rhs.hi; return *this; }
+	sf_forceinline Float8 &operator*=(const Float8 &rhs) { lo *= rhs.lo; hi *= rhs.hi; return *this; }
+	sf_forceinline Float8 &operator/=(const Float8 &rhs) { lo /= rhs.lo; hi /= rhs.hi; return *this; }
+
+	sf_forceinline Float8 sqrt() const { return Float8(lo.sqrt(), hi.sqrt()); }
+	sf_forceinline Float8 rsqrt() const { return Float8(lo.rsqrt(), hi.rsqrt()); }
+	sf_forceinline Float8 abs() const { return Float8(lo.abs(), hi.abs()); }
+	sf_forceinline Float8 round() const { return Float8(lo.round(), hi.round()); }
+	sf_forceinline Float8 min(const Float8 &rhs) const { return Float8(lo.min(rhs.lo), hi.min(rhs.hi)); }
+	sf_forceinline Float8 max(const Float8 &rhs) const { return Float8(lo.max(rhs.lo), hi.max(rhs.hi)); }
+	sf_forceinline Float8 flipSign(const Float8 &rhs) const { return Float8(lo.flipSign(rhs.lo), hi.flipSign(rhs.hi)); }
+
+	sf_forceinline Float8 broadcastX() const { return Float8(lo.broadcastX(), hi.broadcastX()); }
+	sf_forceinline Float8 broadcastY() const { return Float8(lo.broadcastY(), hi.broadcastY()); }
+	sf_forceinline Float8 broadcastZ() const { return Float8(lo.broadcastZ(), hi.broadcastZ()); }
+
+	sf_forceinline bool anyGreaterThanZero() const { return lo.anyGreaterThanZero() || hi.anyGreaterThanZero(); }
+	sf_forceinline bool allGreaterThanZero() const { return lo.allGreaterThanZero() && hi.allGreaterThanZero(); }
+	sf_forceinline uint32_t maskGreaterThanZero() const { return lo.maskGreaterThanZero() | hi.maskGreaterThanZero() << 4; }
+};
+
+#endif
+
+// Per-half `sf::broadcastRcpLengthXYZ()`, for two XYZ vectors packed in the halves
+sf_inline Float8 broadcastRcpLengthXYZ(const Float8 rhs) {
+#if SF_FLOAT8_AVX
+	Float8 sq = rhs * rhs;
+	return (sq.broadcastX() + sq.broadcastY() + sq.broadcastZ()).rsqrt();
+#else
+	return Float8(broadcastRcpLengthXYZ(rhs.lo), broadcastRcpLengthXYZ(rhs.hi));
+#endif
+}
+
+}
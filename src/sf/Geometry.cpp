@@ -148,10 +148,10 @@ float intersectRayFast(const FastRay &ray, const Sphere &sphere, float tMin, flo
 	float b = 2.0f * sf::dot(delta, ray.direction);
 	float c = sf::dot(delta, delta) - sphere.radius*sphere.radius;
 	float radicand = b*b - 4.0f*a*c;
-	if (radicand <= 0.0f) return false;
+	if (radicand <= 0.0f) return tMax;
 	float root = sf::sqrt(radicand);
 	float denom = 0.5f / a;
-	if ((-b + root) * denom < tMin) return false;
+	if ((-b + root) * denom < tMin) return tMax;
 	float t = (-b - root) * denom;
 	if (t >= tMax) return tMax;
 	return sf::max(tMin, t);
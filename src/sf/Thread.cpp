@@ -16,6 +16,7 @@
 		#include <emscripten/threading.h>
     #else
         #include <time.h>
+        #include <unistd.h>
 	#endif
 
 #endif
@@ -123,6 +124,13 @@ void Thread::sleepMs(uint32_t ms)
     Sleep(ms);
 }
 
+uint32_t Thread::getNumCores()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (uint32_t)info.dwNumberOfProcessors : 1;
+}
+
 #elif SF_USE_PTHREADS
 
 void setDebugThreadName(sf::String name)
@@ -188,6 +196,16 @@ void Thread::sleepMs(uint32_t ms)
 #endif
 }
 
+uint32_t Thread::getNumCores()
+{
+#if SF_OS_EMSCRIPTEN
+    int num = emscripten_num_logical_cores();
+#else
+    long num = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return num > 0 ? (uint32_t)num : 1;
+}
+
 #else
 
 void setDebugThreadName(sf::String name)
@@ -207,6 +225,11 @@ void Thread::sleepMs(uint32_t ms)
 {
 }
 
+uint32_t Thread::getNumCores()
+{
+    return 1;
+}
+
 #endif
 
 }
@@ -20,6 +20,9 @@ struct Thread
 	static void join(Thread *thread);
 
 	static void sleepMs(uint32_t ms);
+
+	// Number of logical processors, 1 if threads are not supported
+	static uint32_t getNumCores();
 };
 
 void setDebugThreadName(sf::String name);
@@ -4,6 +4,7 @@
 #include "ext/acl/decompression/output_writer.h"
 
 #include "sf/Array.h"
+#include "sf/Float8.h"
 #include "ContentFile.h"
 #include "ext/sp_tools_common.h"
 
@@ -14,12 +15,16 @@ struct AnimationImp : Animation
 	using ContextType = acl::uniformly_sampled::DecompressionContext<acl::uniformly_sampled::DefaultDecompressionSettings>;
 
 	sf::Array<char> data;
-	ContextType decompressionContext;
 
 	virtual void assetStartLoading() final;
 	virtual void assetUnload() final;
 };
 
+struct AnimationContextImp
+{
+	AnimationImp::ContextType context;
+};
+
 AssetType Animation::SelfType = { "Animation", sizeof(AnimationImp), sizeof(Animation::PropType),
 	[](Asset *a) { new ((AnimationImp*)a) AnimationImp(); }
 };
@@ -59,7 +64,7 @@ static void loadImp(void *user, const ContentFile &file)
 		bone.name = toSymbol(strings, sp_bone.name);
 	}
 
-	imp->decompressionContext.initialize(*(acl::CompressedClip*)imp->data.data);
+	imp->assetSetMemoryUsage(imp->data.size, 0);
 
 	spfile_util_free(&su.file);
 	imp->assetFinishLoading();
@@ -76,7 +81,6 @@ void AnimationImp::assetStartLoading()
 void AnimationImp::assetUnload()
 {
 	sf::reset(data);
-	sf::reset(decompressionContext);
 }
 
 struct AclOutputWriter final : public acl::OutputWriter
@@ -84,6 +88,11 @@ struct AclOutputWriter final : public acl::OutputWriter
 	sf::Slice<const uint32_t> boneMapping;
 	sf::Slice<BoneTransform> transforms;
 
+	// Unmapped bones are skipped without decompressing them
+	bool skip_bone_rotation(uint16_t bone_index) const { return boneMapping[bone_index] == ~0u; }
+	bool skip_bone_translation(uint16_t bone_index) const { return boneMapping[bone_index] == ~0u; }
+	bool skip_bone_scale(uint16_t bone_index) const { return boneMapping[bone_index] == ~0u; }
+
 	void RTM_SIMD_CALL write_bone_rotation(uint16_t bone_index, rtm::quatf_arg0 rotation)
 	{
 		uint32_t ix = boneMapping[bone_index];
@@ -115,6 +124,10 @@ struct AclOutputAlphaWriter final : public acl::OutputWriter
 	sf::Slice<BoneTransform> transforms;
 	float alpha;
 
+	bool skip_bone_rotation(uint16_t bone_index) const { return boneMapping[bone_index] == ~0u; }
+	bool skip_bone_translation(uint16_t bone_index) const { return boneMapping[bone_index] == ~0u; }
+	bool skip_bone_scale(uint16_t bone_index) const { return boneMapping[bone_index] == ~0u; }
+
 	void RTM_SIMD_CALL write_bone_rotation(uint16_t bone_index, rtm::quatf_arg0 rotation)
 	{
 		uint32_t ix = boneMapping[bone_index];
@@ -159,27 +172,37 @@ void Animation::generateBoneMapping(Model *model, sf::Slice<uint32_t> dst)
 	}
 }
 
-void Animation::evaluate(float time, sf::Slice<const uint32_t> boneMapping, sf::Slice<BoneTransform> transforms)
+// Bind the context to the clip of `imp`, cheap if it's already bound
+static AnimationImp::ContextType &bindContext(AnimationContext &ctx, AnimationImp *imp)
 {
-	AnimationImp *imp = (AnimationImp*)this;
-	imp->decompressionContext.seek(time, acl::sample_rounding_policy::none);
+	if (!ctx.imp) ctx.imp = sf::box<AnimationContextImp>();
+	AnimationImp::ContextType &context = ctx.imp->context;
+	const acl::CompressedClip &clip = *(const acl::CompressedClip*)imp->data.data;
+	if (context.is_dirty(clip)) context.initialize(clip);
+	return context;
+}
+
+void Animation::evaluate(AnimationContext &ctx, float time, sf::Slice<const uint32_t> boneMapping, sf::Slice<BoneTransform> transforms)
+{
+	AnimationImp::ContextType &context = bindContext(ctx, (AnimationImp*)this);
+	context.seek(time, acl::sample_rounding_policy::none);
 
 	AclOutputWriter writer;
 	writer.boneMapping = boneMapping;
 	writer.transforms = transforms;
-	imp->decompressionContext.decompress_pose(writer);
+	context.decompress_pose(writer);
 }
 
-void Animation::evaluate(float time, sf::Slice<const uint32_t> boneMapping, sf::Slice<BoneTransform> transforms, float alpha)
+void Animation::evaluate(AnimationContext &ctx, float time, sf::Slice<const uint32_t> boneMapping, sf::Slice<BoneTransform> transforms, float alpha)
 {
-	AnimationImp *imp = (AnimationImp*)this;
-	imp->decompressionContext.seek(time, acl::sample_rounding_policy::none);
+	AnimationImp::ContextType &context = bindContext(ctx, (AnimationImp*)this);
+	context.seek(time, acl::sample_rounding_policy::none);
 
 	AclOutputAlphaWriter writer;
 	writer.boneMapping = boneMapping;
 	writer.transforms = transforms;
 	writer.alpha = alpha;
-	imp->decompressionContext.decompress_pose(writer);
+	context.decompress_pose(writer);
 }
 
 sf::Mat34 boneTransformToMatrix(const BoneTransform &t)
@@ -187,6 +210,214 @@ sf::Mat34 boneTransformToMatrix(const BoneTransform &t)
 	return sf::mat::world(t.translation, t.rotation, t.scale);
 }
 
+// The batched kernels below process eight bones at a time in SoA form using
+// `sf::Float8`, so the quaternion math doesn't need any horizontal operations.
+// Bones 0-3 of a batch live in the low half and 4-7 in the high half, so the
+// AoS <-> SoA conversions are two regular `Float4::transpose4()`s.
+
+static sf_forceinline void loadBones4(sf::Float4 *t, sf::Float4 *r, sf::Float4 *s, const BoneTransform *src)
+{
+	for (uint32_t i = 0; i < 4; i++) {
+		t[i] = sf::Float4::loadu(src[i].translation.v);
+		r[i] = sf::Float4::loadu(src[i].rotation.v);
+		s[i] = sf::Float4::loadu(src[i].scale.v);
+	}
+	sf::Float4::transpose4(t[0], t[1], t[2], t[3]);
+	sf::Float4::transpose4(r[0], r[1], r[2], r[3]);
+	sf::Float4::transpose4(s[0], s[1], s[2], s[3]);
+}
+
+static sf_forceinline void loadBones8(sf::Float8 *t, sf::Float8 *r, sf::Float8 *s, const BoneTransform *src)
+{
+	sf::Float4 tLo[4], rLo[4], sLo[4];
+	sf::Float4 tHi[4], rHi[4], sHi[4];
+	loadBones4(tLo, rLo, sLo, src);
+	loadBones4(tHi, rHi, sHi, src + 4);
+	for (uint32_t i = 0; i < 4; i++) {
+		t[i] = sf::Float8(tLo[i], tHi[i]);
+		r[i] = sf::Float8(rLo[i], rHi[i]);
+		s[i] = sf::Float8(sLo[i], sHi[i]);
+	}
+}
+
+static sf_forceinline void loadRotations8(sf::Float8 *r, const BoneTransform *src)
+{
+	sf::Float4 lo[4], hi[4];
+	for (uint32_t i = 0; i < 4; i++) {
+		lo[i] = sf::Float4::loadu(src[i].rotation.v);
+		hi[i] = sf::Float4::loadu(src[i + 4].rotation.v);
+	}
+	sf::Float4::transpose4(lo[0], lo[1], lo[2], lo[3]);
+	sf::Float4::transpose4(hi[0], hi[1], hi[2], hi[3]);
+	for (uint32_t i = 0; i < 4; i++) {
+		r[i] = sf::Float8(lo[i], hi[i]);
+	}
+}
+
+static sf_forceinline void storeRotations8(BoneTransform *dst, const sf::Float8 *r)
+{
+	sf::Float4 lo[4], hi[4];
+	for (uint32_t i = 0; i < 4; i++) {
+		lo[i] = r[i].getLo();
+		hi[i] = r[i].getHi();
+	}
+	sf::Float4::transpose4(lo[0], lo[1], lo[2], lo[3]);
+	sf::Float4::transpose4(hi[0], hi[1], hi[2], hi[3]);
+	for (uint32_t i = 0; i < 4; i++) {
+		lo[i].storeu(dst[i].rotation.v);
+		hi[i].storeu(dst[i + 4].rotation.v);
+	}
+}
+
+static void blendBone(BoneTransform &d, const BoneTransform &s, float alpha)
+{
+	rtm::vector4f dstT = rtm::vector_load(d.translation.v);
+	rtm::vector4f srcT = rtm::vector_load(s.translation.v);
+	rtm::vector_store(rtm::vector_lerp(dstT, srcT, alpha), d.translation.v);
+
+	rtm::vector4f dstS = rtm::vector_load(d.scale.v);
+	rtm::vector4f srcS = rtm::vector_load(s.scale.v);
+	rtm::vector_store(rtm::vector_lerp(dstS, srcS, alpha), d.scale.v);
+
+	rtm::quatf dstR = rtm::quat_load(d.rotation.v);
+	rtm::quatf srcR = rtm::quat_load(s.rotation.v);
+	rtm::quat_store(rtm::quat_lerp(dstR, srcR, alpha), d.rotation.v);
+}
+
+static void blendBones4(BoneTransform *dst, const BoneTransform *src, const sf::Float4 &alpha)
+{
+	for (uint32_t i = 0; i < 4; i++) {
+		sf::Float4 dt = sf::Float4::loadu(dst[i].translation.v);
+		sf::Float4 st = sf::Float4::loadu(src[i].translation.v);
+		(dt + (st - dt) * alpha).storeu(dst[i].translation.v);
+
+		sf::Float4 ds = sf::Float4::loadu(dst[i].scale.v);
+		sf::Float4 ss = sf::Float4::loadu(src[i].scale.v);
+		(ds + (ss - ds) * alpha).storeu(dst[i].scale.v);
+	}
+
+	sf::Float4 dx = sf::Float4::loadu(dst[0].rotation.v);
+	sf::Float4 dy = sf::Float4::loadu(dst[1].rotation.v);
+	sf::Float4 dz = sf::Float4::loadu(dst[2].rotation.v);
+	sf::Float4 dw = sf::Float4::loadu(dst[3].rotation.v);
+	sf::Float4 sx = sf::Float4::loadu(src[0].rotation.v);
+	sf::Float4 sy = sf::Float4::loadu(src[1].rotation.v);
+	sf::Float4 sz = sf::Float4::loadu(src[2].rotation.v);
+	sf::Float4 sw = sf::Float4::loadu(src[3].rotation.v);
+	sf::Float4::transpose4(dx, dy, dz, dw);
+	sf::Float4::transpose4(sx, sy, sz, sw);
+
+	// Normalized lerp towards the closer hemisphere, matches `rtm::quat_lerp()`
+	sf::Float4 dot = dx*sx + dy*sy + dz*sz + dw*sw;
+	sf::Float4 rx = dx + (sx.flipSign(dot) - dx) * alpha;
+	sf::Float4 ry = dy + (sy.flipSign(dot) - dy) * alpha;
+	sf::Float4 rz = dz + (sz.flipSign(dot) - dz) * alpha;
+	sf::Float4 rw = dw + (sw.flipSign(dot) - dw) * alpha;
+	sf::Float4 rcpLen = (rx*rx + ry*ry + rz*rz + rw*rw).rsqrt();
+	rx *= rcpLen;
+	ry *= rcpLen;
+	rz *= rcpLen;
+	rw *= rcpLen;
+
+	sf::Float4::transpose4(rx, ry, rz, rw);
+	rx.storeu(dst[0].rotation.v);
+	ry.storeu(dst[1].rotation.v);
+	rz.storeu(dst[2].rotation.v);
+	rw.storeu(dst[3].rotation.v);
+}
+
+// Eight bone version of `blendBones4()`
+static void blendBones8(BoneTransform *dst, const BoneTransform *src, const sf::Float8 &alpha)
+{
+	// Translation and scale don't need to be transposed, lerp two bones at a time
+	for (uint32_t i = 0; i < 8; i += 2) {
+		sf::Float8 dt = sf::Float8(sf::Float4::loadu(dst[i].translation.v), sf::Float4::loadu(dst[i + 1].translation.v));
+		sf::Float8 st = sf::Float8(sf::Float4::loadu(src[i].translation.v), sf::Float4::loadu(src[i + 1].translation.v));
+		sf::Float8 rt = dt + (st - dt) * alpha;
+		rt.getLo().storeu(dst[i].translation.v);
+		rt.getHi().storeu(dst[i + 1].translation.v);
+
+		sf::Float8 ds = sf::Float8(sf::Float4::loadu(dst[i].scale.v), sf::Float4::loadu(dst[i + 1].scale.v));
+		sf::Float8 ss = sf::Float8(sf::Float4::loadu(src[i].scale.v), sf::Float4::loadu(src[i + 1].scale.v));
+		sf::Float8 rs = ds + (ss - ds) * alpha;
+		rs.getLo().storeu(dst[i].scale.v);
+		rs.getHi().storeu(dst[i + 1].scale.v);
+	}
+
+	sf::Float8 d[4], s[4], r[4];
+	loadRotations8(d, dst);
+	loadRotations8(s, src);
+
+	sf::Float8 dot = d[0]*s[0] + d[1]*s[1] + d[2]*s[2] + d[3]*s[3];
+	for (uint32_t i = 0; i < 4; i++) {
+		r[i] = d[i] + (s[i].flipSign(dot) - d[i]) * alpha;
+	}
+	sf::Float8 rcpLen = (r[0]*r[0] + r[1]*r[1] + r[2]*r[2] + r[3]*r[3]).rsqrt();
+	for (uint32_t i = 0; i < 4; i++) {
+		r[i] *= rcpLen;
+	}
+
+	storeRotations8(dst, r);
+}
+
+// Local bone matrices are stored as three `Float4`s containing the `Mat34`
+// elements in memory order, see `sf::mat::world()` for the scalar version.
+static void bonesToLocalMatrix8(sf::Float4 *dst, const BoneTransform *src)
+{
+	sf::Float8 t[4], q[4], s[4];
+	loadBones8(t, q, s, src);
+
+	sf::Float8 xx = q[0]*q[0], xy = q[0]*q[1], xz = q[0]*q[2], xw = q[0]*q[3];
+	sf::Float8 yy = q[1]*q[1], yz = q[1]*q[2], yw = q[1]*q[3];
+	sf::Float8 zz = q[2]*q[2], zw = q[2]*q[3];
+	sf::Float8 two = 2.0f, half = 0.5f;
+	sf::Float8 sx = s[0] * two, sy = s[1] * two, sz = s[2] * two;
+
+	// Grouped so that each `transpose4()` below yields four consecutive elements
+	sf::Float8 m[12] = {
+		sx * (half - yy - zz), sx * (xy + zw), sx * (xz - yw), sy * (xy - zw),
+		sy * (half - xx - zz), sy * (xw + yz), sz * (xz + yw), sz * (yz - xw),
+		sz * (half - xx - yy), t[0], t[1], t[2],
+	};
+
+	for (uint32_t half = 0; half < 2; half++) {
+		sf::Float4 c[12];
+		for (uint32_t i = 0; i < 12; i++) {
+			c[i] = half ? m[i].getHi() : m[i].getLo();
+		}
+		sf::Float4::transpose4(c[0], c[1], c[2], c[3]);
+		sf::Float4::transpose4(c[4], c[5], c[6], c[7]);
+		sf::Float4::transpose4(c[8], c[9], c[10], c[11]);
+
+		sf::Float4 *d = dst + half * 12;
+		for (uint32_t i = 0; i < 4; i++) {
+			d[i * 3 + 0] = c[i];
+			d[i * 3 + 1] = c[4 + i];
+			d[i * 3 + 2] = c[8 + i];
+		}
+	}
+}
+
+// `dst = parent * local` with `parent` as four columns (W ignored)
+static sf_forceinline void concatBoneMatrix(sf::Float4 *dst, const sf::Float4 *parent, const sf::Float4 *local)
+{
+	sf::Float4 p0 = parent[0], p1 = parent[1], p2 = parent[2], p3 = parent[3];
+	sf::Float4 l0 = local[0], l1 = local[1], l2 = local[2];
+	dst[0] = p0 * l0.broadcastX() + p1 * l0.broadcastY() + p2 * l0.broadcastZ();
+	dst[1] = p0 * l0.broadcastW() + p1 * l1.broadcastX() + p2 * l1.broadcastY();
+	dst[2] = p0 * l1.broadcastZ() + p1 * l1.broadcastW() + p2 * l2.broadcastX();
+	dst[3] = p0 * l2.broadcastY() + p1 * l2.broadcastZ() + p2 * l2.broadcastW() + p3;
+}
+
+static sf_forceinline void storeBoneMatrix(sf::Mat34 &dst, const sf::Float4 *cols)
+{
+	// Overlapping stores, the last column can't be written as a full `Float4`
+	cols[0].storeu(dst.v + 0);
+	cols[1].storeu(dst.v + 3);
+	cols[2].storeu(dst.v + 6);
+	dst.cols[3] = cols[3].asVec3();
+}
+
 void blendBoneTransform(sf::Slice<BoneTransform> dst, sf::Slice<const BoneTransform> src, float alpha)
 {
 	sf_assert(dst.size == src.size);
@@ -196,35 +427,67 @@ void blendBoneTransform(sf::Slice<BoneTransform> dst, sf::Slice<const BoneTransf
 		return;
 	}
 
-	for (uint32_t i = 0; i < dst.size; i++) {
-		BoneTransform &d = dst[i];
-		const BoneTransform &s = src[i];
-
-		rtm::vector4f dstT = rtm::vector_load(d.translation.v);
-		rtm::vector4f srcT = rtm::vector_load(s.translation.v);
-		rtm::vector_store(rtm::vector_lerp(dstT, srcT, alpha), d.translation.v);
+	sf::Float8 alpha8 = alpha;
+	uint32_t numBones = dst.size;
+	uint32_t numFull8 = numBones & ~7u, numFull4 = numBones & ~3u;
+	for (uint32_t i = 0; i < numFull8; i += 8) {
+		blendBones8(dst.data + i, src.data + i, alpha8);
+	}
 
-		rtm::vector4f dstS = rtm::vector_load(d.scale.v);
-		rtm::vector4f srcS = rtm::vector_load(s.scale.v);
-		rtm::vector_store(rtm::vector_lerp(dstS, srcS, alpha), d.scale.v);
+	if (numFull8 < numFull4) {
+		blendBones4(dst.data + numFull8, src.data + numFull8, sf::Float4(alpha));
+	}
 
-		rtm::quatf dstR = rtm::quat_load(d.rotation.v);
-		rtm::quatf srcR = rtm::quat_load(s.rotation.v);
-		rtm::quat_store(rtm::quat_lerp(dstR, srcR, alpha), d.rotation.v);
+	for (uint32_t i = numFull4; i < numBones; i++) {
+		blendBone(dst[i], src[i], alpha);
 	}
 }
 
-void boneTransformToWorld(Model *model, sf::Slice<sf::Mat34> dst, sf::Slice<const BoneTransform> src, const sf::Mat34 &toWorld)
+void boneTransformToWorld(sf::Slice<const Bone> bones, sf::Slice<sf::Mat34> dst, sf::Slice<const BoneTransform> src, const sf::Mat34 &toWorld)
 {
-	if (!model) return;
-	uint32_t numBones = model->bones.size;
+	uint32_t numBones = bones.size;
 	if (numBones == 0) return;
 
-	dst[0] = toWorld * boneTransformToMatrix(src[0]);
+	uint32_t numFull = numBones & ~7u;
+	uint32_t numBatched = (numBones + 7) & ~7u;
+
+	sf::SmallArray<sf::Float4, MaxBones * 3> local;
+	sf::SmallArray<sf::Float4, MaxBones * 4> world;
+	local.resizeUninit(numBatched * 3);
+	world.resizeUninit(numBones * 4);
+
+	for (uint32_t i = 0; i < numFull; i += 8) {
+		bonesToLocalMatrix8(local.data + i * 3, src.data + i);
+	}
+	if (numFull < numBones) {
+		// Unused lanes are identity transforms with zeroed padding so the
+		// kernel never reads indeterminate (possibly NaN/denormal) values
+		BoneTransform tail[8] = { };
+		memcpy(tail, src.data + numFull, (numBones - numFull) * sizeof(BoneTransform));
+		bonesToLocalMatrix8(local.data + numFull * 3, tail);
+	}
+
+	sf::Float4 rootParent[4];
+	for (uint32_t i = 0; i < 3; i++) {
+		rootParent[i] = sf::Float4::loadu(toWorld.cols[i].v);
+	}
+	rootParent[3] = sf::Float4(toWorld.m03, toWorld.m13, toWorld.m23, 0.0f);
+
+	concatBoneMatrix(world.data, rootParent, local.data);
+	storeBoneMatrix(dst[0], world.data);
 	for (uint32_t boneI = 1; boneI < numBones; boneI++) {
-		uint32_t parentI = model->bones[boneI].parentIx;
-		dst[boneI] = dst[parentI] * boneTransformToMatrix(src[boneI]);
+		uint32_t parentI = bones[boneI].parentIx;
+		sf_assert(parentI < boneI);
+		sf::Float4 *cols = world.data + boneI * 4;
+		concatBoneMatrix(cols, world.data + parentI * 4, local.data + boneI * 3);
+		storeBoneMatrix(dst[boneI], cols);
 	}
 }
 
+void boneTransformToWorld(Model *model, sf::Slice<sf::Mat34> dst, sf::Slice<const BoneTransform> src, const sf::Mat34 &toWorld)
+{
+	if (!model) return;
+	boneTransformToWorld(model->bones, dst, src, toWorld);
+}
+
 }
@@ -5,6 +5,7 @@
 #include "Model.h"
 
 #include "sf/Array.h"
+#include "sf/Box.h"
 
 namespace sp {
 
@@ -14,6 +15,15 @@ struct AnimationBone
 	sf::Symbol name;
 };
 
+struct AnimationContextImp;
+
+// Decompression state used by `Animation::evaluate()`. Animations can be
+// evaluated concurrently as long as each thread uses its own context.
+struct AnimationContext
+{
+	sf::Box<AnimationContextImp> imp;
+};
+
 struct Animation : Asset
 {
 	static AssetType SelfType;
@@ -23,13 +33,14 @@ struct Animation : Asset
 	float duration = 0.0f;
 
 	void generateBoneMapping(Model *model, sf::Slice<uint32_t> dst);
-	void evaluate(float time, sf::Slice<const uint32_t> boneMapping, sf::Slice<BoneTransform> transforms);
-	void evaluate(float time, sf::Slice<const uint32_t> boneMapping, sf::Slice<BoneTransform> transforms, float alpha);
+	void evaluate(AnimationContext &ctx, float time, sf::Slice<const uint32_t> boneMapping, sf::Slice<BoneTransform> transforms);
+	void evaluate(AnimationContext &ctx, float time, sf::Slice<const uint32_t> boneMapping, sf::Slice<BoneTransform> transforms, float alpha);
 };
 
 using AnimationRef = Ref<Animation>;
 
 void blendBoneTransform(sf::Slice<BoneTransform> dst, sf::Slice<const BoneTransform> src, float alpha);
+void boneTransformToWorld(sf::Slice<const Bone> bones, sf::Slice<sf::Mat34> dst, sf::Slice<const BoneTransform> src, const sf::Mat34 &toWorld);
 void boneTransformToWorld(Model *model, sf::Slice<sf::Mat34> dst, sf::Slice<const BoneTransform> src, const sf::Mat34 &toWorld);
 
 }
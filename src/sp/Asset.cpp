@@ -5,12 +5,20 @@
 #include "sf/Array.h"
 #include "sf/Mutex.h"
 #include "sf/HashSet.h"
+#include "sf/Sort.h"
 
 namespace sp {
 
 // How many frames to wait before actually deleting assets
 const uint32_t FreeQueueFrames = 16;
 
+// Default value for `Asset::setMemoryBudget()`
+const size_t DefaultMemoryBudget = 256 * 1024 * 1024;
+
+// Not all asset types report their memory usage so limit
+// the number of cached assets regardless of the budget
+const uint32_t MaxCachedAssets = 1024;
+
 // #define sp_asset_log(...) sf::debugPrintLine(__VA_ARGS__)
 #define sp_asset_log(...) (void)0
 
@@ -50,9 +58,14 @@ uint32_t hash(const AssetKey &key) {
 struct AssetTypeImp
 {
 	bool inList;
+	AssetType *type;
 
 	// Mapping from name+props to assets
 	sf::HashMap<AssetKey, Asset*> assetMap;
+
+	// Sum of reported memory of the assets
+	size_t cpuBytes;
+	size_t gpuBytes;
 };
 
 static_assert(sizeof(AssetType::impData) >= sizeof(AssetTypeImp), "impData too small");
@@ -69,6 +82,14 @@ struct AssetContext
 	// Number of assets loading at the moment
 	uint32_t numAssetsLoading = 0;
 
+	// Memory accounting, see `Asset::assetSetMemoryUsage()`
+	size_t memoryBudget = DefaultMemoryBudget;
+	size_t cpuBytes = 0;
+	size_t gpuBytes = 0;
+
+	// Indices to `assetsToFree` that are unreferenced but kept loaded
+	sf::Array<uint32_t> cachedIndices;
+
 	void reloadByName(const sf::HashSet<sf::Symbol> &names)
 	{
 		sf::MutexGuard mg(mutex);
@@ -108,6 +129,7 @@ struct AssetContext
 
 		if (!typeImp->inList) {
 			typeImp->inList = true;
+			typeImp->type = type;
 			types.push(typeImp);
 		}
 
@@ -160,6 +182,64 @@ struct AssetContext
 		assetsToFree.push(asset);
 	}
 
+	// Called with `mutex` locked
+	void setMemoryUsage(Asset *asset, size_t newCpuBytes, size_t newGpuBytes)
+	{
+		AssetTypeImp *typeImp = (AssetTypeImp*)asset->type->impData;
+		typeImp->cpuBytes = typeImp->cpuBytes - asset->impCpuBytes + newCpuBytes;
+		typeImp->gpuBytes = typeImp->gpuBytes - asset->impGpuBytes + newGpuBytes;
+		cpuBytes = cpuBytes - asset->impCpuBytes + newCpuBytes;
+		gpuBytes = gpuBytes - asset->impGpuBytes + newGpuBytes;
+		asset->impCpuBytes = newCpuBytes;
+		asset->impGpuBytes = newGpuBytes;
+	}
+
+	// Unload and delete an unreferenced asset, called with `mutex` locked.
+	// Returns `false` if the asset can't be deleted right now.
+	bool deleteAsset(Asset *asset)
+	{
+		// Wait for the asset to finish loading
+		LoadState state = (LoadState)mxa_load32_nf(&asset->impState);
+		if (state == LoadState::Loading) {
+			return false;
+		}
+
+		// Unload the asset if necessary
+		if (state == LoadState::Loaded) {
+			if (mxa_cas32_nf(&asset->impState, (uint32_t)LoadState::Loaded, (uint32_t)LoadState::Unloaded)) {
+				sp_asset_log("Unload: %s %s", asset->type->name, asset->name.data);
+				mutex.unlock();
+				asset->assetUnload();
+				mutex.lock();
+			} else {
+				return false;
+			}
+		}
+
+		sp_asset_log("Delete: %s %s", asset->type->name, asset->name.data);
+
+		setMemoryUsage(asset, 0, 0);
+
+		// Remove the asset from the map
+		AssetTypeImp *typeImp = (AssetTypeImp*)asset->type->impData;
+		AssetKey key = { asset->name, asset->props };
+		typeImp->assetMap.remove(key);
+
+		// Call the virtual destructor and free memory
+		asset->props->~AssetProps();
+		asset->~Asset();
+		sf::memFree(asset);
+
+		return true;
+	}
+
+	bool isCached(const Asset *asset) const
+	{
+		if (frameIndex - asset->impFreeFrame < FreeQueueFrames) return false;
+		if (mxa_load32_nf(&asset->refcount) > 0) return false;
+		return (LoadState)mxa_load32_nf(&asset->impState) == LoadState::Loaded;
+	}
+
 	void update()
 	{
 		sf::MutexGuard mg(mutex);
@@ -180,38 +260,106 @@ struct AssetContext
 				continue;
 			}
 
-			// Wait for the asset to finish loading
+			// Keep loaded assets cached, evicted below if over the budget
 			LoadState state = (LoadState)mxa_load32_nf(&asset->impState);
-			if (state == LoadState::Loading) {
+			if (state == LoadState::Loaded) {
 				continue;
 			}
 
-			// Unload the asset if necessary
-			if (state == LoadState::Loaded) {
-				if (mxa_cas32_nf(&asset->impState, (uint32_t)LoadState::Loaded, (uint32_t)LoadState::Unloaded)) {
-					sp_asset_log("Unload: %s %s", asset->type->name, asset->name.data);
-					mutex.unlock();
-					asset->assetUnload();
-					mutex.lock();
-				} else {
-					continue;
-				}
+			// Remove from the free list
+			if (deleteAsset(asset)) {
+				assetsToFree.removeSwap(index--);
 			}
+		}
 
-			sp_asset_log("Delete: %s %s", asset->type->name, asset->name.data);
+		evictCachedAssets();
+	}
 
-			// Remove the asset from the map
-			AssetTypeImp *typeImp = (AssetTypeImp*)asset->type->impData;
-			AssetKey key = { asset->name, asset->props };
-			typeImp->assetMap.remove(key);
+	// Unload least recently released assets until we're within the budget.
+	// Called with `mutex` locked.
+	void evictCachedAssets()
+	{
+		cachedIndices.clear();
+		for (uint32_t index = 0; index < assetsToFree.size; index++) {
+			if (isCached(assetsToFree[index])) {
+				cachedIndices.push(index);
+			}
+		}
 
-			// Call the virtual destructor and free memory
-			asset->props->~AssetProps();
-			asset->~Asset();
-			sf::memFree(asset);
+		if (cpuBytes + gpuBytes <= memoryBudget && cachedIndices.size <= MaxCachedAssets) return;
 
-			// Remove from the free list
-			assetsToFree.removeSwap(index--);
+		sf::sort(cachedIndices, [&](uint32_t a, uint32_t b) {
+			return (int32_t)(assetsToFree[a]->impFreeFrame - assetsToFree[b]->impFreeFrame) < 0;
+		});
+
+		// NOTE: `deleteAsset()` may unlock the mutex but other threads
+		// only append to `assetsToFree` so the indices stay valid.
+		uint32_t numCached = cachedIndices.size;
+		for (uint32_t index : cachedIndices) {
+			if (cpuBytes + gpuBytes <= memoryBudget && numCached <= MaxCachedAssets) break;
+
+			Asset *asset = assetsToFree[index];
+			sp_asset_log("Evict: %s %s", asset->type->name, asset->name.data);
+			if (mxa_load32_nf(&asset->refcount) == 0 && deleteAsset(asset)) {
+				assetsToFree[index] = nullptr;
+				numCached--;
+			}
+		}
+
+		// Compact the free list
+		uint32_t dst = 0;
+		for (Asset *asset : assetsToFree) {
+			if (asset) assetsToFree[dst++] = asset;
+		}
+		assetsToFree.resizeUninit(dst);
+	}
+
+	void getMemoryStats(AssetMemoryStats &stats, uint32_t maxAssets)
+	{
+		sf::MutexGuard mg(mutex);
+
+		stats.budget = memoryBudget;
+		stats.cpuBytes = cpuBytes;
+		stats.gpuBytes = gpuBytes;
+		stats.cachedBytes = 0;
+		stats.types.clear();
+		stats.assets.clear();
+
+		for (AssetTypeImp *typeImp : types) {
+			AssetTypeMemory &typeMem = stats.types.push();
+			typeMem.name = typeImp->type->name;
+			typeMem.numAssets = typeImp->assetMap.size();
+			typeMem.numCached = 0;
+			typeMem.cpuBytes = typeImp->cpuBytes;
+			typeMem.gpuBytes = typeImp->gpuBytes;
+
+			for (auto &pair : typeImp->assetMap) {
+				Asset *asset = pair.val;
+				if (asset->impCpuBytes + asset->impGpuBytes == 0) continue;
+				AssetMemory &mem = stats.assets.push();
+				mem.type = typeImp->type;
+				mem.name = asset->name;
+				mem.cpuBytes = asset->impCpuBytes;
+				mem.gpuBytes = asset->impGpuBytes;
+				mem.refcount = mxa_load32_nf(&asset->refcount);
+			}
+		}
+
+		for (Asset *asset : assetsToFree) {
+			if (!isCached(asset)) continue;
+			stats.cachedBytes += asset->impCpuBytes + asset->impGpuBytes;
+			for (AssetTypeMemory &typeMem : stats.types) {
+				if (typeMem.name == asset->type->name) {
+					typeMem.numCached++;
+					break;
+				}
+			}
+		}
+
+		sf::sortByRev(stats.types, [](const AssetTypeMemory &m) { return m.cpuBytes + m.gpuBytes; });
+		sf::sortByRev(stats.assets, [](const AssetMemory &m) { return m.cpuBytes + m.gpuBytes; });
+		if (stats.assets.size > maxAssets) {
+			stats.assets.resize(maxAssets);
 		}
 	}
 };
@@ -243,6 +391,8 @@ Asset::Asset()
 	, refcount(1)
 	, impState((uint32_t)LoadState::Unloaded)
 	, impFlags(0)
+	, impCpuBytes(0)
+	, impGpuBytes(0)
 {
 }
 
@@ -322,11 +472,13 @@ static void resetAssetImp(Asset *asset)
 	asset->impFlags = copy->impFlags;
 }
 
+// Called with `g_assetContext.mutex` locked from `AssetContext::reloadByName()`
 void Asset::startReloading()
 {
 	// Transition from Loaded -> Loading
 	if (mxa_cas32_acq(&impState, (uint32_t)LoadState::Loaded, (uint32_t)LoadState::Loading)) {
 		assetUnload();
+		g_assetContext.setMemoryUsage(this, 0, 0);
 		resetAssetImp(this);
 		assetStartLoading();
 		return;
@@ -360,11 +512,28 @@ void Asset::assetFailLoading()
 	sp_asset_log("Fail load: %s %s", type->name, name.data);
 }
 
+void Asset::assetSetMemoryUsage(size_t cpuBytes, size_t gpuBytes)
+{
+	sf::MutexGuard mg(g_assetContext.mutex);
+	g_assetContext.setMemoryUsage(this, cpuBytes, gpuBytes);
+}
+
 uint32_t Asset::getNumAssetsLoading()
 {
 	return mxa_load32_acq(&g_assetContext.numAssetsLoading);
 }
 
+void Asset::setMemoryBudget(size_t bytes)
+{
+	sf::MutexGuard mg(g_assetContext.mutex);
+	g_assetContext.memoryBudget = bytes;
+}
+
+void Asset::getMemoryStats(AssetMemoryStats &stats, uint32_t maxAssets)
+{
+	g_assetContext.getMemoryStats(stats, maxAssets);
+}
+
 void Asset::globalInit()
 {
 }
@@ -3,6 +3,7 @@
 #include "sf/Base.h"
 #include "sf/String.h"
 #include "sf/Symbol.h"
+#include "sf/Array.h"
 
 namespace sp {
 
@@ -21,6 +22,34 @@ struct AssetType
 	alignas(void*) char impData[64];
 };
 
+struct AssetTypeMemory
+{
+	const char *name;   // < Name of the asset type
+	uint32_t numAssets; // < Number of live assets (including cached)
+	uint32_t numCached; // < Number of unreferenced assets kept loaded
+	size_t cpuBytes;    // < Reported CPU memory of all assets of this type
+	size_t gpuBytes;    // < Reported GPU memory of all assets of this type
+};
+
+struct AssetMemory
+{
+	const AssetType *type;
+	sf::Symbol name;
+	size_t cpuBytes;
+	size_t gpuBytes;
+	uint32_t refcount; // < Zero if the asset is only cached
+};
+
+struct AssetMemoryStats
+{
+	size_t budget;      // < See `Asset::setMemoryBudget()`
+	size_t cpuBytes;    // < Total reported CPU memory
+	size_t gpuBytes;    // < Total reported GPU memory
+	size_t cachedBytes; // < Memory used by unreferenced cached assets
+	sf::Array<AssetTypeMemory> types;
+	sf::Array<AssetMemory> assets; // < Biggest consumers first
+};
+
 // Base class for asset properties
 struct AssetProps
 {
@@ -71,7 +100,8 @@ struct Asset
 	// Request the asset to start loading
 	void startLoading();
 
-	// Request the asset to start reloading
+	// Request the asset to start reloading, only used internally by
+	// `reloadAssetsByName()` which holds the asset context lock
 	void startReloading();
 
 	// -- API for Asset implementations
@@ -86,6 +116,10 @@ struct Asset
 	void assetFinishLoading();
 	void assetFailLoading();
 
+	// Report the memory used by the loaded asset, counts towards the
+	// memory budget. Reset automatically when the asset is unloaded.
+	void assetSetMemoryUsage(size_t cpuBytes, size_t gpuBytes);
+
 	// -- Static API
 
 	static void reloadAssetsByName(sf::Slice<const sf::Symbol> names);
@@ -115,6 +149,13 @@ struct Asset
 
 	static uint32_t getNumAssetsLoading();
 
+	// Unreferenced assets are kept loaded as a cache until the total reported
+	// memory exceeds `bytes`, then the least recently used ones are unloaded.
+	static void setMemoryBudget(size_t bytes);
+
+	// Query per-type memory and up to `maxAssets` biggest individual assets
+	static void getMemoryStats(AssetMemoryStats &stats, uint32_t maxAssets);
+
 	// Lifecycle
 	static void globalInit();
 	static void globalCleanup();
@@ -124,6 +165,8 @@ struct Asset
 	uint32_t impState;     // < Atomic
 	uint32_t impFlags;     // < Protected by AssetLibrary::mutex
 	uint32_t impFreeFrame; // < Protected by AssetLibrary::mutex
+	size_t impCpuBytes;    // < Protected by AssetLibrary::mutex
+	size_t impGpuBytes;    // < Protected by AssetLibrary::mutex
 
 	static Asset *impFind(AssetType *type, const sf::Symbol &name, const AssetProps &props);
 	static Asset *impCreate(AssetType *type, const sf::Symbol &name, const AssetProps &props);
@@ -10,6 +10,15 @@ void AudioSampler::advanceMixStereo(float *dst, uint32_t numDst, AudioSource *so
 {
 	float samplesPerT = (float)opts.sampleRate * opts.volumeFadeDuration;
 
+	if (needsSeek) {
+		uint32_t sample = (uint32_t)srcSampleTime;
+		source->seek(sample);
+		srcAdvanceSample = sample;
+		carryFirstSample = sample;
+		carryNumSamples = 0;
+		needsSeek = false;
+	}
+
 	uint32_t numDone = 0;
 	while (numDone < numDst) {
 		if (volumeT >= 0.9999f) {
@@ -38,6 +47,32 @@ void AudioSampler::advanceMixStereo(float *dst, uint32_t numDst, AudioSource *so
 	}
 }
 
+void AudioSampler::advanceVirtual(uint32_t numDst, AudioSource *source, const AudioMixOpts &opts)
+{
+	sf_assert(source->lengthInSamples > 0);
+
+	double dstToSrc = (double)source->sampleRate * (double)opts.pitch / (double)opts.sampleRate;
+	srcSampleTime += dstToSrc * (double)numDst;
+
+	double length = (double)source->lengthInSamples;
+	if (srcSampleTime >= length) {
+		if (opts.loop) {
+			double numLoops = (double)(uint64_t)(srcSampleTime / length);
+			srcSampleTime -= numLoops * length;
+			loopCount += (uint32_t)numLoops;
+		} else {
+			ended = true;
+		}
+	}
+
+	// Fade in from silence once audible again
+	started = true;
+	volumeT = 1.0f;
+	volumeDst[0] = 0.0f;
+	volumeDst[1] = 0.0f;
+	needsSeek = true;
+}
+
 void AudioSampler::advanceMixStereoImp(float *dstBuf, uint32_t numDst, AudioSource *source, const AudioMixOpts &opts)
 {
 	sf_assert(numDst % 2 == 0);
@@ -63,6 +98,14 @@ void AudioSampler::advanceMixStereoImp(float *dstBuf, uint32_t numDst, AudioSour
 	float volumeStep = 1.0f / opts.volumeFadeDuration / (float)opts.sampleRate;
 	sf::Float4 vol = volA + volSpan * sf::Float4(volumeT, volumeT, volumeT + volumeStep, volumeT + volumeStep);
 	sf::Float4 dVolD2S = volSpan * (2.0f * volumeStep);
+	sf::Float4 dVolD4S = volSpan * (4.0f * volumeStep);
+
+	// Sources playing at the output rate without pitch shifting step exactly
+	// one source sample per frame: the interpolation fraction stays constant
+	// so four frames can be resampled from contiguous unaligned loads.
+	// Otherwise four frames are resampled at a time by gathering the source
+	// samples around each position and interpolating with per-frame fractions.
+	bool unitStep = dstToSrc == 1.0f;
 
 	float *dstPtr = dstBuf, *dstEnd = dstPtr + numDst * 2;
 	while (dstPtr != dstEnd) {
@@ -101,6 +144,55 @@ void AudioSampler::advanceMixStereoImp(float *dstBuf, uint32_t numDst, AudioSour
 			uint32_t numSafeSamples = sf::min(dstLeft, (uint32_t)((float)(workNumSamples - 2) * srcToDst - t - 2.0f)) >> 1;
 			srcSampleTime += dstToSrc * (float)(numSafeSamples * 2);
 
+			if (unitStep) {
+				uint32_t i = (uint32_t)t;
+				sf::Float4 delta = t - (float)i;
+				for (; numSafeSamples >= 2; numSafeSamples -= 2) {
+					sf::Float4 src0 = sf::Float4::loadu(workBuf + i);     // A0 A1 A2 A3
+					sf::Float4 src1 = sf::Float4::loadu(workBuf + i + 1); // B0 B1 B2 B3
+					sf::Float4 src = src0 + (src1 - src0) * delta;
+
+					sf::Float4 srcLo, srcHi;
+					sf::Float4::interleave2(srcLo, srcHi, src, src);
+
+					sf::Float4 dst0 = sf::Float4::loadu(dstPtr);
+					sf::Float4 dst1 = sf::Float4::loadu(dstPtr + 4);
+					dst0 += srcLo * vol;
+					dst1 += srcHi * (vol + dVolD2S);
+					dst0.storeu(dstPtr);
+					dst1.storeu(dstPtr + 4);
+
+					vol += dVolD4S;
+					dstPtr += 8;
+					i += 4;
+					t += 4.0f;
+				}
+			} else {
+				for (; numSafeSamples >= 2; numSafeSamples -= 2) {
+					float t0 = t, t1 = t0 + dstToSrc, t2 = t1 + dstToSrc, t3 = t2 + dstToSrc;
+					uint32_t i0 = (uint32_t)t0, i1 = (uint32_t)t1, i2 = (uint32_t)t2, i3 = (uint32_t)t3;
+					t = t3 + dstToSrc;
+
+					sf::Float4 src0(workBuf[i0], workBuf[i1], workBuf[i2], workBuf[i3]); // A0 A1 A2 A3
+					sf::Float4 src1(workBuf[i0 + 1], workBuf[i1 + 1], workBuf[i2 + 1], workBuf[i3 + 1]); // B0 B1 B2 B3
+					sf::Float4 delta = sf::Float4(t0, t1, t2, t3) - sf::Float4((float)i0, (float)i1, (float)i2, (float)i3);
+					sf::Float4 src = src0 + (src1 - src0) * delta;
+
+					sf::Float4 srcLo, srcHi;
+					sf::Float4::interleave2(srcLo, srcHi, src, src);
+
+					sf::Float4 dst0 = sf::Float4::loadu(dstPtr);
+					sf::Float4 dst1 = sf::Float4::loadu(dstPtr + 4);
+					dst0 += srcLo * vol;
+					dst1 += srcHi * (vol + dVolD2S);
+					dst0.storeu(dstPtr);
+					dst1.storeu(dstPtr + 4);
+
+					vol += dVolD4S;
+					dstPtr += 8;
+				}
+			}
+
 			while (numSafeSamples-- > 0) {
 				uint32_t i0, i1;
 				float d0, d1;
@@ -120,7 +212,6 @@ void AudioSampler::advanceMixStereoImp(float *dstBuf, uint32_t numDst, AudioSour
 				dst.storeu(dstPtr);
 
 				vol += dVolD2S;
-				dst.storeu(dstPtr);
 				dstPtr += 4;
 			}
 		} else {
@@ -128,6 +219,57 @@ void AudioSampler::advanceMixStereoImp(float *dstBuf, uint32_t numDst, AudioSour
 			uint32_t numSafeSamples = sf::min(dstLeft, (uint32_t)((float)(workNumSamples - 2) * srcToDst - t - 2.0f)) >> 1;
 			srcSampleTime += dstToSrc * (float)(numSafeSamples * 2);
 
+			if (unitStep) {
+				uint32_t i = (uint32_t)t;
+				sf::Float4 delta = t - (float)i;
+				for (; numSafeSamples >= 2; numSafeSamples -= 2) {
+					const float *src = workBuf + i*2;
+					sf::Float4 srcA0 = sf::Float4::loadu(src + 0); // LA0 RA0 LA1 RA1
+					sf::Float4 srcA1 = sf::Float4::loadu(src + 4); // LA2 RA2 LA3 RA3
+					sf::Float4 srcB0 = sf::Float4::loadu(src + 2); // LB0 RB0 LB1 RB1
+					sf::Float4 srcB1 = sf::Float4::loadu(src + 6); // LB2 RB2 LB3 RB3
+
+					sf::Float4 dst0 = sf::Float4::loadu(dstPtr);
+					sf::Float4 dst1 = sf::Float4::loadu(dstPtr + 4);
+					dst0 += (srcA0 + (srcB0 - srcA0) * delta) * vol;
+					dst1 += (srcA1 + (srcB1 - srcA1) * delta) * (vol + dVolD2S);
+					dst0.storeu(dstPtr);
+					dst1.storeu(dstPtr + 4);
+
+					vol += dVolD4S;
+					dstPtr += 8;
+					i += 4;
+					t += 4.0f;
+				}
+			} else {
+				for (; numSafeSamples >= 2; numSafeSamples -= 2) {
+					float t0 = t, t1 = t0 + dstToSrc, t2 = t1 + dstToSrc, t3 = t2 + dstToSrc;
+					uint32_t i0 = (uint32_t)t0, i1 = (uint32_t)t1, i2 = (uint32_t)t2, i3 = (uint32_t)t3;
+					t = t3 + dstToSrc;
+
+					sf::Float4 srcA0 = sf::Float4::loadu(workBuf + i0*2); // LA0 RA0 LA1 RA1 <-T- (LA0 RA0 LB0 RB0)
+					sf::Float4 srcB0 = sf::Float4::loadu(workBuf + i1*2); // LB0 RB0 LB1 RB1 <-T- (LA1 RA1 LB1 RB1)
+					sf::Float4 srcA1 = sf::Float4::loadu(workBuf + i2*2); // LA2 RA2 LA3 RA3 <-T- (LA2 RA2 LB2 RB2)
+					sf::Float4 srcB1 = sf::Float4::loadu(workBuf + i3*2); // LB2 RB2 LB3 RB3 <-T- (LA3 RA3 LB3 RB3)
+					sf::Float4::transpose22(srcA0, srcB0);
+					sf::Float4::transpose22(srcA1, srcB1);
+
+					sf::Float4 delta = sf::Float4(t0, t1, t2, t3) - sf::Float4((float)i0, (float)i1, (float)i2, (float)i3);
+					sf::Float4 delta0, delta1;
+					sf::Float4::interleave2(delta0, delta1, delta, delta);
+
+					sf::Float4 dst0 = sf::Float4::loadu(dstPtr);
+					sf::Float4 dst1 = sf::Float4::loadu(dstPtr + 4);
+					dst0 += (srcA0 + (srcB0 - srcA0) * delta0) * vol;
+					dst1 += (srcA1 + (srcB1 - srcA1) * delta1) * (vol + dVolD2S);
+					dst0.storeu(dstPtr);
+					dst1.storeu(dstPtr + 4);
+
+					vol += dVolD4S;
+					dstPtr += 8;
+				}
+			}
+
 			while (numSafeSamples-- > 0) {
 				uint32_t i0, i1;
 				float d0, d1;
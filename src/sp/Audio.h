@@ -13,6 +13,9 @@ struct AudioSource
 	uint32_t sampleRate;
 	uint32_t numChannels;
 
+	// Total length if known, sources without one can't be played virtually
+	uint32_t lengthInSamples = 0;
+
 	virtual void seek(uint32_t sample) = 0;
 
 	// Allowed to read past `dst` by AdvancePaddingInFloats floats!
@@ -45,8 +48,14 @@ struct AudioSampler
 	float volumeSrc[2] = { };
 	float volumeDst[2] = { };
 
+	bool needsSeek = false;
+
 	void advanceMixStereo(float *dst, uint32_t numDst, AudioSource *source, const AudioMixOpts &opts);
 
+	// Advance the playback position without decoding or mixing anything, the next
+	// `advanceMixStereo()` seeks `source` and fades in. Requires `source->lengthInSamples`.
+	void advanceVirtual(uint32_t numDst, AudioSource *source, const AudioMixOpts &opts);
+
 	void advanceMixStereoImp(float *dst, uint32_t numDst, AudioSource *source, const AudioMixOpts &opts);
 };
 
@@ -27,6 +27,9 @@ static constexpr uint32_t BufferSize = 8 * 1024 * 1024;
 // From EmbeddedFiles.cpp
 ContentPackage *getEmbeddedContentPackage();
 
+// From ContentPack.cpp
+ContentPackage *createMappedContentPackage(const sf::String &path, const sf::String &prefix);
+
 struct PendingFile
 {
 	PendingFile() = default;
@@ -69,6 +72,25 @@ ContentPackage::~ContentPackage()
 {
 }
 
+ContentFileData::ContentFileData(const ContentFile &file)
+	: size(file.size)
+{
+	if (file.stableData || file.size == 0) {
+		data = file.data;
+	} else {
+		ownedData = sf::memAlloc(file.size);
+		memcpy(ownedData, file.data, file.size);
+		data = ownedData;
+	}
+}
+
+ContentFileData::~ContentFileData()
+{
+	if (ownedData) {
+		sf::memFree(ownedData);
+	}
+}
+
 static void fetchCallback(const sfetch_response_t *response)
 {
 	ContentLoadHandle handle = *(ContentLoadHandle*)response->user_data;
@@ -260,6 +282,16 @@ void ContentFile::addCacheDownloadRoot(sf::String name, ContentCacheResolveFunc
 	ctx.packagesToDelete.push(package);
 }
 
+void ContentFile::addPackFile(const sf::String &path, const sf::String &prefix)
+{
+	ContentFileContext &ctx = g_contentFileContext;
+	sf::MutexGuard mg(ctx.mutex);
+
+	ContentPackage *package = createMappedContentPackage(path, prefix);
+	ctx.packages.push(package);
+	ctx.packagesToDelete.push(package);
+}
+
 static ContentLoadHandle loadImp(const sf::String &name, ContentFile::Callback callback, void *user, bool mainThread)
 {
 	ContentFileContext &ctx = g_contentFileContext;
@@ -369,6 +401,25 @@ void ContentFile::packageFileLoaded(ContentLoadHandle handle, const void *data,
 	file.currentPackage = nullptr;
 }
 
+void ContentFile::packageFileLoadedOwned(ContentLoadHandle handle, void *data, size_t size)
+{
+	ContentFileContext &ctx = g_contentFileContext;
+	sf::MutexGuard mg(ctx.mutex);
+
+	auto pair = ctx.files.find(handle.id);
+	sf_assert(pair != nullptr);
+	PendingFile &file = pair->val;	
+
+	file.file.package = file.currentPackage;
+	file.file.stableData = false;
+	file.file.size = size;
+	file.file.data = data;
+
+	sp_file_log("%s: Loaded %s", file.currentPackage->name.data, file.name.data);
+
+	file.currentPackage = nullptr;
+}
+
 void ContentFile::packageFileFailed(ContentLoadHandle handle)
 {
 	ContentFileContext &ctx = g_contentFileContext;
@@ -53,11 +53,16 @@ struct ContentFile
 	static void addRelativeFileRoot(const sf::String &root, const sf::String &prefix=sf::String());
 	static void addCacheDownloadRoot(sf::String name, ContentCacheResolveFunc *resolveFunc, void *user);
 
+	// Add a packed archive (see ContentPack.h) that is memory mapped for the
+	// rest of the session, names under `prefix` are looked up from it
+	static void addPackFile(const sf::String &path, const sf::String &prefix=sf::String());
+
 	// Add a custom package type
 	static void addContentPackage(ContentPackage *package);
 
 	// Package functions
 	static void packageFileLoaded(ContentLoadHandle handle, const void *data, size_t size, bool stableData=false);
+	static void packageFileLoadedOwned(ContentLoadHandle handle, void *data, size_t size); // < `data` allocated with `sf::memAlloc()`
 	static void packageFileFailed(ContentLoadHandle handle);
 
 	// Load a resource from `name`.
@@ -84,4 +89,19 @@ struct ContentFile
 	static void globalUpdate();
 };
 
+// Keeps the contents of a file alive after the load callback returns,
+// the data is copied only if `ContentFile::stableData` is not set.
+struct ContentFileData
+{
+	const void *data = nullptr;
+	size_t size = 0;
+	void *ownedData = nullptr;
+
+	ContentFileData() { }
+	explicit ContentFileData(const ContentFile &file);
+	ContentFileData(const ContentFileData &) = delete;
+	ContentFileData &operator=(const ContentFileData &) = delete;
+	~ContentFileData();
+};
+
 }
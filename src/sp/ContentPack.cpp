@@ -0,0 +1,234 @@
+#include "ContentPack.h"
+
+#include "ContentFile.h"
+
+#include "sf/File.h"
+#include "sf/Sort.h"
+
+#include "ext/sp_tools_common.h"
+
+namespace sp {
+
+// Only compress if it saves at least 1/8 of the size
+static bool shouldStoreCompressed(size_t uncompressedSize, size_t compressedSize)
+{
+	return compressedSize + (uncompressedSize >> 3) < uncompressedSize;
+}
+
+static bool writePadding(FILE *f, uint64_t &offset, uint32_t alignment)
+{
+	static const char zeros[ContentPackBlobAlignment] = { };
+	uint64_t padding = sf::alignUp(offset, (uint64_t)alignment) - offset;
+	sf_assert(padding <= sizeof(zeros));
+	if (padding > 0 && fwrite(zeros, 1, (size_t)padding, f) != padding) return false;
+	offset += padding;
+	return true;
+}
+
+bool writeContentPack(const sf::String &path, sf::Slice<const ContentPackSource> sources, int level)
+{
+	sf::Array<uint32_t> order;
+	order.resizeUninit(sources.size);
+	for (uint32_t i = 0; i < sources.size; i++) {
+		order[i] = i;
+	}
+	sf::sort(order, [&](uint32_t a, uint32_t b) {
+		return sf::String(sources[a].name) < sf::String(sources[b].name);
+	});
+
+	sf::StringBuf tempPath;
+	tempPath.append(path, ".tmp");
+
+	FILE *f = sf::stdioFileOpen(tempPath, "wb");
+	if (!f) return false;
+
+	ContentPackHeader header = { };
+	header.magic = ContentPackMagic;
+	header.version = ContentPackVersion;
+	header.numEntries = (uint32_t)sources.size;
+
+	bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+	uint64_t offset = sizeof(header);
+
+	sf::Array<ContentPackEntry> entries;
+	sf::Array<char> names;
+	sf::Array<char> data, compressed;
+	entries.reserve(sources.size);
+
+	for (uint32_t index : order) {
+		if (!ok) break;
+		const ContentPackSource &source = sources[index];
+
+		if (!sf::readFile(data, source.path)) {
+			sf::debugPrintLine("Failed to read %s", source.path.data);
+			ok = false;
+			break;
+		}
+
+		ContentPackEntry &entry = entries.push();
+		entry.nameOffset = names.size;
+		entry.nameLength = source.name.size;
+		entry.uncompressedSize = data.size;
+		entry.compressionType = SP_COMPRESSION_NONE;
+		names.push(source.name.data, source.name.size);
+
+		const void *blob = data.data;
+		size_t blobSize = data.size;
+
+		if (data.size > 0) {
+			size_t bound = sp_get_compression_bound(SP_COMPRESSION_ZSTD, data.size);
+			compressed.resizeUninit(bound);
+			size_t size = sp_compress_buffer(SP_COMPRESSION_ZSTD, compressed.data, bound, data.data, data.size, level);
+			if (size > 0 && size <= bound && shouldStoreCompressed(data.size, size)) {
+				entry.compressionType = SP_COMPRESSION_ZSTD;
+				blob = compressed.data;
+				blobSize = size;
+			}
+		}
+
+		ok = ok && writePadding(f, offset, ContentPackBlobAlignment);
+		entry.dataOffset = offset;
+		entry.compressedSize = (uint32_t)blobSize;
+		ok = ok && fwrite(blob, 1, blobSize, f) == blobSize;
+		offset += blobSize;
+	}
+
+	ok = ok && writePadding(f, offset, 8);
+	header.entriesOffset = offset;
+	ok = ok && fwrite(entries.data, sizeof(ContentPackEntry), entries.size, f) == entries.size;
+	offset += entries.size * sizeof(ContentPackEntry);
+
+	header.namesOffset = offset;
+	header.namesSize = names.size;
+	ok = ok && fwrite(names.data, 1, names.size, f) == names.size;
+
+	ok = ok && fseek(f, 0, SEEK_SET) == 0;
+	ok = ok && fwrite(&header, sizeof(header), 1, f) == 1;
+
+	int err = ferror(f);
+	int ret = fclose(f);
+	if (!ok || err != 0 || ret != 0) {
+		sf::deleteFile(tempPath);
+		return false;
+	}
+
+	return sf::replaceFile(path, tempPath);
+}
+
+struct MappedContentPackage : ContentPackage
+{
+	sf::StringBuf prefix;
+	sf::MappedFile file;
+	const ContentPackEntry *entries = nullptr;
+	const char *names = nullptr;
+	uint32_t numEntries = 0;
+
+	MappedContentPackage(const sf::String &path, const sf::String &prefix_)
+		: prefix(prefix_)
+	{
+		name.append("Pack(", path, ")");
+
+		if (!file.open(path)) {
+			sf::debugPrintLine("%s: Failed to open", name.data);
+			return;
+		}
+
+		if (!validate()) {
+			sf::debugPrintLine("%s: Invalid archive", name.data);
+			file.close();
+			return;
+		}
+
+		const char *base = (const char*)file.data;
+		const ContentPackHeader *header = (const ContentPackHeader*)base;
+		entries = (const ContentPackEntry*)(base + header->entriesOffset);
+		names = base + header->namesOffset;
+		numEntries = header->numEntries;
+	}
+
+	bool validate() const
+	{
+		if (file.size < sizeof(ContentPackHeader)) return false;
+		const ContentPackHeader *header = (const ContentPackHeader*)file.data;
+		if (header->magic != ContentPackMagic) return false;
+		if (header->version != ContentPackVersion) return false;
+		if (header->entriesOffset % 8 != 0) return false;
+		if (header->entriesOffset > file.size) return false;
+		if ((file.size - header->entriesOffset) / sizeof(ContentPackEntry) < header->numEntries) return false;
+		if (header->namesOffset > file.size) return false;
+		if (file.size - header->namesOffset < header->namesSize) return false;
+
+		const ContentPackEntry *entries = (const ContentPackEntry*)((const char*)file.data + header->entriesOffset);
+		for (uint32_t i = 0; i < header->numEntries; i++) {
+			const ContentPackEntry &entry = entries[i];
+			if (entry.nameOffset > header->namesSize) return false;
+			if (header->namesSize - entry.nameOffset < entry.nameLength) return false;
+			if (entry.dataOffset > file.size) return false;
+			if (file.size - entry.dataOffset < entry.compressedSize) return false;
+			if (entry.compressionType == SP_COMPRESSION_NONE) {
+				if (entry.compressedSize != entry.uncompressedSize) return false;
+			} else if (entry.compressionType != SP_COMPRESSION_ZSTD) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	const ContentPackEntry *findEntry(sf::String name) const
+	{
+		uint32_t lo = 0, hi = numEntries;
+		while (lo < hi) {
+			uint32_t mid = lo + (hi - lo) / 2;
+			const ContentPackEntry &entry = entries[mid];
+			sf::String entryName(names + entry.nameOffset, entry.nameLength);
+			if (entryName < name) {
+				lo = mid + 1;
+			} else if (name < entryName) {
+				hi = mid;
+			} else {
+				return &entry;
+			}
+		}
+		return nullptr;
+	}
+
+	virtual bool shouldTryToLoad(const sf::CString &name) final
+	{
+		if (!sf::beginsWith(name, prefix)) return false;
+		return findEntry(name.slice().drop(prefix.size)) != nullptr;
+	}
+
+	virtual bool startLoadingFile(ContentLoadHandle handle, const sf::CString &name) final
+	{
+		const ContentPackEntry *entry = findEntry(name.slice().drop(prefix.size));
+		sf_assert(entry != nullptr);
+
+		const char *blob = (const char*)file.data + entry->dataOffset;
+
+		if (entry->compressionType == SP_COMPRESSION_NONE) {
+			// Zero-copy: the mapping stays alive until the package is deleted
+			ContentFile::packageFileLoaded(handle, blob, entry->uncompressedSize, true);
+			return true;
+		}
+
+		void *data = sf::memAlloc(entry->uncompressedSize);
+		size_t size = sp_decompress_buffer((sp_compression_type)entry->compressionType,
+			data, entry->uncompressedSize, blob, entry->compressedSize);
+		if (size != entry->uncompressedSize) {
+			sf::memFree(data);
+			ContentFile::packageFileFailed(handle);
+			return true;
+		}
+
+		ContentFile::packageFileLoadedOwned(handle, data, size);
+		return true;
+	}
+};
+
+ContentPackage *createMappedContentPackage(const sf::String &path, const sf::String &prefix)
+{
+	return new MappedContentPackage(path, prefix);
+}
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "sf/String.h"
+#include "sf/Array.h"
+
+namespace sp {
+
+// Packed content archive (.sppak) built from the processed `Build/` files.
+//
+// Layout:
+//   ContentPackHeader
+//   blobs, each aligned to `ContentPackBlobAlignment`
+//   ContentPackEntry[numEntries] sorted by name
+//   char[namesSize] (names are not null-terminated)
+//
+// Uncompressed blobs can be used directly from a memory mapping.
+
+static constexpr uint32_t ContentPackMagic = 0x6b617073; // 'spak'
+static constexpr uint32_t ContentPackVersion = 1;
+static constexpr uint32_t ContentPackBlobAlignment = 64;
+
+struct ContentPackHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t numEntries;
+	uint32_t namesSize;
+	uint64_t entriesOffset;
+	uint64_t namesOffset;
+};
+
+struct ContentPackEntry
+{
+	uint32_t nameOffset;
+	uint32_t nameLength;
+	uint64_t dataOffset;
+	uint32_t compressedSize;   // < Size of the blob in the archive
+	uint32_t uncompressedSize; // < Size of the file contents
+	uint32_t compressionType;  // < `sp_compression_type`
+	uint32_t padding;
+};
+
+struct ContentPackSource
+{
+	sf::StringBuf name; // < Name inside the archive, '/' separated
+	sf::StringBuf path; // < File to read the contents from
+};
+
+// Write an archive containing `sources` to `path`, blobs are compressed
+// with zstd at `level` if it makes them meaningfully smaller.
+bool writeContentPack(const sf::String &path, sf::Slice<const ContentPackSource> sources, int level);
+
+}
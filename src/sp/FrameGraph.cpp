@@ -0,0 +1,291 @@
+#include "FrameGraph.h"
+
+namespace sp {
+
+static uint32_t getPixelFormatSize(sg_pixel_format format)
+{
+	switch (format) {
+	case SG_PIXELFORMAT_R8: case SG_PIXELFORMAT_R8SN: case SG_PIXELFORMAT_R8UI: case SG_PIXELFORMAT_R8SI:
+		return 1;
+	case SG_PIXELFORMAT_R16: case SG_PIXELFORMAT_R16SN: case SG_PIXELFORMAT_R16UI: case SG_PIXELFORMAT_R16SI: case SG_PIXELFORMAT_R16F:
+	case SG_PIXELFORMAT_RG8: case SG_PIXELFORMAT_RG8SN: case SG_PIXELFORMAT_RG8UI: case SG_PIXELFORMAT_RG8SI:
+		return 2;
+	case SG_PIXELFORMAT_RG16F: case SG_PIXELFORMAT_RG16: case SG_PIXELFORMAT_R32F:
+	case SG_PIXELFORMAT_RGBA8: case SG_PIXELFORMAT_BGRA8: case SG_PIXELFORMAT_BQQ_SRGBA8:
+	case SG_PIXELFORMAT_RGB10A2: case SG_PIXELFORMAT_RG11B10F:
+	case SG_PIXELFORMAT_DEPTH: case SG_PIXELFORMAT_DEPTH_STENCIL:
+		return 4;
+	case SG_PIXELFORMAT_RG32F: case SG_PIXELFORMAT_RGBA16: case SG_PIXELFORMAT_RGBA16F:
+		return 8;
+	case SG_PIXELFORMAT_RGBA32F:
+		return 16;
+	default:
+		return 4;
+	}
+}
+
+static uint64_t getTargetSize(const FrameTargetDesc &desc)
+{
+	return (uint64_t)desc.resolution.x * (uint64_t)desc.resolution.y * getPixelFormatSize(desc.format) * sf::max(desc.msaaSamples, 1u);
+}
+
+void FrameGraph::reset()
+{
+	sf_assert(!inPass);
+	targets.clear();
+	passes.clear();
+	compiled = false;
+}
+
+uint32_t FrameGraph::createTarget(const char *name, const FrameTargetDesc &desc)
+{
+	sf_assert(!compiled);
+	uint32_t index = targets.size;
+	FrameGraphTarget &target = targets.push();
+	target.name = sf::Symbol(name);
+	target.desc = desc;
+	return index;
+}
+
+uint32_t FrameGraph::importTarget(const RenderTarget &renderTarget)
+{
+	sf_assert(!compiled);
+	uint32_t index = targets.size;
+	FrameGraphTarget &target = targets.push();
+	target.desc.resolution = renderTarget.resolution;
+	target.desc.format = renderTarget.format;
+	target.desc.msaaSamples = renderTarget.msaaSamples;
+	target.imported = &renderTarget;
+	return index;
+}
+
+void FrameGraph::markOutput(uint32_t target)
+{
+	sf_assert(!compiled);
+	targets[target].output = true;
+}
+
+uint32_t FrameGraph::addPass(const char *name, const sg_pass_action *action)
+{
+	sf_assert(!compiled);
+	uint32_t index = passes.size;
+	FrameGraphPass &pass = passes.push();
+	pass.name = sf::Symbol(name);
+	if (action) {
+		pass.action = *action;
+		pass.hasAction = true;
+	}
+	return index;
+}
+
+void FrameGraph::read(uint32_t pass, uint32_t target)
+{
+	sf_assert(!compiled);
+	sf_assert(target < targets.size);
+	passes[pass].reads.push(target);
+}
+
+void FrameGraph::write(uint32_t pass, uint32_t target)
+{
+	sf_assert(!compiled);
+	sf_assert(target < targets.size);
+	passes[pass].writes.push(target);
+}
+
+static void touchTarget(FrameGraphTarget &target, uint32_t passIndex)
+{
+	if (target.firstPass == FrameInvalid) target.firstPass = passIndex;
+	target.lastPass = passIndex;
+}
+
+void FrameGraph::compile()
+{
+	sf_assert(!compiled);
+	compiled = true;
+
+	stats = FrameGraphStats();
+	stats.numPasses = passes.size;
+
+	// Release pooled resources that have been unused for a while
+	for (uint32_t i = 0; i < images.size; i++) {
+		if (images[i].unusedFrames > MaxUnusedFrames) {
+			images.removeSwap(i--);
+		} else {
+			images[i].usedThisFrame = false;
+		}
+	}
+	for (uint32_t i = 0; i < renderPasses.size; i++) {
+		if (renderPasses[i].unusedFrames > MaxUnusedFrames) {
+			renderPasses.removeSwap(i--);
+		} else {
+			renderPasses[i].usedThisFrame = false;
+		}
+	}
+
+	// Cull passes in reverse: a pass is needed if it writes to an output,
+	// an imported target, or a target read by a later needed pass.
+	for (FrameGraphTarget &target : targets) {
+		target.needed = target.output || target.imported;
+	}
+	for (uint32_t passIx = passes.size; passIx-- > 0; ) {
+		FrameGraphPass &pass = passes[passIx];
+		pass.active = false;
+		for (uint32_t target : pass.writes) {
+			if (targets[target].needed) {
+				pass.active = true;
+				break;
+			}
+		}
+		if (!pass.active) {
+			stats.numCulledPasses++;
+			continue;
+		}
+		for (uint32_t target : pass.reads) {
+			targets[target].needed = true;
+		}
+	}
+
+	// Resolve lifetimes, outputs must survive the whole frame
+	for (uint32_t passIx = 0; passIx < passes.size; passIx++) {
+		FrameGraphPass &pass = passes[passIx];
+		if (!pass.active) continue;
+		for (uint32_t target : pass.reads) touchTarget(targets[target], passIx);
+		for (uint32_t target : pass.writes) touchTarget(targets[target], passIx);
+	}
+	for (FrameGraphTarget &target : targets) {
+		if (target.firstPass == FrameInvalid) continue;
+		if (target.output || target.imported) target.lastPass = passes.size;
+	}
+
+	// Assign images to transient targets in order of first use, reusing
+	// an image as soon as its previous target is no longer referenced.
+	for (uint32_t passIx = 0; passIx < passes.size; passIx++) {
+		FrameGraphPass &pass = passes[passIx];
+		if (!pass.active) continue;
+
+		for (int rw = 0; rw < 2; rw++) {
+			for (uint32_t targetIx : rw ? pass.writes : pass.reads) {
+				FrameGraphTarget &target = targets[targetIx];
+				if (target.imported || target.firstPass != passIx || target.imageIndex != FrameInvalid) continue;
+
+				uint32_t imageIx = FrameInvalid;
+				for (uint32_t i = 0; i < images.size; i++) {
+					FrameGraphImage &image = images[i];
+					if (image.desc != target.desc) continue;
+					if (image.usedThisFrame && image.busyUntilPass >= passIx) continue;
+					imageIx = i;
+					break;
+				}
+
+				if (imageIx == FrameInvalid) {
+					imageIx = images.size;
+					FrameGraphImage &image = images.push();
+					image.desc = target.desc;
+					image.target.init(target.name.data, target.desc.resolution, target.desc.format, target.desc.msaaSamples);
+				}
+
+				FrameGraphImage &image = images[imageIx];
+				if (!image.usedThisFrame) {
+					image.usedThisFrame = true;
+					stats.numImages++;
+					stats.imageBytes += getTargetSize(image.desc);
+				}
+				image.busyUntilPass = target.lastPass;
+				target.imageIndex = imageIx;
+
+				stats.numTransientTargets++;
+				stats.transientBytes += getTargetSize(target.desc);
+			}
+		}
+	}
+
+	// Find or create the `sg_pass` for each active pass
+	for (FrameGraphPass &pass : passes) {
+		if (!pass.active) continue;
+
+		sf::SmallArray<const RenderTarget*, 4> attachments;
+		sf::SmallArray<uint32_t, 4> imageIds;
+		for (uint32_t targetIx : pass.writes) {
+			FrameGraphTarget &target = targets[targetIx];
+			const RenderTarget *renderTarget = target.imported ? target.imported : &images[target.imageIndex].target;
+			attachments.push(renderTarget);
+			imageIds.push(renderTarget->image.id);
+		}
+
+		uint32_t renderPassIx = FrameInvalid;
+		for (uint32_t i = 0; i < renderPasses.size; i++) {
+			FrameGraphRenderPass &rp = renderPasses[i];
+			if (rp.name != pass.name || rp.imageIds.size != imageIds.size) continue;
+			if (memcmp(rp.imageIds.data, imageIds.data, imageIds.size * sizeof(uint32_t)) != 0) continue;
+			renderPassIx = i;
+			break;
+		}
+
+		if (renderPassIx == FrameInvalid) {
+			renderPassIx = renderPasses.size;
+			FrameGraphRenderPass &rp = renderPasses.push();
+			rp.name = pass.name;
+			rp.imageIds.push(imageIds);
+			rp.pass.init(pass.name.data, attachments);
+		}
+
+		renderPasses[renderPassIx].usedThisFrame = true;
+		pass.renderPassIndex = renderPassIx;
+	}
+
+	for (FrameGraphImage &image : images) {
+		image.unusedFrames = image.usedThisFrame ? 0 : image.unusedFrames + 1;
+	}
+	for (FrameGraphRenderPass &rp : renderPasses) {
+		rp.unusedFrames = rp.usedThisFrame ? 0 : rp.unusedFrames + 1;
+	}
+}
+
+bool FrameGraph::beginPass(uint32_t pass)
+{
+	sf_assert(compiled);
+	sf_assert(!inPass);
+	FrameGraphPass &p = passes[pass];
+	if (!p.active) return false;
+
+	inPass = true;
+	sp::beginPass(renderPasses[p.renderPassIndex].pass, p.hasAction ? &p.action : nullptr);
+	return true;
+}
+
+void FrameGraph::endPass()
+{
+	sf_assert(inPass);
+	inPass = false;
+	sp::endPass();
+}
+
+bool FrameGraph::isPassActive(uint32_t pass) const
+{
+	sf_assert(compiled);
+	return passes[pass].active;
+}
+
+const FrameTargetDesc &FrameGraph::getDesc(uint32_t target) const
+{
+	return targets[target].desc;
+}
+
+sg_image FrameGraph::getImage(uint32_t target) const
+{
+	sf_assert(compiled);
+	const FrameGraphTarget &t = targets[target];
+	if (t.imported) return t.imported->image;
+	if (t.imageIndex == FrameInvalid) return { };
+	return images[t.imageIndex].target.image;
+}
+
+void FrameGraph::releaseAll()
+{
+	sf_assert(!inPass);
+	renderPasses.clear();
+	images.clear();
+	reset();
+}
+
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "sp/Renderer.h"
+#include "sf/Array.h"
+
+namespace sp {
+
+// Per-frame schedule of render passes and the targets they touch.
+// Passes and targets are declared every frame with `addPass()`, `read()` and
+// `write()`, then `compile()` culls the passes that don't contribute to an
+// output and backs the transient targets with pooled images, sharing one
+// image between targets whose lifetimes don't overlap. Passes then run in
+// declaration order through `beginPass()`/`endPass()` which go through
+// `sp::beginPass()` so their timings show up in `getPassTimes()`.
+//
+// Aliased images retain the contents of their previous user, so the first
+// pass writing a transient target must clear it. A pass that loads the
+// previous contents of a target must declare it with `read()` as well.
+
+static const uint32_t FrameInvalid = ~0u;
+
+struct FrameTargetDesc
+{
+	sf::Vec2i resolution;
+	sg_pixel_format format = SG_PIXELFORMAT_RGBA8;
+	uint32_t msaaSamples = 1;
+
+	bool operator==(const FrameTargetDesc &rhs) const { return resolution == rhs.resolution && format == rhs.format && msaaSamples == rhs.msaaSamples; }
+	bool operator!=(const FrameTargetDesc &rhs) const { return !(*this == rhs); }
+};
+
+struct FrameGraphStats
+{
+	uint32_t numPasses = 0;
+	uint32_t numCulledPasses = 0;
+	uint32_t numTransientTargets = 0; // < Transient targets used by active passes
+	uint32_t numImages = 0;           // < Pooled images backing them
+	uint64_t transientBytes = 0;      // < Memory without aliasing
+	uint64_t imageBytes = 0;          // < Memory actually used this frame
+};
+
+struct FrameGraphTarget
+{
+	sf::Symbol name;
+	FrameTargetDesc desc;
+	const RenderTarget *imported = nullptr;
+	bool output = false;
+	bool needed = false;
+	uint32_t firstPass = FrameInvalid;
+	uint32_t lastPass = FrameInvalid;
+	uint32_t imageIndex = FrameInvalid;
+};
+
+struct FrameGraphPass
+{
+	sf::Symbol name;
+	sg_pass_action action;
+	bool hasAction = false;
+	bool active = false;
+	sf::SmallArray<uint32_t, 4> reads;
+	sf::SmallArray<uint32_t, 4> writes;
+	uint32_t renderPassIndex = FrameInvalid;
+};
+
+struct FrameGraphImage
+{
+	FrameTargetDesc desc;
+	RenderTarget target;
+	uint32_t busyUntilPass = 0;
+	uint32_t unusedFrames = 0;
+	bool usedThisFrame = false;
+};
+
+struct FrameGraphRenderPass
+{
+	sf::Symbol name;
+	sf::SmallArray<uint32_t, 4> imageIds;
+	RenderPass pass;
+	uint32_t unusedFrames = 0;
+	bool usedThisFrame = false;
+};
+
+struct FrameGraph
+{
+	// Pooled images and passes are released after being unused this long
+	static const uint32_t MaxUnusedFrames = 8;
+
+	// Start declaring a new frame, pooled images are kept
+	void reset();
+
+	// Targets: transient ones are only valid during the frame they're
+	// declared in, imported ones are owned by the caller and never aliased.
+	uint32_t createTarget(const char *name, const FrameTargetDesc &desc);
+	uint32_t importTarget(const RenderTarget &target);
+	void markOutput(uint32_t target);
+
+	// Passes: `action` defaults to the one used by `sp::beginPass()`
+	uint32_t addPass(const char *name, const sg_pass_action *action=nullptr);
+	void read(uint32_t pass, uint32_t target);
+	void write(uint32_t pass, uint32_t target);
+
+	// Cull passes and assign images, call after declaring the whole frame
+	void compile();
+
+	// Returns false if the pass was culled, otherwise call `endPass()`
+	bool beginPass(uint32_t pass);
+	void endPass();
+
+	bool isPassActive(uint32_t pass) const;
+	const FrameTargetDesc &getDesc(uint32_t target) const;
+	sg_image getImage(uint32_t target) const;
+
+	// Free all pooled images and passes
+	void releaseAll();
+
+	const FrameGraphStats &getStats() const { return stats; }
+
+	sf::Array<FrameGraphTarget> targets;
+	sf::Array<FrameGraphPass> passes;
+	sf::Array<FrameGraphImage> images;
+	sf::Array<FrameGraphRenderPass> renderPasses;
+	FrameGraphStats stats;
+	bool compiled = false;
+	bool inPass = false;
+};
+
+}
@@ -28,9 +28,12 @@
 #include "Sprite.h"
 #include "Font.h"
 #include "ContentFile.h"
+#include "JobSystem.h"
 #include "Canvas.h"
 #include "Args.h"
 
+#include "sf/Thread.h"
+
 namespace sp {
 
 struct MainConfig
@@ -39,6 +42,7 @@ struct MainConfig
 	sapp_desc sappDesc = { };
 	saudio_desc saudioDesc = { };
 	bool useContentThread = true;
+	uint32_t maxJobWorkers = 4; // < Capped to one less than the number of cores
 };
 
 }
@@ -96,6 +100,7 @@ void impInit()
 
 
 	sp::ContentFile::globalInit(config.useContentThread);
+	sp::JobSystem::globalInit(sf::min(config.maxJobWorkers, sf::Thread::getNumCores() - 1));
 	sp::Asset::globalInit();
 	sp::Sprite::globalInit();
 	sp::Canvas::globalInit();
@@ -111,6 +116,7 @@ void impCleanup()
 	sp::Canvas::globalCleanup();
 	sp::Sprite::globalCleanup();
 	sp::Font::globalCleanup();
+	sp::JobSystem::globalCleanup();
 	sp::Asset::globalCleanup();
 	sp::ContentFile::globalCleanup();
 
@@ -0,0 +1,221 @@
+#include "JobSystem.h"
+
+#include "ContentFile.h"
+
+#include "sf/Array.h"
+#include "sf/Mutex.h"
+#include "sf/Semaphore.h"
+#include "sf/Thread.h"
+#include "sf/ext/mx/mx_platform.h"
+
+namespace sp {
+
+static const uint32_t MaxJobWorkers = 16;
+
+struct JobBatch
+{
+	JobFn fn;
+	void *user;
+	uint32_t count;
+	uint32_t next;      // < Atomic, next item index to claim
+	uint32_t numPicked; // < Number of workers that joined the batch
+	sf::Semaphore doneSemaphore; // < Signaled once by every worker that joined
+};
+
+struct AsyncJob
+{
+	AsyncJobFn fn;
+	void *user;
+};
+
+struct JobWorker
+{
+	sf::Thread *thread = nullptr;
+	uint32_t threadIndex = 0;
+};
+
+struct JobContext
+{
+	sf::Mutex mutex;
+	sf::Semaphore workSemaphore;
+
+	// Only one `parallelFor()` can be in flight as it's called from the main thread
+	JobBatch batch;
+	bool batchActive = false;
+
+	sf::Array<AsyncJob> asyncJobs;
+	uint32_t asyncOffset = 0;
+	uint32_t numAsyncRunning = 0;
+
+	JobWorker workers[MaxJobWorkers];
+	uint32_t numWorkers = 0;
+	bool quit = false;
+};
+
+JobContext g_jobContext;
+
+static void runBatch(JobBatch &batch, uint32_t threadIndex)
+{
+	for (;;) {
+		uint32_t index = mxa_inc32_nf(&batch.next);
+		if (index >= batch.count) break;
+		batch.fn(batch.user, index, threadIndex);
+	}
+}
+
+static void jobWorker(void *arg)
+{
+	JobContext &ctx = g_jobContext;
+	uint32_t threadIndex = ((JobWorker*)arg)->threadIndex;
+
+	for (;;) {
+		ctx.workSemaphore.wait();
+
+		// Drain all available work before waiting again
+		for (;;) {
+			bool runBatchWork = false;
+			AsyncJob async = { };
+
+			{
+				sf::MutexGuard mg(ctx.mutex);
+				if (ctx.batchActive && mxa_load32_nf(&ctx.batch.next) < ctx.batch.count) {
+					ctx.batch.numPicked++;
+					runBatchWork = true;
+				} else if (ctx.asyncOffset < ctx.asyncJobs.size) {
+					async = ctx.asyncJobs[ctx.asyncOffset++];
+					if (ctx.asyncOffset == ctx.asyncJobs.size) {
+						ctx.asyncJobs.clear();
+						ctx.asyncOffset = 0;
+					}
+					ctx.numAsyncRunning++;
+				} else if (ctx.quit) {
+					return;
+				}
+			}
+
+			if (runBatchWork) {
+				runBatch(ctx.batch, threadIndex);
+				ctx.batch.doneSemaphore.signal();
+			} else if (async.fn) {
+				async.fn(async.user);
+				sf::MutexGuard mg(ctx.mutex);
+				ctx.numAsyncRunning--;
+			} else {
+				break;
+			}
+		}
+	}
+}
+
+uint32_t JobSystem::getNumThreads()
+{
+	return g_jobContext.numWorkers + 1;
+}
+
+void JobSystem::parallelFor(uint32_t count, JobFn fn, void *user)
+{
+	JobContext &ctx = g_jobContext;
+
+	if (ctx.numWorkers == 0 || count <= 1) {
+		for (uint32_t i = 0; i < count; i++) {
+			fn(user, i, 0);
+		}
+		return;
+	}
+
+	JobBatch &batch = ctx.batch;
+
+	{
+		sf::MutexGuard mg(ctx.mutex);
+		sf_assertf(!ctx.batchActive, "Nested JobSystem::parallelFor()");
+		batch.fn = fn;
+		batch.user = user;
+		batch.count = count;
+		batch.next = 0;
+		batch.numPicked = 0;
+		ctx.batchActive = true;
+	}
+
+	ctx.workSemaphore.signal(sf::min(count - 1, ctx.numWorkers));
+	runBatch(batch, 0);
+
+	uint32_t numPicked;
+	{
+		sf::MutexGuard mg(ctx.mutex);
+		ctx.batchActive = false;
+		numPicked = batch.numPicked;
+	}
+
+	if (numPicked > 0) {
+		batch.doneSemaphore.wait(numPicked);
+	}
+}
+
+void JobSystem::runAsync(AsyncJobFn fn, void *user)
+{
+	JobContext &ctx = g_jobContext;
+
+	if (ctx.numWorkers == 0) {
+		fn(user);
+		return;
+	}
+
+	{
+		sf::MutexGuard mg(ctx.mutex);
+		ctx.asyncJobs.push({ fn, user });
+	}
+
+	ctx.workSemaphore.signal();
+}
+
+void JobSystem::globalInit(uint32_t numWorkers)
+{
+	JobContext &ctx = g_jobContext;
+
+	numWorkers = sf::min(numWorkers, MaxJobWorkers);
+	for (uint32_t i = 0; i < numWorkers; i++) {
+		JobWorker &worker = ctx.workers[ctx.numWorkers];
+		worker.threadIndex = ctx.numWorkers + 1;
+
+		sf::SmallStringBuf<32> name;
+		name.format("Job Worker %u", worker.threadIndex);
+
+		sf::ThreadDesc desc;
+		desc.entry = &jobWorker;
+		desc.user = &worker;
+		desc.name = name;
+		worker.thread = sf::Thread::start(desc);
+		if (!worker.thread) break;
+
+		ctx.numWorkers++;
+	}
+}
+
+void JobSystem::globalCleanup()
+{
+	JobContext &ctx = g_jobContext;
+
+	// Async jobs may be waiting for the main thread
+	for (;;) {
+		{
+			sf::MutexGuard mg(ctx.mutex);
+			if (ctx.asyncOffset == ctx.asyncJobs.size && ctx.numAsyncRunning == 0) {
+				ctx.quit = true;
+				break;
+			}
+		}
+
+		ContentFile::runMainThreadCallbacks();
+		sf::Thread::sleepMs(1);
+	}
+
+	ctx.workSemaphore.signal(ctx.numWorkers);
+	for (uint32_t i = 0; i < ctx.numWorkers; i++) {
+		sf::Thread::join(ctx.workers[i].thread);
+	}
+
+	ctx.~JobContext();
+	new (&ctx) JobContext();
+}
+
+}
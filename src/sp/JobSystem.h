@@ -0,0 +1,42 @@
+#pragma once
+
+#include "sf/Base.h"
+
+namespace sp {
+
+// Small fixed worker pool for data-parallel loops and background tasks.
+// Without thread support (or with zero workers) everything runs inline on
+// the calling thread, so callers never need a separate serial code path.
+
+typedef void (*JobFn)(void *user, uint32_t index, uint32_t threadIndex);
+typedef void (*AsyncJobFn)(void *user);
+
+struct JobSystem
+{
+	// Number of threads that may run `parallelFor()` items, indices passed
+	// as `threadIndex` are in `[0, getNumThreads())`, zero is the caller.
+	static uint32_t getNumThreads();
+
+	// Call `fn(user, i, threadIndex)` for every `i` in `[0, count)` and wait
+	// for all of them to finish. Items run in unspecified order.
+	// Must be called from the main thread and not from inside a job.
+	static void parallelFor(uint32_t count, JobFn fn, void *user);
+
+	template <typename Fn>
+	sf_forceinline static void parallelForFunc(uint32_t count, Fn fn) {
+		parallelFor(count, [](void *user, uint32_t index, uint32_t threadIndex) {
+			(*(Fn*)user)(index, threadIndex);
+		}, &fn);
+	}
+
+	// Run `fn(user)` on some worker thread at a later point, runs inline
+	// if there are no workers. Async jobs may block on the main thread
+	// using `ContentFile::mainThreadCallback()`.
+	static void runAsync(AsyncJobFn fn, void *user);
+
+	// Lifecycle
+	static void globalInit(uint32_t numWorkers);
+	static void globalCleanup();
+};
+
+}
@@ -2,6 +2,7 @@
 
 #include "ContentFile.h"
 #include "sf/HashMap.h"
+#include "sf/Float4.h"
 
 #include "ext/sokol/sokol_gfx.h"
 
@@ -53,6 +54,67 @@ static sf::Mat34 toSF(const spmdl_matrix &m) {
 	return r;
 };
 
+static float bvhSplitArea(const spmdl_bvh_split &split)
+{
+	sf::Vec3 d = toSF(split.aabb_max) - toSF(split.aabb_min);
+	return d.x*d.y + d.y*d.z + d.z*d.x;
+}
+
+// Collapse the binary tree under `srcIx` into 4-wide nodes by repeatedly
+// opening the largest internal child, returns the index of the new node
+static uint32_t collapseBvhNode(sf::Array<BvhNode4> &dst, sf::Slice<const spmdl_bvh_node> src, uint32_t srcIx)
+{
+	sf_assert(srcIx < src.size);
+	const spmdl_bvh_split *children[4];
+	children[0] = &src[srcIx].splits[0];
+	children[1] = &src[srcIx].splits[1];
+	uint32_t numChildren = 2;
+
+	while (numChildren < 4) {
+		uint32_t bestI = ~0u;
+		float bestArea = -1.0f;
+		for (uint32_t i = 0; i < numChildren; i++) {
+			if (children[i]->num_triangles >= 0) continue;
+			float area = bvhSplitArea(*children[i]);
+			if (area > bestArea) {
+				bestArea = area;
+				bestI = i;
+			}
+		}
+		if (bestI == ~0u) break;
+
+		const spmdl_bvh_node &node = src[children[bestI]->data_index];
+		children[bestI] = &node.splits[0];
+		children[numChildren++] = &node.splits[1];
+	}
+
+	// `dst` may be reallocated by the recursion so fill the node by index
+	uint32_t dstIx = dst.size;
+	BvhNode4 &node = dst.push();
+	memset(&node, 0, sizeof(BvhNode4));
+	node.numChildren = numChildren;
+
+	for (uint32_t i = 0; i < numChildren; i++) {
+		const spmdl_bvh_split &split = *children[i];
+		BvhNode4 &n = dst[dstIx];
+		n.minX[i] = split.aabb_min.x;
+		n.minY[i] = split.aabb_min.y;
+		n.minZ[i] = split.aabb_min.z;
+		n.maxX[i] = split.aabb_max.x;
+		n.maxY[i] = split.aabb_max.y;
+		n.maxZ[i] = split.aabb_max.z;
+		n.numTriangles[i] = split.num_triangles;
+		if (split.num_triangles >= 0) {
+			n.dataIndex[i] = split.data_index;
+		} else {
+			uint32_t childIx = collapseBvhNode(dst, src, split.data_index);
+			dst[dstIx].dataIndex[i] = childIx;
+		}
+	}
+
+	return dstIx;
+}
+
 static void loadImp(void *user, const ContentFile &file)
 {
 	ModelImp *imp = (ModelImp*)user;
@@ -80,9 +142,11 @@ static void loadImp(void *user, const ContentFile &file)
 		index = spmdl_decode_index(&su);
 	}
 
+	sf::Array<spmdl_bvh_node> bvhNodes;
 	if (header.info.num_bvh_nodes > 0) {
-		imp->bvhNodes.resizeUninit(header.info.num_bvh_nodes);
-		spmdl_decode_bvh_nodes_to(&su, imp->bvhNodes.data);
+		bvhNodes.resizeUninit(header.info.num_bvh_nodes);
+		spmdl_decode_bvh_nodes_to(&su, bvhNodes.data);
+		imp->bvhNodes.reserve(header.info.num_bvh_nodes / 2 + 1);
 	}
 
 	if (header.info.num_bvh_tris > 0) {
@@ -130,7 +194,9 @@ static void loadImp(void *user, const ContentFile &file)
 		mesh.numIndices = sp_mesh.num_indices;
 		mesh.numVertices = sp_mesh.num_vertices;
 		mesh.indexBufferOffset = sp_mesh.index_buffer.offset;
-		mesh.bvhRootNodeIndex = sp_mesh.bvh_index;
+		if (sp_mesh.bvh_index != ~0u) {
+			mesh.bvhRootNodeIndex = collapseBvhNode(imp->bvhNodes, bvhNodes, sp_mesh.bvh_index);
+		}
 		mesh.bounds = sf::Bounds3::minMax(aabbMin, aabbMax);
 
 		mesh.attribs.reserve(sp_mesh.num_attribs);
@@ -183,6 +249,14 @@ static void loadImp(void *user, const ContentFile &file)
 		}
 	}
 
+	size_t cpuBytes = imp->cpuVertexData.size + imp->cpuIndexData.size;
+	cpuBytes += imp->bvhNodes.size * sizeof(BvhNode4) + imp->bvhTriangles.size * sizeof(uint32_t);
+	size_t gpuBytes = 0;
+	if (!props.cpuData) {
+		gpuBytes += header.s_vertex.uncompressed_size + header.s_index.uncompressed_size;
+	}
+	imp->assetSetMemoryUsage(cpuBytes, gpuBytes);
+
 	spfile_util_free(&su.file);
 	imp->assetFinishLoading();
 }
@@ -202,7 +276,8 @@ void ModelImp::assetUnload()
 
 struct BvhTraverseFrame
 {
-	spmdl_bvh_split *split;
+	uint32_t nodeIx;
+	uint32_t leafLane; // < Child of `nodeIx` to intersect or ~0u to traverse `nodeIx`
 	float t;
 };
 
@@ -229,13 +304,13 @@ sf_inline sf::Vec3 decodeBvhVertex(const sf::Vec3 &bias, const sf::Vec3 &scale,
 	return sf::Vec3(x, y, z);
 }
 
-static float intersectTriangles(const uint32_t *tris, const spmdl_bvh_split &split, const sf::Ray &ray, float tMin)
+static float intersectTriangles(const uint32_t *tris, const BvhNode4 &node, uint32_t lane, const sf::Ray &ray, float tMin)
 {
-	const uint32_t *tri = tris + split.data_index * 3;
-	const uint32_t *triEnd = tri + split.num_triangles * 3;
+	const uint32_t *tri = tris + node.dataIndex[lane] * 3;
+	const uint32_t *triEnd = tri + node.numTriangles[lane] * 3;
 
-	sf::Vec3 bias = (const sf::Vec3&)split.aabb_min;
-	sf::Vec3 scale = (const sf::Vec3&)split.aabb_max - (const sf::Vec3&)split.aabb_min;
+	sf::Vec3 bias = sf::Vec3(node.minX[lane], node.minY[lane], node.minZ[lane]);
+	sf::Vec3 scale = sf::Vec3(node.maxX[lane], node.maxY[lane], node.maxZ[lane]) - bias;
 
 	const float eps = 0.0000001f;
 	float tHit = HUGE_VALF;
@@ -262,7 +337,7 @@ static float intersectTriangles(const uint32_t *tris, const spmdl_bvh_split &spl
 			// potential quantization mismatch issues
 			if (sf::min(sf::min(u, v), w) >= -0.001f) {
 				float t = f * sf::dot(e2, q);
-				if (t >= tMin) {
+				if (t >= tMin && t < tHit) {
 					tHit = t;
 				}
 			}
@@ -278,62 +353,70 @@ float Model::castMeshRay(uint32_t rootNode, const sf::Ray &ray, float tMin) cons
 {
 	sf::SmallArray<BvhTraverseFrame, 64> stack;
 
-	sf::Vec3 origin = ray.origin;
 	sf::Vec3 rcpDir = sf::Vec3(1.0f) / ray.direction;
+	sf::Float4 originX = ray.origin.x, originY = ray.origin.y, originZ = ray.origin.z;
+	sf::Float4 rcpX = rcpDir.x, rcpY = rcpDir.y, rcpZ = rcpDir.z;
+	sf::Float4 tMin4 = tMin;
 
-	uint32_t *tris = bvhTriangles.data;
-	spmdl_bvh_node *nodes = bvhNodes.data;
+	const uint32_t *tris = bvhTriangles.data;
+	const BvhNode4 *nodes = bvhNodes.data;
 	sf_assert(rootNode < bvhNodes.size);
 
-	float tNext = HUGE_VALF;
 	float tHit = HUGE_VALF;
 
-	uint32_t nodeIx = rootNode;
-	for (;;) {
-		spmdl_bvh_node &node = nodes[nodeIx];
-
-		float t0 = intesersectRayAabb(origin, rcpDir, (sf::Vec3&)node.splits[0].aabb_min, (sf::Vec3&)node.splits[0].aabb_max, tMin);
-		float t1 = intesersectRayAabb(origin, rcpDir, (sf::Vec3&)node.splits[1].aabb_min, (sf::Vec3&)node.splits[1].aabb_max, tMin);
-
-		float tNear = sf::min(t0, t1);
-		float tFar = sf::max(t0, t1);
-		int ixNear = t0 != tNear ? 1 : 0;
-		int ixFar = ixNear ^ 1;
-
-		spmdl_bvh_split &splitNear = node.splits[ixNear];
-		spmdl_bvh_split &splitFar = node.splits[ixFar];
-
-		if (tNear < tHit) {
-			if (splitNear.num_triangles >= 0) {
-				tHit = sf::min(tHit, intersectTriangles(tris, splitNear, ray, tMin));
-				if (tFar < tHit) {
-					if (splitFar.num_triangles >= 0) {
-						tHit = sf::min(tHit, intersectTriangles(tris, splitFar, ray, tMin));
-					} else {
-						nodeIx = splitFar.data_index;
-						continue;
-					}
-				}
+	stack.push({ rootNode, ~0u, -HUGE_VALF });
+	while (stack.size > 0) {
+		BvhTraverseFrame frame = stack.popValue();
+		if (frame.t >= tHit) continue;
+
+		const BvhNode4 &node = nodes[frame.nodeIx];
+		if (frame.leafLane != ~0u) {
+			tHit = sf::min(tHit, intersectTriangles(tris, node, frame.leafLane, ray, tMin));
+			continue;
+		}
+
+		sf::Float4 loX = (sf::Float4::loadu(node.minX) - originX) * rcpX;
+		sf::Float4 loY = (sf::Float4::loadu(node.minY) - originY) * rcpY;
+		sf::Float4 loZ = (sf::Float4::loadu(node.minZ) - originZ) * rcpZ;
+		sf::Float4 hiX = (sf::Float4::loadu(node.maxX) - originX) * rcpX;
+		sf::Float4 hiY = (sf::Float4::loadu(node.maxY) - originY) * rcpY;
+		sf::Float4 hiZ = (sf::Float4::loadu(node.maxZ) - originZ) * rcpZ;
+		sf::Float4 t0 = loX.min(hiX).max(loY.min(hiY)).max(loZ.min(hiZ));
+		sf::Float4 t1 = loX.max(hiX).min(loY.max(hiY)).min(loZ.max(hiZ));
+
+		// Same rejection as `intesersectRayAabb()`: `t0 > t1 || t1 < tMin`
+		uint32_t missMask = (t0 - t1).maskGreaterThanZero() | (tMin4 - t1).maskGreaterThanZero();
+		uint32_t hitMask = ~missMask & ((1u << node.numChildren) - 1);
+		if (hitMask == 0) continue;
+
+		float childT[4];
+		t0.storeu(childT);
+
+		// Insert children sorted far to near so the nearest one is popped first
+		uint32_t base = stack.size;
+		for (uint32_t lane = 0; lane < 4; lane++) {
+			if ((hitMask & (1u << lane)) == 0) continue;
+			float t = childT[lane];
+			if (t >= tHit) continue;
+
+			BvhTraverseFrame child;
+			if (node.numTriangles[lane] >= 0) {
+				child = { frame.nodeIx, lane, t };
 			} else {
-				stack.push({ &splitFar, tFar });
-				nodeIx = splitNear.data_index;
-				continue;
+				child = { node.dataIndex[lane], ~0u, t };
 			}
-		}
 
-		for (;;) {
-			if (stack.size == 0) return tHit;
-			BvhTraverseFrame frame = stack.popValue();
-			if (frame.t < tHit) {
-				if (frame.split->num_triangles >= 0) {
-					tHit = sf::min(tHit, intersectTriangles(tris, *frame.split, ray, tMin));
-				} else {
-					nodeIx = frame.split->data_index;
-					break;
-				}
+			uint32_t ix = stack.size;
+			stack.push();
+			while (ix > base && stack[ix - 1].t < t) {
+				stack[ix] = stack[ix - 1];
+				ix--;
 			}
+			stack[ix] = child;
 		}
 	}
+
+	return tHit;
 }
 
 float Model::castMeshRay(uint32_t rootNode, const sf::Ray &ray, const sf::Mat34 &transform, float tMin) const
@@ -34,6 +34,22 @@ struct MeshCollisionTriangle
 	uint32_t v[3];
 };
 
+// 4-wide BVH node collapsed from the binary `spmdl_bvh_node` tree on load,
+// child bounds are transposed for `sf::Float4` slab tests
+struct BvhNode4
+{
+	float minX[4], minY[4], minZ[4];
+	float maxX[4], maxY[4], maxZ[4];
+
+	// Leaf if non-negative, the leaf bounds are the triangle quantization range
+	int32_t numTriangles[4];
+
+	// Child `BvhNode4` index or offset to `Model::bvhTriangles` for leaves
+	uint32_t dataIndex[4];
+
+	uint32_t numChildren;
+};
+
 struct Mesh
 {
 	sf::Symbol materialName;
@@ -47,7 +63,7 @@ struct Mesh
 	uint32_t numIndices = 0;
 	uint32_t numVertices = 0;
 	uint32_t indexBufferOffset = 0;
-	uint32_t bvhRootNodeIndex = ~0u;
+	uint32_t bvhRootNodeIndex = ~0u; // < Index to `Model::bvhNodes`
 	uint16_t *cpuIndexData16 = nullptr;
 	uint32_t *cpuIndexData32 = nullptr;
 };
@@ -93,7 +109,7 @@ struct Model : Asset
 	sf::Array<char> cpuVertexData;
 	sf::Array<char> cpuIndexData;
 
-	sf::Array<spmdl_bvh_node> bvhNodes;
+	sf::Array<BvhNode4> bvhNodes;
 	sf::Array<uint32_t> bvhTriangles;
 
 	sf::Bounds3 bounds;
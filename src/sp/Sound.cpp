@@ -10,6 +10,10 @@
 
 namespace sp {
 
+// Vorbis takes that decode to at most this many bytes of PCM are decoded once
+// on load and shared between all instances instead of opening a decoder per play
+static const size_t MaxCachedPcmBytes = 512 * 1024;
+
 struct SoundImp : Sound
 {
 	virtual void assetStartLoading() final;
@@ -17,6 +21,7 @@ struct SoundImp : Sound
 
 	sf::Box<void> data;
 	size_t size = 0;
+	size_t cachedPcmSize = 0;
 
 	sf::Array<sf::Box<AudioSource>> sharedSources;
 };
@@ -27,11 +32,12 @@ struct VorbisSource : AudioSource
 	stb_vorbis *vorbis = nullptr;
 	sf::Array<char> tempMemory;
 
-	VorbisSource(const sf::Box<void> &data, uint32_t offset, size_t size, uint32_t tempMemorySize, uint32_t sampleRate, uint32_t numChannels)
+	VorbisSource(const sf::Box<void> &data, uint32_t offset, size_t size, uint32_t tempMemorySize, uint32_t sampleRate, uint32_t numChannels, uint32_t numSamples)
 		: dataRef(data)
 	{
 		this->sampleRate = sampleRate;
 		this->numChannels = numChannels;
+		this->lengthInSamples = numSamples;
 
 		tempMemory.resizeUninit(tempMemorySize);
 
@@ -65,6 +71,7 @@ struct Pcm16Source : AudioSource
 	{
 		this->sampleRate = sampleRate;
 		this->numChannels = numChannels;
+		this->lengthInSamples = numSamples;
 		this->data = (char*)data.ptr + offset;
 	}
 
@@ -112,6 +119,35 @@ struct Pcm16Source : AudioSource
 	}
 };
 
+static sf::Box<void> decodeVorbisToPcm16(const sf::Box<void> &data, const spsound_take &take)
+{
+	sf::Array<char> tempMemory;
+	tempMemory.resizeUninit(take.temp_memory_required);
+
+	stb_vorbis_alloc alloc;
+	alloc.alloc_buffer = tempMemory.data;
+	alloc.alloc_buffer_length_in_bytes = (int)tempMemory.size;
+
+	int error = 0;
+	stb_vorbis *vorbis = stb_vorbis_open_memory((const unsigned char*)data.ptr + take.file_offset, (int)take.file_size, &error, &alloc);
+	if (!vorbis) return { };
+
+	// Padded as `Pcm16Source::advance()` converts 8 values at a time
+	size_t numUnits = (size_t)take.length_in_samples * take.num_channels;
+	size_t size = numUnits * sizeof(int16_t);
+	sf::Box<void> pcm;
+	pcm.ptr = sf::impBoxAllocate(size + 16, &sf::destructRangeImp<char>);
+
+	int16_t *dst = (int16_t*)pcm.ptr;
+	int numRead = stb_vorbis_get_samples_short_interleaved(vorbis, (int)take.num_channels, dst, (int)numUnits);
+	stb_vorbis_close(vorbis);
+
+	size_t numReadUnits = (size_t)sf::max(numRead, 0) * take.num_channels;
+	memset(dst + numReadUnits, 0, size - numReadUnits * sizeof(int16_t) + 16);
+
+	return pcm;
+}
+
 AssetType Sound::SelfType = { "Sound", sizeof(SoundImp), sizeof(Sound::PropType),
 	[](Asset *a) { new ((SoundImp*)a) SoundImp(); }
 };
@@ -147,14 +183,23 @@ static void loadImp(void *user, const ContentFile &file)
 
 	for (spsound_take &take : imp->takes) {
 		imp->info = header.info;
+		size_t pcmSize = (size_t)take.length_in_samples * take.num_channels * sizeof(int16_t);
+		sf::Box<void> pcm;
+		if (take.format == SPSOUND_FORMAT_VORBIS && pcmSize <= MaxCachedPcmBytes) {
+			pcm = decodeVorbisToPcm16(imp->data, take);
+		}
+
 		if (take.format == SPSOUND_FORMAT_PCM16) {
 			imp->sharedSources.push(sf::box<Pcm16Source>(imp->data, take.file_offset, take.sample_rate, take.num_channels, take.length_in_samples));
+		} else if (pcm) {
+			imp->sharedSources.push(sf::box<Pcm16Source>(pcm, 0, take.sample_rate, take.num_channels, take.length_in_samples));
+			imp->cachedPcmSize += pcmSize;
 		} else {
 			imp->sharedSources.push();
 		}
 	}
 
-
+	imp->assetSetMemoryUsage(imp->size + imp->cachedPcmSize, 0);
 	imp->assetFinishLoading();
 }
 
@@ -170,6 +215,7 @@ void SoundImp::assetUnload()
 {
 	data.reset();
 	sharedSources.clear();
+	cachedPcmSize = 0;
 }
 
 sf::Box<AudioSource> Sound::getSource(uint32_t takeIndex) const
@@ -182,7 +228,7 @@ sf::Box<AudioSource> Sound::getSource(uint32_t takeIndex) const
 	const spsound_take &take = takes[takeIndex];
 	if (take.format == SPSOUND_FORMAT_VORBIS) {
 		return sf::box<VorbisSource>(imp->data, take.file_offset, take.file_size, take.temp_memory_required,
-			take.sample_rate, take.num_channels);
+			take.sample_rate, take.num_channels, take.length_in_samples);
 	} else {
 		sf_failf("Unhandled non-shared source: %u", take.format);
 		return { };